@@ -0,0 +1,102 @@
+//
+//  alias_planner.cpp
+//  Metal-Guide
+//
+
+#include "alias_planner.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+
+namespace {
+
+std::uint64_t alignUp(std::uint64_t value, std::uint64_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+bool lifetimesOverlap(const TransientResource& a, const TransientResource& b) {
+    return a.firstPass <= b.lastPass && b.firstPass <= a.lastPass;
+}
+
+struct MemoryRange {
+    std::uint64_t begin;
+    std::uint64_t end;
+};
+
+}
+
+std::uint32_t AliasPlanner::add(const TransientResource& resource) {
+    assert(resource.firstPass <= resource.lastPass);
+    assert(resource.alignment != 0 && (resource.alignment & (resource.alignment - 1)) == 0);
+    resources.push_back(resource);
+    return static_cast<std::uint32_t>(resources.size() - 1);
+}
+
+AliasPlan AliasPlanner::plan() const {
+    AliasPlan result;
+    result.offsets.resize(resources.size());
+
+    std::vector<std::uint32_t> order(resources.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](std::uint32_t a, std::uint32_t b) {
+        if (resources[a].size != resources[b].size) {
+            return resources[a].size > resources[b].size;
+        }
+        return resources[a].firstPass < resources[b].firstPass;
+    });
+
+    std::vector<std::uint32_t> placed;
+    std::vector<MemoryRange> taken;
+    for (std::uint32_t index : order) {
+        const TransientResource& resource = resources[index];
+        result.unaliasedSize += resource.size;
+
+        taken.clear();
+        for (std::uint32_t other : placed) {
+            if (lifetimesOverlap(resource, resources[other])) {
+                taken.push_back(MemoryRange { result.offsets[other], result.offsets[other] + resources[other].size });
+            }
+        }
+        std::sort(taken.begin(), taken.end(), [](const MemoryRange& a, const MemoryRange& b) { return a.begin < b.begin; });
+
+        // First fit between the ranges held by resources that are alive at the same time.
+        std::uint64_t offset = 0;
+        for (const MemoryRange& range : taken) {
+            if (alignUp(offset, resource.alignment) + resource.size <= range.begin) {
+                break;
+            }
+            offset = std::max(offset, range.end);
+        }
+        offset = alignUp(offset, resource.alignment);
+
+        result.offsets[index] = offset;
+        result.heapSize = std::max(result.heapSize, offset + resource.size);
+        placed.push_back(index);
+    }
+
+    for (std::uint32_t a = 0; a < resources.size(); a++) {
+        for (std::uint32_t b = 0; b < resources.size(); b++) {
+            const TransientResource& before = resources[a];
+            const TransientResource& after = resources[b];
+            if (before.lastPass >= after.firstPass) {
+                continue;
+            }
+            bool shareMemory = result.offsets[a] < result.offsets[b] + after.size && result.offsets[b] < result.offsets[a] + before.size;
+            if (shareMemory) {
+                // The next frame reuses the memory in the opposite direction.
+                result.barriers.push_back(AliasingBarrier { before.lastPass, after.firstPass });
+                result.barriers.push_back(AliasingBarrier { after.lastPass, before.firstPass });
+            }
+        }
+    }
+
+    std::sort(result.barriers.begin(), result.barriers.end(), [](const AliasingBarrier& a, const AliasingBarrier& b) {
+        return a.acquirePass != b.acquirePass ? a.acquirePass < b.acquirePass : a.releasePass < b.releasePass;
+    });
+    result.barriers.erase(std::unique(result.barriers.begin(), result.barriers.end(), [](const AliasingBarrier& a, const AliasingBarrier& b) {
+        return a.releasePass == b.releasePass && a.acquirePass == b.acquirePass;
+    }), result.barriers.end());
+
+    return result;
+}
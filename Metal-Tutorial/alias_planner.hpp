@@ -0,0 +1,52 @@
+//
+//  alias_planner.hpp
+//  Metal-Guide
+//
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+struct TransientResource {
+    std::uint64_t size;
+    std::uint64_t alignment;
+    std::uint32_t firstPass;
+    std::uint32_t lastPass;
+};
+
+// Memory handed over from resources whose last use is in releasePass to resources first used in acquirePass. When
+// releasePass comes after acquirePass, the hand-over is from one frame to the next.
+struct AliasingBarrier {
+    std::uint32_t releasePass;
+    std::uint32_t acquirePass;
+};
+
+struct AliasPlan {
+    std::vector<std::uint64_t> offsets;
+    std::uint64_t heapSize = 0;
+    std::uint64_t unaliasedSize = 0;
+    std::vector<AliasingBarrier> barriers;
+};
+
+// Packs a frame's transient resources into one memory range, letting resources whose pass lifetimes don't overlap
+// share bytes. Lifetimes are closed pass intervals, so the conflict graph is an interval graph; resources are placed
+// largest first at the lowest aligned offset that doesn't collide with any conflicting resource already placed.
+//
+// Every pair of resources that ends up sharing memory yields a barrier from the earlier one's last pass to the later
+// one's first pass, and one back from the later to the earlier resource for the following frame, which reuses the same
+// memory. Barriers are deduplicated per pass pair.
+class AliasPlanner {
+public:
+    // Returns the resource's index in the plan.
+    std::uint32_t add(const TransientResource& resource);
+    void clear() { resources.clear(); }
+
+    AliasPlan plan() const;
+
+    std::uint32_t resourceCount() const { return static_cast<std::uint32_t>(resources.size()); }
+    const TransientResource& resource(std::uint32_t index) const { return resources[index]; }
+
+private:
+    std::vector<TransientResource> resources;
+};
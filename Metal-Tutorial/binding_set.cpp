@@ -0,0 +1,70 @@
+//
+//  binding_set.cpp
+//  Metal-Guide
+//
+
+#include "binding_set.hpp"
+
+#include <cassert>
+
+void BindingSet::setBuffer(const MTL::Buffer* buffer, NS::UInteger offset, NS::UInteger index) {
+    assert(index < maxBuffers);
+    buffers[index] = buffer;
+    offsets[index] = offset;
+    if (buffer == flushedBuffers[index] && offset == flushedOffsets[index]) {
+        dirtyBuffers.clear(index);
+    } else {
+        dirtyBuffers.set(index);
+    }
+}
+
+void BindingSet::setBufferOffset(NS::UInteger offset, NS::UInteger index) {
+    assert(index < maxBuffers);
+    setBuffer(buffers[index], offset, index);
+}
+
+void BindingSet::setTexture(const MTL::Texture* texture, NS::UInteger index) {
+    assert(index < maxTextures);
+    textures[index] = texture;
+    if (texture == flushedTextures[index]) {
+        dirtyTextures.clear(index);
+    } else {
+        dirtyTextures.set(index);
+    }
+}
+
+void BindingSet::setSamplerState(const MTL::SamplerState* sampler, NS::UInteger index) {
+    assert(index < maxSamplers);
+    samplers[index] = sampler;
+    if (sampler == flushedSamplers[index]) {
+        dirtySamplers.clear(index);
+    } else {
+        dirtySamplers.set(index);
+    }
+}
+
+void BindingSet::invalidate() {
+    flushedBuffers.fill(nullptr);
+    flushedOffsets.fill(0);
+    flushedTextures.fill(nullptr);
+    flushedSamplers.fill(nullptr);
+
+    dirtyBuffers.clearAll();
+    dirtyTextures.clearAll();
+    dirtySamplers.clearAll();
+    for (NS::UInteger i = 0; i < maxBuffers; i++) {
+        if (buffers[i] || offsets[i]) {
+            dirtyBuffers.set(i);
+        }
+    }
+    for (NS::UInteger i = 0; i < maxTextures; i++) {
+        if (textures[i]) {
+            dirtyTextures.set(i);
+        }
+    }
+    for (NS::UInteger i = 0; i < maxSamplers; i++) {
+        if (samplers[i]) {
+            dirtySamplers.set(i);
+        }
+    }
+}
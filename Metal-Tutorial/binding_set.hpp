@@ -0,0 +1,170 @@
+//
+//  binding_set.hpp
+//  Metal-Guide
+//
+
+#pragma once
+
+#include <Foundation/NSRange.hpp>
+#include <Foundation/NSTypes.hpp>
+
+#include "binding_stage.hpp"
+
+#include <array>
+#include <cstdint>
+
+// Flushing onto a real encoder is in binding_set_encoders.cpp; everything else is Metal-free and builds on Linux.
+namespace MTL {
+class Buffer;
+class ComputeCommandEncoder;
+class RenderCommandEncoder;
+class SamplerState;
+class Texture;
+}
+
+// Fixed-size dirty mask over binding slots, with fast access to the lowest and highest dirty slot.
+template <NS::UInteger SlotCount>
+class BindingMask {
+public:
+    void set(NS::UInteger index) { words[index / 64] |= bit(index); }
+    void clear(NS::UInteger index) { words[index / 64] &= ~bit(index); }
+    void clearAll() { words.fill(0); }
+
+    bool any() const {
+        for (std::uint64_t word : words) {
+            if (word) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Smallest range covering every dirty slot. Only valid when any() is true.
+    NS::Range range() const {
+        NS::UInteger first = 0;
+        NS::UInteger last = 0;
+        for (NS::UInteger i = 0; i < wordCount; i++) {
+            if (words[i]) {
+                first = i * 64 + __builtin_ctzll(words[i]);
+                break;
+            }
+        }
+        for (NS::UInteger i = wordCount; i-- > 0;) {
+            if (words[i]) {
+                last = i * 64 + 63 - __builtin_clzll(words[i]);
+                break;
+            }
+        }
+        return NS::Range::Make(first, last - first + 1);
+    }
+
+private:
+    static constexpr NS::UInteger wordCount = (SlotCount + 63) / 64;
+
+    static std::uint64_t bit(NS::UInteger index) { return std::uint64_t(1) << (index % 64); }
+
+    std::array<std::uint64_t, wordCount> words = {};
+};
+
+// Records buffer, texture and sampler bindings for one shader stage and, on flush, diffs them against what was
+// last sent to the encoder. Every resource kind is flushed with at most one call: a single dirty slot uses the
+// singular setter, anything wider uses the plural set*s:withRange: form over the smallest range covering all
+// dirty slots. Clean slots inside that range are resent with their current value, which is a no-op for Metal
+// but saves a message per gap.
+class BindingSet {
+public:
+    static constexpr NS::UInteger maxBuffers = 31;
+    static constexpr NS::UInteger maxTextures = 128;
+    static constexpr NS::UInteger maxSamplers = 16;
+
+    void setBuffer(const MTL::Buffer* buffer, NS::UInteger offset, NS::UInteger index);
+    void setBufferOffset(NS::UInteger offset, NS::UInteger index);
+    void setTexture(const MTL::Texture* texture, NS::UInteger index);
+    void setSamplerState(const MTL::SamplerState* sampler, NS::UInteger index);
+
+    // stage must be BindingStage::Vertex or BindingStage::Fragment.
+    void flush(MTL::RenderCommandEncoder* encoder, BindingStage stage);
+    void flush(MTL::ComputeCommandEncoder* encoder);
+
+    // Flushes through emitter, which has the singular and plural setters of one stage without the stage in their names:
+    // setBuffer, setBufferOffset, setBuffers, setTexture, setTextures, setSamplerState and setSamplerStates. The
+    // overloads above pass emitters for the Metal encoders; tests pass one that counts calls.
+    template <typename Emitter>
+    void flush(const Emitter& emitter);
+
+    // A new encoder starts with nothing bound, so everything recorded becomes dirty again.
+    void invalidate();
+
+    bool isDirty() const { return dirtyBuffers.any() || dirtyTextures.any() || dirtySamplers.any(); }
+
+    // Number of encoder calls issued by all flushes so far.
+    NS::UInteger encoderCallCount() const { return callCount; }
+
+private:
+    std::array<const MTL::Buffer*, maxBuffers> buffers = {};
+    std::array<NS::UInteger, maxBuffers> offsets = {};
+    std::array<const MTL::Texture*, maxTextures> textures = {};
+    std::array<const MTL::SamplerState*, maxSamplers> samplers = {};
+
+    std::array<const MTL::Buffer*, maxBuffers> flushedBuffers = {};
+    std::array<NS::UInteger, maxBuffers> flushedOffsets = {};
+    std::array<const MTL::Texture*, maxTextures> flushedTextures = {};
+    std::array<const MTL::SamplerState*, maxSamplers> flushedSamplers = {};
+
+    BindingMask<maxBuffers> dirtyBuffers;
+    BindingMask<maxTextures> dirtyTextures;
+    BindingMask<maxSamplers> dirtySamplers;
+
+    NS::UInteger callCount = 0;
+};
+
+template <typename Emitter>
+void BindingSet::flush(const Emitter& emitter) {
+    if (dirtyBuffers.any()) {
+        NS::Range range = dirtyBuffers.range();
+        NS::UInteger index = range.location;
+        if (range.length > 1) {
+            emitter.setBuffers(buffers.data() + index, offsets.data() + index, range);
+        } else if (buffers[index] == flushedBuffers[index]) {
+            emitter.setBufferOffset(offsets[index], index);
+        } else {
+            emitter.setBuffer(buffers[index], offsets[index], index);
+        }
+        for (NS::UInteger i = index; i < range.Max(); i++) {
+            flushedBuffers[i] = buffers[i];
+            flushedOffsets[i] = offsets[i];
+        }
+        dirtyBuffers.clearAll();
+        callCount++;
+    }
+
+    if (dirtyTextures.any()) {
+        NS::Range range = dirtyTextures.range();
+        NS::UInteger index = range.location;
+        if (range.length > 1) {
+            emitter.setTextures(textures.data() + index, range);
+        } else {
+            emitter.setTexture(textures[index], index);
+        }
+        for (NS::UInteger i = index; i < range.Max(); i++) {
+            flushedTextures[i] = textures[i];
+        }
+        dirtyTextures.clearAll();
+        callCount++;
+    }
+
+    if (dirtySamplers.any()) {
+        NS::Range range = dirtySamplers.range();
+        NS::UInteger index = range.location;
+        if (range.length > 1) {
+            emitter.setSamplerStates(samplers.data() + index, range);
+        } else {
+            emitter.setSamplerState(samplers[index], index);
+        }
+        for (NS::UInteger i = index; i < range.Max(); i++) {
+            flushedSamplers[i] = samplers[i];
+        }
+        dirtySamplers.clearAll();
+        callCount++;
+    }
+}
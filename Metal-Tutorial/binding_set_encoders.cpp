@@ -0,0 +1,63 @@
+//
+//  binding_set_encoders.cpp
+//  Metal-Guide
+//
+
+#include <Metal/Metal.hpp>
+
+#include "binding_set.hpp"
+
+#include <cassert>
+
+namespace {
+
+struct VertexEmitter {
+    MTL::RenderCommandEncoder* encoder;
+
+    void setBuffer(const MTL::Buffer* buffer, NS::UInteger offset, NS::UInteger index) const { encoder->setVertexBuffer(buffer, offset, index); }
+    void setBufferOffset(NS::UInteger offset, NS::UInteger index) const { encoder->setVertexBufferOffset(offset, index); }
+    void setBuffers(const MTL::Buffer* const buffers[], const NS::UInteger offsets[], NS::Range range) const { encoder->setVertexBuffers(buffers, offsets, range); }
+    void setTexture(const MTL::Texture* texture, NS::UInteger index) const { encoder->setVertexTexture(texture, index); }
+    void setTextures(const MTL::Texture* const textures[], NS::Range range) const { encoder->setVertexTextures(textures, range); }
+    void setSamplerState(const MTL::SamplerState* sampler, NS::UInteger index) const { encoder->setVertexSamplerState(sampler, index); }
+    void setSamplerStates(const MTL::SamplerState* const samplers[], NS::Range range) const { encoder->setVertexSamplerStates(samplers, range); }
+};
+
+struct FragmentEmitter {
+    MTL::RenderCommandEncoder* encoder;
+
+    void setBuffer(const MTL::Buffer* buffer, NS::UInteger offset, NS::UInteger index) const { encoder->setFragmentBuffer(buffer, offset, index); }
+    void setBufferOffset(NS::UInteger offset, NS::UInteger index) const { encoder->setFragmentBufferOffset(offset, index); }
+    void setBuffers(const MTL::Buffer* const buffers[], const NS::UInteger offsets[], NS::Range range) const { encoder->setFragmentBuffers(buffers, offsets, range); }
+    void setTexture(const MTL::Texture* texture, NS::UInteger index) const { encoder->setFragmentTexture(texture, index); }
+    void setTextures(const MTL::Texture* const textures[], NS::Range range) const { encoder->setFragmentTextures(textures, range); }
+    void setSamplerState(const MTL::SamplerState* sampler, NS::UInteger index) const { encoder->setFragmentSamplerState(sampler, index); }
+    void setSamplerStates(const MTL::SamplerState* const samplers[], NS::Range range) const { encoder->setFragmentSamplerStates(samplers, range); }
+};
+
+struct ComputeEmitter {
+    MTL::ComputeCommandEncoder* encoder;
+
+    void setBuffer(const MTL::Buffer* buffer, NS::UInteger offset, NS::UInteger index) const { encoder->setBuffer(buffer, offset, index); }
+    void setBufferOffset(NS::UInteger offset, NS::UInteger index) const { encoder->setBufferOffset(offset, index); }
+    void setBuffers(const MTL::Buffer* const buffers[], const NS::UInteger offsets[], NS::Range range) const { encoder->setBuffers(buffers, offsets, range); }
+    void setTexture(const MTL::Texture* texture, NS::UInteger index) const { encoder->setTexture(texture, index); }
+    void setTextures(const MTL::Texture* const textures[], NS::Range range) const { encoder->setTextures(textures, range); }
+    void setSamplerState(const MTL::SamplerState* sampler, NS::UInteger index) const { encoder->setSamplerState(sampler, index); }
+    void setSamplerStates(const MTL::SamplerState* const samplers[], NS::Range range) const { encoder->setSamplerStates(samplers, range); }
+};
+
+}
+
+void BindingSet::flush(MTL::RenderCommandEncoder* encoder, BindingStage stage) {
+    assert(stage != BindingStage::Compute);
+    if (stage == BindingStage::Vertex) {
+        flush(VertexEmitter { encoder });
+    } else {
+        flush(FragmentEmitter { encoder });
+    }
+}
+
+void BindingSet::flush(MTL::ComputeCommandEncoder* encoder) {
+    flush(ComputeEmitter { encoder });
+}
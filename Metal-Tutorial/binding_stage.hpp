@@ -0,0 +1,12 @@
+//
+//  binding_stage.hpp
+//  Metal-Guide
+//
+
+#pragma once
+
+enum class BindingStage {
+    Vertex,
+    Fragment,
+    Compute
+};
@@ -0,0 +1,324 @@
+//
+//  command_decoder.hpp
+//  Metal-Guide
+//
+
+#pragma once
+
+#include "command_list.hpp"
+
+#include <cassert>
+
+template <typename Payload>
+const Payload& payloadAs(const void* payload) {
+    return *static_cast<const Payload*>(payload);
+}
+
+// Debug markers, which every encoder has. Returns false for any other op.
+template <typename Encoder>
+bool replayDebugCommand(Encoder* encoder, CommandOp op, const void* payload) {
+    switch (op) {
+    case CommandOp::PushDebugGroup:
+        encoder->pushDebugGroup(payloadAs<CommandList::DebugString>(payload).string);
+        return true;
+    case CommandOp::PopDebugGroup:
+        encoder->popDebugGroup();
+        return true;
+    case CommandOp::InsertDebugSignpost:
+        encoder->insertDebugSignpost(payloadAs<CommandList::DebugString>(payload).string);
+        return true;
+    default:
+        return false;
+    }
+}
+
+// The replay loops behind replayCommands(), templated on the encoder so they also run against a stand-in with the same
+// method names, off-device. Each takes a list recorded with the matching recorder.
+template <typename Encoder>
+void replayRenderCommands(const CommandList& list, Encoder* encoder) {
+    list.forEach([encoder](const CommandList::CommandHeader& header, const void* payload) {
+        switch (header.op) {
+        case CommandOp::UpdateFence: {
+            const auto& command = payloadAs<CommandList::Fence>(payload);
+            encoder->updateFence(command.fence, command.stages);
+            break;
+        }
+        case CommandOp::WaitForFence: {
+            const auto& command = payloadAs<CommandList::Fence>(payload);
+            encoder->waitForFence(command.fence, command.stages);
+            break;
+        }
+        case CommandOp::UseResource: {
+            const auto& command = payloadAs<CommandList::UseResource>(payload);
+            encoder->useResource(command.resource, command.usage, command.stages);
+            break;
+        }
+        case CommandOp::UseHeap: {
+            const auto& command = payloadAs<CommandList::UseHeap>(payload);
+            encoder->useHeap(command.heap, command.stages);
+            break;
+        }
+        case CommandOp::MemoryBarrier: {
+            const auto& command = payloadAs<CommandList::MemoryBarrier>(payload);
+            encoder->memoryBarrier(command.scope, command.after, command.before);
+            break;
+        }
+        case CommandOp::SetBuffer: {
+            const auto& command = payloadAs<CommandList::SetBuffer>(payload);
+            if (command.stage == BindingStage::Vertex) {
+                encoder->setVertexBuffer(command.buffer, command.offset, command.index);
+            } else {
+                encoder->setFragmentBuffer(command.buffer, command.offset, command.index);
+            }
+            break;
+        }
+        case CommandOp::SetBufferOffset: {
+            const auto& command = payloadAs<CommandList::SetBufferOffset>(payload);
+            if (command.stage == BindingStage::Vertex) {
+                encoder->setVertexBufferOffset(command.offset, command.index);
+            } else {
+                encoder->setFragmentBufferOffset(command.offset, command.index);
+            }
+            break;
+        }
+        case CommandOp::SetBytes: {
+            const auto& command = payloadAs<CommandList::SetBytes>(payload);
+            if (command.stage == BindingStage::Vertex) {
+                encoder->setVertexBytes(&command + 1, command.length, command.index);
+            } else {
+                encoder->setFragmentBytes(&command + 1, command.length, command.index);
+            }
+            break;
+        }
+        case CommandOp::SetTexture: {
+            const auto& command = payloadAs<CommandList::SetTexture>(payload);
+            if (command.stage == BindingStage::Vertex) {
+                encoder->setVertexTexture(command.texture, command.index);
+            } else {
+                encoder->setFragmentTexture(command.texture, command.index);
+            }
+            break;
+        }
+        case CommandOp::SetSamplerState: {
+            const auto& command = payloadAs<CommandList::SetSamplerState>(payload);
+            if (command.stage == BindingStage::Vertex) {
+                encoder->setVertexSamplerState(command.sampler, command.index);
+            } else {
+                encoder->setFragmentSamplerState(command.sampler, command.index);
+            }
+            break;
+        }
+        case CommandOp::SetRenderPipelineState:
+            encoder->setRenderPipelineState(payloadAs<CommandList::SetRenderPipelineState>(payload).pipelineState);
+            break;
+        case CommandOp::SetDepthStencilState:
+            encoder->setDepthStencilState(payloadAs<CommandList::SetDepthStencilState>(payload).depthStencilState);
+            break;
+        case CommandOp::SetCullMode:
+            encoder->setCullMode(payloadAs<CommandList::SetCullMode>(payload).cullMode);
+            break;
+        case CommandOp::SetFrontFacingWinding:
+            encoder->setFrontFacingWinding(payloadAs<CommandList::SetFrontFacingWinding>(payload).winding);
+            break;
+        case CommandOp::SetTriangleFillMode:
+            encoder->setTriangleFillMode(payloadAs<CommandList::SetTriangleFillMode>(payload).fillMode);
+            break;
+        case CommandOp::SetDepthClipMode:
+            encoder->setDepthClipMode(payloadAs<CommandList::SetDepthClipMode>(payload).depthClipMode);
+            break;
+        case CommandOp::SetViewport:
+            encoder->setViewport(payloadAs<CommandList::SetViewport>(payload).viewport);
+            break;
+        case CommandOp::SetScissorRect:
+            encoder->setScissorRect(payloadAs<CommandList::SetScissorRect>(payload).rect);
+            break;
+        case CommandOp::SetDepthBias: {
+            const auto& command = payloadAs<CommandList::SetDepthBias>(payload);
+            encoder->setDepthBias(command.depthBias, command.slopeScale, command.clamp);
+            break;
+        }
+        case CommandOp::SetStencilReferenceValues: {
+            const auto& command = payloadAs<CommandList::SetStencilReferenceValues>(payload);
+            encoder->setStencilReferenceValues(command.front, command.back);
+            break;
+        }
+        case CommandOp::SetBlendColor: {
+            const auto& command = payloadAs<CommandList::SetBlendColor>(payload);
+            encoder->setBlendColor(command.red, command.green, command.blue, command.alpha);
+            break;
+        }
+        case CommandOp::SetVisibilityResultMode: {
+            const auto& command = payloadAs<CommandList::SetVisibilityResultMode>(payload);
+            encoder->setVisibilityResultMode(command.mode, command.offset);
+            break;
+        }
+        case CommandOp::DrawPrimitives: {
+            const auto& command = payloadAs<CommandList::DrawPrimitives>(payload);
+            encoder->drawPrimitives(command.primitiveType, command.vertexStart, command.vertexCount, command.instanceCount,
+                                    command.baseInstance);
+            break;
+        }
+        case CommandOp::DrawIndexedPrimitives: {
+            const auto& command = payloadAs<CommandList::DrawIndexedPrimitives>(payload);
+            encoder->drawIndexedPrimitives(command.primitiveType, command.indexCount, command.indexType, command.indexBuffer,
+                                           command.indexBufferOffset, command.instanceCount, command.baseVertex, command.baseInstance);
+            break;
+        }
+        case CommandOp::DrawPrimitivesIndirect: {
+            const auto& command = payloadAs<CommandList::DrawPrimitivesIndirect>(payload);
+            encoder->drawPrimitives(command.primitiveType, command.indirectBuffer, command.indirectBufferOffset);
+            break;
+        }
+        case CommandOp::DrawIndexedPrimitivesIndirect: {
+            const auto& command = payloadAs<CommandList::DrawIndexedPrimitivesIndirect>(payload);
+            encoder->drawIndexedPrimitives(command.primitiveType, command.indexType, command.indexBuffer, command.indexBufferOffset,
+                                           command.indirectBuffer, command.indirectBufferOffset);
+            break;
+        }
+        default: {
+            bool replayed = replayDebugCommand(encoder, header.op, payload);
+            assert(replayed && "command not recorded for a render encoder");
+            (void)replayed;
+            break;
+        }
+        }
+    });
+}
+
+template <typename Encoder>
+void replayComputeCommands(const CommandList& list, Encoder* encoder) {
+    list.forEach([encoder](const CommandList::CommandHeader& header, const void* payload) {
+        switch (header.op) {
+        case CommandOp::UpdateFence:
+            encoder->updateFence(payloadAs<CommandList::Fence>(payload).fence);
+            break;
+        case CommandOp::WaitForFence:
+            encoder->waitForFence(payloadAs<CommandList::Fence>(payload).fence);
+            break;
+        case CommandOp::UseResource: {
+            const auto& command = payloadAs<CommandList::UseResource>(payload);
+            encoder->useResource(command.resource, command.usage);
+            break;
+        }
+        case CommandOp::UseHeap:
+            encoder->useHeap(payloadAs<CommandList::UseHeap>(payload).heap);
+            break;
+        case CommandOp::MemoryBarrier:
+            encoder->memoryBarrier(payloadAs<CommandList::MemoryBarrier>(payload).scope);
+            break;
+        case CommandOp::SetBuffer: {
+            const auto& command = payloadAs<CommandList::SetBuffer>(payload);
+            encoder->setBuffer(command.buffer, command.offset, command.index);
+            break;
+        }
+        case CommandOp::SetBufferOffset: {
+            const auto& command = payloadAs<CommandList::SetBufferOffset>(payload);
+            encoder->setBufferOffset(command.offset, command.index);
+            break;
+        }
+        case CommandOp::SetBytes: {
+            const auto& command = payloadAs<CommandList::SetBytes>(payload);
+            encoder->setBytes(&command + 1, command.length, command.index);
+            break;
+        }
+        case CommandOp::SetTexture: {
+            const auto& command = payloadAs<CommandList::SetTexture>(payload);
+            encoder->setTexture(command.texture, command.index);
+            break;
+        }
+        case CommandOp::SetSamplerState: {
+            const auto& command = payloadAs<CommandList::SetSamplerState>(payload);
+            encoder->setSamplerState(command.sampler, command.index);
+            break;
+        }
+        case CommandOp::SetThreadgroupMemoryLength: {
+            const auto& command = payloadAs<CommandList::SetThreadgroupMemoryLength>(payload);
+            encoder->setThreadgroupMemoryLength(command.length, command.index);
+            break;
+        }
+        case CommandOp::SetComputePipelineState:
+            encoder->setComputePipelineState(payloadAs<CommandList::SetComputePipelineState>(payload).pipelineState);
+            break;
+        case CommandOp::DispatchThreadgroups: {
+            const auto& command = payloadAs<CommandList::Dispatch>(payload);
+            encoder->dispatchThreadgroups(command.grid, command.threadsPerThreadgroup);
+            break;
+        }
+        case CommandOp::DispatchThreads: {
+            const auto& command = payloadAs<CommandList::Dispatch>(payload);
+            encoder->dispatchThreads(command.grid, command.threadsPerThreadgroup);
+            break;
+        }
+        case CommandOp::DispatchThreadgroupsIndirect: {
+            const auto& command = payloadAs<CommandList::DispatchThreadgroupsIndirect>(payload);
+            encoder->dispatchThreadgroups(command.indirectBuffer, command.indirectBufferOffset, command.threadsPerThreadgroup);
+            break;
+        }
+        default: {
+            bool replayed = replayDebugCommand(encoder, header.op, payload);
+            assert(replayed && "command not recorded for a compute encoder");
+            (void)replayed;
+            break;
+        }
+        }
+    });
+}
+
+template <typename Encoder>
+void replayBlitCommands(const CommandList& list, Encoder* encoder) {
+    list.forEach([encoder](const CommandList::CommandHeader& header, const void* payload) {
+        switch (header.op) {
+        case CommandOp::UpdateFence:
+            encoder->updateFence(payloadAs<CommandList::Fence>(payload).fence);
+            break;
+        case CommandOp::WaitForFence:
+            encoder->waitForFence(payloadAs<CommandList::Fence>(payload).fence);
+            break;
+        case CommandOp::CopyBufferToBuffer: {
+            const auto& command = payloadAs<CommandList::CopyBufferToBuffer>(payload);
+            encoder->copyFromBuffer(command.source, command.sourceOffset, command.destination, command.destinationOffset, command.size);
+            break;
+        }
+        case CommandOp::CopyTextureToTexture: {
+            const auto& command = payloadAs<CommandList::CopyTextureToTexture>(payload);
+            encoder->copyFromTexture(command.source, command.sourceSlice, command.sourceLevel, command.sourceOrigin, command.sourceSize,
+                                     command.destination, command.destinationSlice, command.destinationLevel, command.destinationOrigin);
+            break;
+        }
+        case CommandOp::CopyBufferToTexture: {
+            const auto& command = payloadAs<CommandList::CopyBufferToTexture>(payload);
+            encoder->copyFromBuffer(command.source, command.sourceOffset, command.sourceBytesPerRow, command.sourceBytesPerImage,
+                                    command.sourceSize, command.destination, command.destinationSlice, command.destinationLevel,
+                                    command.destinationOrigin);
+            break;
+        }
+        case CommandOp::CopyTextureToBuffer: {
+            const auto& command = payloadAs<CommandList::CopyTextureToBuffer>(payload);
+            encoder->copyFromTexture(command.source, command.sourceSlice, command.sourceLevel, command.sourceOrigin, command.sourceSize,
+                                     command.destination, command.destinationOffset, command.destinationBytesPerRow,
+                                     command.destinationBytesPerImage);
+            break;
+        }
+        case CommandOp::FillBuffer: {
+            const auto& command = payloadAs<CommandList::FillBuffer>(payload);
+            encoder->fillBuffer(command.buffer, NS::Range::Make(command.location, command.length), command.value);
+            break;
+        }
+        case CommandOp::GenerateMipmaps:
+            encoder->generateMipmaps(payloadAs<CommandList::TextureOp>(payload).texture);
+            break;
+        case CommandOp::SynchronizeResource:
+            encoder->synchronizeResource(payloadAs<CommandList::ResourceOp>(payload).resource);
+            break;
+        case CommandOp::OptimizeContentsForGPUAccess:
+            encoder->optimizeContentsForGPUAccess(payloadAs<CommandList::TextureOp>(payload).texture);
+            break;
+        default: {
+            bool replayed = replayDebugCommand(encoder, header.op, payload);
+            assert(replayed && "command not recorded for a blit encoder");
+            (void)replayed;
+            break;
+        }
+        }
+    });
+}
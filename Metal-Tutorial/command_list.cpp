@@ -0,0 +1,356 @@
+//
+//  command_list.cpp
+//  Metal-Guide
+//
+
+#include "command_list.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+CommandList::CommandList(std::size_t chunkSize)
+    : chunkSize(chunkSize) {
+}
+
+std::byte* CommandList::allocate(std::size_t size) {
+    if (chunkCount == 0 || chunks[chunkCount - 1].capacity - chunks[chunkCount - 1].used < size) {
+        // Reuse the chunk kept from before reset() if it is big enough, otherwise put a new one in its place.
+        if (chunkCount == chunks.size()) {
+            chunks.push_back(Chunk { nullptr, 0, 0 });
+        }
+        Chunk& chunk = chunks[chunkCount];
+        if (chunk.capacity < size) {
+            chunk.capacity = std::max(chunkSize, size);
+            chunk.data = std::make_unique<std::byte[]>(chunk.capacity);
+        }
+        chunk.used = 0;
+        chunkCount++;
+    }
+    Chunk& chunk = chunks[chunkCount - 1];
+    std::byte* record = chunk.data.get() + chunk.used;
+    chunk.used += size;
+    commands++;
+    return record;
+}
+
+void CommandList::reset() {
+    chunkCount = 0;
+    commands = 0;
+}
+
+std::size_t CommandList::byteSize() const {
+    std::size_t size = 0;
+    for (std::size_t i = 0; i < chunkCount; i++) {
+        size += chunks[i].used;
+    }
+    return size;
+}
+
+void CommandRecorder::pushDebugGroup(const NS::String* string) {
+    list.push(CommandOp::PushDebugGroup, CommandList::DebugString { string });
+}
+
+void CommandRecorder::popDebugGroup() {
+    list.push(CommandOp::PopDebugGroup, CommandList::DebugString { nullptr });
+}
+
+void CommandRecorder::insertDebugSignpost(const NS::String* string) {
+    list.push(CommandOp::InsertDebugSignpost, CommandList::DebugString { string });
+}
+
+void CommandRecorder::setBuffer(BindingStage stage, const MTL::Buffer* buffer, NS::UInteger offset, NS::UInteger index) {
+    list.push(CommandOp::SetBuffer, CommandList::SetBuffer { stage, buffer, offset, index });
+}
+
+void CommandRecorder::setBufferOffset(BindingStage stage, NS::UInteger offset, NS::UInteger index) {
+    list.push(CommandOp::SetBufferOffset, CommandList::SetBufferOffset { stage, offset, index });
+}
+
+void CommandRecorder::setBytes(BindingStage stage, const void* bytes, NS::UInteger length, NS::UInteger index) {
+    auto& command = list.push(CommandOp::SetBytes, CommandList::SetBytes { stage, length, index }, length);
+    std::memcpy(&command + 1, bytes, length);
+}
+
+void CommandRecorder::setTexture(BindingStage stage, const MTL::Texture* texture, NS::UInteger index) {
+    list.push(CommandOp::SetTexture, CommandList::SetTexture { stage, texture, index });
+}
+
+void CommandRecorder::setSamplerState(BindingStage stage, const MTL::SamplerState* sampler, NS::UInteger index) {
+    list.push(CommandOp::SetSamplerState, CommandList::SetSamplerState { stage, sampler, index });
+}
+
+void CommandRecorder::fence(CommandOp op, const MTL::Fence* fence, MTL::RenderStages stages) {
+    list.push(op, CommandList::Fence { fence, stages });
+}
+
+void CommandRecorder::useResource(const MTL::Resource* resource, MTL::ResourceUsage usage, MTL::RenderStages stages) {
+    list.push(CommandOp::UseResource, CommandList::UseResource { resource, usage, stages });
+}
+
+void CommandRecorder::useHeap(const MTL::Heap* heap, MTL::RenderStages stages) {
+    list.push(CommandOp::UseHeap, CommandList::UseHeap { heap, stages });
+}
+
+void CommandRecorder::memoryBarrier(MTL::BarrierScope scope, MTL::RenderStages after, MTL::RenderStages before) {
+    list.push(CommandOp::MemoryBarrier, CommandList::MemoryBarrier { scope, after, before });
+}
+
+void RenderCommandRecorder::setRenderPipelineState(const MTL::RenderPipelineState* pipelineState) {
+    list.push(CommandOp::SetRenderPipelineState, CommandList::SetRenderPipelineState { pipelineState });
+}
+
+void RenderCommandRecorder::setDepthStencilState(const MTL::DepthStencilState* depthStencilState) {
+    list.push(CommandOp::SetDepthStencilState, CommandList::SetDepthStencilState { depthStencilState });
+}
+
+void RenderCommandRecorder::setCullMode(MTL::CullMode cullMode) {
+    list.push(CommandOp::SetCullMode, CommandList::SetCullMode { cullMode });
+}
+
+void RenderCommandRecorder::setFrontFacingWinding(MTL::Winding frontFacingWinding) {
+    list.push(CommandOp::SetFrontFacingWinding, CommandList::SetFrontFacingWinding { frontFacingWinding });
+}
+
+void RenderCommandRecorder::setTriangleFillMode(MTL::TriangleFillMode fillMode) {
+    list.push(CommandOp::SetTriangleFillMode, CommandList::SetTriangleFillMode { fillMode });
+}
+
+void RenderCommandRecorder::setDepthClipMode(MTL::DepthClipMode depthClipMode) {
+    list.push(CommandOp::SetDepthClipMode, CommandList::SetDepthClipMode { depthClipMode });
+}
+
+void RenderCommandRecorder::setViewport(CommandViewport viewport) {
+    list.push(CommandOp::SetViewport, CommandList::SetViewport { viewport });
+}
+
+void RenderCommandRecorder::setScissorRect(CommandScissorRect rect) {
+    list.push(CommandOp::SetScissorRect, CommandList::SetScissorRect { rect });
+}
+
+void RenderCommandRecorder::setDepthBias(float depthBias, float slopeScale, float clamp) {
+    list.push(CommandOp::SetDepthBias, CommandList::SetDepthBias { depthBias, slopeScale, clamp });
+}
+
+void RenderCommandRecorder::setStencilReferenceValue(std::uint32_t referenceValue) {
+    setStencilReferenceValues(referenceValue, referenceValue);
+}
+
+void RenderCommandRecorder::setStencilReferenceValues(std::uint32_t frontReferenceValue, std::uint32_t backReferenceValue) {
+    list.push(CommandOp::SetStencilReferenceValues, CommandList::SetStencilReferenceValues { frontReferenceValue, backReferenceValue });
+}
+
+void RenderCommandRecorder::setBlendColor(float red, float green, float blue, float alpha) {
+    list.push(CommandOp::SetBlendColor, CommandList::SetBlendColor { red, green, blue, alpha });
+}
+
+void RenderCommandRecorder::setVisibilityResultMode(MTL::VisibilityResultMode mode, NS::UInteger offset) {
+    list.push(CommandOp::SetVisibilityResultMode, CommandList::SetVisibilityResultMode { mode, offset });
+}
+
+void RenderCommandRecorder::setVertexBuffer(const MTL::Buffer* buffer, NS::UInteger offset, NS::UInteger index) {
+    setBuffer(BindingStage::Vertex, buffer, offset, index);
+}
+
+void RenderCommandRecorder::setVertexBufferOffset(NS::UInteger offset, NS::UInteger index) {
+    setBufferOffset(BindingStage::Vertex, offset, index);
+}
+
+void RenderCommandRecorder::setVertexBytes(const void* bytes, NS::UInteger length, NS::UInteger index) {
+    setBytes(BindingStage::Vertex, bytes, length, index);
+}
+
+void RenderCommandRecorder::setVertexTexture(const MTL::Texture* texture, NS::UInteger index) {
+    setTexture(BindingStage::Vertex, texture, index);
+}
+
+void RenderCommandRecorder::setVertexSamplerState(const MTL::SamplerState* sampler, NS::UInteger index) {
+    setSamplerState(BindingStage::Vertex, sampler, index);
+}
+
+void RenderCommandRecorder::setFragmentBuffer(const MTL::Buffer* buffer, NS::UInteger offset, NS::UInteger index) {
+    setBuffer(BindingStage::Fragment, buffer, offset, index);
+}
+
+void RenderCommandRecorder::setFragmentBufferOffset(NS::UInteger offset, NS::UInteger index) {
+    setBufferOffset(BindingStage::Fragment, offset, index);
+}
+
+void RenderCommandRecorder::setFragmentBytes(const void* bytes, NS::UInteger length, NS::UInteger index) {
+    setBytes(BindingStage::Fragment, bytes, length, index);
+}
+
+void RenderCommandRecorder::setFragmentTexture(const MTL::Texture* texture, NS::UInteger index) {
+    setTexture(BindingStage::Fragment, texture, index);
+}
+
+void RenderCommandRecorder::setFragmentSamplerState(const MTL::SamplerState* sampler, NS::UInteger index) {
+    setSamplerState(BindingStage::Fragment, sampler, index);
+}
+
+void RenderCommandRecorder::drawPrimitives(MTL::PrimitiveType primitiveType, NS::UInteger vertexStart, NS::UInteger vertexCount,
+                                           NS::UInteger instanceCount, NS::UInteger baseInstance) {
+    list.push(CommandOp::DrawPrimitives, CommandList::DrawPrimitives { primitiveType, vertexStart, vertexCount, instanceCount, baseInstance });
+}
+
+void RenderCommandRecorder::drawIndexedPrimitives(MTL::PrimitiveType primitiveType, NS::UInteger indexCount, MTL::IndexType indexType,
+                                                  const MTL::Buffer* indexBuffer, NS::UInteger indexBufferOffset,
+                                                  NS::UInteger instanceCount, NS::Integer baseVertex, NS::UInteger baseInstance) {
+    list.push(CommandOp::DrawIndexedPrimitives, CommandList::DrawIndexedPrimitives {
+        primitiveType, indexType, indexCount, indexBuffer, indexBufferOffset, instanceCount, baseVertex, baseInstance
+    });
+}
+
+void RenderCommandRecorder::drawPrimitives(MTL::PrimitiveType primitiveType, const MTL::Buffer* indirectBuffer, NS::UInteger indirectBufferOffset) {
+    list.push(CommandOp::DrawPrimitivesIndirect, CommandList::DrawPrimitivesIndirect { primitiveType, indirectBuffer, indirectBufferOffset });
+}
+
+void RenderCommandRecorder::drawIndexedPrimitives(MTL::PrimitiveType primitiveType, MTL::IndexType indexType, const MTL::Buffer* indexBuffer,
+                                                  NS::UInteger indexBufferOffset, const MTL::Buffer* indirectBuffer,
+                                                  NS::UInteger indirectBufferOffset) {
+    list.push(CommandOp::DrawIndexedPrimitivesIndirect, CommandList::DrawIndexedPrimitivesIndirect {
+        primitiveType, indexType, indexBuffer, indexBufferOffset, indirectBuffer, indirectBufferOffset
+    });
+}
+
+void RenderCommandRecorder::updateFence(const MTL::Fence* fence, MTL::RenderStages stages) {
+    CommandRecorder::fence(CommandOp::UpdateFence, fence, stages);
+}
+
+void RenderCommandRecorder::waitForFence(const MTL::Fence* fence, MTL::RenderStages stages) {
+    CommandRecorder::fence(CommandOp::WaitForFence, fence, stages);
+}
+
+void RenderCommandRecorder::useResource(const MTL::Resource* resource, MTL::ResourceUsage usage, MTL::RenderStages stages) {
+    CommandRecorder::useResource(resource, usage, stages);
+}
+
+void RenderCommandRecorder::useHeap(const MTL::Heap* heap, MTL::RenderStages stages) {
+    CommandRecorder::useHeap(heap, stages);
+}
+
+void RenderCommandRecorder::memoryBarrier(MTL::BarrierScope scope, MTL::RenderStages after, MTL::RenderStages before) {
+    CommandRecorder::memoryBarrier(scope, after, before);
+}
+
+void ComputeCommandRecorder::setComputePipelineState(const MTL::ComputePipelineState* state) {
+    list.push(CommandOp::SetComputePipelineState, CommandList::SetComputePipelineState { state });
+}
+
+void ComputeCommandRecorder::setBuffer(const MTL::Buffer* buffer, NS::UInteger offset, NS::UInteger index) {
+    CommandRecorder::setBuffer(BindingStage::Compute, buffer, offset, index);
+}
+
+void ComputeCommandRecorder::setBufferOffset(NS::UInteger offset, NS::UInteger index) {
+    CommandRecorder::setBufferOffset(BindingStage::Compute, offset, index);
+}
+
+void ComputeCommandRecorder::setBytes(const void* bytes, NS::UInteger length, NS::UInteger index) {
+    CommandRecorder::setBytes(BindingStage::Compute, bytes, length, index);
+}
+
+void ComputeCommandRecorder::setTexture(const MTL::Texture* texture, NS::UInteger index) {
+    CommandRecorder::setTexture(BindingStage::Compute, texture, index);
+}
+
+void ComputeCommandRecorder::setSamplerState(const MTL::SamplerState* sampler, NS::UInteger index) {
+    CommandRecorder::setSamplerState(BindingStage::Compute, sampler, index);
+}
+
+void ComputeCommandRecorder::setThreadgroupMemoryLength(NS::UInteger length, NS::UInteger index) {
+    list.push(CommandOp::SetThreadgroupMemoryLength, CommandList::SetThreadgroupMemoryLength { length, index });
+}
+
+void ComputeCommandRecorder::dispatchThreadgroups(CommandSize threadgroupsPerGrid, CommandSize threadsPerThreadgroup) {
+    list.push(CommandOp::DispatchThreadgroups, CommandList::Dispatch { threadgroupsPerGrid, threadsPerThreadgroup });
+}
+
+void ComputeCommandRecorder::dispatchThreadgroups(const MTL::Buffer* indirectBuffer, NS::UInteger indirectBufferOffset,
+                                                  CommandSize threadsPerThreadgroup) {
+    list.push(CommandOp::DispatchThreadgroupsIndirect, CommandList::DispatchThreadgroupsIndirect {
+        indirectBuffer, indirectBufferOffset, threadsPerThreadgroup
+    });
+}
+
+void ComputeCommandRecorder::dispatchThreads(CommandSize threadsPerGrid, CommandSize threadsPerThreadgroup) {
+    list.push(CommandOp::DispatchThreads, CommandList::Dispatch { threadsPerGrid, threadsPerThreadgroup });
+}
+
+void ComputeCommandRecorder::updateFence(const MTL::Fence* fence) {
+    CommandRecorder::fence(CommandOp::UpdateFence, fence, 0);
+}
+
+void ComputeCommandRecorder::waitForFence(const MTL::Fence* fence) {
+    CommandRecorder::fence(CommandOp::WaitForFence, fence, 0);
+}
+
+void ComputeCommandRecorder::useResource(const MTL::Resource* resource, MTL::ResourceUsage usage) {
+    CommandRecorder::useResource(resource, usage, 0);
+}
+
+void ComputeCommandRecorder::useHeap(const MTL::Heap* heap) {
+    CommandRecorder::useHeap(heap, 0);
+}
+
+void ComputeCommandRecorder::memoryBarrier(MTL::BarrierScope scope) {
+    CommandRecorder::memoryBarrier(scope, 0, 0);
+}
+
+void BlitCommandRecorder::copyFromBuffer(const MTL::Buffer* sourceBuffer, NS::UInteger sourceOffset, const MTL::Buffer* destinationBuffer,
+                                         NS::UInteger destinationOffset, NS::UInteger size) {
+    list.push(CommandOp::CopyBufferToBuffer, CommandList::CopyBufferToBuffer {
+        sourceBuffer, sourceOffset, destinationBuffer, destinationOffset, size
+    });
+}
+
+void BlitCommandRecorder::copyFromTexture(const MTL::Texture* sourceTexture, NS::UInteger sourceSlice, NS::UInteger sourceLevel,
+                                          CommandOrigin sourceOrigin, CommandSize sourceSize, const MTL::Texture* destinationTexture,
+                                          NS::UInteger destinationSlice, NS::UInteger destinationLevel, CommandOrigin destinationOrigin) {
+    list.push(CommandOp::CopyTextureToTexture, CommandList::CopyTextureToTexture {
+        sourceTexture, sourceSlice, sourceLevel, sourceOrigin, sourceSize, destinationTexture, destinationSlice, destinationLevel,
+        destinationOrigin
+    });
+}
+
+void BlitCommandRecorder::copyFromBuffer(const MTL::Buffer* sourceBuffer, NS::UInteger sourceOffset, NS::UInteger sourceBytesPerRow,
+                                         NS::UInteger sourceBytesPerImage, CommandSize sourceSize, const MTL::Texture* destinationTexture,
+                                         NS::UInteger destinationSlice, NS::UInteger destinationLevel, CommandOrigin destinationOrigin) {
+    list.push(CommandOp::CopyBufferToTexture, CommandList::CopyBufferToTexture {
+        sourceBuffer, sourceOffset, sourceBytesPerRow, sourceBytesPerImage, sourceSize, destinationTexture, destinationSlice,
+        destinationLevel, destinationOrigin
+    });
+}
+
+void BlitCommandRecorder::copyFromTexture(const MTL::Texture* sourceTexture, NS::UInteger sourceSlice, NS::UInteger sourceLevel,
+                                          CommandOrigin sourceOrigin, CommandSize sourceSize, const MTL::Buffer* destinationBuffer,
+                                          NS::UInteger destinationOffset, NS::UInteger destinationBytesPerRow,
+                                          NS::UInteger destinationBytesPerImage) {
+    list.push(CommandOp::CopyTextureToBuffer, CommandList::CopyTextureToBuffer {
+        sourceTexture, sourceSlice, sourceLevel, sourceOrigin, sourceSize, destinationBuffer, destinationOffset, destinationBytesPerRow,
+        destinationBytesPerImage
+    });
+}
+
+void BlitCommandRecorder::fillBuffer(const MTL::Buffer* buffer, NS::Range range, std::uint8_t value) {
+    list.push(CommandOp::FillBuffer, CommandList::FillBuffer { buffer, range.location, range.length, value });
+}
+
+void BlitCommandRecorder::generateMipmaps(const MTL::Texture* texture) {
+    list.push(CommandOp::GenerateMipmaps, CommandList::TextureOp { texture });
+}
+
+void BlitCommandRecorder::synchronizeResource(const MTL::Resource* resource) {
+    list.push(CommandOp::SynchronizeResource, CommandList::ResourceOp { resource });
+}
+
+void BlitCommandRecorder::optimizeContentsForGPUAccess(const MTL::Texture* texture) {
+    list.push(CommandOp::OptimizeContentsForGPUAccess, CommandList::TextureOp { texture });
+}
+
+void BlitCommandRecorder::updateFence(const MTL::Fence* fence) {
+    CommandRecorder::fence(CommandOp::UpdateFence, fence, 0);
+}
+
+void BlitCommandRecorder::waitForFence(const MTL::Fence* fence) {
+    CommandRecorder::fence(CommandOp::WaitForFence, fence, 0);
+}
@@ -0,0 +1,444 @@
+//
+//  command_list.hpp
+//  Metal-Guide
+//
+
+#pragma once
+
+#include <Foundation/NSRange.hpp>
+#include <Foundation/NSTypes.hpp>
+
+#include "binding_stage.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+
+// Recording only stores pointers and enum values, so the Metal headers stay out of here and the recorders build on
+// Linux. The declarations below must match metal-cpp.
+namespace NS {
+class String;
+}
+
+namespace MTL {
+class Buffer;
+class ComputePipelineState;
+class DepthStencilState;
+class Fence;
+class Heap;
+class RenderPipelineState;
+class Resource;
+class SamplerState;
+class Texture;
+
+enum CullMode : NS::UInteger;
+enum DepthClipMode : NS::UInteger;
+enum IndexType : NS::UInteger;
+enum PrimitiveType : NS::UInteger;
+enum TriangleFillMode : NS::UInteger;
+enum VisibilityResultMode : NS::UInteger;
+enum Winding : NS::UInteger;
+
+using BarrierScope = NS::UInteger;
+using RenderStages = NS::UInteger;
+using ResourceUsage = NS::UInteger;
+}
+
+// Stand-ins for MTL::Origin, MTL::Size, MTL::Viewport and MTL::ScissorRect. They convert implicitly from and to those
+// (or any type with the same fields) wherever the Metal headers are included.
+struct CommandOrigin {
+    NS::UInteger x, y, z;
+
+    CommandOrigin() = default;
+    template <typename Origin>
+    CommandOrigin(const Origin& origin) : x(origin.x), y(origin.y), z(origin.z) {}
+    template <typename Origin>
+    operator Origin() const { return Origin { x, y, z }; }
+};
+
+struct CommandSize {
+    NS::UInteger width, height, depth;
+
+    CommandSize() = default;
+    template <typename Size>
+    CommandSize(const Size& size) : width(size.width), height(size.height), depth(size.depth) {}
+    template <typename Size>
+    operator Size() const { return Size { width, height, depth }; }
+};
+
+struct CommandViewport {
+    double originX, originY, width, height, znear, zfar;
+
+    CommandViewport() = default;
+    template <typename Viewport>
+    CommandViewport(const Viewport& viewport)
+        : originX(viewport.originX), originY(viewport.originY), width(viewport.width), height(viewport.height),
+          znear(viewport.znear), zfar(viewport.zfar) {}
+    template <typename Viewport>
+    operator Viewport() const { return Viewport { originX, originY, width, height, znear, zfar }; }
+};
+
+struct CommandScissorRect {
+    NS::UInteger x, y, width, height;
+
+    CommandScissorRect() = default;
+    template <typename ScissorRect>
+    CommandScissorRect(const ScissorRect& rect) : x(rect.x), y(rect.y), width(rect.width), height(rect.height) {}
+    template <typename ScissorRect>
+    operator ScissorRect() const { return ScissorRect { x, y, width, height }; }
+};
+
+enum class CommandOp : std::uint16_t {
+    // Any encoder.
+    PushDebugGroup,
+    PopDebugGroup,
+    InsertDebugSignpost,
+    UpdateFence,
+    WaitForFence,
+    UseResource,
+    UseHeap,
+    MemoryBarrier,
+
+    // Render and compute encoders. Stage selects vertex, fragment or compute.
+    SetBuffer,
+    SetBufferOffset,
+    SetBytes,
+    SetTexture,
+    SetSamplerState,
+    SetThreadgroupMemoryLength,
+
+    // Render encoders.
+    SetRenderPipelineState,
+    SetDepthStencilState,
+    SetCullMode,
+    SetFrontFacingWinding,
+    SetTriangleFillMode,
+    SetDepthClipMode,
+    SetViewport,
+    SetScissorRect,
+    SetDepthBias,
+    SetStencilReferenceValues,
+    SetBlendColor,
+    SetVisibilityResultMode,
+    DrawPrimitives,
+    DrawIndexedPrimitives,
+    DrawPrimitivesIndirect,
+    DrawIndexedPrimitivesIndirect,
+
+    // Compute encoders.
+    SetComputePipelineState,
+    DispatchThreadgroups,
+    DispatchThreads,
+    DispatchThreadgroupsIndirect,
+
+    // Blit encoders.
+    CopyBufferToBuffer,
+    CopyTextureToTexture,
+    CopyBufferToTexture,
+    CopyTextureToBuffer,
+    FillBuffer,
+    GenerateMipmaps,
+    SynchronizeResource,
+    OptimizeContentsForGPUAccess,
+};
+
+// Encoder calls stored as a stream of plain records in arena memory, to be replayed onto a real encoder later, possibly
+// on another thread. Each record is a CommandHeader followed by the op's payload struct, 8-byte aligned. Objects are
+// stored as pointers and not retained: everything a list refers to, debug strings included, must outlive its replay.
+// Recording never messages the Objective-C runtime.
+//
+// reset() empties the list but keeps its memory, so a list can be re-recorded every frame without allocating.
+class CommandList {
+public:
+    struct CommandHeader {
+        CommandOp op;
+        std::uint32_t size;
+    };
+
+    struct DebugString { const NS::String* string; };
+    struct Fence { const MTL::Fence* fence; MTL::RenderStages stages; };
+    struct UseResource { const MTL::Resource* resource; MTL::ResourceUsage usage; MTL::RenderStages stages; };
+    struct UseHeap { const MTL::Heap* heap; MTL::RenderStages stages; };
+    struct MemoryBarrier { MTL::BarrierScope scope; MTL::RenderStages after; MTL::RenderStages before; };
+
+    struct SetBuffer { BindingStage stage; const MTL::Buffer* buffer; NS::UInteger offset; NS::UInteger index; };
+    struct SetBufferOffset { BindingStage stage; NS::UInteger offset; NS::UInteger index; };
+    // Followed by length bytes.
+    struct SetBytes { BindingStage stage; NS::UInteger length; NS::UInteger index; };
+    struct SetTexture { BindingStage stage; const MTL::Texture* texture; NS::UInteger index; };
+    struct SetSamplerState { BindingStage stage; const MTL::SamplerState* sampler; NS::UInteger index; };
+    struct SetThreadgroupMemoryLength { NS::UInteger length; NS::UInteger index; };
+
+    struct SetRenderPipelineState { const MTL::RenderPipelineState* pipelineState; };
+    struct SetDepthStencilState { const MTL::DepthStencilState* depthStencilState; };
+    struct SetCullMode { MTL::CullMode cullMode; };
+    struct SetFrontFacingWinding { MTL::Winding winding; };
+    struct SetTriangleFillMode { MTL::TriangleFillMode fillMode; };
+    struct SetDepthClipMode { MTL::DepthClipMode depthClipMode; };
+    struct SetViewport { CommandViewport viewport; };
+    struct SetScissorRect { CommandScissorRect rect; };
+    struct SetDepthBias { float depthBias; float slopeScale; float clamp; };
+    struct SetStencilReferenceValues { std::uint32_t front; std::uint32_t back; };
+    struct SetBlendColor { float red; float green; float blue; float alpha; };
+    struct SetVisibilityResultMode { MTL::VisibilityResultMode mode; NS::UInteger offset; };
+    struct DrawPrimitives {
+        MTL::PrimitiveType primitiveType;
+        NS::UInteger vertexStart;
+        NS::UInteger vertexCount;
+        NS::UInteger instanceCount;
+        NS::UInteger baseInstance;
+    };
+    struct DrawIndexedPrimitives {
+        MTL::PrimitiveType primitiveType;
+        MTL::IndexType indexType;
+        NS::UInteger indexCount;
+        const MTL::Buffer* indexBuffer;
+        NS::UInteger indexBufferOffset;
+        NS::UInteger instanceCount;
+        NS::Integer baseVertex;
+        NS::UInteger baseInstance;
+    };
+    struct DrawPrimitivesIndirect {
+        MTL::PrimitiveType primitiveType;
+        const MTL::Buffer* indirectBuffer;
+        NS::UInteger indirectBufferOffset;
+    };
+    struct DrawIndexedPrimitivesIndirect {
+        MTL::PrimitiveType primitiveType;
+        MTL::IndexType indexType;
+        const MTL::Buffer* indexBuffer;
+        NS::UInteger indexBufferOffset;
+        const MTL::Buffer* indirectBuffer;
+        NS::UInteger indirectBufferOffset;
+    };
+
+    struct SetComputePipelineState { const MTL::ComputePipelineState* pipelineState; };
+    struct Dispatch { CommandSize grid; CommandSize threadsPerThreadgroup; };
+    struct DispatchThreadgroupsIndirect {
+        const MTL::Buffer* indirectBuffer;
+        NS::UInteger indirectBufferOffset;
+        CommandSize threadsPerThreadgroup;
+    };
+
+    struct CopyBufferToBuffer {
+        const MTL::Buffer* source;
+        NS::UInteger sourceOffset;
+        const MTL::Buffer* destination;
+        NS::UInteger destinationOffset;
+        NS::UInteger size;
+    };
+    struct CopyTextureToTexture {
+        const MTL::Texture* source;
+        NS::UInteger sourceSlice;
+        NS::UInteger sourceLevel;
+        CommandOrigin sourceOrigin;
+        CommandSize sourceSize;
+        const MTL::Texture* destination;
+        NS::UInteger destinationSlice;
+        NS::UInteger destinationLevel;
+        CommandOrigin destinationOrigin;
+    };
+    struct CopyBufferToTexture {
+        const MTL::Buffer* source;
+        NS::UInteger sourceOffset;
+        NS::UInteger sourceBytesPerRow;
+        NS::UInteger sourceBytesPerImage;
+        CommandSize sourceSize;
+        const MTL::Texture* destination;
+        NS::UInteger destinationSlice;
+        NS::UInteger destinationLevel;
+        CommandOrigin destinationOrigin;
+    };
+    struct CopyTextureToBuffer {
+        const MTL::Texture* source;
+        NS::UInteger sourceSlice;
+        NS::UInteger sourceLevel;
+        CommandOrigin sourceOrigin;
+        CommandSize sourceSize;
+        const MTL::Buffer* destination;
+        NS::UInteger destinationOffset;
+        NS::UInteger destinationBytesPerRow;
+        NS::UInteger destinationBytesPerImage;
+    };
+    struct FillBuffer { const MTL::Buffer* buffer; NS::UInteger location; NS::UInteger length; std::uint8_t value; };
+    struct TextureOp { const MTL::Texture* texture; };
+    struct ResourceOp { const MTL::Resource* resource; };
+
+    explicit CommandList(std::size_t chunkSize = 64 * 1024);
+
+    CommandList(const CommandList&) = delete;
+    CommandList& operator=(const CommandList&) = delete;
+    CommandList(CommandList&&) = default;
+    CommandList& operator=(CommandList&&) = default;
+
+    // Appends a record and returns its payload, followed by extraBytes of uninitialized space.
+    template <typename Payload>
+    Payload& push(CommandOp op, const Payload& payload, std::size_t extraBytes = 0) {
+        std::size_t size = recordSize(sizeof(Payload) + extraBytes);
+        std::byte* record = allocate(size);
+        new (record) CommandHeader { op, static_cast<std::uint32_t>(size) };
+        return *new (record + sizeof(CommandHeader)) Payload(payload);
+    }
+
+    // Calls function(header, payload) for every record in order.
+    template <typename Function>
+    void forEach(Function&& function) const {
+        for (std::size_t i = 0; i < chunkCount; i++) {
+            const std::byte* chunk = chunks[i].data.get();
+            for (std::size_t offset = 0; offset < chunks[i].used;) {
+                const auto* header = reinterpret_cast<const CommandHeader*>(chunk + offset);
+                function(*header, static_cast<const void*>(header + 1));
+                offset += header->size;
+            }
+        }
+    }
+
+    void reset();
+
+    bool empty() const { return commands == 0; }
+    std::size_t commandCount() const { return commands; }
+    std::size_t byteSize() const;
+
+private:
+    struct Chunk {
+        std::unique_ptr<std::byte[]> data;
+        std::size_t capacity;
+        std::size_t used;
+    };
+
+    static constexpr std::size_t recordAlignment = 8;
+
+    static std::size_t recordSize(std::size_t payloadSize) {
+        return (sizeof(CommandHeader) + payloadSize + recordAlignment - 1) & ~(recordAlignment - 1);
+    }
+
+    std::byte* allocate(std::size_t size);
+
+    std::size_t chunkSize;
+    std::vector<Chunk> chunks;
+    // Chunks in use; the rest are kept from before the last reset().
+    std::size_t chunkCount = 0;
+    std::size_t commands = 0;
+};
+
+// Shared by the recorders: the CommandEncoder methods plus calls every encoder kind has.
+class CommandRecorder {
+public:
+    explicit CommandRecorder(CommandList& list) : list(list) {}
+
+    CommandList& commandList() const { return list; }
+
+    void pushDebugGroup(const NS::String* string);
+    void popDebugGroup();
+    void insertDebugSignpost(const NS::String* string);
+
+protected:
+    void setBuffer(BindingStage stage, const MTL::Buffer* buffer, NS::UInteger offset, NS::UInteger index);
+    void setBufferOffset(BindingStage stage, NS::UInteger offset, NS::UInteger index);
+    void setBytes(BindingStage stage, const void* bytes, NS::UInteger length, NS::UInteger index);
+    void setTexture(BindingStage stage, const MTL::Texture* texture, NS::UInteger index);
+    void setSamplerState(BindingStage stage, const MTL::SamplerState* sampler, NS::UInteger index);
+    void fence(CommandOp op, const MTL::Fence* fence, MTL::RenderStages stages);
+    void useResource(const MTL::Resource* resource, MTL::ResourceUsage usage, MTL::RenderStages stages);
+    void useHeap(const MTL::Heap* heap, MTL::RenderStages stages);
+    void memoryBarrier(MTL::BarrierScope scope, MTL::RenderStages after, MTL::RenderStages before);
+
+    CommandList& list;
+};
+
+// Same method names and arguments as MTL::RenderCommandEncoder, for the subset it supports.
+class RenderCommandRecorder : public CommandRecorder {
+public:
+    using CommandRecorder::CommandRecorder;
+
+    void setRenderPipelineState(const MTL::RenderPipelineState* pipelineState);
+    void setDepthStencilState(const MTL::DepthStencilState* depthStencilState);
+    void setCullMode(MTL::CullMode cullMode);
+    void setFrontFacingWinding(MTL::Winding frontFacingWinding);
+    void setTriangleFillMode(MTL::TriangleFillMode fillMode);
+    void setDepthClipMode(MTL::DepthClipMode depthClipMode);
+    void setViewport(CommandViewport viewport);
+    void setScissorRect(CommandScissorRect rect);
+    void setDepthBias(float depthBias, float slopeScale, float clamp);
+    void setStencilReferenceValue(std::uint32_t referenceValue);
+    void setStencilReferenceValues(std::uint32_t frontReferenceValue, std::uint32_t backReferenceValue);
+    void setBlendColor(float red, float green, float blue, float alpha);
+    void setVisibilityResultMode(MTL::VisibilityResultMode mode, NS::UInteger offset);
+
+    void setVertexBuffer(const MTL::Buffer* buffer, NS::UInteger offset, NS::UInteger index);
+    void setVertexBufferOffset(NS::UInteger offset, NS::UInteger index);
+    void setVertexBytes(const void* bytes, NS::UInteger length, NS::UInteger index);
+    void setVertexTexture(const MTL::Texture* texture, NS::UInteger index);
+    void setVertexSamplerState(const MTL::SamplerState* sampler, NS::UInteger index);
+    void setFragmentBuffer(const MTL::Buffer* buffer, NS::UInteger offset, NS::UInteger index);
+    void setFragmentBufferOffset(NS::UInteger offset, NS::UInteger index);
+    void setFragmentBytes(const void* bytes, NS::UInteger length, NS::UInteger index);
+    void setFragmentTexture(const MTL::Texture* texture, NS::UInteger index);
+    void setFragmentSamplerState(const MTL::SamplerState* sampler, NS::UInteger index);
+
+    void drawPrimitives(MTL::PrimitiveType primitiveType, NS::UInteger vertexStart, NS::UInteger vertexCount,
+                        NS::UInteger instanceCount = 1, NS::UInteger baseInstance = 0);
+    void drawIndexedPrimitives(MTL::PrimitiveType primitiveType, NS::UInteger indexCount, MTL::IndexType indexType,
+                               const MTL::Buffer* indexBuffer, NS::UInteger indexBufferOffset, NS::UInteger instanceCount = 1,
+                               NS::Integer baseVertex = 0, NS::UInteger baseInstance = 0);
+    void drawPrimitives(MTL::PrimitiveType primitiveType, const MTL::Buffer* indirectBuffer, NS::UInteger indirectBufferOffset);
+    void drawIndexedPrimitives(MTL::PrimitiveType primitiveType, MTL::IndexType indexType, const MTL::Buffer* indexBuffer,
+                               NS::UInteger indexBufferOffset, const MTL::Buffer* indirectBuffer, NS::UInteger indirectBufferOffset);
+
+    void updateFence(const MTL::Fence* fence, MTL::RenderStages stages);
+    void waitForFence(const MTL::Fence* fence, MTL::RenderStages stages);
+    void useResource(const MTL::Resource* resource, MTL::ResourceUsage usage, MTL::RenderStages stages);
+    void useHeap(const MTL::Heap* heap, MTL::RenderStages stages);
+    void memoryBarrier(MTL::BarrierScope scope, MTL::RenderStages after, MTL::RenderStages before);
+};
+
+// Same method names and arguments as MTL::ComputeCommandEncoder, for the subset it supports.
+class ComputeCommandRecorder : public CommandRecorder {
+public:
+    using CommandRecorder::CommandRecorder;
+
+    void setComputePipelineState(const MTL::ComputePipelineState* state);
+    void setBuffer(const MTL::Buffer* buffer, NS::UInteger offset, NS::UInteger index);
+    void setBufferOffset(NS::UInteger offset, NS::UInteger index);
+    void setBytes(const void* bytes, NS::UInteger length, NS::UInteger index);
+    void setTexture(const MTL::Texture* texture, NS::UInteger index);
+    void setSamplerState(const MTL::SamplerState* sampler, NS::UInteger index);
+    void setThreadgroupMemoryLength(NS::UInteger length, NS::UInteger index);
+
+    void dispatchThreadgroups(CommandSize threadgroupsPerGrid, CommandSize threadsPerThreadgroup);
+    void dispatchThreadgroups(const MTL::Buffer* indirectBuffer, NS::UInteger indirectBufferOffset, CommandSize threadsPerThreadgroup);
+    void dispatchThreads(CommandSize threadsPerGrid, CommandSize threadsPerThreadgroup);
+
+    void updateFence(const MTL::Fence* fence);
+    void waitForFence(const MTL::Fence* fence);
+    void useResource(const MTL::Resource* resource, MTL::ResourceUsage usage);
+    void useHeap(const MTL::Heap* heap);
+    void memoryBarrier(MTL::BarrierScope scope);
+};
+
+// Same method names and arguments as MTL::BlitCommandEncoder, for the subset it supports.
+class BlitCommandRecorder : public CommandRecorder {
+public:
+    using CommandRecorder::CommandRecorder;
+
+    void copyFromBuffer(const MTL::Buffer* sourceBuffer, NS::UInteger sourceOffset, const MTL::Buffer* destinationBuffer,
+                        NS::UInteger destinationOffset, NS::UInteger size);
+    void copyFromTexture(const MTL::Texture* sourceTexture, NS::UInteger sourceSlice, NS::UInteger sourceLevel, CommandOrigin sourceOrigin,
+                         CommandSize sourceSize, const MTL::Texture* destinationTexture, NS::UInteger destinationSlice,
+                         NS::UInteger destinationLevel, CommandOrigin destinationOrigin);
+    void copyFromBuffer(const MTL::Buffer* sourceBuffer, NS::UInteger sourceOffset, NS::UInteger sourceBytesPerRow,
+                        NS::UInteger sourceBytesPerImage, CommandSize sourceSize, const MTL::Texture* destinationTexture,
+                        NS::UInteger destinationSlice, NS::UInteger destinationLevel, CommandOrigin destinationOrigin);
+    void copyFromTexture(const MTL::Texture* sourceTexture, NS::UInteger sourceSlice, NS::UInteger sourceLevel, CommandOrigin sourceOrigin,
+                         CommandSize sourceSize, const MTL::Buffer* destinationBuffer, NS::UInteger destinationOffset,
+                         NS::UInteger destinationBytesPerRow, NS::UInteger destinationBytesPerImage);
+    void fillBuffer(const MTL::Buffer* buffer, NS::Range range, std::uint8_t value);
+    void generateMipmaps(const MTL::Texture* texture);
+    void synchronizeResource(const MTL::Resource* resource);
+    void optimizeContentsForGPUAccess(const MTL::Texture* texture);
+
+    void updateFence(const MTL::Fence* fence);
+    void waitForFence(const MTL::Fence* fence);
+};
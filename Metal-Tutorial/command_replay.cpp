@@ -0,0 +1,20 @@
+//
+//  command_replay.cpp
+//  Metal-Guide
+//
+
+#include "command_replay.hpp"
+
+#include "command_decoder.hpp"
+
+void replayCommands(const CommandList& list, MTL::RenderCommandEncoder* encoder) {
+    replayRenderCommands(list, encoder);
+}
+
+void replayCommands(const CommandList& list, MTL::ComputeCommandEncoder* encoder) {
+    replayComputeCommands(list, encoder);
+}
+
+void replayCommands(const CommandList& list, MTL::BlitCommandEncoder* encoder) {
+    replayBlitCommands(list, encoder);
+}
@@ -0,0 +1,16 @@
+//
+//  command_replay.hpp
+//  Metal-Guide
+//
+
+#pragma once
+
+#include <Metal/Metal.hpp>
+
+#include "command_list.hpp"
+
+// Issue a recorded CommandList onto a real encoder, in order. The list must have been recorded with the recorder for
+// the same kind of encoder. The encoder is left open.
+void replayCommands(const CommandList& list, MTL::RenderCommandEncoder* encoder);
+void replayCommands(const CommandList& list, MTL::ComputeCommandEncoder* encoder);
+void replayCommands(const CommandList& list, MTL::BlitCommandEncoder* encoder);
@@ -0,0 +1,83 @@
+//
+//  defrag_planner.cpp
+//  Metal-Guide
+//
+
+#include "defrag_planner.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+DefragPlanner::DefragPlanner(double sparseThreshold)
+    : sparseThreshold(sparseThreshold) {
+}
+
+std::vector<bool> DefragPlanner::pickSources(const std::vector<TlsfStats>& heaps) const {
+    std::vector<bool> sources(heaps.size(), false);
+
+    std::vector<std::uint64_t> freeBefore(heaps.size() + 1, 0);
+    for (std::size_t i = 0; i < heaps.size(); i++) {
+        freeBefore[i + 1] = freeBefore[i] + heaps[i].freeBytes;
+    }
+
+    // Live bytes of the heaps chosen so far, which all have to fit into heaps before the next one chosen.
+    std::uint64_t movingBytes = 0;
+    for (std::size_t i = heaps.size(); i-- > 0;) {
+        const TlsfStats& heap = heaps[i];
+        // Empty heaps need no moves, releasing them is enough.
+        if (heap.usedBytes == 0 || double(heap.usedBytes) >= sparseThreshold * double(heap.capacity)) {
+            continue;
+        }
+        if (movingBytes + heap.usedBytes > freeBefore[i]) {
+            continue;
+        }
+        sources[i] = true;
+        movingBytes += heap.usedBytes;
+    }
+    return sources;
+}
+
+std::vector<DefragMove> DefragPlanner::plan(const std::vector<TlsfAllocator*>& heaps, const std::vector<bool>& sources,
+                                            std::vector<DefragBlock> blocks, std::uint64_t budgetBytes) const {
+    assert(heaps.size() == sources.size());
+
+    std::vector<std::uint32_t> destinations;
+    std::vector<std::uint64_t> usedBytes(heaps.size());
+    for (std::uint32_t i = 0; i < heaps.size(); i++) {
+        if (!sources[i]) {
+            destinations.push_back(i);
+            usedBytes[i] = heaps[i]->stats().usedBytes;
+        }
+    }
+    // Filling the fullest heaps first keeps the free space of the others in one piece.
+    std::stable_sort(destinations.begin(), destinations.end(), [&usedBytes](std::uint32_t a, std::uint32_t b) {
+        return usedBytes[a] > usedBytes[b];
+    });
+
+    std::stable_sort(blocks.begin(), blocks.end(), [](const DefragBlock& a, const DefragBlock& b) {
+        return a.allocation.size > b.allocation.size;
+    });
+
+    std::vector<DefragMove> moves;
+    std::uint64_t plannedBytes = 0;
+    for (const DefragBlock& block : blocks) {
+        if (plannedBytes >= budgetBytes) {
+            break;
+        }
+        if (!sources[block.heap]) {
+            continue;
+        }
+        for (std::uint32_t destination : destinations) {
+            if (destination >= block.heap) {
+                continue;
+            }
+            TlsfAllocation to = heaps[destination]->allocate(block.allocation.size, block.alignment);
+            if (to) {
+                moves.push_back(DefragMove { block.owner, block.heap, block.allocation, destination, to });
+                plannedBytes += block.allocation.size;
+                break;
+            }
+        }
+    }
+    return moves;
+}
@@ -0,0 +1,48 @@
+//
+//  defrag_planner.hpp
+//  Metal-Guide
+//
+
+#pragma once
+
+#include "tlsf_allocator.hpp"
+
+#include <cstdint>
+#include <vector>
+
+// A live allocation that may be moved. owner is the caller's id for it.
+struct DefragBlock {
+    std::uint32_t owner;
+    std::uint32_t heap;
+    TlsfAllocation allocation;
+    std::uint64_t alignment;
+};
+
+struct DefragMove {
+    std::uint32_t owner;
+    std::uint32_t fromHeap;
+    TlsfAllocation from;
+    std::uint32_t toHeap;
+    TlsfAllocation to;
+};
+
+// Plans compaction of a set of heaps, each managed by a TlsfAllocator, without touching any memory itself.
+//
+// Blocks only ever move to a heap with a lower index, so repeated passes converge and the heaps at the end, the only
+// ones that can be released, drain first. pickSources() marks the heaps worth emptying: those less than
+// sparseThreshold full whose live bytes, together with those of the later heaps already picked, fit into the free
+// space of the heaps before them. plan() then reserves destinations for blocks in those heaps, largest first, in
+// earlier heaps that aren't being emptied, fullest first, until budgetBytes have been planned. The caller copies the
+// data and frees the source ranges afterwards; a block that fits nowhere is left where it is.
+class DefragPlanner {
+public:
+    explicit DefragPlanner(double sparseThreshold = 0.5);
+
+    std::vector<bool> pickSources(const std::vector<TlsfStats>& heaps) const;
+
+    std::vector<DefragMove> plan(const std::vector<TlsfAllocator*>& heaps, const std::vector<bool>& sources,
+                                 std::vector<DefragBlock> blocks, std::uint64_t budgetBytes) const;
+
+private:
+    double sparseThreshold;
+};
@@ -0,0 +1,39 @@
+//
+//  dirty_ranges.cpp
+//  Metal-Guide
+//
+
+#include "dirty_ranges.hpp"
+
+#include <algorithm>
+
+void DirtyRanges::add(std::uint64_t begin, std::uint64_t end) {
+    if (begin >= end) {
+        return;
+    }
+
+    // Widen the probe by the gap so neighbours close enough to merge are found too.
+    std::uint64_t probeBegin = begin > gap ? begin - gap : 0;
+    std::uint64_t probeEnd = end + gap;
+
+    auto it = ranges.upper_bound(probeBegin);
+    if (it != ranges.begin() && std::prev(it)->second >= probeBegin) {
+        --it;
+    }
+
+    while (it != ranges.end() && it->first <= probeEnd) {
+        begin = std::min(begin, it->first);
+        end = std::max(end, it->second);
+        it = ranges.erase(it);
+    }
+
+    ranges.emplace_hint(it, begin, end);
+}
+
+std::uint64_t DirtyRanges::bytes() const {
+    std::uint64_t total = 0;
+    for (const auto& range : ranges) {
+        total += range.second - range.first;
+    }
+    return total;
+}
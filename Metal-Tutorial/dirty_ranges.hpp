@@ -0,0 +1,39 @@
+//
+//  dirty_ranges.hpp
+//  Metal-Guide
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+
+// Set of half-open byte ranges [begin, end). Ranges that overlap, or that are separated by no more than mergeGap
+// bytes, are merged on insertion, trading a few clean bytes for fewer ranges.
+class DirtyRanges {
+public:
+    explicit DirtyRanges(std::uint64_t mergeGap = 0) : gap(mergeGap) {}
+
+    void add(std::uint64_t begin, std::uint64_t end);
+    void clear() { ranges.clear(); }
+
+    bool empty() const { return ranges.empty(); }
+    std::size_t count() const { return ranges.size(); }
+    std::uint64_t bytes() const;
+
+    std::uint64_t mergeGap() const { return gap; }
+    void setMergeGap(std::uint64_t mergeGap) { gap = mergeGap; }
+
+    // Calls function(begin, end) for every range in ascending order.
+    template <typename Function>
+    void forEach(Function&& function) const {
+        for (const auto& range : ranges) {
+            function(range.first, range.second);
+        }
+    }
+
+private:
+    std::uint64_t gap;
+    std::map<std::uint64_t, std::uint64_t> ranges;
+};
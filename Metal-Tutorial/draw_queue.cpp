@@ -0,0 +1,142 @@
+//
+//  draw_queue.cpp
+//  Metal-Guide
+//
+
+#include "draw_queue.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+
+std::uint64_t DrawKey::make(std::uint32_t pass, std::uint32_t pipeline, std::uint32_t material, std::uint32_t depth) {
+    assert(pass < (1u << passBits) && pipeline < (1u << pipelineBits) && material < (1u << materialBits) && depth < (1u << depthBits));
+    return std::uint64_t(pass) << passShift | std::uint64_t(pipeline) << pipelineShift | std::uint64_t(material) << materialShift
+        | std::uint64_t(depth) << depthShift;
+}
+
+std::uint32_t DrawKey::quantizeDepth(float depth, bool backToFront) {
+    constexpr std::uint32_t maxDepth = (1u << depthBits) - 1;
+    float clamped = std::clamp(depth, 0.0f, 1.0f);
+    auto quantized = static_cast<std::uint32_t>(std::lround(clamped * maxDepth));
+    return backToFront ? maxDepth - quantized : quantized;
+}
+
+DrawQueue::DrawQueue(WorkStealingPool* pool, std::size_t parallelThreshold)
+    : pool(pool), parallelThreshold(parallelThreshold) {}
+
+void DrawQueue::countChange(std::uint64_t key, const std::uint64_t* previous, DrawStateChanges& changes) {
+    if (!previous || DrawKey::pass(key) != DrawKey::pass(*previous)) {
+        changes.passes++;
+    }
+    if (!previous || DrawKey::pipeline(key) != DrawKey::pipeline(*previous)) {
+        changes.pipelines++;
+    }
+    if (!previous || DrawKey::material(key) != DrawKey::material(*previous)) {
+        changes.materials++;
+    }
+}
+
+DrawStateChanges DrawQueue::countStateChanges(const std::vector<Item>& items) {
+    DrawStateChanges changes;
+    for (std::size_t i = 0; i < items.size(); i++) {
+        countChange(items[i].key, i > 0 ? &items[i - 1].key : nullptr, changes);
+    }
+    return changes;
+}
+
+void DrawQueue::push(std::uint64_t key, std::uint32_t payload) {
+    // Counted as they come, so the unsorted order costs no extra pass.
+    countChange(key, queue.empty() ? nullptr : &queue.back().key, queueStats.submitted);
+    queue.push_back(Item { key, payload });
+    queueStats.items++;
+}
+
+void DrawQueue::clear() {
+    queue.clear();
+    queueStats = DrawQueueStats {};
+}
+
+template <typename Function>
+void DrawQueue::forEachBlock(std::size_t blocks, const Function& function) {
+    if (blocks == 1) {
+        function(0);
+        return;
+    }
+    pool->run(blocks, function);
+}
+
+void DrawQueue::sort() {
+    std::size_t n = queue.size();
+    queueStats.radixPasses = 0;
+    if (n < 2) {
+        queueStats.sorted = queueStats.submitted;
+        return;
+    }
+
+    std::size_t blocks = pool && n >= parallelThreshold ? pool->threadCount() : 1;
+    auto blockBegin = [n, blocks](std::size_t block) { return n * block / blocks; };
+    scratch.resize(n);
+
+    // Digit totals don't depend on order, so one read up front finds the bytes every key shares.
+    std::vector<std::array<std::size_t, radix * keyBytes>> totals(blocks);
+    forEachBlock(blocks, [&](std::size_t block) {
+        std::array<std::size_t, radix * keyBytes>& total = totals[block];
+        total.fill(0);
+        for (std::size_t i = blockBegin(block); i < blockBegin(block + 1); i++) {
+            for (std::uint32_t byte = 0; byte < keyBytes; byte++) {
+                total[byte * radix + ((queue[i].key >> (byte * 8)) & 0xff)]++;
+            }
+        }
+    });
+
+    Item* source = queue.data();
+    Item* destination = scratch.data();
+    counts.resize(blocks * radix);
+
+    for (std::uint32_t byte = 0; byte < keyBytes; byte++) {
+        std::uint32_t shift = byte * 8;
+        std::size_t firstDigit = (queue.front().key >> shift) & 0xff;
+        std::size_t keysWithFirstDigit = 0;
+        for (std::size_t block = 0; block < blocks; block++) {
+            keysWithFirstDigit += totals[block][byte * radix + firstDigit];
+        }
+        if (keysWithFirstDigit == n) {
+            continue;
+        }
+
+        forEachBlock(blocks, [&](std::size_t block) {
+            std::size_t* count = &counts[block * radix];
+            std::fill(count, count + radix, 0);
+            for (std::size_t i = blockBegin(block); i < blockBegin(block + 1); i++) {
+                count[(source[i].key >> shift) & 0xff]++;
+            }
+        });
+
+        // Digit-major, block-minor offsets keep equal digits in their original order.
+        std::size_t offset = 0;
+        for (std::size_t digit = 0; digit < radix; digit++) {
+            for (std::size_t block = 0; block < blocks; block++) {
+                std::size_t count = counts[block * radix + digit];
+                counts[block * radix + digit] = offset;
+                offset += count;
+            }
+        }
+
+        forEachBlock(blocks, [&](std::size_t block) {
+            std::size_t* next = &counts[block * radix];
+            for (std::size_t i = blockBegin(block); i < blockBegin(block + 1); i++) {
+                destination[next[(source[i].key >> shift) & 0xff]++] = source[i];
+            }
+        });
+
+        std::swap(source, destination);
+        queueStats.radixPasses++;
+    }
+
+    if (source != queue.data()) {
+        queue.swap(scratch);
+    }
+    queueStats.sorted = countStateChanges(queue);
+}
@@ -0,0 +1,100 @@
+//
+//  draw_queue.hpp
+//  Metal-Guide
+//
+
+#pragma once
+
+#include "work_stealing_pool.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// 64-bit draw sort key, most significant field first: pass, pipeline, material, depth. Sorting by key groups draws by
+// pass, then by pipeline and material so each is bound once per run, and orders each run by depth.
+struct DrawKey {
+    static constexpr std::uint32_t passBits = 8;
+    static constexpr std::uint32_t pipelineBits = 12;
+    static constexpr std::uint32_t materialBits = 20;
+    static constexpr std::uint32_t depthBits = 24;
+
+    static constexpr std::uint32_t depthShift = 0;
+    static constexpr std::uint32_t materialShift = depthShift + depthBits;
+    static constexpr std::uint32_t pipelineShift = materialShift + materialBits;
+    static constexpr std::uint32_t passShift = pipelineShift + pipelineBits;
+
+    static std::uint64_t make(std::uint32_t pass, std::uint32_t pipeline, std::uint32_t material, std::uint32_t depth);
+
+    // depth is normalized to [0, 1]; back-to-front inverts it, for blended passes.
+    static std::uint32_t quantizeDepth(float depth, bool backToFront = false);
+
+    static std::uint32_t pass(std::uint64_t key) { return field(key, passShift, passBits); }
+    static std::uint32_t pipeline(std::uint64_t key) { return field(key, pipelineShift, pipelineBits); }
+    static std::uint32_t material(std::uint64_t key) { return field(key, materialShift, materialBits); }
+    static std::uint32_t depth(std::uint64_t key) { return field(key, depthShift, depthBits); }
+
+private:
+    static std::uint32_t field(std::uint64_t key, std::uint32_t shift, std::uint32_t bits) {
+        return static_cast<std::uint32_t>((key >> shift) & ((std::uint64_t(1) << bits) - 1));
+    }
+};
+
+// Times a sequence of draws switches pass, pipeline and material; the first draw counts as a switch of each.
+struct DrawStateChanges {
+    std::uint64_t passes = 0;
+    std::uint64_t pipelines = 0;
+    std::uint64_t materials = 0;
+};
+
+struct DrawQueueStats {
+    std::uint64_t items = 0;
+    DrawStateChanges submitted;
+    DrawStateChanges sorted;
+    // Byte passes the last sort() needed; bytes every key shares are skipped.
+    std::uint32_t radixPasses = 0;
+};
+
+// Draws collected in traversal order, then sorted by key before submission. The payload is the caller's, usually an
+// index into its own draw records. sort() is a stable LSD radix sort over the key bytes; with a pool, each pass is
+// split into one block per thread, with per-block histograms so the scatter stays stable.
+class DrawQueue {
+public:
+    struct Item {
+        std::uint64_t key;
+        std::uint32_t payload;
+    };
+
+    // Queues smaller than parallelThreshold are sorted on the calling thread.
+    explicit DrawQueue(WorkStealingPool* pool = nullptr, std::size_t parallelThreshold = 16 * 1024);
+
+    void push(std::uint64_t key, std::uint32_t payload);
+    void sort();
+    // Empties the queue and its stats but keeps the memory.
+    void clear();
+
+    const std::vector<Item>& items() const { return queue; }
+    std::size_t size() const { return queue.size(); }
+    const DrawQueueStats& stats() const { return queueStats; }
+
+    static DrawStateChanges countStateChanges(const std::vector<Item>& items);
+
+private:
+    static constexpr std::size_t radix = 256;
+    static constexpr std::uint32_t keyBytes = 8;
+
+    static void countChange(std::uint64_t key, const std::uint64_t* previous, DrawStateChanges& changes);
+
+    template <typename Function>
+    void forEachBlock(std::size_t blocks, const Function& function);
+
+    WorkStealingPool* pool;
+    std::size_t parallelThreshold;
+
+    std::vector<Item> queue;
+    std::vector<Item> scratch;
+    // blocks * radix counts, reused between passes and frames.
+    std::vector<std::size_t> counts;
+
+    DrawQueueStats queueStats;
+};
@@ -0,0 +1,39 @@
+//
+//  frame_pacer.cpp
+//  Metal-Guide
+//
+
+#include "frame_pacer.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+FramePacer::FramePacer(std::uint32_t framesInFlight) {
+    setFramesInFlight(framesInFlight);
+}
+
+void FramePacer::setFramesInFlight(std::uint32_t framesInFlight) {
+    assert(framesInFlight >= minFramesInFlight && framesInFlight <= maxFramesInFlight);
+    latency = framesInFlight;
+}
+
+void FramePacer::observe(std::uint64_t signaledValue) {
+    // Nothing past the last submitted frame can have been signaled by this pacer's frames.
+    completed = std::max(completed, std::min(signaledValue, submitted));
+}
+
+std::uint64_t FramePacer::requiredValue() const {
+    std::uint64_t next = submitted + 1;
+    return next > latency ? next - latency : 0;
+}
+
+std::uint64_t FramePacer::beginFrame(bool blocked) {
+    assert(canBeginFrame());
+    submitted++;
+    pacerStats.frames++;
+    if (blocked) {
+        pacerStats.blockedFrames++;
+    }
+    pacerStats.maxFramesPending = std::max(pacerStats.maxFramesPending, framesPending());
+    return submitted;
+}
@@ -0,0 +1,56 @@
+//
+//  frame_pacer.hpp
+//  Metal-Guide
+//
+
+#pragma once
+
+#include <cstdint>
+
+struct FramePacerStats {
+    std::uint64_t frames = 0;
+    // Frames that could not begin on the first check and had to wait for the GPU.
+    std::uint64_t blockedFrames = 0;
+    std::uint32_t maxFramesPending = 0;
+};
+
+// Decides when the CPU may start another frame, given the value the GPU has signaled on a timeline. Frame n signals
+// value n once the GPU has finished it, and may begin once frame n - framesInFlight has, so the CPU runs at most
+// framesInFlight frames ahead without ever waiting for the frame it just submitted. Values only count up, so a stale
+// observation is harmless.
+//
+// Knows nothing about events or clocks: feed it signaledValue() from a SharedEvent, or from a simulated GPU.
+class FramePacer {
+public:
+    static constexpr std::uint32_t minFramesInFlight = 1;
+    static constexpr std::uint32_t maxFramesInFlight = 3;
+
+    explicit FramePacer(std::uint32_t framesInFlight = 2);
+
+    // Applies from the next frame on. Lowering it makes the next frame wait for more of the ones already submitted.
+    void setFramesInFlight(std::uint32_t framesInFlight);
+    std::uint32_t framesInFlight() const { return latency; }
+
+    void observe(std::uint64_t signaledValue);
+
+    // Value that has to be signaled before the next frame can begin; 0 when it can begin regardless.
+    std::uint64_t requiredValue() const;
+    bool canBeginFrame() const { return completed >= requiredValue(); }
+
+    // Starts the next frame, which canBeginFrame() must allow, and returns the value it signals. blocked says whether
+    // the caller had to wait for it, and only feeds the stats.
+    std::uint64_t beginFrame(bool blocked = false);
+
+    std::uint64_t submittedValue() const { return submitted; }
+    std::uint64_t completedValue() const { return completed; }
+    std::uint32_t framesPending() const { return static_cast<std::uint32_t>(submitted - completed); }
+
+    const FramePacerStats& stats() const { return pacerStats; }
+
+private:
+    std::uint32_t latency;
+    std::uint64_t submitted = 0;
+    std::uint64_t completed = 0;
+
+    FramePacerStats pacerStats;
+};
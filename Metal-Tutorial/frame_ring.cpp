@@ -0,0 +1,109 @@
+//
+//  frame_ring.cpp
+//  Metal-Guide
+//
+
+#include "frame_ring.hpp"
+
+#include <cassert>
+
+FrameRing::FrameRing(std::size_t regionSize, std::size_t regionCount)
+    : bytesPerRegion(regionSize), regionUsers(regionCount, 0), regionOrder(regionCount) {
+    assert(regionSize > 0 && regionCount > 0);
+    for (std::size_t region = 0; region < regionCount; region++) {
+        regionOrder[region] = region;
+    }
+}
+
+std::uint64_t FrameRing::completedFrames() const {
+    std::lock_guard<std::mutex> lock(completionMutex);
+    return completed;
+}
+
+bool FrameRing::regionReady() const {
+    std::uint64_t user = nextRegionUser();
+    return user == 0 || completedFrames() >= user;
+}
+
+std::uint64_t FrameRing::beginFrame() {
+    assert(!frameOpen);
+
+    if (!regionReady()) {
+        ringStats.stalls++;
+        waitForFrame(nextRegionUser() - 1);
+    }
+
+    nextRegionUser() = nextFrame + 1;
+    currentRegion = regionOrder[orderCursor];
+    orderCursor = (orderCursor + 1) % regionOrder.size();
+
+    regionBegin = currentRegion * bytesPerRegion;
+    regionEnd = regionBegin + bytesPerRegion;
+    cursor = regionBegin;
+    frameOpen = true;
+
+    ringStats.frames++;
+    return nextFrame;
+}
+
+std::optional<std::size_t> FrameRing::allocate(std::size_t size, std::size_t alignment) {
+    assert(frameOpen);
+    assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+    std::size_t offset = (cursor + alignment - 1) & ~(alignment - 1);
+    if (offset > regionEnd || size > regionEnd - offset) {
+        ringStats.failedAllocations++;
+        return std::nullopt;
+    }
+
+    cursor = offset + size;
+    ringStats.allocations++;
+    ringStats.allocatedBytes += size;
+    return offset;
+}
+
+std::uint64_t FrameRing::endFrame() {
+    assert(frameOpen);
+    frameOpen = false;
+    return nextFrame++;
+}
+
+void FrameRing::completeFrame(std::uint64_t serial) {
+    // Notified under the lock: a waiter that sees the frame complete may destroy the ring as soon as it can take the
+    // lock, so the condition variable has to be left alone by then.
+    std::lock_guard<std::mutex> lock(completionMutex);
+    if (serial + 1 > completed) {
+        completed = serial + 1;
+    }
+    completionCondition.notify_all();
+}
+
+void FrameRing::waitForFrame(std::uint64_t serial) {
+    std::unique_lock<std::mutex> lock(completionMutex);
+    completionCondition.wait(lock, [&] { return completed > serial; });
+}
+
+bool FrameRing::growIfFull(std::size_t maxRegions) {
+    if (regionUsers.size() >= maxRegions || regionReady()) {
+        return false;
+    }
+
+    // The new region goes last in memory but first in line, and the busy region it stood in for comes after it.
+    regionOrder.insert(regionOrder.begin() + static_cast<std::ptrdiff_t>(orderCursor), regionUsers.size());
+    regionUsers.push_back(0);
+    ringStats.regionsAdded++;
+    return true;
+}
+
+void FrameRing::reset(std::size_t regionSize) {
+    assert(regionSize > 0);
+    bytesPerRegion = regionSize;
+
+    // An open frame continues at the start of its region in the new memory.
+    if (frameOpen) {
+        regionBegin = currentRegion * bytesPerRegion;
+        regionEnd = regionBegin + bytesPerRegion;
+        cursor = regionBegin;
+    }
+    ringStats.resets++;
+}
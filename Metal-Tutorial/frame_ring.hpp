@@ -0,0 +1,98 @@
+//
+//  frame_ring.hpp
+//  Metal-Guide
+//
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+struct FrameRingStats {
+    std::uint64_t frames = 0;
+    std::uint64_t allocations = 0;
+    std::uint64_t allocatedBytes = 0;
+    std::uint64_t failedAllocations = 0;
+    std::uint64_t stalls = 0;
+    std::uint64_t resets = 0;
+    std::uint64_t regionsAdded = 0;
+};
+
+// Offset bookkeeping for a buffer split into regionCount equal regions, one per frame in flight. Frames take the regions
+// in turn and bump-allocate from theirs, and a frame may only start once the last frame that used its region has
+// completed on the GPU, so no more than regionCount frames are ever in flight. Knows nothing about the memory itself,
+// so any CPU or GPU buffer can sit behind it.
+//
+// beginFrame, allocate and endFrame belong to the thread that records frames. completeFrame may be called from any
+// thread, typically a command buffer completion handler.
+class FrameRing {
+public:
+    FrameRing(std::size_t regionSize, std::size_t regionCount);
+
+    std::size_t regionSize() const { return bytesPerRegion; }
+    std::size_t regionCount() const { return regionUsers.size(); }
+    std::size_t capacity() const { return bytesPerRegion * regionUsers.size(); }
+
+    // True when the next frame's region is no longer read by the GPU, so beginFrame() would not block.
+    bool regionReady() const;
+
+    // Starts the next frame, blocking until its region is free. Returns the frame's serial.
+    std::uint64_t beginFrame();
+
+    // Aligned bump allocation in the current frame's region. Returns the offset from the start of the buffer, or
+    // nothing when the region is full. alignment must be a power of two.
+    std::optional<std::size_t> allocate(std::size_t size, std::size_t alignment);
+
+    // Closes the current frame. Pass the returned serial to completeFrame() once the GPU is done with it.
+    std::uint64_t endFrame();
+
+    // Frames complete in the order they were submitted.
+    void completeFrame(std::uint64_t serial);
+
+    // Blocks until every frame up to and including serial has completed.
+    void waitForFrame(std::uint64_t serial);
+
+    // Number of frames the GPU has finished, which is also the serial of the oldest frame still in flight.
+    std::uint64_t completedFrames() const;
+
+    // Adds a free region, used by the next frame, when the next region is still in flight and the ring has fewer than
+    // maxRegions. Returns whether it grew; the caller then moves to backing memory of the new capacity(). Past
+    // maxRegions, beginFrame() blocks as usual.
+    bool growIfFull(std::size_t maxRegions);
+
+    // Switches to fresh backing memory with a new region size. Each region stays busy until the frame that last used
+    // it completes, even though that frame reads the old memory, so a reset never lets the CPU run further ahead.
+    void reset(std::size_t regionSize);
+
+    std::size_t frameUsedBytes() const { return cursor - regionBegin; }
+    const FrameRingStats& stats() const { return ringStats; }
+
+private:
+    // The frame serial plus one of the last frame each region held, 0 for none.
+    std::uint64_t& nextRegionUser() { return regionUsers[regionOrder[orderCursor]]; }
+    std::uint64_t nextRegionUser() const { return regionUsers[regionOrder[orderCursor]]; }
+
+    std::size_t bytesPerRegion;
+    std::vector<std::uint64_t> regionUsers;
+    // Region indices in the order frames take them; a region added by growIfFull() is inserted at the cursor.
+    std::vector<std::size_t> regionOrder;
+    std::size_t orderCursor = 0;
+    std::size_t currentRegion = 0;
+
+    std::uint64_t nextFrame = 0;
+    bool frameOpen = false;
+
+    std::size_t regionBegin = 0;
+    std::size_t regionEnd = 0;
+    std::size_t cursor = 0;
+
+    mutable std::mutex completionMutex;
+    std::condition_variable completionCondition;
+    std::uint64_t completed = 0;
+
+    FrameRingStats ringStats;
+};
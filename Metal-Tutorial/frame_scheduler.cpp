@@ -0,0 +1,82 @@
+//
+//  frame_scheduler.cpp
+//  Metal-Guide
+//
+
+#include "frame_scheduler.hpp"
+
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+namespace {
+
+// Shared with the listener callback, which may run after the waiter gave up on it.
+struct Waiter {
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool signaled = false;
+};
+
+}
+
+FrameScheduler::FrameScheduler(MTL::Device* device, std::uint32_t framesInFlight)
+    : sharedEvent(device->newSharedEvent()), listener(MTL::SharedEventListener::alloc()->init()), pacer(framesInFlight) {
+    assert(sharedEvent && listener);
+    sharedEvent->setLabel(MTLSTR("Frame Event"));
+}
+
+FrameScheduler::~FrameScheduler() {
+    waitForValue(endedValue);
+    listener->release();
+    sharedEvent->release();
+}
+
+std::uint64_t FrameScheduler::beginFrame() {
+    assert(!frameOpen);
+    pacer.observe(sharedEvent->signaledValue());
+
+    bool blocked = !pacer.canBeginFrame();
+    if (blocked) {
+        auto start = std::chrono::steady_clock::now();
+        waitForValue(pacer.requiredValue());
+        waitSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        pacer.observe(sharedEvent->signaledValue());
+    }
+
+    frameOpen = true;
+    return pacer.beginFrame(blocked);
+}
+
+void FrameScheduler::endFrame(MTL::CommandBuffer* commandBuffer) {
+    assert(frameOpen);
+    endedValue = pacer.submittedValue();
+    commandBuffer->encodeSignalEvent(sharedEvent, endedValue);
+    frameOpen = false;
+}
+
+void FrameScheduler::notify(std::uint64_t value, const std::function<void(std::uint64_t value)>& function) {
+    sharedEvent->notifyListener(listener, value, [function](MTL::SharedEvent*, std::uint64_t signaledValue) {
+        function(signaledValue);
+    });
+}
+
+void FrameScheduler::waitForValue(std::uint64_t value) {
+    // A value no ended frame signals would never arrive.
+    assert(value <= endedValue);
+    if (isComplete(value)) {
+        return;
+    }
+
+    auto waiter = std::make_shared<Waiter>();
+    sharedEvent->notifyListener(listener, value, [waiter](MTL::SharedEvent*, std::uint64_t) {
+        std::lock_guard<std::mutex> lock(waiter->mutex);
+        waiter->signaled = true;
+        waiter->condition.notify_all();
+    });
+
+    std::unique_lock<std::mutex> lock(waiter->mutex);
+    waiter->condition.wait(lock, [&waiter] { return waiter->signaled; });
+}
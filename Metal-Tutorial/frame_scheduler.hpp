@@ -0,0 +1,63 @@
+//
+//  frame_scheduler.hpp
+//  Metal-Guide
+//
+
+#pragma once
+
+#include <Metal/Metal.hpp>
+
+#include "frame_pacer.hpp"
+
+#include <cstdint>
+#include <functional>
+
+struct FrameSchedulerStats {
+    FramePacerStats pacing;
+    // Time beginFrame() spent blocked on the GPU.
+    double waitSeconds = 0.0;
+};
+
+// Bounds the frames in flight with a SharedEvent instead of waitUntilCompleted or a semaphore. Each frame's last
+// command buffer signals the frame's value on the event; beginFrame() only blocks when the GPU is framesInFlight
+// frames behind, and then on notifyListener rather than by polling. Other CPU work can check or wait for a frame's
+// value the same way, and GPU work on other queues can encodeWait on event().
+//
+// beginFrame() and endFrame() belong to the thread that records frames. Pacing decisions are FramePacer's.
+class FrameScheduler {
+public:
+    explicit FrameScheduler(MTL::Device* device, std::uint32_t framesInFlight = 2);
+    // Waits for every submitted frame, so the event outlives any command buffer signaling it.
+    ~FrameScheduler();
+
+    FrameScheduler(const FrameScheduler&) = delete;
+    FrameScheduler& operator=(const FrameScheduler&) = delete;
+
+    // 1 to 3. Applies from the next frame on.
+    void setFramesInFlight(std::uint32_t framesInFlight) { pacer.setFramesInFlight(framesInFlight); }
+    std::uint32_t framesInFlight() const { return pacer.framesInFlight(); }
+
+    // Blocks until the frame can start, then returns the value it will signal.
+    std::uint64_t beginFrame();
+    // Encodes the frame's signal at the end of commandBuffer, which must be the frame's last. Commit it afterwards.
+    void endFrame(MTL::CommandBuffer* commandBuffer);
+
+    bool isComplete(std::uint64_t value) const { return sharedEvent->signaledValue() >= value; }
+    // Blocks until value is signaled. value must belong to a frame that has ended.
+    void waitForValue(std::uint64_t value);
+    void waitForIdle() { waitForValue(pacer.submittedValue()); }
+    // Calls function on the listener's dispatch queue once value is signaled, right away if it already has been.
+    void notify(std::uint64_t value, const std::function<void(std::uint64_t value)>& function);
+
+    MTL::SharedEvent* event() const { return sharedEvent; }
+    std::uint64_t currentValue() const { return pacer.submittedValue(); }
+    FrameSchedulerStats stats() const { return FrameSchedulerStats { pacer.stats(), waitSeconds }; }
+
+private:
+    MTL::SharedEvent* sharedEvent;
+    MTL::SharedEventListener* listener;
+    FramePacer pacer;
+    bool frameOpen = false;
+    std::uint64_t endedValue = 0;
+    double waitSeconds = 0.0;
+};
@@ -0,0 +1,147 @@
+//
+//  heap_defragmenter.cpp
+//  Metal-Guide
+//
+
+#include "heap_defragmenter.hpp"
+
+#include <cassert>
+
+HeapDefragmenter::HeapDefragmenter(PlacementHeapAllocator& allocator, NS::UInteger bytesPerFrame, double sparseThreshold)
+    : allocator(allocator), bytesPerFrame(bytesPerFrame), planner(sparseThreshold) {
+}
+
+HeapDefragmenter::~HeapDefragmenter() {
+    // Owners keep their old buffers; the copies must have completed, or their ranges could be handed out again while
+    // the GPU is still writing to them.
+    for (PendingMove& move : pending) {
+        allocator.free(move.replacement);
+    }
+    for (RetiredBuffer& buffer : retired) {
+        allocator.free(buffer.buffer);
+    }
+}
+
+void HeapDefragmenter::track(HeapBuffer* owner) {
+    assert(*owner);
+    owners.insert(owner);
+}
+
+void HeapDefragmenter::untrack(HeapBuffer* owner) {
+    owners.erase(owner);
+    for (PendingMove& move : pending) {
+        if (move.owner == owner) {
+            move.owner = nullptr;
+        }
+    }
+}
+
+bool HeapDefragmenter::isMoving(const HeapBuffer* owner) const {
+    for (const PendingMove& move : pending) {
+        if (move.owner == owner) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void HeapDefragmenter::finishMoves(std::uint64_t serial) {
+    for (PendingMove& move : pending) {
+        if (!move.owner) {
+            allocator.free(move.replacement);
+            continue;
+        }
+        move.replacement.buffer->setLabel(move.owner->buffer->label());
+        retired.push_back(RetiredBuffer { *move.owner, serial });
+        *move.owner = move.replacement;
+        defragStats.movedBuffers++;
+        defragStats.movedBytes += move.replacement.allocation.size;
+    }
+    pending.clear();
+}
+
+void HeapDefragmenter::releaseRetired(std::uint64_t completed) {
+    std::size_t kept = 0;
+    for (RetiredBuffer& buffer : retired) {
+        if (buffer.serial <= completed) {
+            allocator.free(buffer.buffer);
+        } else {
+            retired[kept++] = buffer;
+        }
+    }
+    if (kept == retired.size()) {
+        return;
+    }
+    retired.resize(kept);
+
+    NS::UInteger heaps = allocator.heapCount();
+    allocator.releaseEmptyHeaps();
+    defragStats.releasedHeaps += heaps - allocator.heapCount();
+}
+
+void HeapDefragmenter::encodeMoves(MTL::CommandBuffer* commandBuffer, std::uint64_t serial) {
+    std::vector<TlsfStats> heapStats;
+    std::vector<TlsfAllocator*> heapAllocators;
+    for (NS::UInteger i = 0; i < allocator.heapCount(); i++) {
+        heapStats.push_back(allocator.heapStats(i));
+        heapAllocators.push_back(&allocator.heapAllocator(i));
+    }
+    std::vector<bool> sources = planner.pickSources(heapStats);
+
+    std::vector<HeapBuffer*> candidates;
+    std::vector<DefragBlock> blocks;
+    for (HeapBuffer* owner : owners) {
+        if (sources[owner->heapIndex]) {
+            MTL::SizeAndAlign sizeAndAlign = allocator.bufferSizeAndAlign(owner->buffer->length());
+            blocks.push_back(DefragBlock { static_cast<std::uint32_t>(candidates.size()), owner->heapIndex, owner->allocation,
+                                           sizeAndAlign.align });
+            candidates.push_back(owner);
+        }
+    }
+    if (blocks.empty()) {
+        return;
+    }
+
+    std::vector<DefragMove> moves = planner.plan(heapAllocators, sources, std::move(blocks), bytesPerFrame);
+    if (moves.empty()) {
+        return;
+    }
+
+    MTL::BlitCommandEncoder* encoder = commandBuffer->blitCommandEncoder();
+    for (const DefragMove& move : moves) {
+        HeapBuffer* owner = candidates[move.owner];
+        NS::UInteger length = owner->buffer->length();
+        HeapBuffer replacement = allocator.newBuffer(length, move.toHeap, move.to);
+        if (!replacement) {
+            continue;
+        }
+        encoder->copyFromBuffer(owner->buffer, 0, replacement.buffer, 0, length);
+        pending.push_back(PendingMove { owner, replacement });
+    }
+    encoder->endEncoding();
+
+    pendingSerial = serial;
+    defragStats.passes++;
+}
+
+void HeapDefragmenter::step(MTL::CommandBuffer* commandBuffer) {
+    std::uint64_t serial = ++stepSerial;
+    std::uint64_t completed = completedSerial->load(std::memory_order_acquire);
+
+    releaseRetired(completed);
+    if (!pending.empty() && pendingSerial <= completed) {
+        // Work committed before this step's command buffer may still read the old buffers.
+        finishMoves(serial);
+    }
+    if (pending.empty()) {
+        encodeMoves(commandBuffer, serial);
+    }
+
+    if (!pending.empty() || !retired.empty()) {
+        std::shared_ptr<std::atomic<std::uint64_t>> shared = completedSerial;
+        commandBuffer->addCompletedHandler([shared, serial](MTL::CommandBuffer*) {
+            // Command buffers on one queue complete in order, so this only ever raises the value.
+            shared->store(serial, std::memory_order_release);
+        });
+    }
+}
@@ -0,0 +1,86 @@
+//
+//  heap_defragmenter.hpp
+//  Metal-Guide
+//
+
+#pragma once
+
+#include <Metal/Metal.hpp>
+
+#include "defrag_planner.hpp"
+#include "placement_heap_allocator.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+struct HeapDefragmenterStats {
+    std::uint64_t passes = 0;
+    std::uint64_t movedBuffers = 0;
+    std::uint64_t movedBytes = 0;
+    std::uint64_t releasedHeaps = 0;
+};
+
+// Compacts the buffers of a PlacementHeapAllocator a little every frame, so sparse heaps drain and get released. Owners
+// register the HeapBuffer they hold with track(); the defragmenter copies a buffer to its new place with a blit and,
+// once the GPU has completed the copy, overwrites the owner's HeapBuffer with the new one. Work committed before that
+// may still read the old buffer, so it is retired, and only freed once the command buffer of the step() that swapped
+// it has completed too.
+//
+// Call step() once per frame, on one queue, with a command buffer committed after the frame's other work. Until the
+// move finishes,
+// isMoving() is true and the buffer must only be read: writes to it would not reach the copy. Only buffers move;
+// textures stay where they are. Destroy the defragmenter only once the GPU is done with the last step(). The choice
+// of moves is DefragPlanner's.
+class HeapDefragmenter {
+public:
+    HeapDefragmenter(PlacementHeapAllocator& allocator, NS::UInteger bytesPerFrame, double sparseThreshold = 0.5);
+    ~HeapDefragmenter();
+
+    HeapDefragmenter(const HeapDefragmenter&) = delete;
+    HeapDefragmenter& operator=(const HeapDefragmenter&) = delete;
+
+    // owner must stay at the same address until untrack(). Untrack before freeing the buffer.
+    void track(HeapBuffer* owner);
+    void untrack(HeapBuffer* owner);
+    bool isMoving(const HeapBuffer* owner) const;
+
+    // Finishes the moves the GPU has completed, then encodes the next batch into commandBuffer if none is in flight.
+    void step(MTL::CommandBuffer* commandBuffer);
+
+    const HeapDefragmenterStats& stats() const { return defragStats; }
+
+private:
+    struct PendingMove {
+        // nullptr once the owner has been untracked.
+        HeapBuffer* owner;
+        HeapBuffer replacement;
+    };
+
+    struct RetiredBuffer {
+        HeapBuffer buffer;
+        // The step() whose command buffer has to complete before the buffer can be freed.
+        std::uint64_t serial;
+    };
+
+    void finishMoves(std::uint64_t serial);
+    void releaseRetired(std::uint64_t completed);
+    void encodeMoves(MTL::CommandBuffer* commandBuffer, std::uint64_t serial);
+
+    PlacementHeapAllocator& allocator;
+    NS::UInteger bytesPerFrame;
+    DefragPlanner planner;
+
+    std::unordered_set<HeapBuffer*> owners;
+    std::vector<PendingMove> pending;
+    std::uint64_t pendingSerial = 0;
+    std::vector<RetiredBuffer> retired;
+
+    // Each step() has a serial; the serial of the last step() whose command buffer completed.
+    std::uint64_t stepSerial = 0;
+    std::shared_ptr<std::atomic<std::uint64_t>> completedSerial = std::make_shared<std::atomic<std::uint64_t>>(0);
+
+    HeapDefragmenterStats defragStats;
+};
@@ -0,0 +1,305 @@
+//
+//  indirect_draw_baker.cpp
+//  Metal-Guide
+//
+
+#include "indirect_draw_baker.hpp"
+
+#include "command_decoder.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <unordered_set>
+
+IndirectDrawBaker::IndirectDrawBaker(MTL::Device* device, NS::UInteger maxVertexBuffers, NS::UInteger maxFragmentBuffers)
+    : device(device), maxVertexBuffers(maxVertexBuffers), maxFragmentBuffers(maxFragmentBuffers) {}
+
+IndirectDrawBaker::~IndirectDrawBaker() {
+    if (indirectCommands) {
+        indirectCommands->release();
+    }
+}
+
+bool IndirectDrawBaker::bake(const CommandList& list) {
+    std::vector<Draw> bakedDraws;
+    std::vector<Binding> bakedBindings;
+    std::vector<CommandList::UseResource> bakedResources;
+    std::vector<CommandList::UseHeap> bakedHeaps;
+
+    const MTL::RenderPipelineState* pipelineState = nullptr;
+    std::vector<Binding> current(maxVertexBuffers + maxFragmentBuffers);
+    bool supported = true;
+
+    auto binding = [&](BindingStage stage, NS::UInteger index) -> Binding* {
+        if (stage == BindingStage::Vertex && index < maxVertexBuffers) {
+            return &current[index];
+        }
+        if (stage == BindingStage::Fragment && index < maxFragmentBuffers) {
+            return &current[maxVertexBuffers + index];
+        }
+        return nullptr;
+    };
+    auto addDraw = [&](bool indexed, const void* payload) {
+        if (!pipelineState || !pipelineState->supportIndirectCommandBuffers()) {
+            supported = false;
+            return;
+        }
+        Draw draw {};
+        draw.pipelineState = pipelineState;
+        draw.indexed = indexed;
+        if (indexed) {
+            draw.indexedPrimitives = payloadAs<CommandList::DrawIndexedPrimitives>(payload);
+        } else {
+            draw.primitives = payloadAs<CommandList::DrawPrimitives>(payload);
+        }
+        bakedDraws.push_back(draw);
+        bakedBindings.insert(bakedBindings.end(), current.begin(), current.end());
+    };
+
+    list.forEach([&](const CommandList::CommandHeader& header, const void* payload) {
+        switch (header.op) {
+        case CommandOp::PushDebugGroup:
+        case CommandOp::PopDebugGroup:
+        case CommandOp::InsertDebugSignpost:
+            break;
+        case CommandOp::UseResource:
+            bakedResources.push_back(payloadAs<CommandList::UseResource>(payload));
+            break;
+        case CommandOp::UseHeap:
+            bakedHeaps.push_back(payloadAs<CommandList::UseHeap>(payload));
+            break;
+        case CommandOp::SetRenderPipelineState:
+            pipelineState = payloadAs<CommandList::SetRenderPipelineState>(payload).pipelineState;
+            break;
+        case CommandOp::SetBuffer: {
+            const auto& command = payloadAs<CommandList::SetBuffer>(payload);
+            if (Binding* slot = binding(command.stage, command.index)) {
+                *slot = Binding { command.buffer, command.offset };
+            } else {
+                supported = false;
+            }
+            break;
+        }
+        case CommandOp::SetBufferOffset: {
+            const auto& command = payloadAs<CommandList::SetBufferOffset>(payload);
+            if (Binding* slot = binding(command.stage, command.index)) {
+                slot->offset = command.offset;
+            } else {
+                supported = false;
+            }
+            break;
+        }
+        case CommandOp::DrawPrimitives:
+            addDraw(false, payload);
+            break;
+        case CommandOp::DrawIndexedPrimitives:
+            addDraw(true, payload);
+            break;
+        default:
+            supported = false;
+            break;
+        }
+    });
+    if (!supported) {
+        return false;
+    }
+
+    NS::UInteger capacity = std::max<NS::UInteger>(bakedDraws.size(), 1);
+    if (!indirectCommands || indirectCommands->size() < capacity) {
+        MTL::IndirectCommandBufferDescriptor* descriptor = MTL::IndirectCommandBufferDescriptor::alloc()->init();
+        descriptor->setCommandTypes(MTL::IndirectCommandTypeDraw | MTL::IndirectCommandTypeDrawIndexed);
+        descriptor->setInheritPipelineState(false);
+        descriptor->setInheritBuffers(false);
+        descriptor->setMaxVertexBufferBindCount(maxVertexBuffers);
+        descriptor->setMaxFragmentBufferBindCount(maxFragmentBuffers);
+
+        MTL::IndirectCommandBuffer* replacement = device->newIndirectCommandBuffer(descriptor, capacity, MTL::ResourceStorageModeShared);
+        descriptor->release();
+        if (!replacement) {
+            return false;
+        }
+        replacement->setLabel(MTLSTR("Baked Draws"));
+        // Command buffers still executing the old one retain it.
+        if (indirectCommands) {
+            indirectCommands->release();
+        }
+        indirectCommands = replacement;
+        executionsInFlight = std::make_shared<std::atomic<std::uint32_t>>(0);
+    }
+
+    draws = std::move(bakedDraws);
+    bindings = std::move(bakedBindings);
+    usedResources = std::move(bakedResources);
+    usedHeaps = std::move(bakedHeaps);
+    commandCount = 0;
+    stale = true;
+    bakerStats.bakedDraws = draws.size();
+    return true;
+}
+
+NS::UInteger IndirectDrawBaker::replaceBuffer(const MTL::Buffer* from, const MTL::Buffer* to) {
+    NS::UInteger replaced = 0;
+    for (NS::UInteger draw = 0; draw < draws.size(); draw++) {
+        bool changed = false;
+        Binding* drawBinding = drawBindings(draw);
+        for (NS::UInteger i = 0; i < maxVertexBuffers + maxFragmentBuffers; i++) {
+            if (drawBinding[i].buffer == from) {
+                drawBinding[i].buffer = to;
+                changed = true;
+            }
+        }
+        if (draws[draw].indexed && draws[draw].indexedPrimitives.indexBuffer == from) {
+            draws[draw].indexedPrimitives.indexBuffer = to;
+            changed = true;
+        }
+        if (changed) {
+            replaced++;
+        }
+    }
+    stale = stale || replaced > 0;
+    return replaced;
+}
+
+NS::UInteger IndirectDrawBaker::replacePipelineState(const MTL::RenderPipelineState* from, const MTL::RenderPipelineState* to) {
+    if (!to->supportIndirectCommandBuffers()) {
+        return 0;
+    }
+    NS::UInteger replaced = 0;
+    for (Draw& draw : draws) {
+        if (draw.pipelineState == from) {
+            draw.pipelineState = to;
+            replaced++;
+        }
+    }
+    stale = stale || replaced > 0;
+    return replaced;
+}
+
+void IndirectDrawBaker::removeDraw(NS::UInteger draw) {
+    assert(draw < draws.size());
+    if (!draws[draw].removed) {
+        draws[draw].removed = true;
+        stale = true;
+    }
+}
+
+template <typename Encoder>
+void IndirectDrawBaker::encodeDraw(Encoder* encoder, NS::UInteger draw) {
+    const Draw& command = draws[draw];
+    const Binding* drawBinding = drawBindings(draw);
+
+    encoder->setRenderPipelineState(command.pipelineState);
+    for (NS::UInteger i = 0; i < maxVertexBuffers; i++) {
+        if (drawBinding[i].buffer) {
+            encoder->setVertexBuffer(drawBinding[i].buffer, drawBinding[i].offset, i);
+        }
+    }
+    for (NS::UInteger i = 0; i < maxFragmentBuffers; i++) {
+        const Binding& fragment = drawBinding[maxVertexBuffers + i];
+        if (fragment.buffer) {
+            encoder->setFragmentBuffer(fragment.buffer, fragment.offset, i);
+        }
+    }
+
+    if (command.indexed) {
+        const CommandList::DrawIndexedPrimitives& indexed = command.indexedPrimitives;
+        encoder->drawIndexedPrimitives(indexed.primitiveType, indexed.indexCount, indexed.indexType, indexed.indexBuffer,
+                                       indexed.indexBufferOffset, indexed.instanceCount, indexed.baseVertex, indexed.baseInstance);
+    } else {
+        const CommandList::DrawPrimitives& primitives = command.primitives;
+        encoder->drawPrimitives(primitives.primitiveType, primitives.vertexStart, primitives.vertexCount,
+                                primitives.instanceCount, primitives.baseInstance);
+    }
+}
+
+void IndirectDrawBaker::collectResources() {
+    std::unordered_set<const MTL::Resource*> seen;
+    resources.clear();
+    auto add = [&](const MTL::Buffer* buffer) {
+        if (buffer && seen.insert(buffer).second) {
+            resources.push_back(buffer);
+        }
+    };
+    for (NS::UInteger draw = 0; draw < draws.size(); draw++) {
+        if (draws[draw].removed) {
+            continue;
+        }
+        const Binding* drawBinding = drawBindings(draw);
+        for (NS::UInteger i = 0; i < maxVertexBuffers + maxFragmentBuffers; i++) {
+            add(drawBinding[i].buffer);
+        }
+        if (draws[draw].indexed) {
+            add(draws[draw].indexedPrimitives.indexBuffer);
+        }
+    }
+}
+
+bool IndirectDrawBaker::update(MTL::CommandBuffer* commandBuffer) {
+    if (!stale) {
+        return true;
+    }
+    if (!indirectCommands || executionsInFlight->load(std::memory_order_acquire) != 0) {
+        return false;
+    }
+
+    // Optimizing moves commands around, so edits rewrite the whole buffer rather than patching commands in place.
+    indirectCommands->reset(NS::Range(0, indirectCommands->size()));
+    commandCount = 0;
+    for (NS::UInteger draw = 0; draw < draws.size(); draw++) {
+        if (!draws[draw].removed) {
+            encodeDraw(indirectCommands->indirectRenderCommand(commandCount++), draw);
+        }
+    }
+    collectResources();
+
+    if (commandCount > 0) {
+        // Drops the state each command repeats from the one before it.
+        MTL::BlitCommandEncoder* encoder = commandBuffer->blitCommandEncoder();
+        encoder->optimizeIndirectCommandBuffer(indirectCommands, NS::Range(0, commandCount));
+        encoder->endEncoding();
+        // The blit rewrites the ICB on the GPU, so the CPU must not touch it again before it's done either.
+        trackUntilCompleted(commandBuffer);
+    }
+
+    stale = false;
+    bakerStats.rewrites++;
+    return true;
+}
+
+void IndirectDrawBaker::execute(MTL::RenderCommandEncoder* encoder, MTL::CommandBuffer* commandBuffer) {
+    for (const CommandList::UseResource& use : usedResources) {
+        encoder->useResource(use.resource, use.usage, use.stages);
+    }
+    for (const CommandList::UseHeap& use : usedHeaps) {
+        encoder->useHeap(use.heap, use.stages);
+    }
+
+    if (stale) {
+        for (NS::UInteger draw = 0; draw < draws.size(); draw++) {
+            if (!draws[draw].removed) {
+                encodeDraw(encoder, draw);
+            }
+        }
+        bakerStats.directExecutions++;
+        return;
+    }
+    if (commandCount == 0) {
+        return;
+    }
+
+    // Buffers bound by ICB commands aren't made resident by the encoder on its own.
+    encoder->useResources(resources.data(), resources.size(), MTL::ResourceUsageRead,
+                          MTL::RenderStageVertex | MTL::RenderStageFragment);
+    encoder->executeCommandsInBuffer(indirectCommands, NS::Range(0, commandCount));
+
+    trackUntilCompleted(commandBuffer);
+    bakerStats.indirectExecutions++;
+}
+
+void IndirectDrawBaker::trackUntilCompleted(MTL::CommandBuffer* commandBuffer) {
+    executionsInFlight->fetch_add(1, std::memory_order_relaxed);
+    std::shared_ptr<std::atomic<std::uint32_t>> inFlight = executionsInFlight;
+    commandBuffer->addCompletedHandler([inFlight](MTL::CommandBuffer*) {
+        inFlight->fetch_sub(1, std::memory_order_release);
+    });
+}
@@ -0,0 +1,110 @@
+//
+//  indirect_draw_baker.hpp
+//  Metal-Guide
+//
+
+#pragma once
+
+#include <Metal/Metal.hpp>
+
+#include "command_list.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+struct IndirectDrawBakerStats {
+    std::uint64_t bakedDraws = 0;
+    std::uint64_t rewrites = 0;
+    std::uint64_t indirectExecutions = 0;
+    // Frames that encoded the draws directly because the bake was stale.
+    std::uint64_t directExecutions = 0;
+};
+
+// Bakes a static draw list, recorded with a RenderCommandRecorder, into an indirect command buffer, so replaying it
+// costs one executeCommandsInBuffer a frame instead of re-encoding every draw.
+//
+// The baker keeps its own copy of the draws. Editing them with replaceBuffer(), replacePipelineState() or removeDraw()
+// marks the bake stale; update() rewrites the ICB and compacts it with optimizeIndirectCommandBuffer, but only once no
+// command buffer executing or compacting it is still in flight, since the CPU writes the commands. Until then
+// execute() encodes the draws directly, so an edit takes effect the same frame and only costs CPU time while it
+// settles.
+//
+// Only pipeline state, vertex and fragment buffers and direct draws can be baked. Fixed-function and depth-stencil
+// state is inherited from the encoder, so set it before execute(). Pipelines must be created with
+// supportIndirectCommandBuffers; bake() and replacePipelineState() refuse any other. Nothing is retained: everything
+// the draws refer to must outlive the baker's use of it.
+class IndirectDrawBaker {
+public:
+    IndirectDrawBaker(MTL::Device* device, NS::UInteger maxVertexBuffers = 8, NS::UInteger maxFragmentBuffers = 8);
+    ~IndirectDrawBaker();
+
+    IndirectDrawBaker(const IndirectDrawBaker&) = delete;
+    IndirectDrawBaker& operator=(const IndirectDrawBaker&) = delete;
+
+    // Replaces the baked draws with the ones in list. Debug markers are dropped and useResource/useHeap calls are
+    // repeated on every execute(). Returns false and keeps the previous bake if the list holds anything else an ICB
+    // can't: bytes, textures, samplers, encoder state, indirect draws or a draw without an ICB-capable pipeline. Draws
+    // are numbered in recorded order.
+    bool bake(const CommandList& list);
+
+    // Points every binding and index buffer using from at to instead, e.g. after HeapDefragmenter moved it. Both return
+    // the number of draws changed; replacePipelineState() changes none if to doesn't support ICBs.
+    NS::UInteger replaceBuffer(const MTL::Buffer* from, const MTL::Buffer* to);
+    NS::UInteger replacePipelineState(const MTL::RenderPipelineState* from, const MTL::RenderPipelineState* to);
+    void removeDraw(NS::UInteger draw);
+
+    // Rewrites a stale ICB if the GPU is done with it, encoding the compaction into commandBuffer, which has to run
+    // before any render pass executing the ICB. Returns whether the bake is current.
+    bool update(MTL::CommandBuffer* commandBuffer);
+
+    // Draws the baked list into encoder, which is left with undefined pipeline and buffer bindings. commandBuffer is
+    // the one encoder belongs to and tells the baker when the GPU is done with the ICB.
+    void execute(MTL::RenderCommandEncoder* encoder, MTL::CommandBuffer* commandBuffer);
+
+    bool isStale() const { return stale; }
+    NS::UInteger drawCount() const { return static_cast<NS::UInteger>(draws.size()); }
+    const IndirectDrawBakerStats& stats() const { return bakerStats; }
+
+private:
+    struct Binding {
+        const MTL::Buffer* buffer = nullptr;
+        NS::UInteger offset = 0;
+    };
+
+    struct Draw {
+        const MTL::RenderPipelineState* pipelineState;
+        bool indexed;
+        bool removed;
+        CommandList::DrawPrimitives primitives;
+        CommandList::DrawIndexedPrimitives indexedPrimitives;
+    };
+
+    // maxVertexBuffers vertex bindings followed by maxFragmentBuffers fragment bindings.
+    Binding* drawBindings(NS::UInteger draw) { return &bindings[draw * (maxVertexBuffers + maxFragmentBuffers)]; }
+
+    template <typename Encoder>
+    void encodeDraw(Encoder* encoder, NS::UInteger draw);
+    void collectResources();
+    // Counts commandBuffer as using the ICB until it completes.
+    void trackUntilCompleted(MTL::CommandBuffer* commandBuffer);
+
+    MTL::Device* device;
+    NS::UInteger maxVertexBuffers;
+    NS::UInteger maxFragmentBuffers;
+
+    std::vector<Draw> draws;
+    std::vector<Binding> bindings;
+    std::vector<CommandList::UseResource> usedResources;
+    std::vector<CommandList::UseHeap> usedHeaps;
+
+    MTL::IndirectCommandBuffer* indirectCommands = nullptr;
+    NS::UInteger commandCount = 0;
+    // Every buffer the written commands use, made resident with one useResources call.
+    std::vector<const MTL::Resource*> resources;
+    bool stale = false;
+    std::shared_ptr<std::atomic<std::uint32_t>> executionsInFlight = std::make_shared<std::atomic<std::uint32_t>>(0);
+
+    IndirectDrawBakerStats bakerStats;
+};
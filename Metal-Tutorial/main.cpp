@@ -7,11 +7,17 @@
 
 #include <iostream>
 
+#include "memory_accounting.hpp"
+
 int main(int argc, const char * argv[]) {
     // insert code here...
+    NS::AutoreleaseScope autoreleaseScope("main");
+    MemoryAccounting::shared().install();
     
     MTL::Device* metalDevice = MTL::CreateSystemDefaultDevice();
     
     std::cout << "Hello, World from Metal-CPP!\n";
+
+    MemoryAccounting::shared().reportLeaks(std::cerr);
     return 0;
 }
@@ -0,0 +1,46 @@
+//
+//  managed_buffer.cpp
+//  Metal-Guide
+//
+
+#include "managed_buffer.hpp"
+
+#include <cassert>
+#include <cstring>
+
+ManagedBuffer::ManagedBuffer(MTL::Buffer* buffer, NS::UInteger mergeGap)
+    : managedBuffer(buffer->retain()), cpuContents(static_cast<std::uint8_t*>(buffer->contents())), length(buffer->length()),
+      dirtyRanges(mergeGap) {
+    assert(buffer->storageMode() == MTL::StorageModeManaged);
+}
+
+ManagedBuffer::~ManagedBuffer() {
+    flush();
+    managedBuffer->release();
+}
+
+void ManagedBuffer::write(NS::UInteger offset, const void* data, NS::UInteger size) {
+    assert(offset + size <= length);
+    std::memcpy(cpuContents + offset, data, size);
+    markDirty(offset, size);
+}
+
+void ManagedBuffer::markDirty(NS::UInteger offset, NS::UInteger size) {
+    assert(offset + size <= length);
+    dirtyRanges.add(offset, offset + size);
+    bufferStats.writes++;
+    bufferStats.writtenBytes += size;
+}
+
+void ManagedBuffer::flush() {
+    if (dirtyRanges.empty()) {
+        return;
+    }
+    dirtyRanges.forEach([this](std::uint64_t begin, std::uint64_t end) {
+        managedBuffer->didModifyRange(NS::Range::Make(begin, end - begin));
+        bufferStats.modifiedRanges++;
+        bufferStats.modifiedBytes += end - begin;
+    });
+    dirtyRanges.clear();
+    bufferStats.flushes++;
+}
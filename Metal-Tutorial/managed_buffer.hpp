@@ -0,0 +1,57 @@
+//
+//  managed_buffer.hpp
+//  Metal-Guide
+//
+
+#pragma once
+
+#include <Metal/Metal.hpp>
+
+#include "dirty_ranges.hpp"
+
+#include <cstdint>
+
+struct ManagedBufferStats {
+    NS::UInteger writes = 0;
+    NS::UInteger writtenBytes = 0;
+    NS::UInteger flushes = 0;
+    NS::UInteger modifiedRanges = 0;
+    NS::UInteger modifiedBytes = 0;
+};
+
+// Tracks CPU writes to a StorageModeManaged buffer and reports them with as few didModifyRange calls as possible.
+// Write through write(), or write to contents() directly and call markDirty(); then call flush() once per frame,
+// before committing the command buffers that read the buffer. Dirty ranges closer than mergeGap bytes are reported
+// as one range.
+class ManagedBuffer {
+public:
+    // Retains buffer.
+    explicit ManagedBuffer(MTL::Buffer* buffer, NS::UInteger mergeGap = 256);
+    ~ManagedBuffer();
+
+    ManagedBuffer(const ManagedBuffer&) = delete;
+    ManagedBuffer& operator=(const ManagedBuffer&) = delete;
+
+    MTL::Buffer* buffer() const { return managedBuffer; }
+    void* contents() const { return cpuContents; }
+
+    void write(NS::UInteger offset, const void* data, NS::UInteger size);
+    void markDirty(NS::UInteger offset, NS::UInteger size);
+
+    // Sends one didModifyRange per dirty range and forgets them.
+    void flush();
+
+    NS::UInteger pendingRanges() const { return static_cast<NS::UInteger>(dirtyRanges.count()); }
+    void setMergeGap(NS::UInteger mergeGap) { dirtyRanges.setMergeGap(mergeGap); }
+
+    const ManagedBufferStats& stats() const { return bufferStats; }
+    void resetStats() { bufferStats = {}; }
+
+private:
+    MTL::Buffer* managedBuffer;
+    std::uint8_t* cpuContents;
+    NS::UInteger length;
+
+    DirtyRanges dirtyRanges;
+    ManagedBufferStats bufferStats;
+};
@@ -0,0 +1,177 @@
+//
+//  memory_accounting.cpp
+//  Metal-Guide
+//
+
+#include "memory_accounting.hpp"
+
+#include <algorithm>
+#include <map>
+
+namespace {
+
+thread_local std::string tagPath;
+
+const char* kindName(MTL::AllocationKind kind) {
+    switch (kind) {
+    case MTL::AllocationKindBuffer:
+        return "buffer";
+    case MTL::AllocationKindTexture:
+        return "texture";
+    case MTL::AllocationKindHeap:
+        return "heap";
+    }
+    return "resource";
+}
+
+NS::String* objectLabel(id object, MTL::AllocationKind kind) {
+    if (kind == MTL::AllocationKindHeap) {
+        return reinterpret_cast<MTL::Heap*>(object)->label();
+    }
+    return reinterpret_cast<MTL::Resource*>(object)->label();
+}
+
+}
+
+#if METALCPP_ALLOCATION_HOOKS
+MemoryTag::MemoryTag(const char* name)
+    : outerLength(tagPath.size()) {
+    if (!tagPath.empty()) {
+        tagPath += '/';
+    }
+    tagPath += name;
+}
+
+MemoryTag::~MemoryTag() {
+    tagPath.resize(outerLength);
+}
+#endif
+
+MemoryAccounting& MemoryAccounting::shared() {
+    static MemoryAccounting accounting;
+    return accounting;
+}
+
+void MemoryAccounting::install(PublishHandler handler) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        publishHandler = handler;
+    }
+    MTL::setAllocationHandler(&MemoryAccounting::onAllocation);
+}
+
+void MemoryAccounting::onAllocation(void* object, MTL::AllocationKind kind, MTL::Heap* heap) {
+    shared().record(object, kind, heap);
+}
+
+void MemoryAccounting::record(void* object, MTL::AllocationKind kind, MTL::Heap* heap) {
+    std::uint64_t bytes = kind == MTL::AllocationKindHeap ? static_cast<MTL::Heap*>(object)->size()
+                                                          : static_cast<MTL::Resource*>(object)->allocatedSize();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    // An address already in the table belonged to an object that has died since the last sweep.
+    Allocation& allocation = live[object];
+    allocation.kind = kind;
+    allocation.inHeap = heap != nullptr;
+    allocation.bytes = bytes;
+    allocation.tag = tagPath;
+    allocation.label.clear();
+    objc_storeWeak(&allocation.object, reinterpret_cast<id>(object));
+}
+
+void MemoryAccounting::sweep() {
+    // objc_loadWeak autoreleases what it returns.
+    NS::AutoreleaseScope autoreleaseScope("MemoryAccounting");
+    for (auto it = live.begin(); it != live.end();) {
+        Allocation& allocation = it->second;
+        id object = objc_loadWeak(&allocation.object);
+        if (!object) {
+            it = live.erase(it);
+            continue;
+        }
+        // Labels can be set or changed at any time, so read them every sweep. Most are stored as contiguous UTF-8 and
+        // compare without a copy; the string is only reassigned when the label changed.
+        char buffer[256];
+        NS::String* label = objectLabel(object, allocation.kind);
+        std::string_view current = label ? label->utf8View(buffer) : std::string_view();
+        if (current != allocation.label) {
+            allocation.label.assign(current);
+        }
+        ++it;
+    }
+}
+
+std::string MemoryAccounting::path(const Allocation& allocation) const {
+    if (allocation.tag.empty()) {
+        return allocation.label.empty() ? std::string("(untagged)") : allocation.label;
+    }
+    return allocation.label.empty() ? allocation.tag : allocation.tag + '/' + allocation.label;
+}
+
+std::vector<MemoryTotal> MemoryAccounting::totals() {
+    std::lock_guard<std::mutex> lock(mutex);
+    sweep();
+    return sum();
+}
+
+std::vector<MemoryTotal> MemoryAccounting::sum() const {
+    std::map<std::string, MemoryTotal> byLabel;
+    for (const auto& entry : live) {
+        const Allocation& allocation = entry.second;
+        std::string label = path(allocation);
+        // Every prefix ending at a '/' gets the allocation too, and so does the full label.
+        for (std::size_t end = label.find('/'); ; end = label.find('/', end + 1)) {
+            std::string prefix = label.substr(0, end);
+            MemoryTotal& total = byLabel[prefix];
+            total.label = prefix;
+            (allocation.inHeap ? total.heapBytes : total.bytes) += allocation.bytes;
+            total.allocations++;
+            if (end == std::string::npos) {
+                break;
+            }
+        }
+    }
+
+    std::vector<MemoryTotal> result;
+    result.reserve(byLabel.size());
+    for (auto& entry : byLabel) {
+        result.push_back(std::move(entry.second));
+    }
+    return result;
+}
+
+void MemoryAccounting::endFrame() {
+    PublishHandler handler;
+    std::uint64_t publishedFrame;
+    std::vector<MemoryTotal> frameTotals;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        publishedFrame = ++frame;
+        handler = publishHandler;
+        sweep();
+        if (handler) {
+            frameTotals = sum();
+        }
+    }
+    // Called without the lock, so the handler may create resources or ask for totals itself.
+    if (handler) {
+        handler(publishedFrame, frameTotals);
+    }
+}
+
+std::size_t MemoryAccounting::reportLeaks(std::ostream& out) {
+    std::lock_guard<std::mutex> lock(mutex);
+    sweep();
+
+    std::vector<std::pair<std::string, const Allocation*>> leaks;
+    for (const auto& entry : live) {
+        leaks.emplace_back(path(entry.second), &entry.second);
+    }
+    std::sort(leaks.begin(), leaks.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    for (const auto& leak : leaks) {
+        out << "GPU memory leak: " << leak.first << " (" << kindName(leak.second->kind) << ", " << leak.second->bytes << " bytes"
+            << (leak.second->inHeap ? ", in heap" : "") << ")\n";
+    }
+    return leaks.size();
+}
@@ -0,0 +1,95 @@
+//
+//  memory_accounting.hpp
+//  Metal-Guide
+//
+
+#pragma once
+
+#include <Metal/Metal.hpp>
+
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+struct MemoryTotal {
+    std::string label;
+    // Standalone buffers and textures, and heaps.
+    std::uint64_t bytes = 0;
+    // Resources placed in heaps. Their memory is already part of the heap's bytes, wherever that heap is labelled.
+    std::uint64_t heapBytes = 0;
+    std::uint64_t allocations = 0;
+};
+
+// Labels the allocations made on this thread while it is alive. Tags nest, so a "terrain" tag inside a "world" tag
+// gives "world/terrain".
+class MemoryTag {
+public:
+#if METALCPP_ALLOCATION_HOOKS
+    explicit MemoryTag(const char* name);
+    ~MemoryTag();
+#else
+    explicit MemoryTag(const char*) {}
+#endif
+
+    MemoryTag(const MemoryTag&) = delete;
+    MemoryTag& operator=(const MemoryTag&) = delete;
+
+#if METALCPP_ALLOCATION_HOOKS
+private:
+    std::size_t outerLength;
+#endif
+};
+
+// Attributes the memory of every buffer, texture and heap the device or a heap creates to a hierarchical label: the
+// enclosing MemoryTags, then the object's own label once setLabel has been called. Totals roll up along "/", so
+// "world" also counts everything under "world/terrain".
+//
+// Relies on the METALCPP_ALLOCATION_HOOKS allocation handler; when that is compiled out, no allocation is seen and
+// MemoryTag is empty. Objects are held weakly, and the ones that died are dropped on the next endFrame().
+class MemoryAccounting {
+public:
+    using PublishHandler = void (*)(std::uint64_t frame, const std::vector<MemoryTotal>& totals);
+
+    static MemoryAccounting& shared();
+
+    // Starts recording. handler, if any, receives the totals at every endFrame().
+    void install(PublishHandler handler = nullptr);
+
+    void endFrame();
+
+    // Sorted by label, so every label comes right before its children.
+    std::vector<MemoryTotal> totals();
+
+    // Writes every allocation still alive, typically at shutdown once everything should have been released. Returns
+    // how many there were.
+    std::size_t reportLeaks(std::ostream& out);
+
+private:
+    struct Allocation {
+        // Weak reference slot, registered with the Objective-C runtime, so it must not move.
+        id object = nullptr;
+        MTL::AllocationKind kind;
+        bool inHeap;
+        std::uint64_t bytes;
+        std::string tag;
+        std::string label;
+    };
+
+    static void onAllocation(void* object, MTL::AllocationKind kind, MTL::Heap* heap);
+
+    void record(void* object, MTL::AllocationKind kind, MTL::Heap* heap);
+    // These expect mutex to be held.
+    void sweep();
+    std::vector<MemoryTotal> sum() const;
+    std::string path(const Allocation& allocation) const;
+
+    // Guards everything below; allocations are recorded on whichever thread creates them.
+    std::mutex mutex;
+    std::unordered_map<void*, Allocation> live;
+    PublishHandler publishHandler = nullptr;
+    std::uint64_t frame = 0;
+};
@@ -0,0 +1,45 @@
+//
+//  parallel_draw_encoder.cpp
+//  Metal-Guide
+//
+
+#include "parallel_draw_encoder.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+ParallelDrawEncoder::ParallelDrawEncoder(WorkStealingPool& pool, std::size_t minDrawsPerChunk, std::size_t chunksPerThread)
+    : pool(pool), minDrawsPerChunk(minDrawsPerChunk), chunksPerThread(chunksPerThread) {
+    assert(minDrawsPerChunk > 0 && chunksPerThread > 0);
+}
+
+std::size_t ParallelDrawEncoder::chunkCount(std::size_t drawCount) const {
+    std::size_t bySize = std::max<std::size_t>(drawCount / minDrawsPerChunk, 1);
+    return std::min(bySize, pool.threadCount() * chunksPerThread);
+}
+
+void ParallelDrawEncoder::encode(MTL::ParallelRenderCommandEncoder* parallelEncoder, std::size_t drawCount,
+                                 const EncodeChunk& encodeChunk) {
+    if (drawCount == 0) {
+        return;
+    }
+    std::size_t chunks = chunkCount(drawCount);
+
+    // Creation order is execution order, so this stays on the calling thread.
+    std::vector<MTL::RenderCommandEncoder*> encoders(chunks);
+    for (std::size_t chunk = 0; chunk < chunks; chunk++) {
+        encoders[chunk] = parallelEncoder->renderCommandEncoder();
+        assert(encoders[chunk]);
+    }
+
+    pool.run(chunks, [&](std::size_t chunk) {
+        // The pool's threads live as long as the pool and have no autorelease pool of their own, so anything Metal
+        // autoreleases while encoding would otherwise never be freed.
+        NS::AutoreleaseScope autoreleaseScope("ParallelDrawEncoder");
+        std::size_t begin = drawCount * chunk / chunks;
+        std::size_t end = drawCount * (chunk + 1) / chunks;
+        encodeChunk(encoders[chunk], begin, end);
+        encoders[chunk]->endEncoding();
+    });
+}
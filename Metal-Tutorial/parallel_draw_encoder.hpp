@@ -0,0 +1,38 @@
+//
+//  parallel_draw_encoder.hpp
+//  Metal-Guide
+//
+
+#pragma once
+
+#include <Metal/Metal.hpp>
+
+#include "work_stealing_pool.hpp"
+
+#include <cstddef>
+#include <functional>
+
+// Encodes a sorted draw list through a ParallelRenderCommandEncoder. The list is split into contiguous chunks, each
+// with its own sub-encoder, and the chunks are encoded on a WorkStealingPool. The GPU runs sub-encoders in the order
+// they were created rather than the order they were finished, so creating them all up front in list order keeps the
+// submitted work identical from run to run however the threads are scheduled.
+class ParallelDrawEncoder {
+public:
+    // Encodes draws [begin, end) of the list. Every sub-encoder starts from default state, so this has to set all the
+    // state its draws rely on, not just the changes since the previous draw. Must not end the encoder.
+    using EncodeChunk = std::function<void(MTL::RenderCommandEncoder* encoder, std::size_t begin, std::size_t end)>;
+
+    // Chunks hold at least minDrawsPerChunk draws, since each sub-encoder has a fixed cost, and there are at most
+    // chunksPerThread per pool thread, which leaves enough small chunks around for idle threads to steal.
+    ParallelDrawEncoder(WorkStealingPool& pool, std::size_t minDrawsPerChunk = 256, std::size_t chunksPerThread = 4);
+
+    // Encodes drawCount draws and ends every sub-encoder. parallelEncoder itself is left open for the caller to end.
+    void encode(MTL::ParallelRenderCommandEncoder* parallelEncoder, std::size_t drawCount, const EncodeChunk& encodeChunk);
+
+    std::size_t chunkCount(std::size_t drawCount) const;
+
+private:
+    WorkStealingPool& pool;
+    std::size_t minDrawsPerChunk;
+    std::size_t chunksPerThread;
+};
@@ -0,0 +1,129 @@
+//
+//  placement_heap_allocator.cpp
+//  Metal-Guide
+//
+
+#include "placement_heap_allocator.hpp"
+
+#include <cassert>
+
+PlacementHeapAllocator::PlacementHeapAllocator(MTL::Device* device, MTL::StorageMode storageMode, NS::UInteger heapSize)
+    : device(device), heapStorageMode(storageMode), defaultHeapSize(heapSize) {
+    // What heap->resourceOptions() reports for a placement heap: its storage mode (at MTLResourceStorageModeShift)
+    // and untracked hazards. Computed here so sizes can be queried even when the first heap can't be created.
+    resourceOptions = (MTL::ResourceOptions(storageMode) << 4) | MTL::ResourceHazardTrackingModeUntracked;
+    addHeap(heapSize);
+}
+
+PlacementHeapAllocator::~PlacementHeapAllocator() {
+    for (auto& placementHeap : heaps) {
+        placementHeap.heap->release();
+    }
+}
+
+HeapBuffer PlacementHeapAllocator::newBuffer(NS::UInteger length) {
+    HeapBuffer result;
+    result.heapIndex = place(device->heapBufferSizeAndAlign(length, resourceOptions), result.allocation);
+    if (result.heapIndex == noHeap) {
+        return HeapBuffer {};
+    }
+    result.buffer = heaps[result.heapIndex].heap->newBuffer(length, resourceOptions, result.allocation.offset);
+    if (!result.buffer) {
+        heaps[result.heapIndex].allocator.free(result.allocation);
+        return HeapBuffer {};
+    }
+    return result;
+}
+
+HeapBuffer PlacementHeapAllocator::newBuffer(NS::UInteger length, std::uint32_t heapIndex, const TlsfAllocation& allocation) {
+    HeapBuffer result;
+    result.heapIndex = heapIndex;
+    result.allocation = allocation;
+    result.buffer = heaps[heapIndex].heap->newBuffer(length, resourceOptions, allocation.offset);
+    if (!result.buffer) {
+        heaps[heapIndex].allocator.free(allocation);
+        return HeapBuffer {};
+    }
+    return result;
+}
+
+MTL::SizeAndAlign PlacementHeapAllocator::bufferSizeAndAlign(NS::UInteger length) const {
+    return device->heapBufferSizeAndAlign(length, resourceOptions);
+}
+
+HeapTexture PlacementHeapAllocator::newTexture(const MTL::TextureDescriptor* descriptor) {
+    assert(descriptor->storageMode() == heapStorageMode);
+
+    HeapTexture result;
+    result.heapIndex = place(device->heapTextureSizeAndAlign(descriptor), result.allocation);
+    if (result.heapIndex == noHeap) {
+        return HeapTexture {};
+    }
+    result.texture = heaps[result.heapIndex].heap->newTexture(descriptor, result.allocation.offset);
+    if (!result.texture) {
+        heaps[result.heapIndex].allocator.free(result.allocation);
+        return HeapTexture {};
+    }
+    return result;
+}
+
+void PlacementHeapAllocator::free(HeapBuffer& buffer) {
+    if (!buffer) {
+        return;
+    }
+    buffer.buffer->release();
+    heaps[buffer.heapIndex].allocator.free(buffer.allocation);
+    buffer = HeapBuffer {};
+}
+
+void PlacementHeapAllocator::free(HeapTexture& texture) {
+    if (!texture) {
+        return;
+    }
+    texture.texture->release();
+    heaps[texture.heapIndex].allocator.free(texture.allocation);
+    texture = HeapTexture {};
+}
+
+void PlacementHeapAllocator::releaseEmptyHeaps() {
+    // Live allocations refer to heaps by index, so only heaps at the end can go.
+    while (heaps.size() > 1 && heaps.back().allocator.empty()) {
+        heaps.back().heap->release();
+        heaps.pop_back();
+    }
+}
+
+std::uint32_t PlacementHeapAllocator::place(MTL::SizeAndAlign sizeAndAlign, TlsfAllocation& allocation) {
+    for (std::uint32_t i = 0; i < heaps.size(); i++) {
+        allocation = heaps[i].allocator.allocate(sizeAndAlign.size, sizeAndAlign.align);
+        if (allocation) {
+            return i;
+        }
+    }
+
+    std::uint32_t index = addHeap(sizeAndAlign.size + sizeAndAlign.align);
+    if (index == noHeap) {
+        allocation = TlsfAllocation {};
+        return noHeap;
+    }
+    allocation = heaps[index].allocator.allocate(sizeAndAlign.size, sizeAndAlign.align);
+    assert(allocation);
+    return index;
+}
+
+std::uint32_t PlacementHeapAllocator::addHeap(NS::UInteger minimumSize) {
+    MTL::HeapDescriptor* descriptor = MTL::HeapDescriptor::alloc()->init();
+    descriptor->setType(MTL::HeapTypePlacement);
+    descriptor->setStorageMode(heapStorageMode);
+    descriptor->setSize(minimumSize > defaultHeapSize ? minimumSize : defaultHeapSize);
+
+    MTL::Heap* heap = device->newHeap(descriptor);
+    descriptor->release();
+    if (!heap) {
+        return noHeap;
+    }
+
+    heap->setLabel(MTLSTR("Placement Heap"));
+    heaps.push_back(PlacementHeap { heap, TlsfAllocator(heap->size()) });
+    return static_cast<std::uint32_t>(heaps.size() - 1);
+}
@@ -0,0 +1,84 @@
+//
+//  placement_heap_allocator.hpp
+//  Metal-Guide
+//
+
+#pragma once
+
+#include <Metal/Metal.hpp>
+
+#include "tlsf_allocator.hpp"
+
+#include <cstdint>
+#include <vector>
+
+struct HeapBuffer {
+    MTL::Buffer* buffer = nullptr;
+    std::uint32_t heapIndex = 0;
+    TlsfAllocation allocation;
+
+    explicit operator bool() const { return buffer != nullptr; }
+};
+
+struct HeapTexture {
+    MTL::Texture* texture = nullptr;
+    std::uint32_t heapIndex = 0;
+    TlsfAllocation allocation;
+
+    explicit operator bool() const { return texture != nullptr; }
+};
+
+// Places buffers and textures into placement heaps at offsets chosen by a TlsfAllocator per heap. When no heap has
+// room, a new one of heapSize bytes (or larger, for oversized resources) is created with Device::newHeap. When the
+// device can't create it, newBuffer and newTexture return an empty resource; the constructor's first heap may fail
+// the same way, leaving the allocator with no heaps until a later call succeeds.
+//
+// All heaps share one storage mode and the resource options derived from it; texture descriptors must use the same
+// storage mode. Placement heaps don't track hazards between aliasing resources, so only free a resource once the GPU
+// has finished with it.
+class PlacementHeapAllocator {
+public:
+    PlacementHeapAllocator(MTL::Device* device, MTL::StorageMode storageMode, NS::UInteger heapSize);
+    ~PlacementHeapAllocator();
+
+    PlacementHeapAllocator(const PlacementHeapAllocator&) = delete;
+    PlacementHeapAllocator& operator=(const PlacementHeapAllocator&) = delete;
+
+    HeapBuffer newBuffer(NS::UInteger length);
+    // Places a buffer in a range already reserved from heapAllocator(heapIndex), which the buffer then owns.
+    HeapBuffer newBuffer(NS::UInteger length, std::uint32_t heapIndex, const TlsfAllocation& allocation);
+    HeapTexture newTexture(const MTL::TextureDescriptor* descriptor);
+
+    // Releases the resource and returns its range to the heap.
+    void free(HeapBuffer& buffer);
+    void free(HeapTexture& texture);
+
+    // Releases heaps without live resources, keeping at least one.
+    void releaseEmptyHeaps();
+
+    NS::UInteger heapCount() const { return static_cast<NS::UInteger>(heaps.size()); }
+    MTL::Heap* heap(NS::UInteger index) const { return heaps[index].heap; }
+    TlsfStats heapStats(NS::UInteger index) const { return heaps[index].allocator.stats(); }
+    TlsfAllocator& heapAllocator(NS::UInteger index) { return heaps[index].allocator; }
+    MTL::SizeAndAlign bufferSizeAndAlign(NS::UInteger length) const;
+
+private:
+    struct PlacementHeap {
+        MTL::Heap* heap;
+        TlsfAllocator allocator;
+    };
+
+    static constexpr std::uint32_t noHeap = UINT32_MAX;
+
+    // Finds room for sizeAndAlign, creating a heap if needed. Returns the heap index, or noHeap when no heap could
+    // be created.
+    std::uint32_t place(MTL::SizeAndAlign sizeAndAlign, TlsfAllocation& allocation);
+    std::uint32_t addHeap(NS::UInteger minimumSize);
+
+    MTL::Device* device;
+    MTL::StorageMode heapStorageMode;
+    MTL::ResourceOptions resourceOptions;
+    NS::UInteger defaultHeapSize;
+
+    std::vector<PlacementHeap> heaps;
+};
@@ -0,0 +1,77 @@
+//
+//  residency_manager.cpp
+//  Metal-Guide
+//
+
+#include "residency_manager.hpp"
+
+#include <cassert>
+
+ResidencyManager::ResidencyManager(MTL::Device* device, double budgetFraction, std::uint32_t protectedFrames)
+    : device(device), budgetFraction(budgetFraction), policy(protectedFrames) {
+    assert(budgetFraction > 0.0);
+}
+
+ResidencyManager::~ResidencyManager() {
+    for (Entry& entry : entries) {
+        if (entry.resource) {
+            entry.resource->release();
+        }
+        if (entry.heap) {
+            entry.heap->release();
+        }
+    }
+}
+
+ResidencyManager::Handle ResidencyManager::add(const Entry& entry, std::uint64_t size, std::uint64_t reloadCost) {
+    Handle handle = policy.add(size, reloadCost);
+    if (handle >= entries.size()) {
+        entries.resize(handle + 1);
+    }
+    entries[handle] = entry;
+    return handle;
+}
+
+ResidencyManager::Handle ResidencyManager::track(MTL::Resource* resource, std::uint64_t reloadCost) {
+    return add(Entry { resource->retain(), nullptr }, resource->allocatedSize(), reloadCost);
+}
+
+ResidencyManager::Handle ResidencyManager::track(MTL::Heap* heap, std::uint64_t reloadCost) {
+    return add(Entry { nullptr, heap->retain() }, heap->size(), reloadCost);
+}
+
+void ResidencyManager::untrack(Handle handle) {
+    Entry& entry = entries[handle];
+    if (entry.resource) {
+        entry.resource->release();
+    }
+    if (entry.heap) {
+        entry.heap->release();
+    }
+    entry = Entry {};
+    policy.remove(handle);
+}
+
+MTL::PurgeableState ResidencyManager::setPurgeableState(const Entry& entry, MTL::PurgeableState state) {
+    return entry.resource ? entry.resource->setPurgeableState(state) : entry.heap->setPurgeableState(state);
+}
+
+bool ResidencyManager::use(Handle handle) {
+    if (!policy.use(handle)) {
+        return true;
+    }
+    bool contentsLost = setPurgeableState(entries[handle], MTL::PurgeableStateNonVolatile) == MTL::PurgeableStateEmpty;
+    policy.restored(handle, contentsLost);
+    return !contentsLost;
+}
+
+std::uint64_t ResidencyManager::budget() const {
+    return static_cast<std::uint64_t>(static_cast<double>(device->recommendedMaxWorkingSetSize()) * budgetFraction);
+}
+
+void ResidencyManager::endFrame() {
+    for (Handle handle : policy.evict(device->currentAllocatedSize(), budget())) {
+        setPurgeableState(entries[handle], MTL::PurgeableStateVolatile);
+    }
+    policy.beginFrame();
+}
@@ -0,0 +1,59 @@
+//
+//  residency_manager.hpp
+//  Metal-Guide
+//
+
+#pragma once
+
+#include <Metal/Metal.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include "residency_policy.hpp"
+
+// Hands memory back to the system under pressure. Tracked resources and heaps are made volatile, least recently used
+// first, once the device's allocated size goes over a fraction of its recommended working set; the OS may then
+// discard them. use() makes an entry non-volatile again and reports whether its contents have to be reloaded.
+//
+// The decisions come from ResidencyPolicy, which this class only feeds with device sizes and applies through
+// setPurgeableState.
+class ResidencyManager {
+public:
+    using Handle = ResidencyPolicy::Handle;
+
+    explicit ResidencyManager(MTL::Device* device, double budgetFraction = 0.9, std::uint32_t protectedFrames = 3);
+    ~ResidencyManager();
+
+    ResidencyManager(const ResidencyManager&) = delete;
+    ResidencyManager& operator=(const ResidencyManager&) = delete;
+
+    // The manager retains tracked objects until untrack(). reloadCost is accounted when contents are lost.
+    Handle track(MTL::Resource* resource, std::uint64_t reloadCost);
+    Handle track(MTL::Heap* heap, std::uint64_t reloadCost);
+    void untrack(Handle handle);
+
+    // Call before encoding work that reads the entry. Returns false when its contents were discarded and must be
+    // written again.
+    bool use(Handle handle);
+
+    // Makes cold entries volatile if the device is over budget, then starts the next frame.
+    void endFrame();
+
+    std::uint64_t budget() const;
+    const ResidencyStats& stats() const { return policy.stats(); }
+
+private:
+    struct Entry {
+        MTL::Resource* resource = nullptr;
+        MTL::Heap* heap = nullptr;
+    };
+
+    Handle add(const Entry& entry, std::uint64_t size, std::uint64_t reloadCost);
+    MTL::PurgeableState setPurgeableState(const Entry& entry, MTL::PurgeableState state);
+
+    MTL::Device* device;
+    double budgetFraction;
+    ResidencyPolicy policy;
+    std::vector<Entry> entries;
+};
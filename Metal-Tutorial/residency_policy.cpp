@@ -0,0 +1,122 @@
+//
+//  residency_policy.cpp
+//  Metal-Guide
+//
+
+#include "residency_policy.hpp"
+
+#include <cassert>
+
+ResidencyPolicy::ResidencyPolicy(std::uint32_t protectedFrames)
+    : protectedFrames(protectedFrames) {
+}
+
+ResidencyPolicy::Handle ResidencyPolicy::add(std::uint64_t size, std::uint64_t reloadCost) {
+    Entry entry = { size, reloadCost, frame, invalidHandle, invalidHandle, true, false };
+    Handle handle;
+    if (!freeHandles.empty()) {
+        handle = freeHandles.back();
+        freeHandles.pop_back();
+        entries[handle] = entry;
+    } else {
+        handle = static_cast<Handle>(entries.size());
+        entries.push_back(entry);
+    }
+    pushMostRecent(handle);
+    return handle;
+}
+
+void ResidencyPolicy::remove(Handle handle) {
+    Entry& entry = entries[handle];
+    assert(entry.live);
+    if (entry.isVolatile) {
+        policyStats.volatileBytes -= entry.size;
+    } else {
+        unlink(handle);
+    }
+    entry.live = false;
+    freeHandles.push_back(handle);
+}
+
+void ResidencyPolicy::unlink(Handle handle) {
+    Entry& entry = entries[handle];
+    if (entry.prev != invalidHandle) {
+        entries[entry.prev].next = entry.next;
+    } else {
+        lruHead = entry.next;
+    }
+    if (entry.next != invalidHandle) {
+        entries[entry.next].prev = entry.prev;
+    } else {
+        lruTail = entry.prev;
+    }
+    entry.prev = invalidHandle;
+    entry.next = invalidHandle;
+}
+
+void ResidencyPolicy::pushMostRecent(Handle handle) {
+    Entry& entry = entries[handle];
+    entry.prev = lruTail;
+    entry.next = invalidHandle;
+    if (lruTail != invalidHandle) {
+        entries[lruTail].next = handle;
+    } else {
+        lruHead = handle;
+    }
+    lruTail = handle;
+}
+
+bool ResidencyPolicy::use(Handle handle) {
+    Entry& entry = entries[handle];
+    assert(entry.live);
+    entry.lastUse = frame;
+    if (entry.isVolatile) {
+        return true;
+    }
+    unlink(handle);
+    pushMostRecent(handle);
+    return false;
+}
+
+void ResidencyPolicy::restored(Handle handle, bool contentsLost) {
+    Entry& entry = entries[handle];
+    assert(entry.live && entry.isVolatile);
+    entry.isVolatile = false;
+    entry.lastUse = frame;
+    policyStats.volatileBytes -= entry.size;
+    policyStats.restores++;
+    if (contentsLost) {
+        policyStats.reloads++;
+        policyStats.reloadCost += entry.reloadCost;
+    }
+    pushMostRecent(handle);
+}
+
+std::vector<ResidencyPolicy::Handle> ResidencyPolicy::evict(std::uint64_t allocatedBytes, std::uint64_t budgetBytes) {
+    std::vector<Handle> evicted;
+
+    // Volatile memory is the system's to take, so it doesn't count against the budget.
+    std::uint64_t pinnedBytes = allocatedBytes > policyStats.volatileBytes ? allocatedBytes - policyStats.volatileBytes : 0;
+
+    Handle handle = lruHead;
+    while (pinnedBytes > budgetBytes && handle != invalidHandle) {
+        Entry& entry = entries[handle];
+        Handle next = entry.next;
+
+        // The list is in use order, so everything after the first protected entry is protected too.
+        if (entry.lastUse + protectedFrames > frame) {
+            break;
+        }
+
+        unlink(handle);
+        entry.isVolatile = true;
+        policyStats.volatileBytes += entry.size;
+        policyStats.evictions++;
+        policyStats.evictedBytes += entry.size;
+        pinnedBytes = pinnedBytes > entry.size ? pinnedBytes - entry.size : 0;
+        evicted.push_back(handle);
+
+        handle = next;
+    }
+    return evicted;
+}
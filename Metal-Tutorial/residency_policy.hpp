@@ -0,0 +1,76 @@
+//
+//  residency_policy.hpp
+//  Metal-Guide
+//
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+struct ResidencyStats {
+    std::uint64_t evictions = 0;
+    std::uint64_t evictedBytes = 0;
+    std::uint64_t restores = 0;
+    std::uint64_t reloads = 0;
+    std::uint64_t reloadCost = 0;
+    std::uint64_t volatileBytes = 0;
+};
+
+// Decides which resources to make purgeable under memory pressure, without touching any API itself, so the same
+// policy drives Metal or a fake device in a test.
+//
+// Entries are kept in least-recently-used order. When the device reports more allocated bytes than the budget,
+// evict() picks the coldest entries, skipping any used in the last protectedFrames frames since the GPU may still be
+// reading them, until the bytes not yet marked volatile fit. use() tells the caller when an entry has to be made
+// non-volatile again, and restored() records whether its contents survived; lost contents add the entry's reload
+// cost to the stats.
+class ResidencyPolicy {
+public:
+    using Handle = std::uint32_t;
+    static constexpr Handle invalidHandle = UINT32_MAX;
+
+    explicit ResidencyPolicy(std::uint32_t protectedFrames = 3);
+
+    // reloadCost is in whatever unit the caller likes to account, bytes to re-upload for example.
+    Handle add(std::uint64_t size, std::uint64_t reloadCost);
+    void remove(Handle handle);
+
+    void beginFrame() { frame++; }
+
+    // Marks the entry used this frame. Returns true when it is volatile and must be restored before use.
+    bool use(Handle handle);
+    void restored(Handle handle, bool contentsLost);
+
+    // Returns the entries to make volatile, coldest first, and marks them volatile.
+    std::vector<Handle> evict(std::uint64_t allocatedBytes, std::uint64_t budgetBytes);
+
+    bool isVolatile(Handle handle) const { return entries[handle].isVolatile; }
+    const ResidencyStats& stats() const { return policyStats; }
+
+private:
+    struct Entry {
+        std::uint64_t size;
+        std::uint64_t reloadCost;
+        std::uint64_t lastUse;
+        Handle prev;
+        Handle next;
+        bool live;
+        bool isVolatile;
+    };
+
+    void unlink(Handle handle);
+    void pushMostRecent(Handle handle);
+
+    std::uint32_t protectedFrames;
+    std::uint64_t frame = 0;
+
+    std::vector<Entry> entries;
+    std::vector<Handle> freeHandles;
+
+    // Non-volatile entries only, least recently used first.
+    Handle lruHead = invalidHandle;
+    Handle lruTail = invalidHandle;
+
+    ResidencyStats policyStats;
+};
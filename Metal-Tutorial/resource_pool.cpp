@@ -0,0 +1,242 @@
+//
+//  resource_pool.cpp
+//  Metal-Guide
+//
+
+#include "resource_pool.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+
+namespace {
+
+constexpr NS::UInteger minimumBufferSize = 4096;
+
+void hashCombine(std::size_t& seed, std::size_t value) {
+    seed ^= value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+}
+
+}
+
+bool ResourcePool::TextureKey::operator==(const TextureKey& other) const {
+    return textureType == other.textureType && pixelFormat == other.pixelFormat && width == other.width && height == other.height
+        && depth == other.depth && mipmapLevelCount == other.mipmapLevelCount && sampleCount == other.sampleCount
+        && arrayLength == other.arrayLength && resourceOptions == other.resourceOptions && usage == other.usage
+        && allowGPUOptimizedContents == other.allowGPUOptimizedContents && compressionType == other.compressionType
+        && swizzle.red == other.swizzle.red && swizzle.green == other.swizzle.green && swizzle.blue == other.swizzle.blue
+        && swizzle.alpha == other.swizzle.alpha;
+}
+
+std::size_t ResourcePool::BufferKeyHash::operator()(const BufferKey& key) const {
+    std::size_t seed = std::hash<NS::UInteger>()(key.sizeClass);
+    hashCombine(seed, std::hash<NS::UInteger>()(key.options));
+    return seed;
+}
+
+std::size_t ResourcePool::TextureKeyHash::operator()(const TextureKey& key) const {
+    std::size_t seed = std::hash<NS::UInteger>()(key.width);
+    hashCombine(seed, key.height);
+    hashCombine(seed, key.depth);
+    hashCombine(seed, key.pixelFormat);
+    hashCombine(seed, key.textureType);
+    hashCombine(seed, key.mipmapLevelCount);
+    hashCombine(seed, key.sampleCount);
+    hashCombine(seed, key.arrayLength);
+    hashCombine(seed, key.resourceOptions);
+    hashCombine(seed, key.usage);
+    return seed;
+}
+
+ResourcePool::ResourcePool(MTL::Device* device, std::uint32_t trimInterval)
+    : device(device), trimInterval(trimInterval) {
+    assert(trimInterval > 0);
+}
+
+ResourcePool::~ResourcePool() {
+    // Command buffers retain the resources they use, so nothing still on the GPU is freed from under it.
+    forEachBucket([](Bucket& bucket) {
+        for (MTL::Resource* resource : bucket.idle) {
+            resource->release();
+        }
+        for (PendingResource& pending : bucket.pending) {
+            pending.resource->release();
+        }
+    });
+    for (auto& owner : owners) {
+        owner.first->release();
+    }
+}
+
+template <typename Function>
+void ResourcePool::forEachBucket(Function&& function) {
+    for (auto& entry : bufferBuckets) {
+        function(entry.second);
+    }
+    for (auto& entry : textureBuckets) {
+        function(entry.second);
+    }
+}
+
+NS::UInteger ResourcePool::sizeClass(NS::UInteger length) {
+    if (length <= minimumBufferSize) {
+        return minimumBufferSize;
+    }
+    // Four classes per power of two, so a pooled buffer is at most 25% larger than requested.
+    NS::UInteger top = 63 - static_cast<NS::UInteger>(__builtin_clzll(length));
+    NS::UInteger step = NS::UInteger(1) << (top - 2);
+    return (length + step - 1) & ~(step - 1);
+}
+
+ResourcePool::TextureKey ResourcePool::textureKey(const MTL::TextureDescriptor* descriptor) {
+    return TextureKey {
+        descriptor->textureType(),
+        descriptor->pixelFormat(),
+        descriptor->width(),
+        descriptor->height(),
+        descriptor->depth(),
+        descriptor->mipmapLevelCount(),
+        descriptor->sampleCount(),
+        descriptor->arrayLength(),
+        descriptor->resourceOptions(),
+        descriptor->usage(),
+        descriptor->allowGPUOptimizedContents(),
+        descriptor->compressionType(),
+        descriptor->swizzle(),
+    };
+}
+
+MTL::Resource* ResourcePool::reuse(Bucket& bucket) {
+    reclaim(bucket, completedFrames->load(std::memory_order_acquire));
+    if (bucket.idle.empty()) {
+        counters.misses++;
+        return nullptr;
+    }
+    MTL::Resource* resource = bucket.idle.back();
+    bucket.idle.pop_back();
+    counters.hits++;
+    return resource;
+}
+
+void ResourcePool::track(MTL::Resource* resource, Bucket& bucket) {
+    bucket.inUse++;
+    bucket.highWaterMark = std::max(bucket.highWaterMark, bucket.inUse);
+    owners[resource] = &bucket;
+}
+
+MTL::Buffer* ResourcePool::newBuffer(NS::UInteger length, MTL::ResourceOptions options) {
+    Bucket& bucket = bufferBuckets[BufferKey { sizeClass(length), options }];
+    auto* buffer = static_cast<MTL::Buffer*>(reuse(bucket));
+    if (!buffer) {
+        buffer = device->newBuffer(sizeClass(length), options);
+        if (!buffer) {
+            return nullptr;
+        }
+    }
+    track(buffer, bucket);
+    return buffer;
+}
+
+MTL::Texture* ResourcePool::newTexture(const MTL::TextureDescriptor* descriptor) {
+    Bucket& bucket = textureBuckets[textureKey(descriptor)];
+    auto* texture = static_cast<MTL::Texture*>(reuse(bucket));
+    if (!texture) {
+        texture = device->newTexture(descriptor);
+        if (!texture) {
+            return nullptr;
+        }
+    }
+    track(texture, bucket);
+    return texture;
+}
+
+void ResourcePool::recycleResource(MTL::Resource* resource) {
+    auto owner = owners.find(resource);
+    assert(owner != owners.end());
+    Bucket& bucket = *owner->second;
+    owners.erase(owner);
+
+    bucket.inUse--;
+    bucket.pending.push_back(PendingResource { resource, currentFrame });
+}
+
+void ResourcePool::recycle(MTL::Buffer* buffer) {
+    recycleResource(buffer);
+}
+
+void ResourcePool::recycle(MTL::Texture* texture) {
+    recycleResource(texture);
+}
+
+void ResourcePool::reclaim(Bucket& bucket, std::uint64_t completed) {
+    auto ready = std::stable_partition(bucket.pending.begin(), bucket.pending.end(), [completed](const PendingResource& pending) {
+        return pending.frame >= completed;
+    });
+    for (auto it = ready; it != bucket.pending.end(); ++it) {
+        bucket.idle.push_back(it->resource);
+    }
+    bucket.pending.erase(ready, bucket.pending.end());
+}
+
+void ResourcePool::trim(Bucket& bucket, NS::UInteger keep) {
+    while (bucket.idle.size() > keep) {
+        bucket.idle.back()->release();
+        bucket.idle.pop_back();
+        counters.trimmed++;
+    }
+}
+
+void ResourcePool::endFrame(MTL::CommandBuffer* commandBuffer) {
+    std::uint64_t frame = currentFrame++;
+    std::shared_ptr<std::atomic<std::uint64_t>> completed = completedFrames;
+    commandBuffer->addCompletedHandler([completed, frame](MTL::CommandBuffer*) {
+        completed->store(frame + 1, std::memory_order_release);
+    });
+
+    if (currentFrame % trimInterval != 0) {
+        return;
+    }
+    std::uint64_t completedNow = completedFrames->load(std::memory_order_acquire);
+    forEachBucket([&](Bucket& bucket) {
+        reclaim(bucket, completedNow);
+        NS::UInteger owned = bucket.inUse + bucket.pending.size();
+        trim(bucket, bucket.highWaterMark > owned ? bucket.highWaterMark - owned : 0);
+        bucket.highWaterMark = bucket.inUse;
+    });
+}
+
+void ResourcePool::trimAll() {
+    std::uint64_t completedNow = completedFrames->load(std::memory_order_acquire);
+    forEachBucket([&](Bucket& bucket) {
+        reclaim(bucket, completedNow);
+        trim(bucket, 0);
+    });
+}
+
+ResourcePoolStats ResourcePool::stats() const {
+    ResourcePoolStats result = counters;
+    auto add = [&result](const Bucket& bucket) {
+        result.resourcesInUse += bucket.inUse;
+        result.pooledResources += bucket.idle.size() + bucket.pending.size();
+        for (MTL::Resource* resource : bucket.idle) {
+            result.pooledBytes += resource->allocatedSize();
+        }
+        for (const PendingResource& pending : bucket.pending) {
+            result.pooledBytes += pending.resource->allocatedSize();
+        }
+    };
+    for (const auto& entry : bufferBuckets) {
+        add(entry.second);
+    }
+    for (const auto& entry : textureBuckets) {
+        add(entry.second);
+    }
+    for (const auto& owner : owners) {
+        result.bytesInUse += owner.first->allocatedSize();
+    }
+    return result;
+}
+
+void ResourcePool::resetCounters() {
+    counters = ResourcePoolStats {};
+}
@@ -0,0 +1,129 @@
+//
+//  resource_pool.hpp
+//  Metal-Guide
+//
+
+#pragma once
+
+#include <Metal/Metal.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+struct ResourcePoolStats {
+    NS::UInteger hits = 0;
+    NS::UInteger misses = 0;
+    NS::UInteger trimmed = 0;
+    NS::UInteger pooledResources = 0;
+    NS::UInteger pooledBytes = 0;
+    NS::UInteger resourcesInUse = 0;
+    NS::UInteger bytesInUse = 0;
+
+    double hitRate() const { return hits + misses ? double(hits) / double(hits + misses) : 0.0; }
+};
+
+// Recycles buffers and textures instead of creating and releasing them every frame. Buffers are pooled by size class
+// and resource options, so a buffer may be longer than requested; textures by every descriptor property that
+// affects the texture.
+//
+// Give resources back with recycle(). They are handed out again only once the frame they were recycled in has
+// completed, which endFrame() tracks through a completion handler on the frame's last command buffer.
+//
+// Every trimInterval frames, each bucket is trimmed to the most resources it had in use at once during that window
+// (its high-water mark); idle resources beyond that are released.
+class ResourcePool {
+public:
+    explicit ResourcePool(MTL::Device* device, std::uint32_t trimInterval = 60);
+    ~ResourcePool();
+
+    ResourcePool(const ResourcePool&) = delete;
+    ResourcePool& operator=(const ResourcePool&) = delete;
+
+    // The pool owns the returned resources; don't release them, recycle them.
+    MTL::Buffer* newBuffer(NS::UInteger length, MTL::ResourceOptions options);
+    MTL::Texture* newTexture(const MTL::TextureDescriptor* descriptor);
+
+    void recycle(MTL::Buffer* buffer);
+    void recycle(MTL::Texture* texture);
+
+    // Closes the current frame. commandBuffer must be the frame's last command buffer and not yet committed.
+    void endFrame(MTL::CommandBuffer* commandBuffer);
+
+    // Releases every idle resource now.
+    void trimAll();
+
+    ResourcePoolStats stats() const;
+    void resetCounters();
+
+private:
+    struct BufferKey {
+        NS::UInteger sizeClass;
+        MTL::ResourceOptions options;
+
+        bool operator==(const BufferKey& other) const { return sizeClass == other.sizeClass && options == other.options; }
+    };
+
+    struct TextureKey {
+        MTL::TextureType textureType;
+        MTL::PixelFormat pixelFormat;
+        NS::UInteger width;
+        NS::UInteger height;
+        NS::UInteger depth;
+        NS::UInteger mipmapLevelCount;
+        NS::UInteger sampleCount;
+        NS::UInteger arrayLength;
+        MTL::ResourceOptions resourceOptions;
+        MTL::TextureUsage usage;
+        bool allowGPUOptimizedContents;
+        MTL::TextureCompressionType compressionType;
+        MTL::TextureSwizzleChannels swizzle;
+
+        bool operator==(const TextureKey& other) const;
+    };
+
+    struct BufferKeyHash {
+        std::size_t operator()(const BufferKey& key) const;
+    };
+
+    struct TextureKeyHash {
+        std::size_t operator()(const TextureKey& key) const;
+    };
+
+    struct PendingResource {
+        MTL::Resource* resource;
+        std::uint64_t frame;
+    };
+
+    struct Bucket {
+        std::vector<MTL::Resource*> idle;
+        std::vector<PendingResource> pending;
+        NS::UInteger inUse = 0;
+        NS::UInteger highWaterMark = 0;
+    };
+
+    static TextureKey textureKey(const MTL::TextureDescriptor* descriptor);
+    static NS::UInteger sizeClass(NS::UInteger length);
+
+    MTL::Resource* reuse(Bucket& bucket);
+    void track(MTL::Resource* resource, Bucket& bucket);
+    void recycleResource(MTL::Resource* resource);
+    void reclaim(Bucket& bucket, std::uint64_t completedFrames);
+    void trim(Bucket& bucket, NS::UInteger keep);
+
+    template <typename Function>
+    void forEachBucket(Function&& function);
+
+    MTL::Device* device;
+    std::uint32_t trimInterval;
+    std::uint64_t currentFrame = 0;
+    std::shared_ptr<std::atomic<std::uint64_t>> completedFrames = std::make_shared<std::atomic<std::uint64_t>>(0);
+
+    std::unordered_map<BufferKey, Bucket, BufferKeyHash> bufferBuckets;
+    std::unordered_map<TextureKey, Bucket, TextureKeyHash> textureBuckets;
+    std::unordered_map<MTL::Resource*, Bucket*> owners;
+
+    ResourcePoolStats counters;
+};
@@ -0,0 +1,94 @@
+//
+//  sparse_texture_streamer.cpp
+//  Metal-Guide
+//
+
+#include "sparse_texture_streamer.hpp"
+
+#include <cassert>
+
+namespace {
+
+TileBox tileBox(MTL::Region region) {
+    return TileBox {
+        static_cast<std::uint32_t>(region.origin.x),
+        static_cast<std::uint32_t>(region.origin.y),
+        static_cast<std::uint32_t>(region.origin.z),
+        static_cast<std::uint32_t>(region.size.width),
+        static_cast<std::uint32_t>(region.size.height),
+        static_cast<std::uint32_t>(region.size.depth),
+    };
+}
+
+MTL::Region region(const TileBox& box) {
+    return MTL::Region(box.x, box.y, box.z, box.width, box.height, box.depth);
+}
+
+}
+
+SparseTextureLayout SparseTextureStreamer::layout(MTL::Device* device, MTL::Texture* texture) {
+    MTL::Size tile = device->sparseTileSize(texture->textureType(), texture->pixelFormat(), texture->sampleCount());
+    NS::UInteger slices = texture->arrayLength();
+    if (texture->textureType() == MTL::TextureTypeCube || texture->textureType() == MTL::TextureTypeCubeArray) {
+        slices *= 6;
+    }
+    return SparseTextureLayout {
+        static_cast<std::uint32_t>(texture->width()),
+        static_cast<std::uint32_t>(texture->height()),
+        static_cast<std::uint32_t>(texture->depth()),
+        static_cast<std::uint32_t>(texture->mipmapLevelCount()),
+        static_cast<std::uint32_t>(slices),
+        static_cast<std::uint32_t>(texture->firstMipmapInTail()),
+        TileBox { 0, 0, 0, static_cast<std::uint32_t>(tile.width), static_cast<std::uint32_t>(tile.height),
+                  static_cast<std::uint32_t>(tile.depth) },
+    };
+}
+
+SparseTextureStreamer::SparseTextureStreamer(MTL::Device* device, MTL::Texture* texture, NS::UInteger budgetBytes)
+    : texture(texture->retain()),
+      sparseTileSize(device->sparseTileSize(texture->textureType(), texture->pixelFormat(), texture->sampleCount())),
+      residency(layout(device, texture), budgetBytes / device->sparseTileSizeInBytes()) {
+    assert(texture->isSparse());
+}
+
+SparseTextureStreamer::~SparseTextureStreamer() {
+    texture->release();
+}
+
+void SparseTextureStreamer::request(MTL::Region pixels, NS::UInteger mipLevel, NS::UInteger slice) {
+    residency.request(tileBox(pixels), static_cast<std::uint32_t>(mipLevel), static_cast<std::uint32_t>(slice));
+}
+
+MTL::Region SparseTextureStreamer::pixelRegion(const TileBox& tiles, NS::UInteger mipLevel) const {
+    return region(residency.tilesToPixels(tiles, static_cast<std::uint32_t>(mipLevel)));
+}
+
+void SparseTextureStreamer::encode(MTL::ResourceStateCommandEncoder* encoder, MTL::SparseTextureMappingMode mode, const TileBatch& batch) {
+    regions.clear();
+    mipLevels.clear();
+    slices.clear();
+    for (std::size_t i = 0; i < batch.regions.size(); i++) {
+        regions.push_back(region(batch.regions[i]));
+        mipLevels.push_back(batch.mipLevels[i]);
+        slices.push_back(batch.slices[i]);
+    }
+    encoder->updateTextureMappings(texture, mode, regions.data(), mipLevels.data(), slices.data(), regions.size());
+}
+
+bool SparseTextureStreamer::encode(MTL::CommandBuffer* commandBuffer) {
+    TileUpdates updates = residency.update();
+    lastMapped = std::move(updates.map);
+    if (updates.unmap.empty() && lastMapped.empty()) {
+        return false;
+    }
+
+    MTL::ResourceStateCommandEncoder* encoder = commandBuffer->resourceStateCommandEncoder();
+    if (!updates.unmap.empty()) {
+        encode(encoder, MTL::SparseTextureMappingModeUnmap, updates.unmap);
+    }
+    if (!lastMapped.empty()) {
+        encode(encoder, MTL::SparseTextureMappingModeMap, lastMapped);
+    }
+    encoder->endEncoding();
+    return true;
+}
@@ -0,0 +1,54 @@
+//
+//  sparse_texture_streamer.hpp
+//  Metal-Guide
+//
+
+#pragma once
+
+#include <Metal/Metal.hpp>
+
+#include <vector>
+
+#include "tile_residency.hpp"
+
+// Keeps only the requested tiles of a sparse texture backed by memory, within a byte budget. Request the pixel regions
+// a frame is about to sample, then call encode() once on a command buffer ahead of the work that samples them: it
+// applies the frame's unmaps and maps with one updateTextureMappings call each. Newly mapped tiles have undefined
+// contents until the caller fills them, using mappedRegions() to find out which.
+//
+// The tile bookkeeping lives in TileResidency.
+class SparseTextureStreamer {
+public:
+    // texture must have been made from a sparse heap.
+    SparseTextureStreamer(MTL::Device* device, MTL::Texture* texture, NS::UInteger budgetBytes);
+    ~SparseTextureStreamer();
+
+    SparseTextureStreamer(const SparseTextureStreamer&) = delete;
+    SparseTextureStreamer& operator=(const SparseTextureStreamer&) = delete;
+
+    void request(MTL::Region pixels, NS::UInteger mipLevel, NS::UInteger slice = 0);
+
+    // Returns false when there was nothing to update.
+    bool encode(MTL::CommandBuffer* commandBuffer);
+
+    // Tiles mapped by the last encode(), in tile coordinates. pixelRegion() converts one for uploading.
+    const TileBatch& mappedRegions() const { return lastMapped; }
+    MTL::Region pixelRegion(const TileBox& tiles, NS::UInteger mipLevel) const;
+
+    MTL::Size tileSize() const { return sparseTileSize; }
+    const TileResidencyStats& stats() const { return residency.stats(); }
+
+private:
+    static SparseTextureLayout layout(MTL::Device* device, MTL::Texture* texture);
+
+    void encode(MTL::ResourceStateCommandEncoder* encoder, MTL::SparseTextureMappingMode mode, const TileBatch& batch);
+
+    MTL::Texture* texture;
+    MTL::Size sparseTileSize;
+    TileResidency residency;
+    TileBatch lastMapped;
+
+    std::vector<MTL::Region> regions;
+    std::vector<NS::UInteger> mipLevels;
+    std::vector<NS::UInteger> slices;
+};
@@ -0,0 +1,187 @@
+//
+//  state_filter.cpp
+//  Metal-Guide
+//
+
+#include "state_filter.hpp"
+
+#include <cassert>
+
+bool ViewportState::operator==(const ViewportState& other) const {
+    return viewport.originX == other.viewport.originX && viewport.originY == other.viewport.originY
+        && viewport.width == other.viewport.width && viewport.height == other.viewport.height
+        && viewport.znear == other.viewport.znear && viewport.zfar == other.viewport.zfar;
+}
+
+bool ScissorState::operator==(const ScissorState& other) const {
+    return rect.x == other.rect.x && rect.y == other.rect.y && rect.width == other.rect.width && rect.height == other.rect.height;
+}
+
+void StageShadowState::forget() {
+    for (auto& buffer : buffers) {
+        buffer.forget();
+    }
+    for (auto& texture : textures) {
+        texture.forget();
+    }
+    for (auto& sampler : samplers) {
+        sampler.forget();
+    }
+}
+
+FilteredRenderEncoder::FilteredRenderEncoder(MTL::RenderCommandEncoder* encoder)
+    : renderEncoder(encoder) {
+}
+
+void FilteredRenderEncoder::setRenderPipelineState(const MTL::RenderPipelineState* state) {
+    if (pipelineState.update(state, filterStats)) {
+        renderEncoder->setRenderPipelineState(state);
+    }
+}
+
+void FilteredRenderEncoder::setDepthStencilState(const MTL::DepthStencilState* state) {
+    if (depthStencilState.update(state, filterStats)) {
+        renderEncoder->setDepthStencilState(state);
+    }
+}
+
+void FilteredRenderEncoder::setCullMode(MTL::CullMode mode) {
+    if (cullMode.update(mode, filterStats)) {
+        renderEncoder->setCullMode(mode);
+    }
+}
+
+void FilteredRenderEncoder::setFrontFacingWinding(MTL::Winding winding) {
+    if (frontFacingWinding.update(winding, filterStats)) {
+        renderEncoder->setFrontFacingWinding(winding);
+    }
+}
+
+void FilteredRenderEncoder::setTriangleFillMode(MTL::TriangleFillMode mode) {
+    if (fillMode.update(mode, filterStats)) {
+        renderEncoder->setTriangleFillMode(mode);
+    }
+}
+
+void FilteredRenderEncoder::setDepthClipMode(MTL::DepthClipMode mode) {
+    if (depthClipMode.update(mode, filterStats)) {
+        renderEncoder->setDepthClipMode(mode);
+    }
+}
+
+void FilteredRenderEncoder::setViewport(const MTL::Viewport& newViewport) {
+    if (viewport.update(ViewportState { newViewport }, filterStats)) {
+        renderEncoder->setViewport(newViewport);
+    }
+}
+
+void FilteredRenderEncoder::setScissorRect(const MTL::ScissorRect& rect) {
+    if (scissorRect.update(ScissorState { rect }, filterStats)) {
+        renderEncoder->setScissorRect(rect);
+    }
+}
+
+void FilteredRenderEncoder::setDepthBias(float bias, float slopeScale, float clamp) {
+    if (depthBias.update(DepthBiasState { bias, slopeScale, clamp }, filterStats)) {
+        renderEncoder->setDepthBias(bias, slopeScale, clamp);
+    }
+}
+
+void FilteredRenderEncoder::setStencilReferenceValue(std::uint32_t referenceValue) {
+    if (stencilReferenceValue.update(referenceValue, filterStats)) {
+        renderEncoder->setStencilReferenceValue(referenceValue);
+    }
+}
+
+void FilteredRenderEncoder::setVertexBuffer(const MTL::Buffer* buffer, NS::UInteger offset, NS::UInteger index) {
+    assert(index < StageShadowState::maxBuffers);
+    if (vertexStage.buffers[index].update(BufferBinding { buffer, offset }, filterStats)) {
+        renderEncoder->setVertexBuffer(buffer, offset, index);
+    }
+}
+
+void FilteredRenderEncoder::setVertexTexture(const MTL::Texture* texture, NS::UInteger index) {
+    assert(index < StageShadowState::maxTextures);
+    if (vertexStage.textures[index].update(texture, filterStats)) {
+        renderEncoder->setVertexTexture(texture, index);
+    }
+}
+
+void FilteredRenderEncoder::setVertexSamplerState(const MTL::SamplerState* sampler, NS::UInteger index) {
+    assert(index < StageShadowState::maxSamplers);
+    if (vertexStage.samplers[index].update(sampler, filterStats)) {
+        renderEncoder->setVertexSamplerState(sampler, index);
+    }
+}
+
+void FilteredRenderEncoder::setFragmentBuffer(const MTL::Buffer* buffer, NS::UInteger offset, NS::UInteger index) {
+    assert(index < StageShadowState::maxBuffers);
+    if (fragmentStage.buffers[index].update(BufferBinding { buffer, offset }, filterStats)) {
+        renderEncoder->setFragmentBuffer(buffer, offset, index);
+    }
+}
+
+void FilteredRenderEncoder::setFragmentTexture(const MTL::Texture* texture, NS::UInteger index) {
+    assert(index < StageShadowState::maxTextures);
+    if (fragmentStage.textures[index].update(texture, filterStats)) {
+        renderEncoder->setFragmentTexture(texture, index);
+    }
+}
+
+void FilteredRenderEncoder::setFragmentSamplerState(const MTL::SamplerState* sampler, NS::UInteger index) {
+    assert(index < StageShadowState::maxSamplers);
+    if (fragmentStage.samplers[index].update(sampler, filterStats)) {
+        renderEncoder->setFragmentSamplerState(sampler, index);
+    }
+}
+
+void FilteredRenderEncoder::forgetState() {
+    pipelineState.forget();
+    depthStencilState.forget();
+    cullMode.forget();
+    frontFacingWinding.forget();
+    fillMode.forget();
+    depthClipMode.forget();
+    viewport.forget();
+    scissorRect.forget();
+    depthBias.forget();
+    stencilReferenceValue.forget();
+    vertexStage.forget();
+    fragmentStage.forget();
+}
+
+FilteredComputeEncoder::FilteredComputeEncoder(MTL::ComputeCommandEncoder* encoder)
+    : computeEncoder(encoder) {
+}
+
+void FilteredComputeEncoder::setComputePipelineState(const MTL::ComputePipelineState* state) {
+    if (pipelineState.update(state, filterStats)) {
+        computeEncoder->setComputePipelineState(state);
+    }
+}
+
+void FilteredComputeEncoder::setBuffer(const MTL::Buffer* buffer, NS::UInteger offset, NS::UInteger index) {
+    assert(index < StageShadowState::maxBuffers);
+    if (kernelStage.buffers[index].update(BufferBinding { buffer, offset }, filterStats)) {
+        computeEncoder->setBuffer(buffer, offset, index);
+    }
+}
+
+void FilteredComputeEncoder::setTexture(const MTL::Texture* texture, NS::UInteger index) {
+    assert(index < StageShadowState::maxTextures);
+    if (kernelStage.textures[index].update(texture, filterStats)) {
+        computeEncoder->setTexture(texture, index);
+    }
+}
+
+void FilteredComputeEncoder::setSamplerState(const MTL::SamplerState* sampler, NS::UInteger index) {
+    assert(index < StageShadowState::maxSamplers);
+    if (kernelStage.samplers[index].update(sampler, filterStats)) {
+        computeEncoder->setSamplerState(sampler, index);
+    }
+}
+
+void FilteredComputeEncoder::forgetState() {
+    pipelineState.forget();
+    kernelStage.forget();
+}
@@ -0,0 +1,161 @@
+//
+//  state_filter.hpp
+//  Metal-Guide
+//
+
+#pragma once
+
+#include <Metal/Metal.hpp>
+
+#include <array>
+#include <cstdint>
+
+struct StateFilterStats {
+    NS::UInteger forwarded = 0;
+    NS::UInteger filtered = 0;
+
+    StateFilterStats& operator+=(const StateFilterStats& other) {
+        forwarded += other.forwarded;
+        filtered += other.filtered;
+        return *this;
+    }
+};
+
+// Last value sent to the encoder for one piece of state. Starts out unknown so the first set is always forwarded.
+template <typename T>
+class ShadowState {
+public:
+    // Returns true when value differs from the shadowed one and the call has to be forwarded.
+    bool update(const T& value, StateFilterStats& stats) {
+        if (known && current == value) {
+            stats.filtered++;
+            return false;
+        }
+        current = value;
+        known = true;
+        stats.forwarded++;
+        return true;
+    }
+
+    void forget() { known = false; }
+
+private:
+    T current = {};
+    bool known = false;
+};
+
+struct BufferBinding {
+    const MTL::Buffer* buffer;
+    NS::UInteger offset;
+
+    bool operator==(const BufferBinding& other) const { return buffer == other.buffer && offset == other.offset; }
+};
+
+struct ViewportState {
+    MTL::Viewport viewport;
+
+    bool operator==(const ViewportState& other) const;
+};
+
+struct ScissorState {
+    MTL::ScissorRect rect;
+
+    bool operator==(const ScissorState& other) const;
+};
+
+struct DepthBiasState {
+    float depthBias;
+    float slopeScale;
+    float clamp;
+
+    bool operator==(const DepthBiasState& other) const { return depthBias == other.depthBias && slopeScale == other.slopeScale && clamp == other.clamp; }
+};
+
+// Per-stage buffer, texture and sampler slots of an encoder.
+struct StageShadowState {
+    static constexpr NS::UInteger maxBuffers = 31;
+    static constexpr NS::UInteger maxTextures = 128;
+    static constexpr NS::UInteger maxSamplers = 16;
+
+    std::array<ShadowState<BufferBinding>, maxBuffers> buffers;
+    std::array<ShadowState<const MTL::Texture*>, maxTextures> textures;
+    std::array<ShadowState<const MTL::SamplerState*>, maxSamplers> samplers;
+
+    void forget();
+};
+
+// Wraps a render command encoder and drops state changes that repeat the current state. Anything the wrapper
+// doesn't filter, draws included, goes straight to encoder().
+class FilteredRenderEncoder {
+public:
+    explicit FilteredRenderEncoder(MTL::RenderCommandEncoder* encoder);
+
+    MTL::RenderCommandEncoder* encoder() const { return renderEncoder; }
+
+    void setRenderPipelineState(const MTL::RenderPipelineState* pipelineState);
+    void setDepthStencilState(const MTL::DepthStencilState* depthStencilState);
+    void setCullMode(MTL::CullMode cullMode);
+    void setFrontFacingWinding(MTL::Winding frontFacingWinding);
+    void setTriangleFillMode(MTL::TriangleFillMode fillMode);
+    void setDepthClipMode(MTL::DepthClipMode depthClipMode);
+    void setViewport(const MTL::Viewport& viewport);
+    void setScissorRect(const MTL::ScissorRect& rect);
+    void setDepthBias(float depthBias, float slopeScale, float clamp);
+    void setStencilReferenceValue(std::uint32_t referenceValue);
+
+    void setVertexBuffer(const MTL::Buffer* buffer, NS::UInteger offset, NS::UInteger index);
+    void setVertexTexture(const MTL::Texture* texture, NS::UInteger index);
+    void setVertexSamplerState(const MTL::SamplerState* sampler, NS::UInteger index);
+    void setFragmentBuffer(const MTL::Buffer* buffer, NS::UInteger offset, NS::UInteger index);
+    void setFragmentTexture(const MTL::Texture* texture, NS::UInteger index);
+    void setFragmentSamplerState(const MTL::SamplerState* sampler, NS::UInteger index);
+
+    // Call after changing state on encoder() directly, so the shadow copy doesn't go stale.
+    void forgetState();
+
+    const StateFilterStats& stats() const { return filterStats; }
+    void resetStats() { filterStats = {}; }
+
+private:
+    MTL::RenderCommandEncoder* renderEncoder;
+    StateFilterStats filterStats;
+
+    ShadowState<const MTL::RenderPipelineState*> pipelineState;
+    ShadowState<const MTL::DepthStencilState*> depthStencilState;
+    ShadowState<MTL::CullMode> cullMode;
+    ShadowState<MTL::Winding> frontFacingWinding;
+    ShadowState<MTL::TriangleFillMode> fillMode;
+    ShadowState<MTL::DepthClipMode> depthClipMode;
+    ShadowState<ViewportState> viewport;
+    ShadowState<ScissorState> scissorRect;
+    ShadowState<DepthBiasState> depthBias;
+    ShadowState<std::uint32_t> stencilReferenceValue;
+
+    StageShadowState vertexStage;
+    StageShadowState fragmentStage;
+};
+
+// Same as FilteredRenderEncoder, for compute command encoders.
+class FilteredComputeEncoder {
+public:
+    explicit FilteredComputeEncoder(MTL::ComputeCommandEncoder* encoder);
+
+    MTL::ComputeCommandEncoder* encoder() const { return computeEncoder; }
+
+    void setComputePipelineState(const MTL::ComputePipelineState* pipelineState);
+    void setBuffer(const MTL::Buffer* buffer, NS::UInteger offset, NS::UInteger index);
+    void setTexture(const MTL::Texture* texture, NS::UInteger index);
+    void setSamplerState(const MTL::SamplerState* sampler, NS::UInteger index);
+
+    void forgetState();
+
+    const StateFilterStats& stats() const { return filterStats; }
+    void resetStats() { filterStats = {}; }
+
+private:
+    MTL::ComputeCommandEncoder* computeEncoder;
+    StateFilterStats filterStats;
+
+    ShadowState<const MTL::ComputePipelineState*> pipelineState;
+    StageShadowState kernelStage;
+};
@@ -0,0 +1,216 @@
+//
+//  tile_residency.cpp
+//  Metal-Guide
+//
+
+#include "tile_residency.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <map>
+#include <tuple>
+#include <unordered_set>
+
+namespace {
+
+// Tile keys sort by slice, mip, z, y and x, which is the order batches are built in.
+constexpr std::uint32_t xBits = 14;
+constexpr std::uint32_t yBits = 14;
+constexpr std::uint32_t zBits = 10;
+constexpr std::uint32_t mipBits = 5;
+constexpr std::uint32_t sliceBits = 16;
+
+constexpr std::uint32_t yShift = xBits;
+constexpr std::uint32_t zShift = yShift + yBits;
+constexpr std::uint32_t mipShift = zShift + zBits;
+constexpr std::uint32_t sliceShift = mipShift + mipBits;
+
+std::uint32_t field(std::uint64_t key, std::uint32_t shift, std::uint32_t bits) {
+    return static_cast<std::uint32_t>((key >> shift) & ((std::uint64_t(1) << bits) - 1));
+}
+
+std::uint32_t mipExtent(std::uint32_t extent, std::uint32_t mipLevel) {
+    return std::max(extent >> mipLevel, 1u);
+}
+
+std::uint32_t divideUp(std::uint32_t value, std::uint32_t divisor) {
+    return (value + divisor - 1) / divisor;
+}
+
+}
+
+TileResidency::TileResidency(const SparseTextureLayout& layout, std::uint64_t budgetTiles)
+    : layout(layout), budgetTiles(budgetTiles) {
+    assert(layout.tileSize.width > 0 && layout.tileSize.height > 0 && layout.tileSize.depth > 0);
+    assert(layout.mipLevels <= (1u << mipBits) && layout.slices <= (1u << sliceBits));
+    assert(tileCount(0).width <= (1u << xBits) && tileCount(0).height <= (1u << yBits) && tileCount(0).depth <= (1u << zBits));
+}
+
+TileResidency::TileKey TileResidency::key(std::uint32_t x, std::uint32_t y, std::uint32_t z, std::uint32_t mipLevel, std::uint32_t slice) {
+    return std::uint64_t(x) | std::uint64_t(y) << yShift | std::uint64_t(z) << zShift | std::uint64_t(mipLevel) << mipShift
+        | std::uint64_t(slice) << sliceShift;
+}
+
+TileBox TileResidency::tileCount(std::uint32_t mipLevel) const {
+    if (mipLevel >= layout.firstMipInTail) {
+        return TileBox {};
+    }
+    return TileBox {
+        0, 0, 0,
+        divideUp(mipExtent(layout.width, mipLevel), layout.tileSize.width),
+        divideUp(mipExtent(layout.height, mipLevel), layout.tileSize.height),
+        divideUp(mipExtent(layout.depth, mipLevel), layout.tileSize.depth),
+    };
+}
+
+TileBox TileResidency::pixelsToTiles(const TileBox& pixels, std::uint32_t mipLevel, bool outward) const {
+    TileBox count = tileCount(mipLevel);
+    if (mipLevel >= layout.firstMipInTail) {
+        return count;
+    }
+    auto axis = [outward](std::uint32_t begin, std::uint32_t size, std::uint32_t tile, std::uint32_t tiles,
+                          std::uint32_t& first, std::uint32_t& length) {
+        std::uint32_t end = begin + size;
+        std::uint32_t firstTile = outward ? begin / tile : divideUp(begin, tile);
+        std::uint32_t endTile = std::min(outward ? divideUp(end, tile) : end / tile, tiles);
+        first = std::min(firstTile, endTile);
+        length = endTile - first;
+    };
+    TileBox tiles;
+    axis(pixels.x, pixels.width, layout.tileSize.width, count.width, tiles.x, tiles.width);
+    axis(pixels.y, pixels.height, layout.tileSize.height, count.height, tiles.y, tiles.height);
+    axis(pixels.z, pixels.depth, layout.tileSize.depth, count.depth, tiles.z, tiles.depth);
+    return tiles;
+}
+
+TileBox TileResidency::tilesToPixels(const TileBox& tiles, std::uint32_t mipLevel) const {
+    std::uint32_t level = std::min(mipLevel, layout.firstMipInTail);
+    auto axis = [](std::uint32_t first, std::uint32_t length, std::uint32_t tile, std::uint32_t extent,
+                   std::uint32_t& begin, std::uint32_t& size) {
+        begin = std::min(first * tile, extent);
+        size = std::min((first + length) * tile, extent) - begin;
+    };
+    TileBox pixels;
+    axis(tiles.x, tiles.width, layout.tileSize.width, mipExtent(layout.width, level), pixels.x, pixels.width);
+    axis(tiles.y, tiles.height, layout.tileSize.height, mipExtent(layout.height, level), pixels.y, pixels.height);
+    axis(tiles.z, tiles.depth, layout.tileSize.depth, mipExtent(layout.depth, level), pixels.z, pixels.depth);
+    return pixels;
+}
+
+void TileResidency::requestTile(TileKey tile) {
+    auto found = mapped.find(tile);
+    if (found != mapped.end()) {
+        if (found->second.lastUse != frame) {
+            found->second.lastUse = frame;
+            lru.splice(lru.end(), lru, found->second.lru);
+        }
+        return;
+    }
+    wanted.push_back(tile);
+}
+
+void TileResidency::request(const TileBox& pixels, std::uint32_t mipLevel, std::uint32_t slice) {
+    assert(mipLevel < layout.mipLevels && slice < layout.slices);
+    if (mipLevel >= layout.firstMipInTail) {
+        requestTile(key(0, 0, 0, layout.firstMipInTail, slice));
+        return;
+    }
+    TileBox tiles = pixelsToTiles(pixels, mipLevel);
+    for (std::uint32_t z = tiles.z; z < tiles.z + tiles.depth; z++) {
+        for (std::uint32_t y = tiles.y; y < tiles.y + tiles.height; y++) {
+            for (std::uint32_t x = tiles.x; x < tiles.x + tiles.width; x++) {
+                requestTile(key(x, y, z, mipLevel, slice));
+            }
+        }
+    }
+}
+
+bool TileResidency::isMapped(std::uint32_t x, std::uint32_t y, std::uint32_t z, std::uint32_t mipLevel, std::uint32_t slice) const {
+    if (mipLevel >= layout.firstMipInTail) {
+        return mapped.count(key(0, 0, 0, layout.firstMipInTail, slice)) != 0;
+    }
+    return mapped.count(key(x, y, z, mipLevel, slice)) != 0;
+}
+
+TileBatch TileResidency::batch(std::vector<TileKey>& keys) {
+    TileBatch result;
+    result.tiles = keys.size();
+    std::sort(keys.begin(), keys.end());
+
+    // Runs along x become rows; rows with the same x range on consecutive y become boxes.
+    std::map<std::tuple<std::uint32_t, std::uint32_t, std::uint32_t, std::uint32_t, std::uint32_t>, std::size_t> openBoxes;
+    std::size_t i = 0;
+    while (i < keys.size()) {
+        TileKey first = keys[i];
+        std::size_t runEnd = i + 1;
+        // A carry out of x into y is the start of the next row, not part of this run.
+        while (runEnd < keys.size() && keys[runEnd] == first + (runEnd - i) && field(keys[runEnd], 0, xBits) != 0) {
+            runEnd++;
+        }
+        std::uint32_t x = field(first, 0, xBits);
+        std::uint32_t width = static_cast<std::uint32_t>(runEnd - i);
+        std::uint32_t y = field(first, yShift, yBits);
+        std::uint32_t z = field(first, zShift, zBits);
+        std::uint32_t mipLevel = field(first, mipShift, mipBits);
+        std::uint32_t slice = field(first, sliceShift, sliceBits);
+        i = runEnd;
+
+        auto row = std::make_tuple(slice, mipLevel, z, x, width);
+        auto open = openBoxes.find(row);
+        if (open != openBoxes.end()) {
+            TileBox& box = result.regions[open->second];
+            if (box.y + box.height == y) {
+                box.height++;
+                continue;
+            }
+        }
+        openBoxes[row] = result.regions.size();
+        result.regions.push_back(TileBox { x, y, z, width, 1, 1 });
+        result.mipLevels.push_back(mipLevel);
+        result.slices.push_back(slice);
+    }
+    return result;
+}
+
+TileUpdates TileResidency::update() {
+    // The same tile may have been requested through several regions.
+    std::vector<TileKey> requested;
+    requested.reserve(wanted.size());
+    std::unordered_set<TileKey> seen;
+    for (TileKey tile : wanted) {
+        if (seen.insert(tile).second) {
+            requested.push_back(tile);
+        }
+    }
+    wanted.clear();
+
+    std::vector<TileKey> evicted;
+    while (mapped.size() + requested.size() > budgetTiles && !lru.empty()) {
+        TileKey victim = lru.front();
+        // Everything from here on was requested this frame.
+        if (mapped[victim].lastUse == frame) {
+            break;
+        }
+        lru.pop_front();
+        mapped.erase(victim);
+        evicted.push_back(victim);
+    }
+
+    std::size_t room = budgetTiles > mapped.size() ? budgetTiles - mapped.size() : 0;
+    if (requested.size() > room) {
+        residencyStats.tilesDeferred += requested.size() - room;
+        requested.resize(room);
+    }
+    for (TileKey tile : requested) {
+        mapped[tile] = Tile { lru.insert(lru.end(), tile), frame };
+    }
+
+    TileUpdates updates { batch(evicted), batch(requested) };
+    residencyStats.mappedTiles = mapped.size();
+    residencyStats.tilesMapped += updates.map.tiles;
+    residencyStats.tilesUnmapped += updates.unmap.tiles;
+    residencyStats.mapRegions += updates.map.regions.size();
+    residencyStats.unmapRegions += updates.unmap.regions.size();
+    frame++;
+    return updates;
+}
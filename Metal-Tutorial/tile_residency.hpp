@@ -0,0 +1,103 @@
+//
+//  tile_residency.hpp
+//  Metal-Guide
+//
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+// Box in pixels or in tiles, depending on context.
+struct TileBox {
+    std::uint32_t x = 0;
+    std::uint32_t y = 0;
+    std::uint32_t z = 0;
+    std::uint32_t width = 1;
+    std::uint32_t height = 1;
+    std::uint32_t depth = 1;
+};
+
+// Parallel arrays in the layout updateTextureMappings takes, so a batch is applied with one call.
+struct TileBatch {
+    std::vector<TileBox> regions;
+    std::vector<std::uint32_t> mipLevels;
+    std::vector<std::uint32_t> slices;
+    std::uint64_t tiles = 0;
+
+    bool empty() const { return regions.empty(); }
+};
+
+struct TileUpdates {
+    TileBatch unmap;
+    TileBatch map;
+};
+
+struct TileResidencyStats {
+    std::uint64_t mappedTiles = 0;
+    std::uint64_t tilesMapped = 0;
+    std::uint64_t tilesUnmapped = 0;
+    std::uint64_t tilesDeferred = 0;
+    std::uint64_t mapRegions = 0;
+    std::uint64_t unmapRegions = 0;
+};
+
+struct SparseTextureLayout {
+    std::uint32_t width;
+    std::uint32_t height;
+    std::uint32_t depth;
+    std::uint32_t mipLevels;
+    std::uint32_t slices;
+    // Mips from here on share one tail allocation per slice, mapped as tile (0, 0, 0) of this level.
+    std::uint32_t firstMipInTail;
+    TileBox tileSize;
+};
+
+// Which tiles of a sparse texture are mapped, without touching any API. Each frame, request() the pixel regions about
+// to be sampled; update() then evicts the least recently requested tiles if the new ones would go over budgetTiles, and
+// returns the unmaps and maps to apply, coalesced into as few boxes as it can. Tiles requested in the current frame are
+// never evicted for each other; requests that still don't fit are deferred and have to be made again.
+class TileResidency {
+public:
+    TileResidency(const SparseTextureLayout& layout, std::uint64_t budgetTiles);
+
+    // Tile range covering a pixel box of a mip, clamped to the mip. Outward covers every touched tile, inward only
+    // tiles entirely inside the box, matching MTLSparseTextureRegionAlignmentMode.
+    TileBox pixelsToTiles(const TileBox& pixels, std::uint32_t mipLevel, bool outward = true) const;
+    TileBox tilesToPixels(const TileBox& tiles, std::uint32_t mipLevel) const;
+    TileBox tileCount(std::uint32_t mipLevel) const;
+
+    void request(const TileBox& pixels, std::uint32_t mipLevel, std::uint32_t slice);
+
+    // Ends the frame. Apply unmap before map, both in the returned order.
+    TileUpdates update();
+
+    bool isMapped(std::uint32_t x, std::uint32_t y, std::uint32_t z, std::uint32_t mipLevel, std::uint32_t slice) const;
+    const TileResidencyStats& stats() const { return residencyStats; }
+
+private:
+    using TileKey = std::uint64_t;
+
+    struct Tile {
+        std::list<TileKey>::iterator lru;
+        std::uint64_t lastUse;
+    };
+
+    static TileKey key(std::uint32_t x, std::uint32_t y, std::uint32_t z, std::uint32_t mipLevel, std::uint32_t slice);
+    static TileBatch batch(std::vector<TileKey>& keys);
+
+    void requestTile(TileKey tile);
+
+    SparseTextureLayout layout;
+    std::uint64_t budgetTiles;
+    std::uint64_t frame = 0;
+
+    std::unordered_map<TileKey, Tile> mapped;
+    // Mapped tiles, least recently requested first.
+    std::list<TileKey> lru;
+    std::vector<TileKey> wanted;
+
+    TileResidencyStats residencyStats;
+};
@@ -0,0 +1,231 @@
+//
+//  tlsf_allocator.cpp
+//  Metal-Guide
+//
+
+#include "tlsf_allocator.hpp"
+
+#include <cassert>
+
+namespace {
+
+std::uint32_t highestBit(std::uint64_t value) {
+    return 63 - static_cast<std::uint32_t>(__builtin_clzll(value));
+}
+
+std::uint32_t lowestBit(std::uint64_t value) {
+    return static_cast<std::uint32_t>(__builtin_ctzll(value));
+}
+
+std::uint64_t alignUp(std::uint64_t value, std::uint64_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+}
+
+TlsfAllocator::TlsfAllocator(std::uint64_t capacity, std::uint64_t granularity)
+    : totalSize(capacity & ~(granularity - 1)), granularity(granularity), granularityLog2(lowestBit(granularity)) {
+    assert(granularity != 0 && (granularity & (granularity - 1)) == 0);
+    for (auto& lists : freeLists) {
+        lists.fill(nullBlock);
+    }
+    if (totalSize) {
+        insertFree(newBlock(0, totalSize));
+    }
+}
+
+// Sizes are counted in granules. Sizes below secondLevelCount granules are binned exactly in the first row, larger
+// ones by their highest bit and the secondLevelLog2 bits below it.
+TlsfAllocator::Bin TlsfAllocator::binForSize(std::uint64_t size) const {
+    std::uint64_t granules = size >> granularityLog2;
+    if (granules < secondLevelCount) {
+        return Bin { 0, static_cast<std::uint32_t>(granules) };
+    }
+    std::uint32_t top = highestBit(granules);
+    std::uint32_t secondLevel = static_cast<std::uint32_t>(granules >> (top - secondLevelLog2)) & (secondLevelCount - 1);
+    return Bin { top - secondLevelLog2 + 1, secondLevel };
+}
+
+// Rounds the request up to the next bin boundary, so that every block in the bin that is found is large enough.
+bool TlsfAllocator::findFreeBin(std::uint64_t size, Bin& bin) const {
+    std::uint64_t granules = size >> granularityLog2;
+    if (granules >= secondLevelCount) {
+        granules += (std::uint64_t(1) << (highestBit(granules) - secondLevelLog2)) - 1;
+    }
+    bin = binForSize(granules << granularityLog2);
+    if (bin.firstLevel >= firstLevelCount) {
+        return false;
+    }
+
+    std::uint32_t secondLevelMap = secondLevelMaps[bin.firstLevel] & (~0u << bin.secondLevel);
+    if (!secondLevelMap) {
+        std::uint64_t firstLevelMapAbove = bin.firstLevel + 1 < firstLevelCount ? firstLevelMap & (~std::uint64_t(0) << (bin.firstLevel + 1)) : 0;
+        if (!firstLevelMapAbove) {
+            return false;
+        }
+        bin.firstLevel = lowestBit(firstLevelMapAbove);
+        secondLevelMap = secondLevelMaps[bin.firstLevel];
+    }
+    bin.secondLevel = lowestBit(secondLevelMap);
+    return true;
+}
+
+std::uint32_t TlsfAllocator::newBlock(std::uint64_t offset, std::uint64_t size) {
+    Block block = { offset, size, nullBlock, nullBlock, nullBlock, nullBlock, false };
+    if (!unusedBlocks.empty()) {
+        std::uint32_t index = unusedBlocks.back();
+        unusedBlocks.pop_back();
+        blocks[index] = block;
+        return index;
+    }
+    blocks.push_back(block);
+    return static_cast<std::uint32_t>(blocks.size() - 1);
+}
+
+void TlsfAllocator::releaseBlock(std::uint32_t index) {
+    unusedBlocks.push_back(index);
+}
+
+void TlsfAllocator::insertFree(std::uint32_t index) {
+    Block& block = blocks[index];
+    Bin bin = binForSize(block.size);
+    std::uint32_t& head = freeLists[bin.firstLevel][bin.secondLevel];
+
+    block.free = true;
+    block.prevFree = nullBlock;
+    block.nextFree = head;
+    if (head != nullBlock) {
+        blocks[head].prevFree = index;
+    }
+    head = index;
+
+    firstLevelMap |= std::uint64_t(1) << bin.firstLevel;
+    secondLevelMaps[bin.firstLevel] |= 1u << bin.secondLevel;
+    freeBlockCount++;
+}
+
+void TlsfAllocator::removeFree(std::uint32_t index) {
+    Block& block = blocks[index];
+    Bin bin = binForSize(block.size);
+    std::uint32_t& head = freeLists[bin.firstLevel][bin.secondLevel];
+
+    if (block.prevFree != nullBlock) {
+        blocks[block.prevFree].nextFree = block.nextFree;
+    } else {
+        head = block.nextFree;
+    }
+    if (block.nextFree != nullBlock) {
+        blocks[block.nextFree].prevFree = block.prevFree;
+    }
+    if (head == nullBlock) {
+        secondLevelMaps[bin.firstLevel] &= ~(1u << bin.secondLevel);
+        if (!secondLevelMaps[bin.firstLevel]) {
+            firstLevelMap &= ~(std::uint64_t(1) << bin.firstLevel);
+        }
+    }
+
+    block.free = false;
+    freeBlockCount--;
+}
+
+// Cuts block index down to size and returns the new block holding the rest, linked in physical order.
+std::uint32_t TlsfAllocator::splitTail(std::uint32_t index, std::uint64_t size) {
+    std::uint32_t rest = newBlock(blocks[index].offset + size, blocks[index].size - size);
+    Block& block = blocks[index];
+    Block& tail = blocks[rest];
+
+    tail.prevPhysical = index;
+    tail.nextPhysical = block.nextPhysical;
+    if (block.nextPhysical != nullBlock) {
+        blocks[block.nextPhysical].prevPhysical = rest;
+    }
+    block.nextPhysical = rest;
+    block.size = size;
+    return rest;
+}
+
+TlsfAllocation TlsfAllocator::allocate(std::uint64_t size, std::uint64_t alignment) {
+    assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+    size = alignUp(size ? size : 1, granularity);
+    alignment = alignment > granularity ? alignment : granularity;
+
+    // Offsets are always granule aligned, so only larger alignments need room for padding.
+    std::uint64_t searchSize = size + (alignment - granularity);
+    Bin bin;
+    if (searchSize > totalSize || !findFreeBin(searchSize, bin)) {
+        return TlsfAllocation {};
+    }
+
+    std::uint32_t index = freeLists[bin.firstLevel][bin.secondLevel];
+    removeFree(index);
+
+    std::uint64_t padding = alignUp(blocks[index].offset, alignment) - blocks[index].offset;
+    if (padding) {
+        // The padding stays behind as a free block; its physical predecessor can't be free, or they'd be merged.
+        std::uint32_t aligned = splitTail(index, padding);
+        insertFree(index);
+        index = aligned;
+    }
+    if (blocks[index].size - size >= granularity) {
+        insertFree(splitTail(index, size));
+    }
+
+    usedBytes += blocks[index].size;
+    allocationCount++;
+    return TlsfAllocation { blocks[index].offset, blocks[index].size, index };
+}
+
+void TlsfAllocator::free(const TlsfAllocation& allocation) {
+    if (!allocation) {
+        return;
+    }
+    std::uint32_t index = allocation.block;
+    assert(index < blocks.size() && !blocks[index].free && blocks[index].offset == allocation.offset);
+
+    usedBytes -= blocks[index].size;
+    allocationCount--;
+
+    std::uint32_t prev = blocks[index].prevPhysical;
+    if (prev != nullBlock && blocks[prev].free) {
+        removeFree(prev);
+        blocks[prev].size += blocks[index].size;
+        blocks[prev].nextPhysical = blocks[index].nextPhysical;
+        if (blocks[index].nextPhysical != nullBlock) {
+            blocks[blocks[index].nextPhysical].prevPhysical = prev;
+        }
+        releaseBlock(index);
+        index = prev;
+    }
+
+    std::uint32_t next = blocks[index].nextPhysical;
+    if (next != nullBlock && blocks[next].free) {
+        removeFree(next);
+        blocks[index].size += blocks[next].size;
+        blocks[index].nextPhysical = blocks[next].nextPhysical;
+        if (blocks[next].nextPhysical != nullBlock) {
+            blocks[blocks[next].nextPhysical].prevPhysical = index;
+        }
+        releaseBlock(next);
+    }
+
+    insertFree(index);
+}
+
+TlsfStats TlsfAllocator::stats() const {
+    TlsfStats stats;
+    stats.capacity = totalSize;
+    stats.usedBytes = usedBytes;
+    stats.freeBytes = totalSize - usedBytes;
+    stats.allocations = allocationCount;
+    stats.freeBlocks = freeBlockCount;
+
+    // The largest block sits in the highest non-empty bin, though not necessarily at its head.
+    if (firstLevelMap) {
+        std::uint32_t firstLevel = highestBit(firstLevelMap);
+        std::uint32_t secondLevel = highestBit(secondLevelMaps[firstLevel]);
+        for (std::uint32_t index = freeLists[firstLevel][secondLevel]; index != nullBlock; index = blocks[index].nextFree) {
+            stats.largestFreeBlock = blocks[index].size > stats.largestFreeBlock ? blocks[index].size : stats.largestFreeBlock;
+        }
+    }
+    return stats;
+}
@@ -0,0 +1,94 @@
+//
+//  tlsf_allocator.hpp
+//  Metal-Guide
+//
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+struct TlsfAllocation {
+    static constexpr std::uint32_t invalidBlock = UINT32_MAX;
+
+    std::uint64_t offset = 0;
+    std::uint64_t size = 0;
+    std::uint32_t block = invalidBlock;
+
+    explicit operator bool() const { return block != invalidBlock; }
+};
+
+struct TlsfStats {
+    std::uint64_t capacity = 0;
+    std::uint64_t usedBytes = 0;
+    std::uint64_t freeBytes = 0;
+    std::uint64_t largestFreeBlock = 0;
+    std::uint32_t allocations = 0;
+    std::uint32_t freeBlocks = 0;
+
+    // 0 when all free space is one block, approaching 1 as it splinters into small pieces.
+    double fragmentation() const { return freeBytes ? 1.0 - double(largestFreeBlock) / double(freeBytes) : 0.0; }
+};
+
+// Two-level segregated-fit allocator over an abstract range of capacity bytes. It hands out offsets only, so it can
+// manage a placement heap, a large buffer or anything else that is addressed by offset. Allocation and free are O(1):
+// free blocks are binned by size class in two bitmap levels, and freed blocks merge with free neighbours immediately.
+// Offsets and sizes are multiples of granularity, which must be a power of two.
+class TlsfAllocator {
+public:
+    explicit TlsfAllocator(std::uint64_t capacity, std::uint64_t granularity = 256);
+
+    // Returns an empty allocation when no free block is large enough. alignment must be a power of two.
+    TlsfAllocation allocate(std::uint64_t size, std::uint64_t alignment);
+    void free(const TlsfAllocation& allocation);
+
+    std::uint64_t capacity() const { return totalSize; }
+    bool empty() const { return allocationCount == 0; }
+    TlsfStats stats() const;
+
+private:
+    static constexpr std::uint32_t secondLevelLog2 = 4;
+    static constexpr std::uint32_t secondLevelCount = 1u << secondLevelLog2;
+    static constexpr std::uint32_t firstLevelCount = 64;
+    static constexpr std::uint32_t nullBlock = TlsfAllocation::invalidBlock;
+
+    struct Block {
+        std::uint64_t offset;
+        std::uint64_t size;
+        std::uint32_t prevPhysical;
+        std::uint32_t nextPhysical;
+        std::uint32_t prevFree;
+        std::uint32_t nextFree;
+        bool free;
+    };
+
+    struct Bin {
+        std::uint32_t firstLevel;
+        std::uint32_t secondLevel;
+    };
+
+    Bin binForSize(std::uint64_t size) const;
+    bool findFreeBin(std::uint64_t size, Bin& bin) const;
+
+    std::uint32_t newBlock(std::uint64_t offset, std::uint64_t size);
+    void releaseBlock(std::uint32_t index);
+    void insertFree(std::uint32_t index);
+    void removeFree(std::uint32_t index);
+    std::uint32_t splitTail(std::uint32_t index, std::uint64_t size);
+
+    std::uint64_t totalSize;
+    std::uint64_t granularity;
+    std::uint32_t granularityLog2;
+
+    std::vector<Block> blocks;
+    std::vector<std::uint32_t> unusedBlocks;
+
+    std::uint64_t firstLevelMap = 0;
+    std::array<std::uint32_t, firstLevelCount> secondLevelMaps = {};
+    std::array<std::array<std::uint32_t, secondLevelCount>, firstLevelCount> freeLists;
+
+    std::uint64_t usedBytes = 0;
+    std::uint32_t allocationCount = 0;
+    std::uint32_t freeBlockCount = 0;
+};
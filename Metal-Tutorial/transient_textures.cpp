@@ -0,0 +1,146 @@
+//
+//  transient_textures.cpp
+//  Metal-Guide
+//
+
+#include "transient_textures.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+TransientTextures::TransientTextures(MTL::Device* device)
+    : device(device) {
+}
+
+TransientTextures::~TransientTextures() {
+    clear();
+}
+
+std::uint32_t TransientTextures::add(const MTL::TextureDescriptor* descriptor, std::uint32_t firstPass, std::uint32_t lastPass) {
+    assert(descriptor->storageMode() == MTL::StorageModePrivate);
+
+    MTL::SizeAndAlign sizeAndAlign = device->heapTextureSizeAndAlign(descriptor);
+    descriptors.push_back(descriptor->copy());
+    return planner.add(TransientResource { sizeAndAlign.size, sizeAndAlign.align, firstPass, lastPass });
+}
+
+bool TransientTextures::build() {
+    releaseResources();
+    aliasPlan = planner.plan();
+    if (descriptors.empty()) {
+        return true;
+    }
+
+    MTL::HeapDescriptor* heapDescriptor = MTL::HeapDescriptor::alloc()->init();
+    heapDescriptor->setType(MTL::HeapTypePlacement);
+    heapDescriptor->setStorageMode(MTL::StorageModePrivate);
+    heapDescriptor->setSize(aliasPlan.heapSize);
+    heap = device->newHeap(heapDescriptor);
+    heapDescriptor->release();
+    if (!heap) {
+        return false;
+    }
+    heap->setLabel(MTLSTR("Transient Textures"));
+
+    for (std::uint32_t i = 0; i < descriptors.size(); i++) {
+        MTL::Texture* texture = heap->newTexture(descriptors[i], aliasPlan.offsets[i]);
+        if (!texture) {
+            releaseResources();
+            return false;
+        }
+        textures.push_back(texture);
+    }
+
+    std::uint32_t passCount = 0;
+    for (std::uint32_t i = 0; i < planner.resourceCount(); i++) {
+        passCount = std::max(passCount, planner.resource(i).lastPass + 1);
+    }
+    releaseFences.assign(passCount, nullptr);
+    acquireFences.assign(passCount, {});
+
+    for (const AliasingBarrier& barrier : aliasPlan.barriers) {
+        MTL::Fence*& fence = releaseFences[barrier.releasePass];
+        if (!fence) {
+            fence = device->newFence();
+        }
+        acquireFences[barrier.acquirePass].push_back(fence);
+    }
+    return true;
+}
+
+void TransientTextures::clear() {
+    releaseResources();
+    for (MTL::TextureDescriptor* descriptor : descriptors) {
+        descriptor->release();
+    }
+    descriptors.clear();
+    planner.clear();
+    aliasPlan = AliasPlan {};
+}
+
+void TransientTextures::releaseResources() {
+    for (MTL::Texture* texture : textures) {
+        texture->release();
+    }
+    textures.clear();
+    for (MTL::Fence* fence : releaseFences) {
+        if (fence) {
+            fence->release();
+        }
+    }
+    releaseFences.clear();
+    acquireFences.clear();
+    if (heap) {
+        heap->release();
+        heap = nullptr;
+    }
+}
+
+NS::UInteger TransientTextures::fenceCount() const {
+    return static_cast<NS::UInteger>(std::count_if(releaseFences.begin(), releaseFences.end(), [](MTL::Fence* fence) { return fence != nullptr; }));
+}
+
+const std::vector<MTL::Fence*>& TransientTextures::waitsBefore(std::uint32_t pass) const {
+    static const std::vector<MTL::Fence*> none;
+    return pass < acquireFences.size() ? acquireFences[pass] : none;
+}
+
+MTL::Fence* TransientTextures::updateAfter(std::uint32_t pass) const {
+    return pass < releaseFences.size() ? releaseFences[pass] : nullptr;
+}
+
+void TransientTextures::beginPass(std::uint32_t pass, MTL::RenderCommandEncoder* encoder) const {
+    for (MTL::Fence* fence : waitsBefore(pass)) {
+        encoder->waitForFence(fence, MTL::RenderStageVertex);
+    }
+}
+
+void TransientTextures::endPass(std::uint32_t pass, MTL::RenderCommandEncoder* encoder) const {
+    if (MTL::Fence* fence = updateAfter(pass)) {
+        encoder->updateFence(fence, MTL::RenderStageFragment);
+    }
+}
+
+void TransientTextures::beginPass(std::uint32_t pass, MTL::ComputeCommandEncoder* encoder) const {
+    for (MTL::Fence* fence : waitsBefore(pass)) {
+        encoder->waitForFence(fence);
+    }
+}
+
+void TransientTextures::endPass(std::uint32_t pass, MTL::ComputeCommandEncoder* encoder) const {
+    if (MTL::Fence* fence = updateAfter(pass)) {
+        encoder->updateFence(fence);
+    }
+}
+
+void TransientTextures::beginPass(std::uint32_t pass, MTL::BlitCommandEncoder* encoder) const {
+    for (MTL::Fence* fence : waitsBefore(pass)) {
+        encoder->waitForFence(fence);
+    }
+}
+
+void TransientTextures::endPass(std::uint32_t pass, MTL::BlitCommandEncoder* encoder) const {
+    if (MTL::Fence* fence = updateAfter(pass)) {
+        encoder->updateFence(fence);
+    }
+}
@@ -0,0 +1,77 @@
+//
+//  transient_textures.hpp
+//  Metal-Guide
+//
+
+#pragma once
+
+#include <Metal/Metal.hpp>
+
+#include "alias_planner.hpp"
+
+#include <cstdint>
+#include <vector>
+
+// Render targets and other intermediates that live for a few passes of a frame, aliased into one placement heap.
+// Register each texture with the passes that first and last use it, call build(), then bracket every pass with
+// beginPass()/endPass() so the fences between aliasing textures are waited on and updated automatically:
+//
+//     std::uint32_t bloom = transients.add(bloomDescriptor, 2, 4);
+//     transients.build();
+//     ...
+//     transients.beginPass(2, encoder);
+//     encoder->setFragmentTexture(transients.texture(bloom), 0);
+//     ...
+//     transients.endPass(2, encoder);
+//
+// Passes are numbered in encoding order, starting at 0. Textures must use StorageModePrivate.
+class TransientTextures {
+public:
+    explicit TransientTextures(MTL::Device* device);
+    ~TransientTextures();
+
+    TransientTextures(const TransientTextures&) = delete;
+    TransientTextures& operator=(const TransientTextures&) = delete;
+
+    std::uint32_t add(const MTL::TextureDescriptor* descriptor, std::uint32_t firstPass, std::uint32_t lastPass);
+
+    // Plans the offsets and (re)creates the heap, the textures and the fences. Call again after adding textures.
+    // Returns false, with nothing created, when the device can't create the heap or one of the textures.
+    bool build();
+
+    // Releases all textures and descriptors, so that a different frame layout can be registered.
+    void clear();
+
+    MTL::Texture* texture(std::uint32_t index) const { return textures[index]; }
+
+    void beginPass(std::uint32_t pass, MTL::RenderCommandEncoder* encoder) const;
+    void endPass(std::uint32_t pass, MTL::RenderCommandEncoder* encoder) const;
+    void beginPass(std::uint32_t pass, MTL::ComputeCommandEncoder* encoder) const;
+    void endPass(std::uint32_t pass, MTL::ComputeCommandEncoder* encoder) const;
+    void beginPass(std::uint32_t pass, MTL::BlitCommandEncoder* encoder) const;
+    void endPass(std::uint32_t pass, MTL::BlitCommandEncoder* encoder) const;
+
+    // Bytes needed with aliasing, and what dedicated allocations would have taken.
+    std::uint64_t heapSize() const { return aliasPlan.heapSize; }
+    std::uint64_t unaliasedSize() const { return aliasPlan.unaliasedSize; }
+    NS::UInteger fenceCount() const;
+
+private:
+    void releaseResources();
+
+    const std::vector<MTL::Fence*>& waitsBefore(std::uint32_t pass) const;
+    MTL::Fence* updateAfter(std::uint32_t pass) const;
+
+    MTL::Device* device;
+    AliasPlanner planner;
+    AliasPlan aliasPlan;
+
+    std::vector<MTL::TextureDescriptor*> descriptors;
+    std::vector<MTL::Texture*> textures;
+    MTL::Heap* heap = nullptr;
+
+    // Indexed by pass: the fence a pass updates once it no longer needs memory that later passes reuse, and the
+    // fences it waits for before touching memory that earlier passes used.
+    std::vector<MTL::Fence*> releaseFences;
+    std::vector<std::vector<MTL::Fence*>> acquireFences;
+};
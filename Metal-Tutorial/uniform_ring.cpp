@@ -0,0 +1,124 @@
+//
+//  uniform_ring.cpp
+//  Metal-Guide
+//
+
+#include "uniform_ring.hpp"
+
+#include <cassert>
+
+namespace {
+
+NS::UInteger alignUp(NS::UInteger value, NS::UInteger alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+}
+
+UniformRing::UniformRing(
+    MTL::Device* device, NS::UInteger bytesPerFrame, NS::UInteger framesInFlight, RingFullPolicy policy, NS::UInteger maxRegions)
+    : device(device), fullPolicy(policy), regionLimit(maxRegions ? maxRegions : 2 * framesInFlight),
+      ring(alignUp(bytesPerFrame, defaultAlignment), framesInFlight) {
+    assert(regionLimit >= framesInFlight);
+    installBuffer(newRingBuffer(ring.capacity()));
+}
+
+UniformRing::~UniformRing() {
+    // The completion handlers capture this, so wait for them before going away.
+    if (framesSubmitted) {
+        ring.waitForFrame(lastSubmittedFrame);
+    }
+    for (auto& retired : retiredBuffers) {
+        retired.buffer->release();
+    }
+    if (currentBuffer) {
+        currentBuffer->release();
+    }
+}
+
+void UniformRing::beginFrame() {
+    assert(!frameOpen);
+    releaseRetiredBuffers();
+
+    if (!currentBuffer) {
+        installBuffer(newRingBuffer(ring.capacity()));
+    }
+    // Growing needs the larger buffer first; without one, the ring blocks as if it were at its limit.
+    if (fullPolicy == RingFullPolicy::Grow && currentBuffer && ring.regionCount() < regionLimit && !ring.regionReady()) {
+        if (MTL::Buffer* grown = newRingBuffer(ring.regionSize() * (ring.regionCount() + 1))) {
+            ring.growIfFull(regionLimit);
+            installBuffer(grown);
+        }
+    }
+    currentFrame = ring.beginFrame();
+    frameOpen = true;
+}
+
+UniformAllocation UniformRing::allocate(NS::UInteger size, NS::UInteger alignment) {
+    assert(frameOpen);
+    if (!currentBuffer) {
+        return UniformAllocation {};
+    }
+
+    std::optional<std::size_t> offset = ring.allocate(size, alignment);
+    if (!offset) {
+        // Waiting can't help a frame that outgrew its own region.
+        NS::UInteger regionSize = ring.regionSize() * 2;
+        while (regionSize < alignUp(size, alignment)) {
+            regionSize *= 2;
+        }
+        MTL::Buffer* grown = newRingBuffer(regionSize * ring.regionCount());
+        if (!grown) {
+            return UniformAllocation {};
+        }
+        ring.reset(regionSize);
+        installBuffer(grown);
+        offset = ring.allocate(size, alignment);
+        assert(offset);
+    }
+    return UniformAllocation { currentBuffer, *offset, contents + *offset };
+}
+
+void UniformRing::endFrame(MTL::CommandBuffer* commandBuffer) {
+    assert(frameOpen);
+    frameOpen = false;
+
+    std::uint64_t serial = ring.endFrame();
+    lastSubmittedFrame = serial;
+    framesSubmitted = true;
+    commandBuffer->addCompletedHandler([this, serial](MTL::CommandBuffer*) { ring.completeFrame(serial); });
+}
+
+MTL::Buffer* UniformRing::newRingBuffer(NS::UInteger capacity) const {
+    MTL::Buffer* buffer = device->newBuffer(capacity, MTL::ResourceStorageModeShared | MTL::ResourceCPUCacheModeWriteCombined);
+    if (buffer) {
+        buffer->setLabel(MTLSTR("Uniform Ring"));
+    }
+    return buffer;
+}
+
+void UniformRing::installBuffer(MTL::Buffer* buffer) {
+    if (!buffer) {
+        return;
+    }
+    if (currentBuffer) {
+        // currentFrame is the open frame, which may already have written to the old buffer, or the last one submitted.
+        retiredBuffers.push_back(RetiredBuffer { currentBuffer, currentFrame });
+        replacements++;
+    }
+    currentBuffer = buffer;
+    contents = static_cast<std::uint8_t*>(currentBuffer->contents());
+}
+
+void UniformRing::releaseRetiredBuffers() {
+    std::uint64_t completed = ring.completedFrames();
+    auto it = retiredBuffers.begin();
+    while (it != retiredBuffers.end()) {
+        if (it->lastFrame < completed) {
+            it->buffer->release();
+            it = retiredBuffers.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
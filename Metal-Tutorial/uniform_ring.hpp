@@ -0,0 +1,103 @@
+//
+//  uniform_ring.hpp
+//  Metal-Guide
+//
+
+#pragma once
+
+#include <Metal/Metal.hpp>
+
+#include "frame_ring.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// What to do when the GPU still reads the region the next frame wants to write.
+enum class RingFullPolicy {
+    Block, // wait for the GPU to finish the frame that used the region
+    Grow,  // add a region, up to the ring's region limit, and block once it is reached
+};
+
+struct UniformAllocation {
+    MTL::Buffer* buffer = nullptr;
+    NS::UInteger offset = 0;
+    void* contents = nullptr;
+
+    explicit operator bool() const { return buffer != nullptr; }
+};
+
+// Streams per-frame constants out of one persistently mapped shared buffer, split into one region per frame in
+// flight. Replaces newBuffer and setVertexBytes calls for per-draw data:
+//
+//     ring.beginFrame();
+//     UniformAllocation uniforms = ring.push(drawUniforms);
+//     encoder->setVertexBuffer(uniforms.buffer, uniforms.offset, 1);
+//     ...
+//     ring.endFrame(commandBuffer);
+//
+// Growing moves the ring to a larger buffer and retires the old one once the GPU is done with it. Under Grow the ring
+// adds a region whenever the GPU falls behind, until it has maxRegions (twice framesInFlight when 0), so the CPU
+// never runs more than maxRegions frames ahead. A frame that outgrows its region moves the ring to a buffer with
+// regions twice as large, whatever the policy. Bind allocation.buffer rather than caching buffer(), because the
+// buffer changes when the ring grows.
+//
+// If newBuffer fails, the ring keeps the buffer it has: Grow blocks instead, and an allocation that needed a larger
+// buffer comes back empty. Without any buffer every allocation is empty, and the next beginFrame() tries again.
+class UniformRing {
+public:
+    static constexpr NS::UInteger defaultAlignment = 256;
+
+    UniformRing(MTL::Device* device, NS::UInteger bytesPerFrame, NS::UInteger framesInFlight, RingFullPolicy policy = RingFullPolicy::Block,
+        NS::UInteger maxRegions = 0);
+    ~UniformRing();
+
+    UniformRing(const UniformRing&) = delete;
+    UniformRing& operator=(const UniformRing&) = delete;
+
+    void beginFrame();
+    UniformAllocation allocate(NS::UInteger size, NS::UInteger alignment = defaultAlignment);
+
+    template <typename T>
+    UniformAllocation push(const T& value) {
+        UniformAllocation allocation = allocate(sizeof(T), alignof(T) > defaultAlignment ? alignof(T) : defaultAlignment);
+        if (allocation) {
+            std::memcpy(allocation.contents, &value, sizeof(T));
+        }
+        return allocation;
+    }
+
+    // Adds a completion handler to commandBuffer that hands the frame's region back to the ring. Call before commit().
+    void endFrame(MTL::CommandBuffer* commandBuffer);
+
+    MTL::Buffer* buffer() const { return currentBuffer; }
+    const FrameRingStats& stats() const { return ring.stats(); }
+    NS::UInteger bufferReplacements() const { return replacements; }
+
+private:
+    struct RetiredBuffer {
+        MTL::Buffer* buffer;
+        std::uint64_t lastFrame;
+    };
+
+    // Returns nullptr if the device can't allocate it.
+    MTL::Buffer* newRingBuffer(NS::UInteger capacity) const;
+    // Moves to buffer, retiring the current one until the frames using it complete. Does nothing for nullptr.
+    void installBuffer(MTL::Buffer* buffer);
+    void releaseRetiredBuffers();
+
+    MTL::Device* device;
+    RingFullPolicy fullPolicy;
+    NS::UInteger regionLimit;
+    FrameRing ring;
+
+    MTL::Buffer* currentBuffer = nullptr;
+    std::uint8_t* contents = nullptr;
+    std::uint64_t currentFrame = 0;
+    bool frameOpen = false;
+    std::uint64_t lastSubmittedFrame = 0;
+    bool framesSubmitted = false;
+    NS::UInteger replacements = 0;
+
+    std::vector<RetiredBuffer> retiredBuffers;
+};
@@ -0,0 +1,222 @@
+//
+//  upload_engine.cpp
+//  Metal-Guide
+//
+
+#include "upload_engine.hpp"
+
+#include <cassert>
+#include <chrono>
+#include <cstring>
+
+namespace {
+
+constexpr NS::UInteger bufferCopyAlignment = 4;
+constexpr NS::UInteger textureCopyAlignment = 256;
+
+NS::UInteger alignUp(NS::UInteger value, NS::UInteger alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+}
+
+UploadEngine::UploadEngine(MTL::Device* device, NS::UInteger pageSize)
+    : device(device), pageSize(pageSize), uploadFence(device->newFence()), uploadEvent(device->newSharedEvent()) {
+    uploadFence->setLabel(MTLSTR("Upload Fence"));
+    uploadEvent->setLabel(MTLSTR("Upload Event"));
+}
+
+UploadEngine::~UploadEngine() {
+    for (auto* pages : { &freePages, &openPages }) {
+        for (StagingPage& page : *pages) {
+            page.buffer->release();
+        }
+    }
+    // Command buffers retain the staging buffers they read from, so releasing pages still in flight is safe.
+    for (StagingPage& page : pagesInFlight) {
+        page.buffer->release();
+    }
+    uploadEvent->release();
+    uploadFence->release();
+}
+
+UploadEngine::StagingPage* UploadEngine::stage(const void* data, NS::UInteger size, NS::UInteger alignment, NS::UInteger& offset) {
+    for (StagingPage& page : openPages) {
+        NS::UInteger aligned = alignUp(page.used, alignment);
+        if (aligned + size <= page.capacity) {
+            offset = aligned;
+            page.used = aligned + size;
+            std::memcpy(page.contents + offset, data, size);
+            return &page;
+        }
+    }
+
+    recyclePages();
+
+    // Uploads larger than a page get a staging buffer of their own, released instead of recycled.
+    StagingPage page;
+    if (size <= pageSize && !freePages.empty()) {
+        page = freePages.back();
+        freePages.pop_back();
+    } else {
+        NS::UInteger capacity = size > pageSize ? alignUp(size, textureCopyAlignment) : pageSize;
+        MTL::Buffer* buffer = device->newBuffer(capacity, MTL::ResourceStorageModeShared | MTL::ResourceCPUCacheModeWriteCombined);
+        if (!buffer) {
+            return nullptr;
+        }
+        buffer->setLabel(MTLSTR("Upload Staging"));
+        page = StagingPage { buffer, static_cast<std::uint8_t*>(buffer->contents()), capacity, 0, 0 };
+        counters.stagingPagesCreated++;
+    }
+
+    offset = 0;
+    page.used = size;
+    std::memcpy(page.contents, data, size);
+    openPages.push_back(page);
+    return &openPages.back();
+}
+
+void UploadEngine::recyclePages() {
+    std::uint64_t completed = uploadEvent->signaledValue();
+    while (!pagesInFlight.empty() && pagesInFlight.front().lastTicket <= completed) {
+        StagingPage page = pagesInFlight.front();
+        pagesInFlight.pop_front();
+        if (page.capacity == pageSize) {
+            page.used = 0;
+            freePages.push_back(page);
+        } else {
+            page.buffer->release();
+        }
+    }
+}
+
+bool UploadEngine::uploadBuffer(MTL::Buffer* destination, NS::UInteger destinationOffset, const void* data, NS::UInteger size) {
+    assert(destinationOffset % bufferCopyAlignment == 0 && size % bufferCopyAlignment == 0);
+    if (size == 0) {
+        return false;
+    }
+
+    NS::UInteger sourceOffset = 0;
+    const StagingPage* page = stage(data, size, bufferCopyAlignment, sourceOffset);
+    if (!page) {
+        return false;
+    }
+    const MTL::Buffer* source = page->buffer;
+    counters.uploads++;
+    counters.uploadedBytes += size;
+    pendingBytes += size;
+
+    auto last = lastCopyTo.find(destination);
+    if (last != lastCopyTo.end()) {
+        BufferCopy& copy = bufferCopies[last->second];
+        if (copy.source == source && copy.sourceOffset + copy.size == sourceOffset && copy.destinationOffset + copy.size == destinationOffset) {
+            copy.size += size;
+            counters.mergedUploads++;
+            return true;
+        }
+    }
+
+    lastCopyTo[destination] = bufferCopies.size();
+    bufferCopies.push_back(BufferCopy { source, sourceOffset, destination, destinationOffset, size });
+    return true;
+}
+
+bool UploadEngine::uploadTexture(MTL::Texture* destination, NS::UInteger slice, NS::UInteger level, MTL::Origin origin, MTL::Size size,
+    const void* data, NS::UInteger bytesPerRow, NS::UInteger bytesPerImage) {
+    if (size.width == 0 || size.height == 0 || size.depth == 0) {
+        return false;
+    }
+    if (bytesPerImage == 0) {
+        // A single 2D image. Metal accepts 0 here, but the staging size and the copy both need the real stride.
+        assert(size.depth == 1);
+        bytesPerImage = bytesPerRow * size.height;
+    }
+    NS::UInteger byteCount = bytesPerImage * size.depth;
+    if (byteCount == 0) {
+        return false;
+    }
+
+    NS::UInteger sourceOffset = 0;
+    const StagingPage* page = stage(data, byteCount, textureCopyAlignment, sourceOffset);
+    if (!page) {
+        return false;
+    }
+    const MTL::Buffer* source = page->buffer;
+    counters.uploads++;
+    counters.uploadedBytes += byteCount;
+    pendingBytes += byteCount;
+
+    textureCopies.push_back(TextureCopy { source, sourceOffset, bytesPerRow, bytesPerImage, size, destination, slice, level, origin });
+    return true;
+}
+
+UploadTicket UploadEngine::flush(MTL::CommandBuffer* commandBuffer) {
+    if (bufferCopies.empty() && textureCopies.empty()) {
+        return UploadTicket {};
+    }
+
+    MTL::BlitCommandEncoder* encoder = commandBuffer->blitCommandEncoder();
+    encoder->pushDebugGroup(MTLSTR("Uploads"));
+    for (const BufferCopy& copy : bufferCopies) {
+        encoder->copyFromBuffer(copy.source, copy.sourceOffset, copy.destination, copy.destinationOffset, copy.size);
+    }
+    for (const TextureCopy& copy : textureCopies) {
+        encoder->copyFromBuffer(copy.source, copy.sourceOffset, copy.bytesPerRow, copy.bytesPerImage, copy.size,
+            copy.destination, copy.slice, copy.level, copy.origin);
+    }
+    encoder->popDebugGroup();
+    encoder->updateFence(uploadFence);
+    encoder->endEncoding();
+
+    UploadTicket ticket { nextTicket++ };
+    commandBuffer->encodeSignalEvent(uploadEvent, ticket.value);
+
+    auto start = std::chrono::steady_clock::now();
+    std::uint64_t bytes = pendingBytes;
+    std::shared_ptr<Throughput> shared = throughput;
+    commandBuffer->addCompletedHandler([shared, start, bytes](MTL::CommandBuffer*) {
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        shared->bytes += bytes;
+        shared->nanoseconds += static_cast<std::uint64_t>(elapsed.count());
+    });
+
+    counters.blits += bufferCopies.size() + textureCopies.size();
+    counters.flushes++;
+
+    for (StagingPage& page : openPages) {
+        page.lastTicket = ticket.value;
+        pagesInFlight.push_back(page);
+    }
+    openPages.clear();
+    bufferCopies.clear();
+    textureCopies.clear();
+    lastCopyTo.clear();
+    pendingBytes = 0;
+
+    return ticket;
+}
+
+bool UploadEngine::isComplete(UploadTicket ticket) const {
+    return uploadEvent->signaledValue() >= ticket.value;
+}
+
+void UploadEngine::encodeWait(MTL::CommandBuffer* commandBuffer, UploadTicket ticket) const {
+    if (ticket.value) {
+        commandBuffer->encodeWait(uploadEvent, ticket.value);
+    }
+}
+
+UploadStats UploadEngine::stats() const {
+    UploadStats result = counters;
+    std::uint64_t nanoseconds = throughput->nanoseconds;
+    if (nanoseconds) {
+        result.flushToCompletionMegabytesPerSecond = (double(throughput->bytes) / (1024.0 * 1024.0)) / (double(nanoseconds) * 1e-9);
+    }
+    return result;
+}
+
+void UploadEngine::resetStats() {
+    counters = UploadStats {};
+    throughput->bytes = 0;
+    throughput->nanoseconds = 0;
+}
@@ -0,0 +1,129 @@
+//
+//  upload_engine.hpp
+//  Metal-Guide
+//
+
+#pragma once
+
+#include <Metal/Metal.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// Identifies one flush. Complete once the engine's shared event reaches value.
+struct UploadTicket {
+    std::uint64_t value = 0;
+};
+
+struct UploadStats {
+    NS::UInteger uploads = 0;
+    NS::UInteger uploadedBytes = 0;
+    NS::UInteger blits = 0;
+    NS::UInteger mergedUploads = 0;
+    NS::UInteger flushes = 0;
+    NS::UInteger stagingPagesCreated = 0;
+
+    // Bytes per second from flush() to the command buffer's completion, averaged over all completed flushes. That span
+    // includes queueing behind earlier work and whatever else the command buffer does, so it is a lower bound on the
+    // copy rate, not the blit's own throughput.
+    double flushToCompletionMegabytesPerSecond = 0.0;
+};
+
+// Gathers uploads into private-storage buffers and textures. Data is copied into large shared staging pages right
+// away, and flush() encodes the blits for everything gathered so far. A buffer upload that continues the previous
+// upload to the same destination, from contiguous staging memory, extends that copy instead of adding a blit.
+//
+// Every flush updates fence() at the end of its blit pass and signals event() with the returned ticket's value.
+// Encoders later on the same queue can waitForFence(fence()); other queues and the CPU use the ticket.
+// Staging pages are recycled once the flush that used them has completed.
+class UploadEngine {
+public:
+    explicit UploadEngine(MTL::Device* device, NS::UInteger pageSize = 4 * 1024 * 1024);
+    ~UploadEngine();
+
+    UploadEngine(const UploadEngine&) = delete;
+    UploadEngine& operator=(const UploadEngine&) = delete;
+
+    // Both return false, and upload nothing, when there are no bytes to upload or no staging memory could be allocated.
+    //
+    // destinationOffset and size must be multiples of 4.
+    bool uploadBuffer(MTL::Buffer* destination, NS::UInteger destinationOffset, const void* data, NS::UInteger size);
+    // bytesPerImage may be 0 for a single 2D image, which is then size.height rows of bytesPerRow bytes. Pass it for
+    // block-compressed formats, where there are fewer rows than pixels.
+    bool uploadTexture(MTL::Texture* destination, NS::UInteger slice, NS::UInteger level, MTL::Origin origin, MTL::Size size,
+        const void* data, NS::UInteger bytesPerRow, NS::UInteger bytesPerImage);
+
+    // Encodes all gathered uploads into commandBuffer. Returns an empty ticket when there was nothing to upload.
+    UploadTicket flush(MTL::CommandBuffer* commandBuffer);
+
+    MTL::Fence* fence() const { return uploadFence; }
+    MTL::SharedEvent* event() const { return uploadEvent; }
+
+    bool isComplete(UploadTicket ticket) const;
+    void encodeWait(MTL::CommandBuffer* commandBuffer, UploadTicket ticket) const;
+
+    UploadStats stats() const;
+    void resetStats();
+
+private:
+    struct StagingPage {
+        MTL::Buffer* buffer;
+        std::uint8_t* contents;
+        NS::UInteger capacity;
+        NS::UInteger used;
+        std::uint64_t lastTicket;
+    };
+
+    struct BufferCopy {
+        const MTL::Buffer* source;
+        NS::UInteger sourceOffset;
+        MTL::Buffer* destination;
+        NS::UInteger destinationOffset;
+        NS::UInteger size;
+    };
+
+    struct TextureCopy {
+        const MTL::Buffer* source;
+        NS::UInteger sourceOffset;
+        NS::UInteger bytesPerRow;
+        NS::UInteger bytesPerImage;
+        MTL::Size size;
+        MTL::Texture* destination;
+        NS::UInteger slice;
+        NS::UInteger level;
+        MTL::Origin origin;
+    };
+
+    // Written from completion handlers, so shared with them rather than owned by the engine.
+    struct Throughput {
+        std::atomic<std::uint64_t> bytes { 0 };
+        std::atomic<std::uint64_t> nanoseconds { 0 };
+    };
+
+    // Copies data into staging memory and returns the page and offset it landed at, or null if a new page was needed
+    // and couldn't be allocated.
+    StagingPage* stage(const void* data, NS::UInteger size, NS::UInteger alignment, NS::UInteger& offset);
+    void recyclePages();
+
+    MTL::Device* device;
+    NS::UInteger pageSize;
+    MTL::Fence* uploadFence;
+    MTL::SharedEvent* uploadEvent;
+    std::uint64_t nextTicket = 1;
+
+    std::vector<StagingPage> freePages;
+    std::vector<StagingPage> openPages;
+    std::deque<StagingPage> pagesInFlight;
+
+    std::vector<BufferCopy> bufferCopies;
+    std::vector<TextureCopy> textureCopies;
+    std::unordered_map<const MTL::Buffer*, std::size_t> lastCopyTo;
+    NS::UInteger pendingBytes = 0;
+
+    UploadStats counters;
+    std::shared_ptr<Throughput> throughput = std::make_shared<Throughput>();
+};
@@ -0,0 +1,127 @@
+//
+//  work_stealing_pool.cpp
+//  Metal-Guide
+//
+
+#include "work_stealing_pool.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+WorkStealingPool::WorkStealingPool(std::size_t threadCount) {
+    if (threadCount == 0) {
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    for (std::size_t i = 0; i < threadCount; i++) {
+        queues.push_back(std::make_unique<Queue>());
+    }
+    // Queue 0 belongs to the thread calling run().
+    for (std::size_t i = 1; i < threadCount; i++) {
+        workers.emplace_back(&WorkStealingPool::workerLoop, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+bool WorkStealingPool::popLocal(std::size_t thread, std::size_t& task) {
+    Queue& queue = *queues[thread];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) {
+        return false;
+    }
+    task = queue.tasks.back();
+    queue.tasks.pop_back();
+    return true;
+}
+
+bool WorkStealingPool::steal(std::size_t thread, std::size_t& task) {
+    for (std::size_t i = 1; i < queues.size(); i++) {
+        Queue& victim = *queues[(thread + i) % queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            // The front is furthest from where the owner is working.
+            task = victim.tasks.front();
+            victim.tasks.pop_front();
+            steals.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingPool::execute(std::size_t thread) {
+    std::size_t task;
+    while (popLocal(thread, task) || steal(thread, task)) {
+        (*currentTask)(task);
+        executed.fetch_add(1, std::memory_order_relaxed);
+        if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            std::lock_guard<std::mutex> lock(mutex);
+            finished.notify_all();
+        }
+    }
+}
+
+void WorkStealingPool::workerLoop(std::size_t thread) {
+    std::uint64_t seenGeneration = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&] { return stopping || generation != seenGeneration; });
+            if (stopping) {
+                return;
+            }
+            seenGeneration = generation;
+        }
+        execute(thread);
+    }
+}
+
+void WorkStealingPool::run(std::size_t taskCount, const Task& task) {
+    if (taskCount == 0) {
+        return;
+    }
+    runs++;
+
+    // Published before any task is queued: threads still draining the previous run pick up tasks through the queue
+    // mutexes, which orders these writes before their reads.
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        currentTask = &task;
+        remaining.store(taskCount, std::memory_order_release);
+    }
+
+    // Contiguous blocks keep neighbouring tasks, which usually touch neighbouring data, on one thread.
+    for (std::size_t thread = 0; thread < queues.size(); thread++) {
+        std::size_t begin = taskCount * thread / queues.size();
+        std::size_t end = taskCount * (thread + 1) / queues.size();
+        std::lock_guard<std::mutex> lock(queues[thread]->mutex);
+        for (std::size_t i = begin; i < end; i++) {
+            queues[thread]->tasks.push_back(i);
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        generation++;
+    }
+    wake.notify_all();
+
+    execute(0);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [this] { return remaining.load(std::memory_order_acquire) == 0; });
+    currentTask = nullptr;
+}
+
+WorkStealingPoolStats WorkStealingPool::stats() const {
+    return WorkStealingPoolStats { runs, executed.load(std::memory_order_relaxed), steals.load(std::memory_order_relaxed) };
+}
@@ -0,0 +1,73 @@
+//
+//  work_stealing_pool.hpp
+//  Metal-Guide
+//
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct WorkStealingPoolStats {
+    std::uint64_t runs = 0;
+    std::uint64_t tasks = 0;
+    std::uint64_t steals = 0;
+};
+
+// Fixed set of threads running indexed tasks. run() deals the task indices out to per-thread queues in contiguous
+// blocks; each thread works through its own queue from the back and, once it's empty, steals from the front of the
+// others', so uneven tasks still spread over every core. The calling thread takes part, so a pool of one thread runs
+// everything inline.
+class WorkStealingPool {
+public:
+    using Task = std::function<void(std::size_t task)>;
+
+    // threadCount includes the thread calling run(); 0 picks the hardware concurrency.
+    explicit WorkStealingPool(std::size_t threadCount = 0);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    std::size_t threadCount() const { return queues.size(); }
+
+    // Calls task(i) for every i in [0, taskCount) and returns once all calls have returned. Not reentrant: tasks must
+    // not call run() themselves.
+    void run(std::size_t taskCount, const Task& task);
+
+    WorkStealingPoolStats stats() const;
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<std::size_t> tasks;
+    };
+
+    bool popLocal(std::size_t thread, std::size_t& task);
+    bool steal(std::size_t thread, std::size_t& task);
+    void execute(std::size_t thread);
+    void workerLoop(std::size_t thread);
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> workers;
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable finished;
+    const Task* currentTask = nullptr;
+    std::uint64_t generation = 0;
+    bool stopping = false;
+    std::atomic<std::size_t> remaining { 0 };
+
+    std::uint64_t runs = 0;
+    std::atomic<std::uint64_t> executed { 0 };
+    std::atomic<std::uint64_t> steals { 0 };
+};
@@ -0,0 +1,51 @@
+//
+//  benchmark.hpp
+//  Metal-Guide
+//
+//  Timing helpers for the Linux benchmarks. Each benchmark is its own executable; --quick shrinks the iteration counts
+//  so ctest can run it as a smoke test.
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace benchmark {
+
+inline bool quick(int argc, char** argv) {
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--quick") == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Keeps the compiler from optimizing away a result the benchmark doesn't otherwise use.
+template <typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Runs body(iterations) a few times and reports the fastest run per iteration, which is the least disturbed by
+// whatever else the machine is doing.
+template <typename Body>
+double measure(const char* name, std::uint64_t iterations, Body&& body, int repetitions = 5) {
+    double best = 0.0;
+    for (int repetition = 0; repetition < repetitions; repetition++) {
+        auto start = std::chrono::steady_clock::now();
+        body(iterations);
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        double perIteration = elapsed.count() / double(iterations);
+        if (repetition == 0 || perIteration < best) {
+            best = perIteration;
+        }
+    }
+    std::printf("%-48s %12.2f ns/op\n", name, best);
+    return best;
+}
+
+}
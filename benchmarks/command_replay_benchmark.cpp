@@ -0,0 +1,79 @@
+//
+//  command_replay_benchmark.cpp
+//  Metal-Guide
+//
+//  Cost per command of recording into a CommandList and of replaying it, against a stub encoder that only counts
+//  calls, next to calling the stub directly. The stream is a typical draw loop: a pipeline change every 16 draws, a
+//  vertex buffer and a few bytes of constants per draw.
+//
+
+#include "command_decoder.hpp"
+
+#include "benchmark.hpp"
+#include "../tests/stub_encoder.hpp"
+
+#include <cstdint>
+
+namespace {
+
+constexpr std::size_t drawsPerPipeline = 16;
+// setVertexBuffer, setVertexBytes and drawPrimitives per draw, plus the pipeline change.
+constexpr double commandsPerDraw = 3.0 + 1.0 / drawsPerPipeline;
+
+struct DrawConstants {
+    float transform[16];
+};
+
+template <typename Encoder>
+void encodeDraws(Encoder& encoder, std::size_t drawCount) {
+    DrawConstants constants {};
+    for (std::size_t draw = 0; draw < drawCount; draw++) {
+        if (draw % drawsPerPipeline == 0) {
+            encoder.setRenderPipelineState(reinterpret_cast<const MTL::RenderPipelineState*>(0x1000 + draw / drawsPerPipeline));
+        }
+        constants.transform[0] = float(draw);
+        encoder.setVertexBuffer(reinterpret_cast<const MTL::Buffer*>(0x2000), draw * 64, 0);
+        encoder.setVertexBytes(&constants, sizeof(constants), 1);
+        encoder.drawPrimitives(MTL::PrimitiveType(3), 0, 36, 1, 0);
+    }
+}
+
+}
+
+int main(int argc, char** argv) {
+    std::size_t drawCount = benchmark::quick(argc, argv) ? 1000 : 50000;
+    std::uint64_t frames = benchmark::quick(argc, argv) ? 2 : 20;
+    double commandsPerFrame = double(drawCount) * commandsPerDraw;
+
+    StubRenderEncoder direct;
+    double directNs = benchmark::measure("direct calls, per frame", frames, [&](std::uint64_t count) {
+        for (std::uint64_t frame = 0; frame < count; frame++) {
+            encodeDraws(direct, drawCount);
+        }
+        benchmark::doNotOptimize(direct.calls);
+    });
+
+    CommandList list;
+    RenderCommandRecorder recorder(list);
+    double recordNs = benchmark::measure("record, per frame", frames, [&](std::uint64_t count) {
+        for (std::uint64_t frame = 0; frame < count; frame++) {
+            list.reset();
+            encodeDraws(recorder, drawCount);
+        }
+        benchmark::doNotOptimize(list.byteSize());
+    });
+
+    StubRenderEncoder replayed;
+    double replayNs = benchmark::measure("replay, per frame", frames, [&](std::uint64_t count) {
+        for (std::uint64_t frame = 0; frame < count; frame++) {
+            replayRenderCommands(list, &replayed);
+        }
+        benchmark::doNotOptimize(replayed.calls);
+    });
+
+    std::printf("%zu draws, %.0f commands, %.1f KiB recorded\n", drawCount, commandsPerFrame, double(list.byteSize()) / 1024.0);
+    std::printf("per command: direct %.2f ns, record %.2f ns, replay %.2f ns (replay overhead %.2f ns)\n",
+                directNs / commandsPerFrame, recordNs / commandsPerFrame, replayNs / commandsPerFrame,
+                (replayNs - directNs) / commandsPerFrame);
+    return 0;
+}
@@ -0,0 +1,152 @@
+//
+//  defrag_planner_benchmark.cpp
+//  Metal-Guide
+//
+//  DefragPlanner on synthetic fragmentation traces: heaps are filled with buffers, a trace frees some of them, and the
+//  planner then runs once per frame with a fixed copy budget, with its moves applied right away, until it has nothing
+//  left to do. Reports the planning cost per frame, how many frames and bytes it took, and how many heaps drained.
+//
+
+#include "defrag_planner.hpp"
+
+#include "benchmark.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr std::uint64_t megabyte = 1 << 20;
+constexpr std::uint64_t heapSize = 64 * megabyte;
+constexpr std::uint64_t budgetPerFrame = 8 * megabyte;
+
+struct Block {
+    std::uint32_t heap;
+    TlsfAllocation allocation;
+    bool live;
+};
+
+struct Heaps {
+    std::vector<std::unique_ptr<TlsfAllocator>> allocators;
+    std::vector<Block> blocks;
+
+    bool place(std::uint64_t size, std::uint64_t alignment) {
+        for (std::uint32_t i = 0; i < allocators.size(); i++) {
+            if (TlsfAllocation allocation = allocators[i]->allocate(size, alignment)) {
+                blocks.push_back(Block { i, allocation, true });
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void free(Block& block) {
+        allocators[block.heap]->free(block.allocation);
+        block.live = false;
+    }
+
+    // What PlacementHeapAllocator::releaseEmptyHeaps does: only heaps at the end can go.
+    std::size_t releaseEmpty() {
+        std::size_t released = 0;
+        while (allocators.size() > 1 && allocators.back()->empty()) {
+            allocators.pop_back();
+            released++;
+        }
+        return released;
+    }
+};
+
+// Fills heapCount heaps to about 90% with buffers of 64 KiB to 4 MiB, then frees each with the probability the trace
+// gives for its heap.
+template <typename FreeProbability>
+Heaps makeTrace(std::uint32_t heapCount, std::uint64_t seed, FreeProbability freeProbability) {
+    std::mt19937_64 random(seed);
+    Heaps heaps;
+    for (std::uint32_t i = 0; i < heapCount; i++) {
+        heaps.allocators.push_back(std::make_unique<TlsfAllocator>(heapSize));
+    }
+    std::uint64_t target = heapSize * heapCount / 10 * 9;
+    for (std::uint64_t placed = 0; placed < target;) {
+        std::uint64_t size = (64 * 1024) << (random() % 7);
+        if (!heaps.place(size, 256 << (random() % 4))) {
+            break;
+        }
+        placed += size;
+    }
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    for (Block& block : heaps.blocks) {
+        if (unit(random) < freeProbability(block.heap, heapCount)) {
+            heaps.free(block);
+        }
+    }
+    return heaps;
+}
+
+void run(const char* name, Heaps heaps) {
+    DefragPlanner planner;
+    std::uint32_t heapsBefore = static_cast<std::uint32_t>(heaps.allocators.size());
+    std::uint64_t frames = 0;
+    std::uint64_t movedBytes = 0;
+    std::uint64_t moves = 0;
+    double planNanoseconds = 0.0;
+    heaps.releaseEmpty();
+
+    while (frames < 10000) {
+        auto start = std::chrono::steady_clock::now();
+        std::vector<TlsfStats> stats;
+        std::vector<TlsfAllocator*> allocators;
+        for (auto& allocator : heaps.allocators) {
+            stats.push_back(allocator->stats());
+            allocators.push_back(allocator.get());
+        }
+        std::vector<bool> sources = planner.pickSources(stats);
+        std::vector<DefragBlock> candidates;
+        for (std::uint32_t i = 0; i < heaps.blocks.size(); i++) {
+            const Block& block = heaps.blocks[i];
+            if (block.live && sources[block.heap]) {
+                candidates.push_back(DefragBlock { i, block.heap, block.allocation, 256 });
+            }
+        }
+        std::vector<DefragMove> planned = candidates.empty() ? std::vector<DefragMove>()
+                                                             : planner.plan(allocators, sources, std::move(candidates), budgetPerFrame);
+        planNanoseconds += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        frames++;
+        if (planned.empty()) {
+            break;
+        }
+
+        // The copy happens instantly here; the source range is freed and the block lives at its destination.
+        for (const DefragMove& move : planned) {
+            Block& block = heaps.blocks[move.owner];
+            heaps.allocators[block.heap]->free(block.allocation);
+            block.heap = move.toHeap;
+            block.allocation = move.to;
+            movedBytes += move.to.size;
+            moves++;
+        }
+        heaps.releaseEmpty();
+    }
+
+    std::printf("%-26s %9.2f us/frame %5llu frames %6llu moves %8.1f MiB moved %2u -> %2zu heaps\n", name,
+        planNanoseconds / double(frames) / 1000.0, static_cast<unsigned long long>(frames), static_cast<unsigned long long>(moves),
+        double(movedBytes) / double(megabyte), heapsBefore, heaps.allocators.size());
+}
+
+}
+
+int main(int argc, char** argv) {
+    std::uint32_t heapCount = benchmark::quick(argc, argv) ? 4 : 16;
+
+    run("uniform 60% freed", makeTrace(heapCount, 1, [](std::uint32_t, std::uint32_t) { return 0.6; }));
+    run("tail heaps mostly freed", makeTrace(heapCount, 2, [](std::uint32_t heap, std::uint32_t count) {
+        return heap >= count / 2 ? 0.85 : 0.2;
+    }));
+    run("head heaps mostly freed", makeTrace(heapCount, 3, [](std::uint32_t heap, std::uint32_t count) {
+        return heap < count / 2 ? 0.85 : 0.2;
+    }));
+    run("light churn 20% freed", makeTrace(heapCount, 4, [](std::uint32_t, std::uint32_t) { return 0.2; }));
+    return 0;
+}
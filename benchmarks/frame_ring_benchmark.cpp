@@ -0,0 +1,126 @@
+//
+//  frame_ring_benchmark.cpp
+//  Metal-Guide
+//
+//  Allocation cost and stall frequency of FrameRing under the Block and Grow policies of UniformRing, with a plain
+//  CPU buffer standing in for the MTL::Buffer and a thread standing in for the GPU. The simulated GPU keeps up with the
+//  CPU on average, but every 16th frame takes three times as long, which is what the Grow policy is meant to absorb.
+//
+
+#include "frame_ring.hpp"
+
+#include "benchmark.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+class SimulatedGpu {
+public:
+    explicit SimulatedGpu(FrameRing& ring) : ring(ring), worker([this] { run(); }) {}
+
+    ~SimulatedGpu() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        condition.notify_all();
+        worker.join();
+    }
+
+    void submit(std::uint64_t serial) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            submitted.push_back(serial);
+        }
+        condition.notify_all();
+    }
+
+private:
+    void run() {
+        std::uint64_t frame = 0;
+        while (true) {
+            std::uint64_t serial;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                condition.wait(lock, [&] { return stopping || !submitted.empty(); });
+                if (submitted.empty()) {
+                    return;
+                }
+                serial = submitted.front();
+                submitted.pop_front();
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(frame++ % 16 == 15 ? 1200 : 250));
+            ring.completeFrame(serial);
+        }
+    }
+
+    FrameRing& ring;
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::deque<std::uint64_t> submitted;
+    bool stopping = false;
+    std::thread worker;
+};
+
+struct Uniforms {
+    float transform[16];
+    float color[4];
+};
+
+void runPolicy(const char* name, bool grow, std::uint64_t frames) {
+    constexpr std::size_t framesInFlight = 2;
+    constexpr std::size_t maxRegions = 4;
+    constexpr std::size_t drawsPerFrame = 1000;
+
+    FrameRing ring(drawsPerFrame * 256, framesInFlight);
+    std::vector<std::uint8_t> memory(ring.capacity());
+    Uniforms uniforms = {};
+    std::uint64_t allocationNanoseconds = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    {
+        SimulatedGpu gpu(ring);
+        for (std::uint64_t frame = 0; frame < frames; frame++) {
+            if (grow && ring.growIfFull(maxRegions)) {
+                // Frames in flight keep reading the old memory on a GPU; here they read nothing, so just resize.
+                memory.resize(ring.capacity());
+            }
+            ring.beginFrame();
+
+            auto allocationStart = std::chrono::steady_clock::now();
+            for (std::size_t draw = 0; draw < drawsPerFrame; draw++) {
+                std::size_t offset = *ring.allocate(sizeof(Uniforms), 256);
+                std::memcpy(memory.data() + offset, &uniforms, sizeof(Uniforms));
+            }
+            allocationNanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - allocationStart).count();
+
+            gpu.submit(ring.endFrame());
+            // CPU-side frame work.
+            std::this_thread::sleep_for(std::chrono::microseconds(400));
+        }
+        ring.waitForFrame(frames - 1);
+    }
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    const FrameRingStats& stats = ring.stats();
+    std::printf("%-8s %8.2f ns/allocation %6.2f%% frames stalled %2zu regions %8.3f ms/frame\n", name,
+        double(allocationNanoseconds) / double(stats.allocations), 100.0 * double(stats.stalls) / double(stats.frames), ring.regionCount(),
+        elapsed.count() / double(frames));
+}
+
+}
+
+int main(int argc, char** argv) {
+    std::uint64_t frames = benchmark::quick(argc, argv) ? 64 : 2000;
+    runPolicy("Block", false, frames);
+    runPolicy("Grow", true, frames);
+    return 0;
+}
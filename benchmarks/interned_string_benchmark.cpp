@@ -0,0 +1,111 @@
+//
+//  interned_string_benchmark.cpp
+//  Metal-Guide
+//
+//  Per-frame cost of labelling objects with a String made each frame (alloc, copy and autorelease, then the pool
+//  drain) against an interned String from NS::InternString. The stand-in NSString below counts its allocations so the
+//  difference in allocations per frame is visible next to the timings.
+//
+
+#include <Foundation/NSAutoreleasePool.hpp>
+#include <Foundation/NSInternedString.hpp>
+#include <Foundation/NSString.hpp>
+
+#include "benchmark.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+struct StringStorage {
+    char* bytes;
+    std::uint64_t length;
+    bool freeWhenDone;
+};
+
+std::uint64_t stringAllocations = 0;
+
+StringStorage& storage(id self) {
+    return *static_cast<StringStorage*>(object_getIndexedIvars(self));
+}
+
+id allocString(id cls, SEL) {
+    stringAllocations++;
+    return class_createInstance(reinterpret_cast<Class>(cls), sizeof(StringStorage));
+}
+
+id initWithBytes(id self, SEL, void* bytes, std::uint64_t length, std::uint64_t, bool freeWhenDone) {
+    storage(self) = { static_cast<char*>(bytes), length, freeWhenDone };
+    return self;
+}
+
+id stringWithCString(id cls, SEL, const char* string, std::uint64_t) {
+    std::uint64_t length = std::strlen(string);
+    char* bytes = static_cast<char*>(std::malloc(length + 1));
+    std::memcpy(bytes, string, length + 1);
+    stringAllocations += 2;
+    id self = class_createInstance(reinterpret_cast<Class>(cls), sizeof(StringStorage));
+    storage(self) = { bytes, length, true };
+    return reinterpret_cast<NS::Object*>(self)->autorelease();
+}
+
+void deallocString(id self, SEL) {
+    if (storage(self).freeWhenDone) {
+        std::free(storage(self).bytes);
+    }
+    object_dispose(self);
+}
+
+void registerStringClass() {
+    Class string = objc_allocateClassPair(objc_lookUpClass("NSObject"), "NSString", 0);
+    class_addMethod(object_getClass(reinterpret_cast<id>(string)), sel_registerName("alloc"), reinterpret_cast<IMP>(allocString), "@@:");
+    class_addMethod(object_getClass(reinterpret_cast<id>(string)), sel_registerName("stringWithCString:encoding:"),
+        reinterpret_cast<IMP>(stringWithCString), "@@:*Q");
+    class_addMethod(string, sel_registerName("initWithBytesNoCopy:length:encoding:freeWhenDone:"), reinterpret_cast<IMP>(initWithBytes),
+        "@@:^vQQB");
+    class_addMethod(string, sel_registerName("dealloc"), reinterpret_cast<IMP>(deallocString), "v@:");
+    objc_registerClassPair(string);
+}
+
+// Stands in for setLabel(): it only has to look at the string.
+void setLabel(NS::String* pLabel) {
+    benchmark::doNotOptimize(storage(reinterpret_cast<id>(pLabel)).length);
+}
+
+const char* const labels[] = { "Shadow Pass", "GBuffer Pass", "Lighting Pass", "Transparency Pass", "Bloom Downsample",
+    "Bloom Upsample", "Tonemap", "UI Overlay" };
+constexpr std::uint64_t labelsPerFrame = 64;
+constexpr int repetitions = 5;
+
+}
+
+int main(int argc, char** argv) {
+    registerStringClass();
+    std::uint64_t frames = benchmark::quick(argc, argv) ? 1'000 : 200'000;
+    NS::AutoreleaseScope frameScope("frame");
+
+    std::uint64_t allocationsBefore = stringAllocations;
+    benchmark::measure("String::string per frame (64 labels)", frames, [&](std::uint64_t count) {
+        for (std::uint64_t frame = 0; frame < count; frame++) {
+            for (std::uint64_t i = 0; i < labelsPerFrame; i++) {
+                setLabel(NS::String::string(labels[i % std::size(labels)], NS::UTF8StringEncoding));
+            }
+            frameScope.drain();
+        }
+    }, repetitions);
+    std::printf("%-48s %12.2f allocations/frame\n", "", double(stringAllocations - allocationsBefore) / double(frames * repetitions));
+
+    allocationsBefore = stringAllocations;
+    benchmark::measure("InternString per frame (64 labels)", frames, [&](std::uint64_t count) {
+        for (std::uint64_t frame = 0; frame < count; frame++) {
+            for (std::uint64_t i = 0; i < labelsPerFrame; i++) {
+                setLabel(NS::InternString(labels[i % std::size(labels)]));
+            }
+            frameScope.drain();
+        }
+    }, repetitions);
+    std::printf("%-48s %12.2f allocations/frame\n", "", double(stringAllocations - allocationsBefore) / double(frames * repetitions));
+    return 0;
+}
@@ -0,0 +1,150 @@
+//
+//  lazy_registration_benchmark.cpp
+//  Metal-Guide
+//
+//  Startup cost of metal-cpp's symbol tables with and without METALCPP_LAZY_REGISTRATION, using the real selector and
+//  class names from Metal/MTLHeaderBridge.hpp. Eager registration resolves every one of them during static
+//  initialization; lazy registration resolves only those the program goes on to use, on first use, and then pays an
+//  acquire load per use. A "startup" here is one pass over a fresh table, so it reports ns per startup, not per symbol.
+//
+//  All names are registered once before timing, as Apple's shared cache preregisters the framework selectors and
+//  classes, so both rows measure lookups of existing names rather than first-time interning.
+//
+
+#include <Foundation/NSObject.hpp>
+
+#include "benchmark.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct SymbolNames {
+    std::vector<std::string> selectors;
+    std::vector<std::string> classes;
+};
+
+// Pulls the names out of the _MTL_PRIVATE_DEF_SEL(accessor, "name") and _MTL_PRIVATE_DEF_CLS(name) lines.
+SymbolNames readSymbolNames(const char* path) {
+    std::ifstream file(path);
+    std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    SymbolNames names;
+
+    const std::string selectorMacro = "_MTL_PRIVATE_DEF_SEL(";
+    for (size_t at = text.find(selectorMacro); at != std::string::npos; at = text.find(selectorMacro, at + 1)) {
+        size_t open = text.find('"', at);
+        size_t close = text.find('"', open + 1);
+        names.selectors.push_back(text.substr(open + 1, close - open - 1));
+    }
+    const std::string classMacro = "_MTL_PRIVATE_DEF_CLS(";
+    for (size_t at = text.find(classMacro); at != std::string::npos; at = text.find(classMacro, at + 1)) {
+        size_t begin = at + classMacro.size();
+        names.classes.push_back(text.substr(begin, text.find(')', begin) - begin));
+    }
+    return names;
+}
+
+// What static initialization does without METALCPP_LAZY_REGISTRATION.
+struct EagerTable {
+    std::vector<SEL> selectors;
+    std::vector<void*> classes;
+};
+
+// What it does with it: nothing but constant-initialize the names. The deques stand in for the namespace-scope
+// statics, which can't be rebuilt per repetition.
+struct LazyTable {
+    std::deque<NS::Private::LazySelector> selectors;
+    std::deque<NS::Private::LazyClass> classes;
+
+    explicit LazyTable(const SymbolNames& names) {
+        for (const std::string& name : names.selectors) {
+            selectors.emplace_back(name.c_str());
+        }
+        for (const std::string& name : names.classes) {
+            classes.emplace_back(name.c_str());
+        }
+    }
+};
+
+// A program that touches every 25th selector and every 10th class, a few dozen symbols in all, about what a small
+// renderer uses.
+constexpr size_t selectorStride = 25;
+constexpr size_t classStride = 10;
+
+}
+
+int main(int argc, char** argv) {
+    SymbolNames names = readSymbolNames(METALCPP_DIR "/Metal/MTLHeaderBridge.hpp");
+    if (names.selectors.empty() || names.classes.empty()) {
+        std::fprintf(stderr, "no symbol names found in MTLHeaderBridge.hpp\n");
+        return 1;
+    }
+
+    for (const std::string& name : names.selectors) {
+        sel_registerName(name.c_str());
+    }
+    for (const std::string& name : names.classes) {
+        objc_registerClassPair(objc_allocateClassPair(objc_lookUpClass("NSObject"), name.c_str(), 0));
+    }
+    std::printf("%zu selectors, %zu classes\n", names.selectors.size(), names.classes.size());
+
+    constexpr int repetitions = 5;
+    std::uint64_t iterations = benchmark::quick(argc, argv) ? 100'000 : 20'000'000;
+
+    EagerTable eager;
+    benchmark::measure("eager: resolve every symbol at startup", 1, [&](std::uint64_t) {
+        eager.selectors.clear();
+        eager.classes.clear();
+        for (const std::string& name : names.selectors) {
+            eager.selectors.push_back(sel_registerName(name.c_str()));
+        }
+        for (const std::string& name : names.classes) {
+            eager.classes.push_back(objc_lookUpClass(name.c_str()));
+        }
+    }, repetitions);
+
+    std::deque<LazyTable> lazyTables;
+    for (int repetition = 0; repetition < repetitions; repetition++) {
+        lazyTables.emplace_back(names);
+    }
+    size_t nextTable = 0;
+    benchmark::measure("lazy: resolve the used symbols on first use", 1, [&](std::uint64_t) {
+        LazyTable& lazy = lazyTables[nextTable++];
+        for (size_t i = 0; i < lazy.selectors.size(); i += selectorStride) {
+            benchmark::doNotOptimize(lazy.selectors[i].get());
+        }
+        for (size_t i = 0; i < lazy.classes.size(); i += classStride) {
+            benchmark::doNotOptimize(lazy.classes[i].get());
+        }
+    }, repetitions);
+
+    // What each use costs once startup is over.
+    SEL* volatile eagerSelector = &eager.selectors[0];
+    benchmark::measure("eager: selector load per use", iterations, [&](std::uint64_t count) {
+        for (std::uint64_t i = 0; i < count; i++) {
+            benchmark::doNotOptimize(*eagerSelector);
+        }
+    });
+    NS::Private::LazySelector& lazySelector = lazyTables[0].selectors[0];
+    benchmark::measure("lazy: resolved get() per use", iterations, [&](std::uint64_t count) {
+        for (std::uint64_t i = 0; i < count; i++) {
+            benchmark::doNotOptimize(lazySelector.get());
+        }
+    });
+    // A class the runtime doesn't have isn't cached, so every use looks it up again.
+    NS::Private::LazyClass missingClass("MTLClassThisSystemDoesNotHave");
+    benchmark::measure("lazy: get() of a missing class per use", iterations / 10, [&](std::uint64_t count) {
+        for (std::uint64_t i = 0; i < count; i++) {
+            benchmark::doNotOptimize(missingClass.get());
+        }
+    });
+
+    return 0;
+}
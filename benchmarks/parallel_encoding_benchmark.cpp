@@ -0,0 +1,121 @@
+//
+//  parallel_encoding_benchmark.cpp
+//  Metal-Guide
+//
+//  Scaling of chunked draw encoding on a WorkStealingPool from 1 to N threads. It splits the draw list the way
+//  ParallelDrawEncoder does, and each chunk records into its own CommandList through a RenderCommandRecorder, which
+//  stands in for the sub-encoder. After every run the chunks are read back in creation order, which is the order the
+//  GPU would execute them in, and must hold every draw exactly once and in list order, however the threads ran.
+//
+//  Usage: parallel_encoding_benchmark [--quick] [maximum thread count, default: hardware concurrency]
+//
+
+#include "command_list.hpp"
+#include "work_stealing_pool.hpp"
+
+#include "benchmark.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t drawCount = 50000;
+constexpr std::size_t minDrawsPerChunk = 256;
+constexpr std::size_t chunksPerThread = 4;
+
+struct DrawConstants {
+    float transform[16];
+};
+
+// Same split as ParallelDrawEncoder::chunkCount().
+std::size_t chunkCount(std::size_t threads) {
+    return std::min(std::max<std::size_t>(drawCount / minDrawsPerChunk, 1), threads * chunksPerThread);
+}
+
+// Every sub-encoder starts from default state, so each chunk sets its pipeline before its first draw.
+void encodeChunk(RenderCommandRecorder& encoder, std::size_t begin, std::size_t end) {
+    DrawConstants constants {};
+    for (std::size_t draw = begin; draw < end; draw++) {
+        if (draw == begin || draw % 16 == 0) {
+            encoder.setRenderPipelineState(reinterpret_cast<const MTL::RenderPipelineState*>(0x1000 + draw / 16));
+        }
+        constants.transform[0] = float(draw);
+        encoder.setVertexBuffer(reinterpret_cast<const MTL::Buffer*>(0x2000), draw * 64, 0);
+        encoder.setVertexBytes(&constants, sizeof(constants), 1);
+        encoder.drawPrimitives(MTL::PrimitiveType(3), draw * 36, 36, 1, 0);
+    }
+}
+
+bool drawsInListOrder(const std::vector<CommandList>& lists, std::size_t chunks) {
+    std::size_t next = 0;
+    bool ordered = true;
+    for (std::size_t chunk = 0; chunk < chunks; chunk++) {
+        lists[chunk].forEach([&](const CommandList::CommandHeader& header, const void* payload) {
+            if (header.op == CommandOp::DrawPrimitives) {
+                ordered = ordered && static_cast<const CommandList::DrawPrimitives*>(payload)->vertexStart == next * 36;
+                next++;
+            }
+        });
+    }
+    return ordered && next == drawCount;
+}
+
+}
+
+int main(int argc, char** argv) {
+    bool quick = benchmark::quick(argc, argv);
+    std::size_t maxThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    for (int i = 1; i < argc; i++) {
+        if (argv[i][0] != '-') {
+            maxThreads = std::strtoul(argv[i], nullptr, 10);
+        }
+    }
+    if (quick) {
+        // Still enough to check the ordering across threads.
+        maxThreads = 2;
+    }
+    std::uint64_t frames = quick ? 2 : 50;
+
+    std::vector<CommandList> lists;
+    for (std::size_t i = 0; i < maxThreads * chunksPerThread; i++) {
+        lists.emplace_back();
+    }
+
+    double singleThreaded = 0.0;
+    std::printf("%zu draws, 1 to %zu threads\n", drawCount, maxThreads);
+    for (std::size_t threads = 1; threads <= maxThreads; threads++) {
+        WorkStealingPool pool(threads);
+        std::size_t chunks = chunkCount(threads);
+        auto frame = [&] {
+            pool.run(chunks, [&](std::size_t chunk) {
+                lists[chunk].reset();
+                RenderCommandRecorder encoder(lists[chunk]);
+                encodeChunk(encoder, drawCount * chunk / chunks, drawCount * (chunk + 1) / chunks);
+            });
+        };
+
+        char name[64];
+        std::snprintf(name, sizeof(name), "%zu threads, %zu chunks, per frame", threads, chunks);
+        double nanoseconds = benchmark::measure(name, frames, [&](std::uint64_t count) {
+            for (std::uint64_t i = 0; i < count; i++) {
+                frame();
+            }
+        });
+
+        if (!drawsInListOrder(lists, chunks)) {
+            std::printf("draws out of order with %zu threads\n", threads);
+            return 1;
+        }
+        if (threads == 1) {
+            singleThreaded = nanoseconds;
+        }
+        std::printf("  speedup %.2fx, efficiency %.0f%%, %llu steals\n", singleThreaded / nanoseconds,
+                    100.0 * singleThreaded / nanoseconds / double(threads),
+                    static_cast<unsigned long long>(pool.stats().steals));
+    }
+    return 0;
+}
@@ -0,0 +1,170 @@
+//
+//  string_view_benchmark.cpp
+//  Metal-Guide
+//
+//  Reading a library's function names as UTF-8, the way a pipeline cache enumerates functionNames to look each one up.
+//  utf8String() allocates an autoreleased copy of every name; utf8View() points straight at strings stored as UTF-8
+//  and converts the others into a stack buffer. The stand-in NSString below stores names either way and implements
+//  the CoreFoundation calls utf8View() makes. Every row checks that it read the right bytes before it is timed.
+//
+
+#include <CoreFoundation/CoreFoundation.h>
+
+#include <Foundation/NSAutoreleasePool.hpp>
+#include <Foundation/NSString.hpp>
+
+#include "benchmark.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+// Contiguous strings keep their UTF-8 bytes and hand them out directly; the others keep UTF-16 units, as CFStrings
+// built from non-ASCII text do, and must be converted.
+struct StringStorage {
+    const char* utf8;
+    const char16_t* utf16;
+    std::uint64_t length;
+};
+
+StringStorage& storage(const void* string) {
+    return *static_cast<StringStorage*>(object_getIndexedIvars(reinterpret_cast<id>(const_cast<void*>(string))));
+}
+
+const char* utf8String(id self, SEL) {
+    const StringStorage& string = storage(self);
+    id buffer = class_createInstance(objc_lookUpClass("NSObject"), string.length + 1);
+    char* bytes = static_cast<char*>(object_getIndexedIvars(buffer));
+    for (std::uint64_t i = 0; i < string.length; i++) {
+        bytes[i] = string.utf8 ? string.utf8[i] : char(string.utf16[i]);
+    }
+    bytes[string.length] = '\0';
+    reinterpret_cast<NS::Object*>(buffer)->autorelease();
+    return bytes;
+}
+
+Class registerStringClass() {
+    Class string = objc_allocateClassPair(objc_lookUpClass("NSObject"), "NSString", 0);
+    class_addMethod(string, sel_registerName("UTF8String"), reinterpret_cast<IMP>(utf8String), "*@:");
+    objc_registerClassPair(string);
+    return string;
+}
+
+// Points at utf8 or utf16, whichever isn't null; both must outlive the string.
+NS::String* makeString(Class stringClass, const char* utf8, const char16_t* utf16, std::uint64_t length) {
+    id string = class_createInstance(stringClass, sizeof(StringStorage));
+    storage(string) = { utf8, utf16, length };
+    return reinterpret_cast<NS::String*>(string);
+}
+
+}
+
+extern "C" const char* CFStringGetCStringPtr(CFStringRef string, CFStringEncoding) {
+    return storage(string).utf8;
+}
+
+extern "C" CFIndex CFStringGetLength(CFStringRef string) {
+    return static_cast<CFIndex>(storage(string).length);
+}
+
+// Like CoreFoundation's: converts whole characters while they fit, or only measures when buffer is null.
+extern "C" CFIndex CFStringGetBytes(CFStringRef string, CFRange range, CFStringEncoding, UInt8, Boolean, UInt8* buffer,
+                                    CFIndex maxBufLen, CFIndex* usedBufLen) {
+    const StringStorage& storage = ::storage(string);
+    CFIndex converted = 0;
+    for (; converted < range.length; converted++) {
+        if (buffer && converted == maxBufLen) {
+            break;
+        }
+        if (buffer) {
+            CFIndex at = range.location + converted;
+            buffer[converted] = UInt8(storage.utf16 ? storage.utf16[at] : char16_t(storage.utf8[at]));
+        }
+    }
+    if (usedBufLen) {
+        *usedBufLen = converted;
+    }
+    return converted;
+}
+
+namespace {
+
+constexpr std::size_t nameCount = 4096;
+
+template <typename Read>
+bool check(const std::vector<NS::String*>& strings, const std::vector<std::string>& names, Read&& read) {
+    NS::AutoreleaseScope scope("check");
+    for (std::size_t i = 0; i < strings.size(); i++) {
+        std::string_view view = read(strings[i]);
+        if (view != names[i]) {
+            std::fprintf(stderr, "read \"%.*s\" for \"%s\"\n", int(view.size()), view.data(), names[i].c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+// One row: every name read once per iteration and hashed, as a lookup into a pipeline table would.
+template <typename Read>
+bool run(const char* name, const std::vector<NS::String*>& strings, const std::vector<std::string>& names,
+         std::uint64_t iterations, Read&& read) {
+    if (!check(strings, names, read)) {
+        return false;
+    }
+    NS::AutoreleaseScope scope("enumeration");
+    benchmark::measure(name, iterations * strings.size(), [&](std::uint64_t count) {
+        for (std::uint64_t done = 0; done < count; done += strings.size()) {
+            for (NS::String* string : strings) {
+                benchmark::doNotOptimize(std::hash<std::string_view>()(read(string)));
+            }
+            scope.drain();
+        }
+    });
+    return true;
+}
+
+}
+
+int main(int argc, char** argv) {
+    Class stringClass = registerStringClass();
+    std::uint64_t iterations = benchmark::quick(argc, argv) ? 2 : 500;
+
+    const char* const stages[] = { "vertex", "fragment", "kernel", "mesh", "object" };
+    std::vector<std::string> names;
+    for (std::size_t i = 0; i < nameCount; i++) {
+        names.push_back(std::string(stages[i % std::size(stages)]) + "Material" + std::to_string(i) + "_shadowed_skinned");
+    }
+
+    std::vector<std::u16string> utf16Names;
+    std::vector<NS::String*> contiguous;
+    std::vector<NS::String*> converted;
+    for (const std::string& name : names) {
+        utf16Names.emplace_back(name.begin(), name.end());
+    }
+    for (std::size_t i = 0; i < nameCount; i++) {
+        contiguous.push_back(makeString(stringClass, names[i].c_str(), nullptr, names[i].size()));
+        converted.push_back(makeString(stringClass, nullptr, utf16Names[i].c_str(), names[i].size()));
+    }
+
+    char buffer[256];
+    auto readString = [](NS::String* string) { return std::string_view(string->utf8String()); };
+    auto viewIntoBuffer = [&](NS::String* string) { return string->utf8View(buffer); };
+    auto viewWithoutBuffer = [](NS::String* string) { return string->utf8View(nullptr, 0); };
+    bool ok = run("UTF-8 storage: utf8String()", contiguous, names, iterations, readString)
+        && run("UTF-8 storage: utf8View()", contiguous, names, iterations, viewIntoBuffer)
+        && run("UTF-16 storage: utf8String()", converted, names, iterations, readString)
+        && run("UTF-16 storage: utf8View(buffer)", converted, names, iterations, viewIntoBuffer)
+        && run("UTF-16 storage: utf8View(nullptr, 0)", converted, names, iterations, viewWithoutBuffer);
+
+    for (std::size_t i = 0; i < nameCount; i++) {
+        object_dispose(reinterpret_cast<id>(contiguous[i]));
+        object_dispose(reinterpret_cast<id>(converted[i]));
+    }
+    return ok ? 0 : 1;
+}
@@ -31,6 +31,8 @@
 #include "NSDictionary.hpp"
 #include "NSEnumerator.hpp"
 #include "NSError.hpp"
+#include "NSInternedString.hpp"
+#include "NSLocalPtr.hpp"
 #include "NSLock.hpp"
 #include "NSNotification.hpp"
 #include "NSNumber.hpp"
@@ -38,6 +40,7 @@
 #include "NSPrivate.hpp"
 #include "NSProcessInfo.hpp"
 #include "NSRange.hpp"
+#include "NSRef.hpp"
 #include "NSSet.hpp"
 #include "NSSharedPtr.hpp"
 #include "NSString.hpp"
@@ -22,9 +22,17 @@
 
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------
 
+#include "NSEnumerator.hpp"
 #include "NSObject.hpp"
+#include "NSRange.hpp"
 #include "NSTypes.hpp"
 
+#if __cplusplus >= 202002L
+#include <algorithm>
+#include <ranges>
+#include <span>
+#endif // __cplusplus >= 202002L
+
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 namespace NS
@@ -45,6 +53,21 @@ public:
     template <class _Object = Object>
     _Object* object(UInteger index) const;
     UInteger count() const;
+
+    void     getObjects(Object** pObjects, Range range) const;
+#if __cplusplus >= 202002L
+    template <class _Object = Object, std::size_t _Extent = std::dynamic_extent>
+    UInteger getObjects(std::span<_Object*, _Extent> objects, UInteger location = 0) const;
+
+    template <class _Range>
+        requires std::ranges::contiguous_range<_Range> && std::ranges::sized_range<_Range>
+    UInteger getObjects(_Range&& objects, UInteger location = 0) const;
+#endif // __cplusplus >= 202002L
+
+    template <class _Object = Object>
+    FastEnumerationRange<_Object>   objects() const;
+    FastEnumerationIterator<Object> begin() const;
+    FastEnumerationIterator<Object> end() const;
 };
 }
 
@@ -113,3 +136,61 @@ _NS_INLINE _Object* NS::Array::object(UInteger index) const
 }
 
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+_NS_INLINE void NS::Array::getObjects(Object** pObjects, Range range) const
+{
+    Object::sendMessage<void>(this, _NS_PRIVATE_SEL(getObjects_range_), pObjects, range);
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+#if __cplusplus >= 202002L
+template <class _Object, std::size_t _Extent>
+_NS_INLINE NS::UInteger NS::Array::getObjects(std::span<_Object*, _Extent> objects, UInteger location) const
+{
+    const UInteger available = count();
+    const UInteger length = (location < available) ? std::min<UInteger>(available - location, objects.size()) : 0;
+
+    if (length)
+    {
+        getObjects(reinterpret_cast<Object**>(objects.data()), Range::Make(location, length));
+    }
+
+    return length;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+template <class _Range>
+    requires std::ranges::contiguous_range<_Range> && std::ranges::sized_range<_Range>
+_NS_INLINE NS::UInteger NS::Array::getObjects(_Range&& objects, UInteger location) const
+{
+    // A std::vector or std::array of pointers doesn't deduce _Object through the span overload, so make the span here.
+    return getObjects(std::span(std::ranges::data(objects), std::ranges::size(objects)), location);
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+#endif // __cplusplus >= 202002L
+
+template <class _Object>
+_NS_INLINE NS::FastEnumerationRange<_Object> NS::Array::objects() const
+{
+    return FastEnumerationRange<_Object>(this);
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+_NS_INLINE NS::FastEnumerationIterator<NS::Object> NS::Array::begin() const
+{
+    return FastEnumerationIterator<Object>(this);
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+_NS_INLINE NS::FastEnumerationIterator<NS::Object> NS::Array::end() const
+{
+    return FastEnumerationIterator<Object>();
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -27,6 +27,20 @@
 #include "NSPrivate.hpp"
 #include "NSTypes.hpp"
 
+#include <cstdint>
+
+#if __has_include(<mach/vm_param.h>)
+#include <mach/vm_param.h>
+#endif // __has_include(<mach/vm_param.h>)
+
+#ifndef METALCPP_AUTORELEASE_STATS
+#ifdef NDEBUG
+#define METALCPP_AUTORELEASE_STATS 0
+#else
+#define METALCPP_AUTORELEASE_STATS 1
+#endif // NDEBUG
+#endif // METALCPP_AUTORELEASE_STATS
+
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 namespace NS
@@ -43,8 +57,79 @@ public:
 
     static void             showPools();
 };
+
+struct AutoreleaseScopeStats
+{
+    UInteger scopes = 0;
+    UInteger drainedObjects = 0;
+    UInteger peakDrainedObjects = 0;
+    UInteger uncountedScopes = 0;
+};
+
+/**
+ * Frame-scoped autorelease pool.
+ * Pushes a pool boundary on construction and pops it on destruction, the same way @autoreleasepool does. No
+ * NSAutoreleasePool object is allocated, so scopes nest at the cost of one runtime call each. drain() pops and
+ * re-pushes, which lets one scope live across a render loop and be emptied once per frame.
+ * When METALCPP_AUTORELEASE_STATS is non-zero (the default unless NDEBUG is defined) every drain counts the objects
+ * it released, accumulates them in per-thread statistics and passes them to the report handler. The count is best
+ * effort: it reads the distance between pool boundaries, which relies on the Objective-C runtime's private pool page
+ * layout, and it is reported as UncountedObjects whenever that layout can't be trusted.
+ */
+class AutoreleaseScope
+{
+public:
+    using ReportHandler = void (*)(const char* pName, UInteger drainedObjects);
+
+    static constexpr UInteger UncountedObjects = UIntegerMax;
+
+    explicit AutoreleaseScope(const char* pName = nullptr);
+    ~AutoreleaseScope();
+
+    AutoreleaseScope(const AutoreleaseScope&) = delete;
+    AutoreleaseScope& operator=(const AutoreleaseScope&) = delete;
+
+    /**
+     * Release every object autoreleased since construction or the previous drain, and keep the scope open.
+     * Returns the number of objects released, 0 when statistics are off, or UncountedObjects when the objects spilled
+     * onto another runtime pool page and the count could not be taken.
+     */
+    UInteger drain();
+
+    /**
+     * Number of objects currently waiting in this scope. Same return convention as drain().
+     */
+    UInteger pendingObjects() const;
+
+    const char* name() const;
+
+    /**
+     * Totals for every scope popped or drained on the calling thread.
+     */
+    static const AutoreleaseScopeStats& stats();
+    static void                         resetStats();
+
+    /**
+     * Called with the scope name and object count on every pop or drain. Shared by all threads; set it at startup.
+     */
+    static void                         setReportHandler(ReportHandler handler);
+
+private:
+    UInteger                            pop();
+
+    static UInteger                     countSince(void* pToken);
+    static ReportHandler&               reportHandler();
+    static AutoreleaseScopeStats&       threadStats();
+
+    void*       m_pOuterToken;
+    void*       m_pToken;
+    const char* m_pName;
+};
 }
 
+extern "C" void* objc_autoreleasePoolPush(void);
+extern "C" void  objc_autoreleasePoolPop(void* pToken);
+
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 _NS_INLINE NS::AutoreleasePool* NS::AutoreleasePool::alloc()
@@ -81,3 +166,164 @@ _NS_INLINE void NS::AutoreleasePool::showPools()
 }
 
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+_NS_INLINE NS::AutoreleaseScope::AutoreleaseScope(const char* pName)
+    : m_pOuterToken(nullptr)
+    , m_pToken(objc_autoreleasePoolPush())
+    , m_pName(pName)
+{
+#if METALCPP_AUTORELEASE_STATS
+    // The first push on a thread with no pool page returns a placeholder instead of a boundary address, and nothing can
+    // be measured from it. Pushing again allocates the page, so this scope gets a real boundary to count from.
+    if (m_pToken == reinterpret_cast<void*>(1))
+    {
+        m_pOuterToken = m_pToken;
+        m_pToken = objc_autoreleasePoolPush();
+    }
+#endif // METALCPP_AUTORELEASE_STATS
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+_NS_INLINE NS::AutoreleaseScope::~AutoreleaseScope()
+{
+    pop();
+
+    if (m_pOuterToken)
+    {
+        objc_autoreleasePoolPop(m_pOuterToken);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+_NS_INLINE NS::UInteger NS::AutoreleaseScope::drain()
+{
+    const UInteger drained = pop();
+    m_pToken = objc_autoreleasePoolPush();
+    return drained;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+_NS_INLINE NS::UInteger NS::AutoreleaseScope::pendingObjects() const
+{
+#if METALCPP_AUTORELEASE_STATS
+    return countSince(m_pToken);
+#else
+    return 0;
+#endif // METALCPP_AUTORELEASE_STATS
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+_NS_INLINE const char* NS::AutoreleaseScope::name() const
+{
+    return m_pName;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+_NS_INLINE const NS::AutoreleaseScopeStats& NS::AutoreleaseScope::stats()
+{
+    return threadStats();
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+_NS_INLINE void NS::AutoreleaseScope::resetStats()
+{
+    threadStats() = AutoreleaseScopeStats();
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+_NS_INLINE void NS::AutoreleaseScope::setReportHandler(ReportHandler handler)
+{
+    reportHandler() = handler;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+_NS_INLINE NS::UInteger NS::AutoreleaseScope::pop()
+{
+    UInteger drained = 0;
+
+#if METALCPP_AUTORELEASE_STATS
+    AutoreleaseScopeStats& stats = threadStats();
+
+    drained = countSince(m_pToken);
+
+    stats.scopes++;
+    if (drained == UncountedObjects)
+    {
+        stats.uncountedScopes++;
+    }
+    else
+    {
+        stats.drainedObjects += drained;
+        stats.peakDrainedObjects = drained > stats.peakDrainedObjects ? drained : stats.peakDrainedObjects;
+    }
+
+    if (ReportHandler handler = reportHandler())
+    {
+        handler(m_pName, drained);
+    }
+#endif // METALCPP_AUTORELEASE_STATS
+
+    objc_autoreleasePoolPop(m_pToken);
+
+    return drained;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+_NS_INLINE NS::UInteger NS::AutoreleaseScope::countSince(void* pToken)
+{
+    // A push returns the address of the boundary slot it wrote, and the slots between two boundaries on the same pool
+    // page hold the pending objects. Pool pages are aligned to their size, which is at most PAGE_MAX_SIZE (16 KiB on
+    // arm64). Once the pool spills onto another page the distance means nothing, so the count is reported as unknown.
+#ifdef PAGE_MAX_SIZE
+    constexpr std::uintptr_t kPageMask = ~std::uintptr_t(PAGE_MAX_SIZE - 1);
+#else
+    constexpr std::uintptr_t kPageMask = ~std::uintptr_t(16384 - 1);
+#endif // PAGE_MAX_SIZE
+
+    if (pToken == reinterpret_cast<void*>(1))
+    {
+        return UncountedObjects;
+    }
+
+    void* const pProbe = objc_autoreleasePoolPush();
+    objc_autoreleasePoolPop(pProbe);
+
+    const std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(pToken);
+    const std::uintptr_t end = reinterpret_cast<std::uintptr_t>(pProbe);
+
+    if ((begin & kPageMask) != (end & kPageMask) || end <= begin)
+    {
+        return UncountedObjects;
+    }
+
+    return (end - begin) / sizeof(void*) - 1;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+_NS_INLINE NS::AutoreleaseScope::ReportHandler& NS::AutoreleaseScope::reportHandler()
+{
+    static ReportHandler handler = nullptr;
+
+    return handler;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+_NS_INLINE NS::AutoreleaseScopeStats& NS::AutoreleaseScope::threadStats()
+{
+    static thread_local AutoreleaseScopeStats stats;
+
+    return stats;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -46,6 +46,11 @@ public:
     template <class _KeyType = Object>
     Enumerator<_KeyType>* keyEnumerator() const;
 
+    template <class _KeyType = Object>
+    FastEnumerationRange<_KeyType>  keys() const;
+    FastEnumerationIterator<Object> begin() const;
+    FastEnumerationIterator<Object> end() const;
+
     template <class _Object = Object>
     _Object* object(const Object* pKey) const;
     UInteger count() const;
@@ -126,3 +131,25 @@ _NS_INLINE NS::UInteger NS::Dictionary::count() const
 }
 
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+template <class _KeyType>
+_NS_INLINE NS::FastEnumerationRange<_KeyType> NS::Dictionary::keys() const
+{
+    return FastEnumerationRange<_KeyType>(this);
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+_NS_INLINE NS::FastEnumerationIterator<NS::Object> NS::Dictionary::begin() const
+{
+    return FastEnumerationIterator<Object>(this);
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+_NS_INLINE NS::FastEnumerationIterator<NS::Object> NS::Dictionary::end() const
+{
+    return FastEnumerationIterator<Object>();
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
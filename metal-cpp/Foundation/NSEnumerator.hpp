@@ -25,6 +25,10 @@
 #include "NSObject.hpp"
 #include "NSTypes.hpp"
 
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 namespace NS
@@ -50,6 +54,73 @@ public:
     _ObjectType* nextObject();
     class Array* allObjects();
 };
+
+/**
+ * Input iterator over any collection that implements NSFastEnumeration.
+ * Objects are fetched in batches through countByEnumeratingWithState:objects:count:, so walking a collection costs one
+ * message per batch rather than one per element. Arrays usually hand out their whole backing store in the first batch.
+ * Dictionaries enumerate their keys. The collection must not be mutated while it is being iterated.
+ * As with any input iterator, a copy (such as the one postfix ++ returns) can still be dereferenced, but only one copy
+ * may go on advancing.
+ */
+template <class _ObjectType>
+class FastEnumerationIterator
+{
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = _ObjectType*;
+    using difference_type = std::ptrdiff_t;
+    using pointer = _ObjectType* const*;
+    using reference = _ObjectType*;
+
+    static constexpr UInteger BatchSize = 16;
+
+    /**
+     * Create an end iterator.
+     */
+    FastEnumerationIterator();
+
+    /**
+     * Create an iterator at the first object of pCollection.
+     */
+    explicit FastEnumerationIterator(const Object* pCollection);
+
+    FastEnumerationIterator(const FastEnumerationIterator& other);
+    FastEnumerationIterator& operator=(const FastEnumerationIterator& other);
+
+    _ObjectType*             operator*() const;
+    FastEnumerationIterator& operator++();
+    FastEnumerationIterator  operator++(int);
+
+    bool                     operator==(const FastEnumerationIterator& other) const;
+    bool                     operator!=(const FastEnumerationIterator& other) const;
+
+private:
+    void                     fetch();
+
+    const Object*            m_pCollection;
+    FastEnumerationState     m_state;
+    Object*                  m_buffer[BatchSize];
+    UInteger                 m_index;
+    UInteger                 m_count;
+    unsigned long            m_mutations;
+};
+
+/**
+ * Range over a fast-enumerable collection, for use with range-based for loops.
+ */
+template <class _ObjectType>
+class FastEnumerationRange
+{
+public:
+    explicit FastEnumerationRange(const Object* pCollection);
+
+    FastEnumerationIterator<_ObjectType> begin() const;
+    FastEnumerationIterator<_ObjectType> end() const;
+
+private:
+    const Object* m_pCollection;
+};
 }
 
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -76,3 +147,160 @@ _NS_INLINE NS::Array* NS::Enumerator<_ObjectType>::allObjects()
 }
 
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+template <class _ObjectType>
+_NS_INLINE NS::FastEnumerationIterator<_ObjectType>::FastEnumerationIterator()
+    : m_pCollection(nullptr)
+    , m_state {}
+    , m_buffer {}
+    , m_index(0)
+    , m_count(0)
+    , m_mutations(0)
+{
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+template <class _ObjectType>
+_NS_INLINE NS::FastEnumerationIterator<_ObjectType>::FastEnumerationIterator(const Object* pCollection)
+    : m_pCollection(pCollection)
+    , m_state {}
+    , m_buffer {}
+    , m_index(0)
+    , m_count(0)
+    , m_mutations(0)
+{
+    if (m_pCollection)
+    {
+        fetch();
+        m_mutations = m_pCollection ? *m_state.mutationsPtr : 0;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+template <class _ObjectType>
+_NS_INLINE NS::FastEnumerationIterator<_ObjectType>::FastEnumerationIterator(const FastEnumerationIterator& other)
+{
+    *this = other;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+template <class _ObjectType>
+_NS_INLINE NS::FastEnumerationIterator<_ObjectType>& NS::FastEnumerationIterator<_ObjectType>::operator=(const FastEnumerationIterator& other)
+{
+    if (this != &other)
+    {
+        m_pCollection = other.m_pCollection;
+        m_state = other.m_state;
+        m_index = other.m_index;
+        m_count = other.m_count;
+        m_mutations = other.m_mutations;
+
+        for (UInteger i = 0; i < BatchSize; ++i)
+        {
+            m_buffer[i] = other.m_buffer[i];
+        }
+
+        // The batch may live in the other iterator's buffer rather than in the collection.
+        if (other.m_state.itemsPtr == other.m_buffer)
+        {
+            m_state.itemsPtr = m_buffer;
+        }
+    }
+
+    return *this;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+template <class _ObjectType>
+_NS_INLINE _ObjectType* NS::FastEnumerationIterator<_ObjectType>::operator*() const
+{
+    assert(m_pCollection && (*m_state.mutationsPtr == m_mutations));
+
+    return reinterpret_cast<_ObjectType*>(m_state.itemsPtr[m_index]);
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+template <class _ObjectType>
+_NS_INLINE NS::FastEnumerationIterator<_ObjectType>& NS::FastEnumerationIterator<_ObjectType>::operator++()
+{
+    if (++m_index == m_count)
+    {
+        fetch();
+    }
+
+    return *this;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+template <class _ObjectType>
+_NS_INLINE NS::FastEnumerationIterator<_ObjectType> NS::FastEnumerationIterator<_ObjectType>::operator++(int)
+{
+    FastEnumerationIterator previous(*this);
+
+    ++(*this);
+
+    return previous;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+template <class _ObjectType>
+_NS_INLINE bool NS::FastEnumerationIterator<_ObjectType>::operator==(const FastEnumerationIterator& other) const
+{
+    return (m_pCollection == other.m_pCollection) && (m_index == other.m_index) && (m_count == other.m_count)
+        && (m_state.state == other.m_state.state);
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+template <class _ObjectType>
+_NS_INLINE bool NS::FastEnumerationIterator<_ObjectType>::operator!=(const FastEnumerationIterator& other) const
+{
+    return !(*this == other);
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+template <class _ObjectType>
+_NS_INLINE void NS::FastEnumerationIterator<_ObjectType>::fetch()
+{
+    m_index = 0;
+    m_count = reinterpret_cast<FastEnumeration*>(const_cast<Object*>(m_pCollection))->countByEnumerating(&m_state, m_buffer, BatchSize);
+
+    if (0 == m_count)
+    {
+        *this = FastEnumerationIterator();
+    }
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+template <class _ObjectType>
+_NS_INLINE NS::FastEnumerationRange<_ObjectType>::FastEnumerationRange(const Object* pCollection)
+    : m_pCollection(pCollection)
+{
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+template <class _ObjectType>
+_NS_INLINE NS::FastEnumerationIterator<_ObjectType> NS::FastEnumerationRange<_ObjectType>::begin() const
+{
+    return FastEnumerationIterator<_ObjectType>(m_pCollection);
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+template <class _ObjectType>
+_NS_INLINE NS::FastEnumerationIterator<_ObjectType> NS::FastEnumerationRange<_ObjectType>::end() const
+{
+    return FastEnumerationIterator<_ObjectType>();
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
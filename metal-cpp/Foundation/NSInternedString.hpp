@@ -0,0 +1,112 @@
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+// Foundation/NSInternedString.hpp
+//
+// Copyright 2020-2022 Apple Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+#include "NSDefines.hpp"
+#include "NSString.hpp"
+#include "NSTypes.hpp"
+
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace NS
+{
+namespace Private
+{
+    class InternTable
+    {
+    public:
+        static InternTable& shared();
+
+        String*             intern(std::string_view string);
+
+    private:
+        std::mutex                                    m_mutex;
+        std::deque<std::string>                       m_storage;
+        std::unordered_map<std::string_view, String*> m_strings;
+    };
+} // Private
+
+/**
+ * Return the process-wide String for a UTF-8 label, creating it on first use.
+ * The first call for a given label copies the bytes once into storage that lives as long as the process, and wraps
+ * them in a String with initWithBytesNoCopy. Every later call returns the same object without allocating or
+ * autoreleasing. The returned String is never released, so do not retain or release it.
+ * For string literals, MTLSTR() is cheaper still: it makes a constant string at compile time.
+ */
+String* InternString(const char* pString, UInteger length);
+String* InternString(const char* pString);
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+_NS_INLINE NS::Private::InternTable& NS::Private::InternTable::shared()
+{
+    // Never destroyed, so labels stay valid for code that still uses them while other static objects are destroyed.
+    static InternTable* pTable = new InternTable;
+
+    return *pTable;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+_NS_INLINE NS::String* NS::Private::InternTable::intern(std::string_view string)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_strings.find(string);
+    if (it != m_strings.end())
+    {
+        return it->second;
+    }
+
+    // Deque elements never move, so the stored bytes stay valid for the no-copy String and the map key.
+    const std::string& stored = m_storage.emplace_back(string);
+    String* pString = String::alloc()->init(const_cast<char*>(stored.data()), stored.size(), UTF8StringEncoding, false);
+
+    m_strings.emplace(std::string_view(stored), pString);
+
+    return pString;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+_NS_INLINE NS::String* NS::InternString(const char* pString, UInteger length)
+{
+    return Private::InternTable::shared().intern(std::string_view(pString, length));
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+_NS_INLINE NS::String* NS::InternString(const char* pString)
+{
+    return Private::InternTable::shared().intern(std::string_view(pString, std::strlen(pString)));
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
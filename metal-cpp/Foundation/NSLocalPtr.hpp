@@ -0,0 +1,336 @@
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+// Foundation/NSLocalPtr.hpp
+//
+// Copyright 2020-2022 Apple Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include "NSDefines.hpp"
+#include "NSObject.hpp"
+#include "NSSharedPtr.hpp"
+#include "NSTypes.hpp"
+
+namespace NS
+{
+namespace Private
+{
+    struct LocalPtrBlock
+    {
+        Object*  pObject;
+        UInteger count;
+    };
+} // Private
+
+/**
+ * Single-threaded shared ownership of an Objective-C object.
+ * All LocalPtr copies of one object share a plain, non-atomic C++ reference count. The object itself is retained
+ * once when ownership enters the LocalPtr family and released once when the last copy goes away, so copying,
+ * moving and destroying copies never sends a message.
+ * @warning A LocalPtr and its copies must stay on one thread. Use share() to hand the object to another thread.
+ */
+template <class _Class>
+class LocalPtr
+{
+public:
+    /**
+     * Create a new null pointer.
+     */
+    LocalPtr();
+
+    /**
+     * Destroy this LocalPtr. Releases the pointee if this was the last copy.
+     */
+    ~LocalPtr();
+
+    /**
+     * LocalPtr copy constructor. Increments the local count only.
+     */
+    LocalPtr(const LocalPtr<_Class>& other) noexcept;
+
+    /**
+     * Construction from another pointee type. Shares the other pointer's count.
+     */
+    template <class _OtherClass>
+    LocalPtr(const LocalPtr<_OtherClass>& other, typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>> * = nullptr) noexcept;
+
+    /**
+     * LocalPtr move constructor. Moved-from object is reset to nullptr.
+     */
+    LocalPtr(LocalPtr<_Class>&& other) noexcept;
+
+    /**
+     * Move from another pointee type. Moved-from object is reset to nullptr.
+     */
+    template <class _OtherClass>
+    LocalPtr(LocalPtr<_OtherClass>&& other, typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>> * = nullptr) noexcept;
+
+    /**
+     * Copy assignment operator. Touches local counts only, unless the previous pointee loses its last copy.
+     */
+    LocalPtr& operator=(const LocalPtr<_Class>& other) noexcept;
+
+    /**
+     * Copy-assignment from different pointee.
+     */
+    template <class _OtherClass>
+    typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>, LocalPtr &>
+    operator=(const LocalPtr<_OtherClass>& other) noexcept;
+
+    /**
+     * Move assignment operator. Moved-from object is reset to nullptr.
+     */
+    LocalPtr& operator=(LocalPtr<_Class>&& other) noexcept;
+
+    /**
+     * Move-assignment from different pointee. Moved-from object is reset to nullptr.
+     */
+    template <class _OtherClass>
+    typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>, LocalPtr &>
+    operator=(LocalPtr<_OtherClass>&& other) noexcept;
+
+    /**
+     * Access raw pointee.
+     */
+    _Class* get() const;
+
+    /**
+     * Call operations directly on the pointee.
+     */
+    _Class* operator->() const;
+
+    /**
+     * Implicit cast to bool.
+     */
+    explicit operator bool() const;
+
+    /**
+     * Reset this LocalPtr to null. Releases the pointee if this was the last copy.
+     */
+    void reset();
+
+    /**
+     * Number of LocalPtr copies sharing the pointee.
+     */
+    UInteger useCount() const;
+
+    /**
+     * Create a SharedPtr to the pointee, retaining it. Use this when ownership leaves the current thread or scope.
+     */
+    SharedPtr<_Class> share() const;
+
+    template <class _OtherClass>
+    friend class LocalPtr;
+
+    template <class _OtherClass>
+    friend LocalPtr<_OtherClass> RetainLocalPtr(_OtherClass* ptr);
+
+    template <class _OtherClass>
+    friend LocalPtr<_OtherClass> TransferLocalPtr(_OtherClass* ptr);
+
+private:
+    Private::LocalPtrBlock* m_pBlock;
+};
+
+/**
+ * Create a LocalPtr by retaining an existing raw pointer.
+ * Increases the reference count of the passed-in object once, regardless of how many copies are made later.
+ */
+template <class _Class>
+_NS_INLINE NS::LocalPtr<_Class> RetainLocalPtr(_Class* pObject)
+{
+    NS::LocalPtr<_Class> ret;
+    if (pObject)
+    {
+        ret.m_pBlock = new Private::LocalPtrBlock { reinterpret_cast<Object*>(pObject->retain()), 1 };
+    }
+    return ret;
+}
+
+/*
+ * Create a LocalPtr by transfering the ownership of an existing raw pointer to LocalPtr.
+ * Does not increase the reference count of the passed-in pointer, it is assumed to be >= 1.
+ */
+template <class _Class>
+_NS_INLINE NS::LocalPtr<_Class> TransferLocalPtr(_Class* pObject)
+{
+    NS::LocalPtr<_Class> ret;
+    if (pObject)
+    {
+        ret.m_pBlock = new Private::LocalPtrBlock { reinterpret_cast<Object*>(pObject), 1 };
+    }
+    return ret;
+}
+
+}
+
+template <class _Class>
+_NS_INLINE NS::LocalPtr<_Class>::LocalPtr()
+    : m_pBlock(nullptr)
+{
+}
+
+template <class _Class>
+_NS_INLINE NS::LocalPtr<_Class>::~LocalPtr()
+{
+    reset();
+}
+
+template <class _Class>
+_NS_INLINE NS::LocalPtr<_Class>::LocalPtr(const NS::LocalPtr<_Class>& other) noexcept
+    : m_pBlock(other.m_pBlock)
+{
+    if (m_pBlock)
+    {
+        ++m_pBlock->count;
+    }
+}
+
+template <class _Class>
+template <class _OtherClass>
+_NS_INLINE NS::LocalPtr<_Class>::LocalPtr(const NS::LocalPtr<_OtherClass>& other, typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>> *) noexcept
+    : m_pBlock(other.m_pBlock)
+{
+    if (m_pBlock)
+    {
+        ++m_pBlock->count;
+    }
+}
+
+template <class _Class>
+_NS_INLINE NS::LocalPtr<_Class>::LocalPtr(NS::LocalPtr<_Class>&& other) noexcept
+    : m_pBlock(other.m_pBlock)
+{
+    other.m_pBlock = nullptr;
+}
+
+template <class _Class>
+template <class _OtherClass>
+_NS_INLINE NS::LocalPtr<_Class>::LocalPtr(NS::LocalPtr<_OtherClass>&& other, typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>> *) noexcept
+    : m_pBlock(other.m_pBlock)
+{
+    other.m_pBlock = nullptr;
+}
+
+template <class _Class>
+_NS_INLINE NS::LocalPtr<_Class>& NS::LocalPtr<_Class>::operator=(const LocalPtr<_Class>& other) noexcept
+{
+    if (m_pBlock != other.m_pBlock)
+    {
+        if (other.m_pBlock)
+        {
+            ++other.m_pBlock->count;
+        }
+        reset();
+        m_pBlock = other.m_pBlock;
+    }
+    return *this;
+}
+
+template <class _Class>
+template <class _OtherClass>
+typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>, NS::LocalPtr<_Class> &>
+_NS_INLINE NS::LocalPtr<_Class>::operator=(const LocalPtr<_OtherClass>& other) noexcept
+{
+    if (m_pBlock != other.m_pBlock)
+    {
+        if (other.m_pBlock)
+        {
+            ++other.m_pBlock->count;
+        }
+        reset();
+        m_pBlock = other.m_pBlock;
+    }
+    return *this;
+}
+
+template <class _Class>
+_NS_INLINE NS::LocalPtr<_Class>& NS::LocalPtr<_Class>::operator=(LocalPtr<_Class>&& other) noexcept
+{
+    if (this != &other)
+    {
+        reset();
+        m_pBlock = other.m_pBlock;
+        other.m_pBlock = nullptr;
+    }
+    return *this;
+}
+
+template <class _Class>
+template <class _OtherClass>
+typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>, NS::LocalPtr<_Class> &>
+_NS_INLINE NS::LocalPtr<_Class>::operator=(LocalPtr<_OtherClass>&& other) noexcept
+{
+    // Distinct types, so other can't be this object; a shared block just gives up other's count.
+    reset();
+    m_pBlock = other.m_pBlock;
+    other.m_pBlock = nullptr;
+    return *this;
+}
+
+template <class _Class>
+_NS_INLINE _Class* NS::LocalPtr<_Class>::get() const
+{
+    return m_pBlock ? reinterpret_cast<_Class*>(m_pBlock->pObject) : nullptr;
+}
+
+template <class _Class>
+_NS_INLINE _Class* NS::LocalPtr<_Class>::operator->() const
+{
+    return get();
+}
+
+template <class _Class>
+_NS_INLINE NS::LocalPtr<_Class>::operator bool() const
+{
+    return nullptr != m_pBlock;
+}
+
+template <class _Class>
+_NS_INLINE void NS::LocalPtr<_Class>::reset()
+{
+    if (m_pBlock && (0 == --m_pBlock->count))
+    {
+        m_pBlock->pObject->release();
+        delete m_pBlock;
+    }
+    m_pBlock = nullptr;
+}
+
+template <class _Class>
+_NS_INLINE NS::UInteger NS::LocalPtr<_Class>::useCount() const
+{
+    return m_pBlock ? m_pBlock->count : 0;
+}
+
+template <class _Class>
+_NS_INLINE NS::SharedPtr<_Class> NS::LocalPtr<_Class>::share() const
+{
+    return m_pBlock ? NS::RetainPtr(get()) : NS::SharedPtr<_Class>();
+}
+
+template <class _ClassLhs, class _ClassRhs>
+_NS_INLINE bool operator==(const NS::LocalPtr<_ClassLhs>& lhs, const NS::LocalPtr<_ClassRhs>& rhs)
+{
+    return lhs.get() == rhs.get();
+}
+
+template <class _ClassLhs, class _ClassRhs>
+_NS_INLINE bool operator!=(const NS::LocalPtr<_ClassLhs>& lhs, const NS::LocalPtr<_ClassRhs>& rhs)
+{
+    return lhs.get() != rhs.get();
+}
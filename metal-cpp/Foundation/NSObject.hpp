@@ -29,12 +29,39 @@
 #include <objc/message.h>
 #include <objc/runtime.h>
 
+#include <atomic>
 #include <type_traits>
 
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------
 
+#ifdef METALCPP_IMP_CACHE
+#define _NS_PRIVATE_IMP_CACHE_SITE() ([]() -> NS::Private::ImpCache* { static NS::Private::ImpCache s_cache; return &s_cache; }())
+#else
+#define _NS_PRIVATE_IMP_CACHE_SITE() (static_cast<NS::Private::ImpCache*>(nullptr))
+#endif // METALCPP_IMP_CACHE
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
 namespace NS
 {
+namespace Private
+{
+    class ImpCache
+    {
+    public:
+        constexpr ImpCache() = default;
+
+        IMP lookup(const void* pObj, SEL selector);
+
+    private:
+        IMP refill(::Class cls, SEL selector, std::uint32_t sequence);
+
+        std::atomic<std::uint32_t> m_sequence = { 0 };
+        std::atomic<::Class>       m_class = { nullptr };
+        std::atomic<IMP>           m_imp = { nullptr };
+    };
+} // Private
+
 template <class _Class, class _Base = class Object>
 class _NS_EXPORT Referencing : public _Base
 {
@@ -88,6 +115,8 @@ protected:
     static _Ret sendMessage(const void* pObj, SEL selector, _Args... args);
     template <typename _Ret, typename... _Args>
     static _Ret sendMessageSafe(const void* pObj, SEL selector, _Args... args);
+    template <typename _Ret, typename... _Args>
+    static _Ret sendMessageCached(Private::ImpCache* pCache, const void* pObj, SEL selector, _Args... args);
 
 private:
     Object() = delete;
@@ -219,6 +248,71 @@ _NS_INLINE _Ret NS::Object::sendMessage(const void* pObj, SEL selector, _Args...
 
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------
 
+_NS_INLINE IMP NS::Private::ImpCache::lookup(const void* pObj, SEL selector)
+{
+    ::Class       cls = object_getClass(static_cast<id>(const_cast<void*>(pObj)));
+    std::uint32_t sequence = m_sequence.load(std::memory_order_acquire);
+
+    if (__builtin_expect((sequence & 1) == 0, 1))
+    {
+        ::Class cachedClass = m_class.load(std::memory_order_relaxed);
+        IMP     cachedImp = m_imp.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (__builtin_expect((cachedClass == cls) && (m_sequence.load(std::memory_order_relaxed) == sequence), 1))
+        {
+            return cachedImp;
+        }
+    }
+
+    return refill(cls, selector, sequence);
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+inline IMP NS::Private::ImpCache::refill(::Class cls, SEL selector, std::uint32_t sequence)
+{
+    // Only one writer refills the entry at a time, a losing writer simply uses the IMP it resolved without publishing it.
+
+    IMP imp = class_getMethodImplementation(cls, selector);
+
+    if (((sequence & 1) == 0) && m_sequence.compare_exchange_strong(sequence, sequence + 1, std::memory_order_acquire, std::memory_order_relaxed))
+    {
+        std::atomic_thread_fence(std::memory_order_release);
+
+        m_class.store(cls, std::memory_order_relaxed);
+        m_imp.store(imp, std::memory_order_relaxed);
+        m_sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    return imp;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename _Ret, typename... _Args>
+_NS_INLINE _Ret NS::Object::sendMessageCached(Private::ImpCache* pCache, const void* pObj, SEL selector, _Args... args)
+{
+    // Methods returning large structs go through the _stret entry points, which IMP lookup can't express portably.
+
+    if constexpr (!doesRequireMsgSendStret<_Ret>())
+    {
+        if (pCache && pObj)
+        {
+            using MethodProc = _Ret (*)(const void*, SEL, _Args...);
+
+            const MethodProc pProc = reinterpret_cast<MethodProc>(pCache->lookup(pObj, selector));
+
+            return (*pProc)(pObj, selector, args...);
+        }
+    }
+
+    return sendMessage<_Ret>(pObj, selector, args...);
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
 _NS_INLINE NS::MethodSignature* NS::Object::methodSignatureForSelector(const void* pObj, SEL selector)
 {
     return sendMessage<MethodSignature*>(pObj, _NS_PRIVATE_SEL(methodSignatureForSelector_), selector);
@@ -26,8 +26,13 @@
 
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------
 
+#ifdef METALCPP_LAZY_REGISTRATION
+#define _NS_PRIVATE_CLS(symbol) (Private::Class::s_l##symbol.get())
+#define _NS_PRIVATE_SEL(accessor) (Private::Selector::s_l##accessor.get())
+#else
 #define _NS_PRIVATE_CLS(symbol) (Private::Class::s_k##symbol)
 #define _NS_PRIVATE_SEL(accessor) (Private::Selector::s_k##accessor)
+#endif // METALCPP_LAZY_REGISTRATION
 
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -49,24 +54,125 @@
 #define _NS_PRIVATE_OBJC_GET_PROTOCOL(symbol) objc_getProtocol(#symbol)
 #endif // __OBJC__
 
+#ifdef METALCPP_LAZY_REGISTRATION
+#define _NS_PRIVATE_DEF_CLS(symbol) NS::Private::LazyClass s_l##symbol _NS_PRIVATE_VISIBILITY = { #symbol }
+#define _NS_PRIVATE_DEF_PRO(symbol) NS::Private::LazyProtocol s_l##symbol _NS_PRIVATE_VISIBILITY = { #symbol }
+#define _NS_PRIVATE_DEF_SEL(accessor, symbol) NS::Private::LazySelector s_l##accessor _NS_PRIVATE_VISIBILITY = { symbol }
+#else
 #define _NS_PRIVATE_DEF_CLS(symbol) void* s_k##symbol _NS_PRIVATE_VISIBILITY = _NS_PRIVATE_OBJC_LOOKUP_CLASS(symbol)
 #define _NS_PRIVATE_DEF_PRO(symbol) void* s_k##symbol _NS_PRIVATE_VISIBILITY = _NS_PRIVATE_OBJC_GET_PROTOCOL(symbol)
 #define _NS_PRIVATE_DEF_SEL(accessor, symbol) SEL s_k##accessor _NS_PRIVATE_VISIBILITY = sel_registerName(symbol)
+#endif // METALCPP_LAZY_REGISTRATION
 #define _NS_PRIVATE_DEF_CONST(type, symbol)              \
     _NS_EXTERN type const NS##symbol _NS_PRIVATE_IMPORT; \
     type const                       NS::symbol = (nullptr != &NS##symbol) ? NS##symbol : nullptr
 
 #else
 
+#ifdef METALCPP_LAZY_REGISTRATION
+#define _NS_PRIVATE_DEF_CLS(symbol) extern NS::Private::LazyClass s_l##symbol
+#define _NS_PRIVATE_DEF_PRO(symbol) extern NS::Private::LazyProtocol s_l##symbol
+#define _NS_PRIVATE_DEF_SEL(accessor, symbol) extern NS::Private::LazySelector s_l##accessor
+#else
 #define _NS_PRIVATE_DEF_CLS(symbol) extern void* s_k##symbol
 #define _NS_PRIVATE_DEF_PRO(symbol) extern void* s_k##symbol
 #define _NS_PRIVATE_DEF_SEL(accessor, symbol) extern SEL s_k##accessor
+#endif // METALCPP_LAZY_REGISTRATION
 #define _NS_PRIVATE_DEF_CONST(type, symbol) extern type const NS::symbol
 
 #endif // NS_PRIVATE_IMPLEMENTATION
 
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------
 
+#ifdef METALCPP_LAZY_REGISTRATION
+
+#include <atomic>
+
+namespace NS
+{
+namespace Private
+{
+    template <typename _Type, _Type (*_Resolve)(const char*)>
+    class LazySymbol
+    {
+    public:
+        constexpr LazySymbol(const char* pName)
+            : m_pName(pName)
+            , m_symbol(nullptr)
+        {
+        }
+
+        _Type get();
+
+    private:
+        _Type resolve();
+
+        const char*        m_pName;
+        std::atomic<_Type> m_symbol;
+    };
+
+    inline void* LookUpClass(const char* pName)
+    {
+#ifdef __OBJC__
+        return (__bridge void*)objc_lookUpClass(pName);
+#else
+        return objc_lookUpClass(pName);
+#endif // __OBJC__
+    }
+
+    inline void* GetProtocol(const char* pName)
+    {
+#ifdef __OBJC__
+        return (__bridge void*)objc_getProtocol(pName);
+#else
+        return objc_getProtocol(pName);
+#endif // __OBJC__
+    }
+
+    using LazySelector = LazySymbol<SEL, &sel_registerName>;
+    using LazyClass = LazySymbol<void*, &LookUpClass>;
+    using LazyProtocol = LazySymbol<void*, &GetProtocol>;
+} // Private
+} // NS
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename _Type, _Type (*_Resolve)(const char*)>
+inline __attribute__((always_inline)) _Type NS::Private::LazySymbol<_Type, _Resolve>::get()
+{
+    _Type symbol = m_symbol.load(std::memory_order_acquire);
+
+    if (__builtin_expect(nullptr != symbol, 1))
+    {
+        return symbol;
+    }
+
+    return resolve();
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename _Type, _Type (*_Resolve)(const char*)>
+__attribute__((noinline)) _Type NS::Private::LazySymbol<_Type, _Resolve>::resolve()
+{
+    // The runtime interns selectors and classes, so racing threads all store the same value and no lock is needed.
+    //
+    // A failed class or protocol lookup is stored as nullptr and so is retried on the next get(). That is deliberate:
+    // unlike a symbol resolved at static initialization, a lazy one can still find a class that a bundle loaded later
+    // or the program itself registers after the first lookup. A retry costs one runtime lookup, and only code that
+    // keeps using a class the system doesn't have pays it.
+
+    _Type symbol = (*_Resolve)(m_pName);
+
+    m_symbol.store(symbol, std::memory_order_release);
+
+    return symbol;
+}
+
+#endif // METALCPP_LAZY_REGISTRATION
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
 namespace NS
 {
 namespace Private
@@ -228,6 +334,8 @@ namespace Private
             "floatValue");
         _NS_PRIVATE_DEF_SEL(fullUserName,
             "fullUserName");
+        _NS_PRIVATE_DEF_SEL(getObjects_range_,
+            "getObjects:range:");
         _NS_PRIVATE_DEF_SEL(getValue_size_,
             "getValue:size:");
         _NS_PRIVATE_DEF_SEL(globallyUniqueString,
@@ -0,0 +1,158 @@
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+// Foundation/NSRef.hpp
+//
+// Copyright 2020-2022 Apple Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include "NSDefines.hpp"
+#include "NSLocalPtr.hpp"
+#include "NSSharedPtr.hpp"
+
+namespace NS
+{
+/**
+ * Borrowed, non-owning view of an object owned elsewhere.
+ * A Ref never touches the reference count. It is as cheap to copy as a raw pointer and only documents that the
+ * holder does not own the pointee. The owner must outlive every Ref made from it.
+ */
+template <class _Class>
+class Ref
+{
+public:
+    /**
+     * Create a null reference.
+     */
+    Ref();
+
+    /**
+     * Borrow a raw pointer.
+     */
+    Ref(_Class* pObject);
+
+    /**
+     * Borrow the pointee of a SharedPtr.
+     */
+    Ref(const SharedPtr<_Class>& owner);
+
+    /**
+     * Borrow the pointee of a LocalPtr.
+     */
+    Ref(const LocalPtr<_Class>& owner);
+
+    /**
+     * Borrowing from a temporary owner would dangle as soon as the full expression ends.
+     */
+    Ref(SharedPtr<_Class>&& owner) = delete;
+    Ref(LocalPtr<_Class>&& owner) = delete;
+
+    /**
+     * Access raw pointee.
+     */
+    _Class* get() const;
+
+    /**
+     * Call operations directly on the pointee.
+     */
+    _Class* operator->() const;
+
+    /**
+     * Implicit cast to bool.
+     */
+    explicit operator bool() const;
+
+    /**
+     * Take shared ownership of the pointee, increasing its reference count.
+     */
+    SharedPtr<_Class> retain() const;
+
+    /**
+     * Take single-threaded ownership of the pointee, increasing its reference count once.
+     */
+    LocalPtr<_Class> retainLocal() const;
+
+private:
+    _Class* m_pObject;
+};
+}
+
+template <class _Class>
+_NS_INLINE NS::Ref<_Class>::Ref()
+    : m_pObject(nullptr)
+{
+}
+
+template <class _Class>
+_NS_INLINE NS::Ref<_Class>::Ref(_Class* pObject)
+    : m_pObject(pObject)
+{
+}
+
+template <class _Class>
+_NS_INLINE NS::Ref<_Class>::Ref(const NS::SharedPtr<_Class>& owner)
+    : m_pObject(owner.get())
+{
+}
+
+template <class _Class>
+_NS_INLINE NS::Ref<_Class>::Ref(const NS::LocalPtr<_Class>& owner)
+    : m_pObject(owner.get())
+{
+}
+
+template <class _Class>
+_NS_INLINE _Class* NS::Ref<_Class>::get() const
+{
+    return m_pObject;
+}
+
+template <class _Class>
+_NS_INLINE _Class* NS::Ref<_Class>::operator->() const
+{
+    return m_pObject;
+}
+
+template <class _Class>
+_NS_INLINE NS::Ref<_Class>::operator bool() const
+{
+    return nullptr != m_pObject;
+}
+
+template <class _Class>
+_NS_INLINE NS::SharedPtr<_Class> NS::Ref<_Class>::retain() const
+{
+    return m_pObject ? NS::RetainPtr(m_pObject) : NS::SharedPtr<_Class>();
+}
+
+template <class _Class>
+_NS_INLINE NS::LocalPtr<_Class> NS::Ref<_Class>::retainLocal() const
+{
+    return NS::RetainLocalPtr(m_pObject);
+}
+
+template <class _ClassLhs, class _ClassRhs>
+_NS_INLINE bool operator==(const NS::Ref<_ClassLhs>& lhs, const NS::Ref<_ClassRhs>& rhs)
+{
+    return lhs.get() == rhs.get();
+}
+
+template <class _ClassLhs, class _ClassRhs>
+_NS_INLINE bool operator!=(const NS::Ref<_ClassLhs>& lhs, const NS::Ref<_ClassRhs>& rhs)
+{
+    return lhs.get() != rhs.get();
+}
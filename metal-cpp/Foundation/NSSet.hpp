@@ -35,6 +35,11 @@ namespace NS
             UInteger count() const;
             Enumerator<Object>* objectEnumerator() const;
 
+            template <class _Object = Object>
+            FastEnumerationRange<_Object> objects() const;
+            FastEnumerationIterator<Object> begin() const;
+            FastEnumerationIterator<Object> end() const;
+
             static Set* alloc();
 
             Set* init();
@@ -85,3 +90,25 @@ _NS_INLINE NS::Set* NS::Set::init(const class Coder* pCoder)
 {
     return Object::sendMessage<Set*>(this, _NS_PRIVATE_SEL(initWithCoder_), pCoder);
 }
+
+template <class _Object>
+_NS_INLINE NS::FastEnumerationRange<_Object> NS::Set::objects() const
+{
+    return NS::FastEnumerationRange<_Object>(this);
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+_NS_INLINE NS::FastEnumerationIterator<NS::Object> NS::Set::begin() const
+{
+    return NS::FastEnumerationIterator<NS::Object>(this);
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+_NS_INLINE NS::FastEnumerationIterator<NS::Object> NS::Set::end() const
+{
+    return NS::FastEnumerationIterator<NS::Object>();
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -28,6 +28,10 @@
 #include "NSRange.hpp"
 #include "NSTypes.hpp"
 
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 namespace NS
@@ -96,6 +100,17 @@ public:
     UInteger       maximumLengthOfBytes(StringEncoding encoding) const;
     UInteger       lengthOfBytes(StringEncoding encoding) const;
 
+    /**
+     * View the string as UTF-8 without copying when its storage already is contiguous UTF-8 (or ASCII). Otherwise the
+     * bytes are converted into pBuffer, and the view points there. Strings that do not fit into pBuffer, or any string
+     * when pBuffer is null or bufferLength is 0, fall back to utf8String(), which allocates an autoreleased buffer. The
+     * view is only valid while the string and pBuffer live.
+     */
+    std::string_view utf8View(char* pBuffer, UInteger bufferLength) const;
+
+    template <std::size_t _BufferLength>
+    std::string_view utf8View(char (&buffer)[_BufferLength]) const;
+
     bool           isEqualToString(const String* pString) const;
     Range          rangeOfString(const String* pString, StringCompareOptions options) const;
 
@@ -216,6 +231,44 @@ _NS_INLINE NS::UInteger NS::String::lengthOfBytes(StringEncoding encoding) const
 
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------
 
+_NS_INLINE std::string_view NS::String::utf8View(char* pBuffer, UInteger bufferLength) const
+{
+    const CFStringRef cfString = reinterpret_cast<CFStringRef>(const_cast<String*>(this));
+
+    if (const char* pDirect = CFStringGetCStringPtr(cfString, kCFStringEncodingUTF8))
+    {
+        return std::string_view(pDirect, std::strlen(pDirect));
+    }
+
+    // CFStringGetBytes only measures when given no buffer, so that case must not take the converted path.
+    if (pBuffer && bufferLength)
+    {
+        const CFIndex characterCount = CFStringGetLength(cfString);
+        CFIndex       byteCount = 0;
+        const CFIndex convertedCount = CFStringGetBytes(cfString, CFRangeMake(0, characterCount), kCFStringEncodingUTF8, 0, false,
+            reinterpret_cast<UInt8*>(pBuffer), static_cast<CFIndex>(bufferLength), &byteCount);
+
+        if (convertedCount == characterCount)
+        {
+            return std::string_view(pBuffer, static_cast<std::size_t>(byteCount));
+        }
+    }
+
+    const char* pString = utf8String();
+
+    return pString ? std::string_view(pString, std::strlen(pString)) : std::string_view();
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+template <std::size_t _BufferLength>
+_NS_INLINE std::string_view NS::String::utf8View(char (&buffer)[_BufferLength]) const
+{
+    return utf8View(buffer, _BufferLength);
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
 _NS_INLINE bool NS::String::isEqualToString(const NS::String* pString) const
 {
     return Object::sendMessage<bool>(this, _NS_PRIVATE_SEL(isEqualToString_), pString);
@@ -0,0 +1,102 @@
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+// Metal/MTLAllocationHooks.hpp
+//
+// Copyright 2020-2022 Apple Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+#include "MTLDefines.hpp"
+
+#include "../Foundation/NSTypes.hpp"
+
+#ifndef METALCPP_ALLOCATION_HOOKS
+#define METALCPP_ALLOCATION_HOOKS 0
+#endif // METALCPP_ALLOCATION_HOOKS
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace MTL
+{
+class Heap;
+
+_MTL_ENUM(NS::UInteger, AllocationKind) {
+    AllocationKindBuffer = 0,
+    AllocationKindTexture = 1,
+    AllocationKindHeap = 2,
+};
+
+/**
+ * Called with every buffer, texture and heap created through Device::newBuffer, Device::newTexture, Device::newHeap,
+ * Heap::newBuffer and Heap::newTexture, right after creation. pHeap is the heap a resource was placed in, or nullptr.
+ * Only compiled in when METALCPP_ALLOCATION_HOOKS is non-zero; otherwise the factories are untouched and the handler is
+ * never called. Shared by all threads; set it at startup.
+ */
+using AllocationHandler = void (*)(void* pObject, AllocationKind kind, Heap* pHeap);
+
+void setAllocationHandler(AllocationHandler handler);
+
+namespace Private
+{
+    AllocationHandler& allocationHandler();
+
+    template <typename _Object>
+    _Object* reportAllocation(_Object* pObject, AllocationKind kind, Heap* pHeap);
+}
+}
+
+#if METALCPP_ALLOCATION_HOOKS
+#define _MTL_REPORT_ALLOCATION(object, kind, heap) MTL::Private::reportAllocation(object, kind, heap)
+#else
+#define _MTL_REPORT_ALLOCATION(object, kind, heap) (object)
+#endif // METALCPP_ALLOCATION_HOOKS
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+_MTL_INLINE void MTL::setAllocationHandler(AllocationHandler handler)
+{
+    Private::allocationHandler() = handler;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+_MTL_INLINE MTL::AllocationHandler& MTL::Private::allocationHandler()
+{
+    static AllocationHandler handler = nullptr;
+
+    return handler;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename _Object>
+_MTL_INLINE _Object* MTL::Private::reportAllocation(_Object* pObject, AllocationKind kind, Heap* pHeap)
+{
+    if (pObject)
+    {
+        if (AllocationHandler handler = allocationHandler())
+        {
+            handler(pObject, kind, pHeap);
+        }
+    }
+
+    return pObject;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -57,13 +57,13 @@ public:
 // property: length
 _MTL_INLINE NS::UInteger MTL::Buffer::length() const
 {
-    return Object::sendMessage<NS::UInteger>(this, _MTL_PRIVATE_SEL(length));
+    return Object::sendMessageCached<NS::UInteger>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(length));
 }
 
 // method: contents
 _MTL_INLINE void* MTL::Buffer::contents()
 {
-    return Object::sendMessage<void*>(this, _MTL_PRIVATE_SEL(contents));
+    return Object::sendMessageCached<void*>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(contents));
 }
 
 // method: didModifyRange:
@@ -128,25 +128,25 @@ _MTL_INLINE MTL::DispatchType MTL::ComputeCommandEncoder::dispatchType() const
 // method: setComputePipelineState:
 _MTL_INLINE void MTL::ComputeCommandEncoder::setComputePipelineState(const MTL::ComputePipelineState* state)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setComputePipelineState_), state);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setComputePipelineState_), state);
 }
 
 // method: setBytes:length:atIndex:
 _MTL_INLINE void MTL::ComputeCommandEncoder::setBytes(const void* bytes, NS::UInteger length, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setBytes_length_atIndex_), bytes, length, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setBytes_length_atIndex_), bytes, length, index);
 }
 
 // method: setBuffer:offset:atIndex:
 _MTL_INLINE void MTL::ComputeCommandEncoder::setBuffer(const MTL::Buffer* buffer, NS::UInteger offset, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setBuffer_offset_atIndex_), buffer, offset, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setBuffer_offset_atIndex_), buffer, offset, index);
 }
 
 // method: setBufferOffset:atIndex:
 _MTL_INLINE void MTL::ComputeCommandEncoder::setBufferOffset(NS::UInteger offset, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setBufferOffset_atIndex_), offset, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setBufferOffset_atIndex_), offset, index);
 }
 
 // method: setBuffers:offsets:withRange:
@@ -188,7 +188,7 @@ _MTL_INLINE void MTL::ComputeCommandEncoder::setAccelerationStructure(const MTL:
 // method: setTexture:atIndex:
 _MTL_INLINE void MTL::ComputeCommandEncoder::setTexture(const MTL::Texture* texture, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setTexture_atIndex_), texture, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setTexture_atIndex_), texture, index);
 }
 
 // method: setTextures:withRange:
@@ -200,7 +200,7 @@ _MTL_INLINE void MTL::ComputeCommandEncoder::setTextures(const MTL::Texture* con
 // method: setSamplerState:atIndex:
 _MTL_INLINE void MTL::ComputeCommandEncoder::setSamplerState(const MTL::SamplerState* sampler, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setSamplerState_atIndex_), sampler, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setSamplerState_atIndex_), sampler, index);
 }
 
 // method: setSamplerStates:withRange:
@@ -212,7 +212,7 @@ _MTL_INLINE void MTL::ComputeCommandEncoder::setSamplerStates(const MTL::Sampler
 // method: setSamplerState:lodMinClamp:lodMaxClamp:atIndex:
 _MTL_INLINE void MTL::ComputeCommandEncoder::setSamplerState(const MTL::SamplerState* sampler, float lodMinClamp, float lodMaxClamp, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setSamplerState_lodMinClamp_lodMaxClamp_atIndex_), sampler, lodMinClamp, lodMaxClamp, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setSamplerState_lodMinClamp_lodMaxClamp_atIndex_), sampler, lodMinClamp, lodMaxClamp, index);
 }
 
 // method: setSamplerStates:lodMinClamps:lodMaxClamps:withRange:
@@ -248,19 +248,19 @@ _MTL_INLINE void MTL::ComputeCommandEncoder::setStageInRegion(const MTL::Buffer*
 // method: dispatchThreadgroups:threadsPerThreadgroup:
 _MTL_INLINE void MTL::ComputeCommandEncoder::dispatchThreadgroups(MTL::Size threadgroupsPerGrid, MTL::Size threadsPerThreadgroup)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(dispatchThreadgroups_threadsPerThreadgroup_), threadgroupsPerGrid, threadsPerThreadgroup);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(dispatchThreadgroups_threadsPerThreadgroup_), threadgroupsPerGrid, threadsPerThreadgroup);
 }
 
 // method: dispatchThreadgroupsWithIndirectBuffer:indirectBufferOffset:threadsPerThreadgroup:
 _MTL_INLINE void MTL::ComputeCommandEncoder::dispatchThreadgroups(const MTL::Buffer* indirectBuffer, NS::UInteger indirectBufferOffset, MTL::Size threadsPerThreadgroup)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(dispatchThreadgroupsWithIndirectBuffer_indirectBufferOffset_threadsPerThreadgroup_), indirectBuffer, indirectBufferOffset, threadsPerThreadgroup);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(dispatchThreadgroupsWithIndirectBuffer_indirectBufferOffset_threadsPerThreadgroup_), indirectBuffer, indirectBufferOffset, threadsPerThreadgroup);
 }
 
 // method: dispatchThreads:threadsPerThreadgroup:
 _MTL_INLINE void MTL::ComputeCommandEncoder::dispatchThreads(MTL::Size threadsPerGrid, MTL::Size threadsPerThreadgroup)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(dispatchThreads_threadsPerThreadgroup_), threadsPerGrid, threadsPerThreadgroup);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(dispatchThreads_threadsPerThreadgroup_), threadsPerGrid, threadsPerThreadgroup);
 }
 
 // method: updateFence:
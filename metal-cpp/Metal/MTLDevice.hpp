@@ -21,6 +21,7 @@
 #pragma once
 
 #include "MTLDefines.hpp"
+#include "MTLAllocationHooks.hpp"
 #include "MTLHeaderBridge.hpp"
 #include "MTLPrivate.hpp"
 
@@ -850,25 +851,25 @@ _MTL_INLINE MTL::SizeAndAlign MTL::Device::heapBufferSizeAndAlign(NS::UInteger l
 // method: newHeapWithDescriptor:
 _MTL_INLINE MTL::Heap* MTL::Device::newHeap(const MTL::HeapDescriptor* descriptor)
 {
-    return Object::sendMessage<MTL::Heap*>(this, _MTL_PRIVATE_SEL(newHeapWithDescriptor_), descriptor);
+    return _MTL_REPORT_ALLOCATION(Object::sendMessage<MTL::Heap*>(this, _MTL_PRIVATE_SEL(newHeapWithDescriptor_), descriptor), MTL::AllocationKindHeap, nullptr);
 }
 
 // method: newBufferWithLength:options:
 _MTL_INLINE MTL::Buffer* MTL::Device::newBuffer(NS::UInteger length, MTL::ResourceOptions options)
 {
-    return Object::sendMessage<MTL::Buffer*>(this, _MTL_PRIVATE_SEL(newBufferWithLength_options_), length, options);
+    return _MTL_REPORT_ALLOCATION(Object::sendMessage<MTL::Buffer*>(this, _MTL_PRIVATE_SEL(newBufferWithLength_options_), length, options), MTL::AllocationKindBuffer, nullptr);
 }
 
 // method: newBufferWithBytes:length:options:
 _MTL_INLINE MTL::Buffer* MTL::Device::newBuffer(const void* pointer, NS::UInteger length, MTL::ResourceOptions options)
 {
-    return Object::sendMessage<MTL::Buffer*>(this, _MTL_PRIVATE_SEL(newBufferWithBytes_length_options_), pointer, length, options);
+    return _MTL_REPORT_ALLOCATION(Object::sendMessage<MTL::Buffer*>(this, _MTL_PRIVATE_SEL(newBufferWithBytes_length_options_), pointer, length, options), MTL::AllocationKindBuffer, nullptr);
 }
 
 // method: newBufferWithBytesNoCopy:length:options:deallocator:
 _MTL_INLINE MTL::Buffer* MTL::Device::newBuffer(const void* pointer, NS::UInteger length, MTL::ResourceOptions options, void (^deallocator)(void*, NS::UInteger))
 {
-    return Object::sendMessage<MTL::Buffer*>(this, _MTL_PRIVATE_SEL(newBufferWithBytesNoCopy_length_options_deallocator_), pointer, length, options, deallocator);
+    return _MTL_REPORT_ALLOCATION(Object::sendMessage<MTL::Buffer*>(this, _MTL_PRIVATE_SEL(newBufferWithBytesNoCopy_length_options_deallocator_), pointer, length, options, deallocator), MTL::AllocationKindBuffer, nullptr);
 }
 
 // method: newDepthStencilStateWithDescriptor:
@@ -880,13 +881,13 @@ _MTL_INLINE MTL::DepthStencilState* MTL::Device::newDepthStencilState(const MTL:
 // method: newTextureWithDescriptor:
 _MTL_INLINE MTL::Texture* MTL::Device::newTexture(const MTL::TextureDescriptor* descriptor)
 {
-    return Object::sendMessage<MTL::Texture*>(this, _MTL_PRIVATE_SEL(newTextureWithDescriptor_), descriptor);
+    return _MTL_REPORT_ALLOCATION(Object::sendMessage<MTL::Texture*>(this, _MTL_PRIVATE_SEL(newTextureWithDescriptor_), descriptor), MTL::AllocationKindTexture, nullptr);
 }
 
 // method: newTextureWithDescriptor:iosurface:plane:
 _MTL_INLINE MTL::Texture* MTL::Device::newTexture(const MTL::TextureDescriptor* descriptor, const IOSurfaceRef iosurface, NS::UInteger plane)
 {
-    return Object::sendMessage<MTL::Texture*>(this, _MTL_PRIVATE_SEL(newTextureWithDescriptor_iosurface_plane_), descriptor, iosurface, plane);
+    return _MTL_REPORT_ALLOCATION(Object::sendMessage<MTL::Texture*>(this, _MTL_PRIVATE_SEL(newTextureWithDescriptor_iosurface_plane_), descriptor, iosurface, plane), MTL::AllocationKindTexture, nullptr);
 }
 
 // method: newSharedTextureWithDescriptor:
@@ -28,6 +28,8 @@
 
 #include "MTLEvent.hpp"
 
+#include <functional>
+
 namespace MTL
 {
 class Event : public NS::Referencing<Event>
@@ -53,11 +55,15 @@ public:
 
 using SharedEventNotificationBlock = void (^)(SharedEvent* pEvent, std::uint64_t value);
 
+using SharedEventNotificationFunction = std::function<void(SharedEvent* pEvent, std::uint64_t value)>;
+
 class SharedEvent : public NS::Referencing<SharedEvent, Event>
 {
 public:
     void                     notifyListener(const class SharedEventListener* listener, uint64_t value, const MTL::SharedEventNotificationBlock block);
 
+    void                     notifyListener(const class SharedEventListener* listener, uint64_t value, const MTL::SharedEventNotificationFunction& function);
+
     class SharedEventHandle* newSharedEventHandle();
 
     uint64_t                 signaledValue() const;
@@ -123,6 +129,13 @@ _MTL_INLINE void MTL::SharedEvent::notifyListener(const MTL::SharedEventListener
     Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(notifyListener_atValue_block_), listener, value, block);
 }
 
+_MTL_INLINE void MTL::SharedEvent::notifyListener(const MTL::SharedEventListener* listener, uint64_t value, const MTL::SharedEventNotificationFunction& function)
+{
+    __block MTL::SharedEventNotificationFunction blockFunction = function;
+
+    notifyListener(listener, value, ^(MTL::SharedEvent* pEvent, std::uint64_t notifiedValue) { blockFunction(pEvent, notifiedValue); });
+}
+
 // method: newSharedEventHandle
 _MTL_INLINE MTL::SharedEventHandle* MTL::SharedEvent::newSharedEventHandle()
 {
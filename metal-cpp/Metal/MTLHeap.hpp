@@ -21,6 +21,7 @@
 #pragma once
 
 #include "MTLDefines.hpp"
+#include "MTLAllocationHooks.hpp"
 #include "MTLHeaderBridge.hpp"
 #include "MTLPrivate.hpp"
 
@@ -271,13 +272,13 @@ _MTL_INLINE NS::UInteger MTL::Heap::maxAvailableSize(NS::UInteger alignment)
 // method: newBufferWithLength:options:
 _MTL_INLINE MTL::Buffer* MTL::Heap::newBuffer(NS::UInteger length, MTL::ResourceOptions options)
 {
-    return Object::sendMessage<MTL::Buffer*>(this, _MTL_PRIVATE_SEL(newBufferWithLength_options_), length, options);
+    return _MTL_REPORT_ALLOCATION(Object::sendMessage<MTL::Buffer*>(this, _MTL_PRIVATE_SEL(newBufferWithLength_options_), length, options), MTL::AllocationKindBuffer, this);
 }
 
 // method: newTextureWithDescriptor:
 _MTL_INLINE MTL::Texture* MTL::Heap::newTexture(const MTL::TextureDescriptor* desc)
 {
-    return Object::sendMessage<MTL::Texture*>(this, _MTL_PRIVATE_SEL(newTextureWithDescriptor_), desc);
+    return _MTL_REPORT_ALLOCATION(Object::sendMessage<MTL::Texture*>(this, _MTL_PRIVATE_SEL(newTextureWithDescriptor_), desc), MTL::AllocationKindTexture, this);
 }
 
 // method: setPurgeableState:
@@ -295,13 +296,13 @@ _MTL_INLINE MTL::HeapType MTL::Heap::type() const
 // method: newBufferWithLength:options:offset:
 _MTL_INLINE MTL::Buffer* MTL::Heap::newBuffer(NS::UInteger length, MTL::ResourceOptions options, NS::UInteger offset)
 {
-    return Object::sendMessage<MTL::Buffer*>(this, _MTL_PRIVATE_SEL(newBufferWithLength_options_offset_), length, options, offset);
+    return _MTL_REPORT_ALLOCATION(Object::sendMessage<MTL::Buffer*>(this, _MTL_PRIVATE_SEL(newBufferWithLength_options_offset_), length, options, offset), MTL::AllocationKindBuffer, this);
 }
 
 // method: newTextureWithDescriptor:offset:
 _MTL_INLINE MTL::Texture* MTL::Heap::newTexture(const MTL::TextureDescriptor* descriptor, NS::UInteger offset)
 {
-    return Object::sendMessage<MTL::Texture*>(this, _MTL_PRIVATE_SEL(newTextureWithDescriptor_offset_), descriptor, offset);
+    return _MTL_REPORT_ALLOCATION(Object::sendMessage<MTL::Texture*>(this, _MTL_PRIVATE_SEL(newTextureWithDescriptor_offset_), descriptor, offset), MTL::AllocationKindTexture, this);
 }
 
 // method: newAccelerationStructureWithSize:
@@ -24,12 +24,21 @@
 
 #include "MTLDefines.hpp"
 
+#ifdef METALCPP_LAZY_REGISTRATION
+#include "../Foundation/NSPrivate.hpp"
+#endif // METALCPP_LAZY_REGISTRATION
+
 #include <objc/runtime.h>
 
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------
 
+#ifdef METALCPP_LAZY_REGISTRATION
+#define _MTL_PRIVATE_CLS(symbol) (Private::Class::s_l##symbol.get())
+#define _MTL_PRIVATE_SEL(accessor) (Private::Selector::s_l##accessor.get())
+#else
 #define _MTL_PRIVATE_CLS(symbol) (Private::Class::s_k##symbol)
 #define _MTL_PRIVATE_SEL(accessor) (Private::Selector::s_k##accessor)
+#endif // METALCPP_LAZY_REGISTRATION
 
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -51,9 +60,15 @@
 #define _MTL_PRIVATE_OBJC_GET_PROTOCOL(symbol) objc_getProtocol(#symbol)
 #endif // __OBJC__
 
+#ifdef METALCPP_LAZY_REGISTRATION
+#define _MTL_PRIVATE_DEF_CLS(symbol) NS::Private::LazyClass s_l##symbol _MTL_PRIVATE_VISIBILITY = { #symbol }
+#define _MTL_PRIVATE_DEF_PRO(symbol) NS::Private::LazyProtocol s_l##symbol _MTL_PRIVATE_VISIBILITY = { #symbol }
+#define _MTL_PRIVATE_DEF_SEL(accessor, symbol) NS::Private::LazySelector s_l##accessor _MTL_PRIVATE_VISIBILITY = { symbol }
+#else
 #define _MTL_PRIVATE_DEF_CLS(symbol) void* s_k##symbol _MTL_PRIVATE_VISIBILITY = _MTL_PRIVATE_OBJC_LOOKUP_CLASS(symbol)
 #define _MTL_PRIVATE_DEF_PRO(symbol) void* s_k##symbol _MTL_PRIVATE_VISIBILITY = _MTL_PRIVATE_OBJC_GET_PROTOCOL(symbol)
 #define _MTL_PRIVATE_DEF_SEL(accessor, symbol) SEL s_k##accessor _MTL_PRIVATE_VISIBILITY = sel_registerName(symbol)
+#endif // METALCPP_LAZY_REGISTRATION
 
 #include <dlfcn.h>
 #define MTL_DEF_FUNC( name, signature ) \
@@ -101,9 +116,15 @@ namespace MTL::Private
 
 #else
 
+#ifdef METALCPP_LAZY_REGISTRATION
+#define _MTL_PRIVATE_DEF_CLS(symbol) extern NS::Private::LazyClass s_l##symbol
+#define _MTL_PRIVATE_DEF_PRO(symbol) extern NS::Private::LazyProtocol s_l##symbol
+#define _MTL_PRIVATE_DEF_SEL(accessor, symbol) extern NS::Private::LazySelector s_l##accessor
+#else
 #define _MTL_PRIVATE_DEF_CLS(symbol) extern void* s_k##symbol
 #define _MTL_PRIVATE_DEF_PRO(symbol) extern void* s_k##symbol
 #define _MTL_PRIVATE_DEF_SEL(accessor, symbol) extern SEL s_k##accessor
+#endif // METALCPP_LAZY_REGISTRATION
 #define _MTL_PRIVATE_DEF_STR(type, symbol) extern type const MTL::symbol
 #define _MTL_PRIVATE_DEF_CONST(type, symbol) extern type const MTL::symbol
 #define _MTL_PRIVATE_DEF_WEAK_CONST(type, symbol) extern type const MTL::symbol
@@ -112,6 +133,25 @@ namespace MTL::Private
 
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------
 
+#ifdef METALCPP_SELECTOR_TABLE
+
+#ifdef METALCPP_LAZY_REGISTRATION
+#error "METALCPP_SELECTOR_TABLE and METALCPP_LAZY_REGISTRATION can't be combined."
+#endif // METALCPP_LAZY_REGISTRATION
+
+#include "MTLSelectorTable.hpp"
+
+// All selectors live in the generated table, the per-selector definitions only check that the table is up to date.
+
+#undef _MTL_PRIVATE_SEL
+#undef _MTL_PRIVATE_DEF_SEL
+#define _MTL_PRIVATE_SEL(accessor) (Private::Selector::s_kTable[static_cast<std::size_t>(Private::Selector::Index::accessor)])
+#define _MTL_PRIVATE_DEF_SEL(accessor, symbol) static_assert(Index::accessor < Index::Count, "Regenerate MTLSelectorTable.hpp: " symbol)
+
+#endif // METALCPP_SELECTOR_TABLE
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
 namespace MTL
 {
 namespace Private
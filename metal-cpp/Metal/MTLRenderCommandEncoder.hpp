@@ -397,25 +397,25 @@ public:
 // method: setRenderPipelineState:
 _MTL_INLINE void MTL::RenderCommandEncoder::setRenderPipelineState(const MTL::RenderPipelineState* pipelineState)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setRenderPipelineState_), pipelineState);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setRenderPipelineState_), pipelineState);
 }
 
 // method: setVertexBytes:length:atIndex:
 _MTL_INLINE void MTL::RenderCommandEncoder::setVertexBytes(const void* bytes, NS::UInteger length, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setVertexBytes_length_atIndex_), bytes, length, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setVertexBytes_length_atIndex_), bytes, length, index);
 }
 
 // method: setVertexBuffer:offset:atIndex:
 _MTL_INLINE void MTL::RenderCommandEncoder::setVertexBuffer(const MTL::Buffer* buffer, NS::UInteger offset, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setVertexBuffer_offset_atIndex_), buffer, offset, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setVertexBuffer_offset_atIndex_), buffer, offset, index);
 }
 
 // method: setVertexBufferOffset:atIndex:
 _MTL_INLINE void MTL::RenderCommandEncoder::setVertexBufferOffset(NS::UInteger offset, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setVertexBufferOffset_atIndex_), offset, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setVertexBufferOffset_atIndex_), offset, index);
 }
 
 // method: setVertexBuffers:offsets:withRange:
@@ -427,7 +427,7 @@ _MTL_INLINE void MTL::RenderCommandEncoder::setVertexBuffers(const MTL::Buffer*
 // method: setVertexTexture:atIndex:
 _MTL_INLINE void MTL::RenderCommandEncoder::setVertexTexture(const MTL::Texture* texture, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setVertexTexture_atIndex_), texture, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setVertexTexture_atIndex_), texture, index);
 }
 
 // method: setVertexTextures:withRange:
@@ -439,7 +439,7 @@ _MTL_INLINE void MTL::RenderCommandEncoder::setVertexTextures(const MTL::Texture
 // method: setVertexSamplerState:atIndex:
 _MTL_INLINE void MTL::RenderCommandEncoder::setVertexSamplerState(const MTL::SamplerState* sampler, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setVertexSamplerState_atIndex_), sampler, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setVertexSamplerState_atIndex_), sampler, index);
 }
 
 // method: setVertexSamplerStates:withRange:
@@ -451,7 +451,7 @@ _MTL_INLINE void MTL::RenderCommandEncoder::setVertexSamplerStates(const MTL::Sa
 // method: setVertexSamplerState:lodMinClamp:lodMaxClamp:atIndex:
 _MTL_INLINE void MTL::RenderCommandEncoder::setVertexSamplerState(const MTL::SamplerState* sampler, float lodMinClamp, float lodMaxClamp, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setVertexSamplerState_lodMinClamp_lodMaxClamp_atIndex_), sampler, lodMinClamp, lodMaxClamp, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setVertexSamplerState_lodMinClamp_lodMaxClamp_atIndex_), sampler, lodMinClamp, lodMaxClamp, index);
 }
 
 // method: setVertexSamplerStates:lodMinClamps:lodMaxClamps:withRange:
@@ -493,7 +493,7 @@ _MTL_INLINE void MTL::RenderCommandEncoder::setVertexAccelerationStructure(const
 // method: setViewport:
 _MTL_INLINE void MTL::RenderCommandEncoder::setViewport(MTL::Viewport viewport)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setViewport_), viewport);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setViewport_), viewport);
 }
 
 // method: setViewports:count:
@@ -517,7 +517,7 @@ _MTL_INLINE void MTL::RenderCommandEncoder::setVertexAmplificationCount(NS::UInt
 // method: setCullMode:
 _MTL_INLINE void MTL::RenderCommandEncoder::setCullMode(MTL::CullMode cullMode)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setCullMode_), cullMode);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setCullMode_), cullMode);
 }
 
 // method: setDepthClipMode:
@@ -535,7 +535,7 @@ _MTL_INLINE void MTL::RenderCommandEncoder::setDepthBias(float depthBias, float
 // method: setScissorRect:
 _MTL_INLINE void MTL::RenderCommandEncoder::setScissorRect(MTL::ScissorRect rect)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setScissorRect_), rect);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setScissorRect_), rect);
 }
 
 // method: setScissorRects:count:
@@ -553,19 +553,19 @@ _MTL_INLINE void MTL::RenderCommandEncoder::setTriangleFillMode(MTL::TriangleFil
 // method: setFragmentBytes:length:atIndex:
 _MTL_INLINE void MTL::RenderCommandEncoder::setFragmentBytes(const void* bytes, NS::UInteger length, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setFragmentBytes_length_atIndex_), bytes, length, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setFragmentBytes_length_atIndex_), bytes, length, index);
 }
 
 // method: setFragmentBuffer:offset:atIndex:
 _MTL_INLINE void MTL::RenderCommandEncoder::setFragmentBuffer(const MTL::Buffer* buffer, NS::UInteger offset, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setFragmentBuffer_offset_atIndex_), buffer, offset, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setFragmentBuffer_offset_atIndex_), buffer, offset, index);
 }
 
 // method: setFragmentBufferOffset:atIndex:
 _MTL_INLINE void MTL::RenderCommandEncoder::setFragmentBufferOffset(NS::UInteger offset, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setFragmentBufferOffset_atIndex_), offset, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setFragmentBufferOffset_atIndex_), offset, index);
 }
 
 // method: setFragmentBuffers:offsets:withRange:
@@ -577,7 +577,7 @@ _MTL_INLINE void MTL::RenderCommandEncoder::setFragmentBuffers(const MTL::Buffer
 // method: setFragmentTexture:atIndex:
 _MTL_INLINE void MTL::RenderCommandEncoder::setFragmentTexture(const MTL::Texture* texture, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setFragmentTexture_atIndex_), texture, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setFragmentTexture_atIndex_), texture, index);
 }
 
 // method: setFragmentTextures:withRange:
@@ -589,7 +589,7 @@ _MTL_INLINE void MTL::RenderCommandEncoder::setFragmentTextures(const MTL::Textu
 // method: setFragmentSamplerState:atIndex:
 _MTL_INLINE void MTL::RenderCommandEncoder::setFragmentSamplerState(const MTL::SamplerState* sampler, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setFragmentSamplerState_atIndex_), sampler, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setFragmentSamplerState_atIndex_), sampler, index);
 }
 
 // method: setFragmentSamplerStates:withRange:
@@ -601,7 +601,7 @@ _MTL_INLINE void MTL::RenderCommandEncoder::setFragmentSamplerStates(const MTL::
 // method: setFragmentSamplerState:lodMinClamp:lodMaxClamp:atIndex:
 _MTL_INLINE void MTL::RenderCommandEncoder::setFragmentSamplerState(const MTL::SamplerState* sampler, float lodMinClamp, float lodMaxClamp, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setFragmentSamplerState_lodMinClamp_lodMaxClamp_atIndex_), sampler, lodMinClamp, lodMaxClamp, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setFragmentSamplerState_lodMinClamp_lodMaxClamp_atIndex_), sampler, lodMinClamp, lodMaxClamp, index);
 }
 
 // method: setFragmentSamplerStates:lodMinClamps:lodMaxClamps:withRange:
@@ -649,7 +649,7 @@ _MTL_INLINE void MTL::RenderCommandEncoder::setBlendColor(float red, float green
 // method: setDepthStencilState:
 _MTL_INLINE void MTL::RenderCommandEncoder::setDepthStencilState(const MTL::DepthStencilState* depthStencilState)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setDepthStencilState_), depthStencilState);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setDepthStencilState_), depthStencilState);
 }
 
 // method: setStencilReferenceValue:
@@ -853,49 +853,49 @@ _MTL_INLINE void MTL::RenderCommandEncoder::drawMeshThreadgroups(const MTL::Buff
 // method: drawPrimitives:vertexStart:vertexCount:instanceCount:
 _MTL_INLINE void MTL::RenderCommandEncoder::drawPrimitives(MTL::PrimitiveType primitiveType, NS::UInteger vertexStart, NS::UInteger vertexCount, NS::UInteger instanceCount)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(drawPrimitives_vertexStart_vertexCount_instanceCount_), primitiveType, vertexStart, vertexCount, instanceCount);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(drawPrimitives_vertexStart_vertexCount_instanceCount_), primitiveType, vertexStart, vertexCount, instanceCount);
 }
 
 // method: drawPrimitives:vertexStart:vertexCount:
 _MTL_INLINE void MTL::RenderCommandEncoder::drawPrimitives(MTL::PrimitiveType primitiveType, NS::UInteger vertexStart, NS::UInteger vertexCount)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(drawPrimitives_vertexStart_vertexCount_), primitiveType, vertexStart, vertexCount);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(drawPrimitives_vertexStart_vertexCount_), primitiveType, vertexStart, vertexCount);
 }
 
 // method: drawIndexedPrimitives:indexCount:indexType:indexBuffer:indexBufferOffset:instanceCount:
 _MTL_INLINE void MTL::RenderCommandEncoder::drawIndexedPrimitives(MTL::PrimitiveType primitiveType, NS::UInteger indexCount, MTL::IndexType indexType, const MTL::Buffer* indexBuffer, NS::UInteger indexBufferOffset, NS::UInteger instanceCount)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(drawIndexedPrimitives_indexCount_indexType_indexBuffer_indexBufferOffset_instanceCount_), primitiveType, indexCount, indexType, indexBuffer, indexBufferOffset, instanceCount);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(drawIndexedPrimitives_indexCount_indexType_indexBuffer_indexBufferOffset_instanceCount_), primitiveType, indexCount, indexType, indexBuffer, indexBufferOffset, instanceCount);
 }
 
 // method: drawIndexedPrimitives:indexCount:indexType:indexBuffer:indexBufferOffset:
 _MTL_INLINE void MTL::RenderCommandEncoder::drawIndexedPrimitives(MTL::PrimitiveType primitiveType, NS::UInteger indexCount, MTL::IndexType indexType, const MTL::Buffer* indexBuffer, NS::UInteger indexBufferOffset)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(drawIndexedPrimitives_indexCount_indexType_indexBuffer_indexBufferOffset_), primitiveType, indexCount, indexType, indexBuffer, indexBufferOffset);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(drawIndexedPrimitives_indexCount_indexType_indexBuffer_indexBufferOffset_), primitiveType, indexCount, indexType, indexBuffer, indexBufferOffset);
 }
 
 // method: drawPrimitives:vertexStart:vertexCount:instanceCount:baseInstance:
 _MTL_INLINE void MTL::RenderCommandEncoder::drawPrimitives(MTL::PrimitiveType primitiveType, NS::UInteger vertexStart, NS::UInteger vertexCount, NS::UInteger instanceCount, NS::UInteger baseInstance)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(drawPrimitives_vertexStart_vertexCount_instanceCount_baseInstance_), primitiveType, vertexStart, vertexCount, instanceCount, baseInstance);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(drawPrimitives_vertexStart_vertexCount_instanceCount_baseInstance_), primitiveType, vertexStart, vertexCount, instanceCount, baseInstance);
 }
 
 // method: drawIndexedPrimitives:indexCount:indexType:indexBuffer:indexBufferOffset:instanceCount:baseVertex:baseInstance:
 _MTL_INLINE void MTL::RenderCommandEncoder::drawIndexedPrimitives(MTL::PrimitiveType primitiveType, NS::UInteger indexCount, MTL::IndexType indexType, const MTL::Buffer* indexBuffer, NS::UInteger indexBufferOffset, NS::UInteger instanceCount, NS::Integer baseVertex, NS::UInteger baseInstance)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(drawIndexedPrimitives_indexCount_indexType_indexBuffer_indexBufferOffset_instanceCount_baseVertex_baseInstance_), primitiveType, indexCount, indexType, indexBuffer, indexBufferOffset, instanceCount, baseVertex, baseInstance);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(drawIndexedPrimitives_indexCount_indexType_indexBuffer_indexBufferOffset_instanceCount_baseVertex_baseInstance_), primitiveType, indexCount, indexType, indexBuffer, indexBufferOffset, instanceCount, baseVertex, baseInstance);
 }
 
 // method: drawPrimitives:indirectBuffer:indirectBufferOffset:
 _MTL_INLINE void MTL::RenderCommandEncoder::drawPrimitives(MTL::PrimitiveType primitiveType, const MTL::Buffer* indirectBuffer, NS::UInteger indirectBufferOffset)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(drawPrimitives_indirectBuffer_indirectBufferOffset_), primitiveType, indirectBuffer, indirectBufferOffset);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(drawPrimitives_indirectBuffer_indirectBufferOffset_), primitiveType, indirectBuffer, indirectBufferOffset);
 }
 
 // method: drawIndexedPrimitives:indexType:indexBuffer:indexBufferOffset:indirectBuffer:indirectBufferOffset:
 _MTL_INLINE void MTL::RenderCommandEncoder::drawIndexedPrimitives(MTL::PrimitiveType primitiveType, MTL::IndexType indexType, const MTL::Buffer* indexBuffer, NS::UInteger indexBufferOffset, const MTL::Buffer* indirectBuffer, NS::UInteger indirectBufferOffset)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(drawIndexedPrimitives_indexType_indexBuffer_indexBufferOffset_indirectBuffer_indirectBufferOffset_), primitiveType, indexType, indexBuffer, indexBufferOffset, indirectBuffer, indirectBufferOffset);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(drawIndexedPrimitives_indexType_indexBuffer_indexBufferOffset_indirectBuffer_indirectBufferOffset_), primitiveType, indexType, indexBuffer, indexBufferOffset, indirectBuffer, indirectBufferOffset);
 }
 
 // method: textureBarrier
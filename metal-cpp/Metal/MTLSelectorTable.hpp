@@ -0,0 +1,2179 @@
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+//
+// Metal/MTLSelectorTable.hpp
+//
+// Autogenerated by SingleHeader/MakeSelectorTable.py from MTLPrivate.hpp, MTLHeaderBridge.hpp. Do not edit.
+//
+// Copyright 2020-2022 Apple Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+#include <objc/runtime.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace MTL::Private::Selector
+{
+
+enum class Index : std::uint16_t
+{
+    beginScope,
+    endScope,
+    GPUEndTime,
+    GPUStartTime,
+    URL,
+    accelerationStructureCommandEncoder,
+    accelerationStructureCommandEncoderWithDescriptor_,
+    accelerationStructurePassDescriptor,
+    accelerationStructureSizesWithDescriptor_,
+    access,
+    addBarrier,
+    addCompletedHandler_,
+    addComputePipelineFunctionsWithDescriptor_error_,
+    addDebugMarker_range_,
+    addFunctionWithDescriptor_library_error_,
+    addPresentedHandler_,
+    addRenderPipelineFunctionsWithDescriptor_error_,
+    addScheduledHandler_,
+    addTileRenderPipelineFunctionsWithDescriptor_error_,
+    alignment,
+    allocatedSize,
+    allowDuplicateIntersectionFunctionInvocation,
+    allowGPUOptimizedContents,
+    alphaBlendOperation,
+    areBarycentricCoordsSupported,
+    areProgrammableSamplePositionsSupported,
+    areRasterOrderGroupsSupported,
+    argumentBuffersSupport,
+    argumentDescriptor,
+    argumentIndex,
+    argumentIndexStride,
+    arguments,
+    arrayLength,
+    arrayType,
+    attributeIndex,
+    attributeType,
+    attributes,
+    backFaceStencil,
+    binaryArchives,
+    binaryFunctions,
+    bindings,
+    blitCommandEncoder,
+    blitCommandEncoderWithDescriptor_,
+    blitPassDescriptor,
+    borderColor,
+    boundingBoxBuffer,
+    boundingBoxBufferOffset,
+    boundingBoxBuffers,
+    boundingBoxCount,
+    boundingBoxStride,
+    buffer,
+    bufferAlignment,
+    bufferBytesPerRow,
+    bufferDataSize,
+    bufferDataType,
+    bufferIndex,
+    bufferOffset,
+    bufferPointerType,
+    bufferStructType,
+    buffers,
+    buildAccelerationStructure_descriptor_scratchBuffer_scratchBufferOffset_,
+    captureObject,
+    clearBarrier,
+    clearColor,
+    clearDepth,
+    clearStencil,
+    colorAttachments,
+    column,
+    commandBuffer,
+    commandBufferWithDescriptor_,
+    commandBufferWithUnretainedReferences,
+    commandQueue,
+    commandTypes,
+    commit,
+    compareFunction,
+    compressionType,
+    computeCommandEncoder,
+    computeCommandEncoderWithDescriptor_,
+    computeCommandEncoderWithDispatchType_,
+    computeFunction,
+    computePassDescriptor,
+    concurrentDispatchThreadgroups_threadsPerThreadgroup_,
+    concurrentDispatchThreads_threadsPerThreadgroup_,
+    constantBlockAlignment,
+    constantDataAtIndex_,
+    constantValues,
+    contents,
+    controlDependencies,
+    convertSparsePixelRegions_toTileRegions_withTileSize_alignmentMode_numRegions_,
+    convertSparseTileRegions_toPixelRegions_withTileSize_numRegions_,
+    copyAccelerationStructure_toAccelerationStructure_,
+    copyAndCompactAccelerationStructure_toAccelerationStructure_,
+    copyFromBuffer_sourceOffset_sourceBytesPerRow_sourceBytesPerImage_sourceSize_toTexture_destinationSlice_destinationLevel_destinationOrigin_,
+    copyFromBuffer_sourceOffset_sourceBytesPerRow_sourceBytesPerImage_sourceSize_toTexture_destinationSlice_destinationLevel_destinationOrigin_options_,
+    copyFromBuffer_sourceOffset_toBuffer_destinationOffset_size_,
+    copyFromTexture_sourceSlice_sourceLevel_sourceOrigin_sourceSize_toBuffer_destinationOffset_destinationBytesPerRow_destinationBytesPerImage_,
+    copyFromTexture_sourceSlice_sourceLevel_sourceOrigin_sourceSize_toBuffer_destinationOffset_destinationBytesPerRow_destinationBytesPerImage_options_,
+    copyFromTexture_sourceSlice_sourceLevel_sourceOrigin_sourceSize_toTexture_destinationSlice_destinationLevel_destinationOrigin_,
+    copyFromTexture_sourceSlice_sourceLevel_toTexture_destinationSlice_destinationLevel_sliceCount_levelCount_,
+    copyFromTexture_toTexture_,
+    copyIndirectCommandBuffer_sourceRange_destination_destinationIndex_,
+    copyParameterDataToBuffer_offset_,
+    copyStatusToBuffer_offset_,
+    counterSet,
+    counterSets,
+    counters,
+    cpuCacheMode,
+    currentAllocatedSize,
+    data,
+    dataSize,
+    dataType,
+    dealloc,
+    debugLocation,
+    debugSignposts,
+    defaultCaptureScope,
+    defaultRasterSampleCount,
+    depth,
+    depthAttachment,
+    depthAttachmentPixelFormat,
+    depthCompareFunction,
+    depthFailureOperation,
+    depthPlane,
+    depthResolveFilter,
+    depthStencilPassOperation,
+    descriptor,
+    destination,
+    destinationAlphaBlendFactor,
+    destinationRGBBlendFactor,
+    device,
+    didModifyRange_,
+    dispatchQueue,
+    dispatchThreadgroups_threadsPerThreadgroup_,
+    dispatchThreadgroupsWithIndirectBuffer_indirectBufferOffset_threadsPerThreadgroup_,
+    dispatchThreads_threadsPerThreadgroup_,
+    dispatchThreadsPerTile_,
+    dispatchType,
+    drawIndexedPatches_patchIndexBuffer_patchIndexBufferOffset_controlPointIndexBuffer_controlPointIndexBufferOffset_indirectBuffer_indirectBufferOffset_,
+    drawIndexedPatches_patchStart_patchCount_patchIndexBuffer_patchIndexBufferOffset_controlPointIndexBuffer_controlPointIndexBufferOffset_instanceCount_baseInstance_,
+    drawIndexedPatches_patchStart_patchCount_patchIndexBuffer_patchIndexBufferOffset_controlPointIndexBuffer_controlPointIndexBufferOffset_instanceCount_baseInstance_tessellationFactorBuffer_tessellationFactorBufferOffset_tessellationFactorBufferInstanceStride_,
+    drawIndexedPrimitives_indexCount_indexType_indexBuffer_indexBufferOffset_,
+    drawIndexedPrimitives_indexCount_indexType_indexBuffer_indexBufferOffset_instanceCount_,
+    drawIndexedPrimitives_indexCount_indexType_indexBuffer_indexBufferOffset_instanceCount_baseVertex_baseInstance_,
+    drawIndexedPrimitives_indexType_indexBuffer_indexBufferOffset_indirectBuffer_indirectBufferOffset_,
+    drawMeshThreadgroups_threadsPerObjectThreadgroup_threadsPerMeshThreadgroup_,
+    drawMeshThreadgroupsWithIndirectBuffer_indirectBufferOffset_threadsPerObjectThreadgroup_threadsPerMeshThreadgroup_,
+    drawMeshThreads_threadsPerObjectThreadgroup_threadsPerMeshThreadgroup_,
+    drawPatches_patchIndexBuffer_patchIndexBufferOffset_indirectBuffer_indirectBufferOffset_,
+    drawPatches_patchStart_patchCount_patchIndexBuffer_patchIndexBufferOffset_instanceCount_baseInstance_,
+    drawPatches_patchStart_patchCount_patchIndexBuffer_patchIndexBufferOffset_instanceCount_baseInstance_tessellationFactorBuffer_tessellationFactorBufferOffset_tessellationFactorBufferInstanceStride_,
+    drawPrimitives_indirectBuffer_indirectBufferOffset_,
+    drawPrimitives_vertexStart_vertexCount_,
+    drawPrimitives_vertexStart_vertexCount_instanceCount_,
+    drawPrimitives_vertexStart_vertexCount_instanceCount_baseInstance_,
+    drawableID,
+    elementArrayType,
+    elementIsArgumentBuffer,
+    elementPointerType,
+    elementStructType,
+    elementTextureReferenceType,
+    elementType,
+    encodeSignalEvent_value_,
+    encodeWaitForEvent_value_,
+    encodedLength,
+    encoderLabel,
+    endEncoding,
+    endOfEncoderSampleIndex,
+    endOfFragmentSampleIndex,
+    endOfVertexSampleIndex,
+    enqueue,
+    enqueueBarrier,
+    error,
+    errorOptions,
+    errorState,
+    executeCommandsInBuffer_indirectBuffer_indirectBufferOffset_,
+    executeCommandsInBuffer_withRange_,
+    fastMathEnabled,
+    fillBuffer_range_value_,
+    firstMipmapInTail,
+    format,
+    fragmentAdditionalBinaryFunctions,
+    fragmentArguments,
+    fragmentBindings,
+    fragmentBuffers,
+    fragmentFunction,
+    fragmentLinkedFunctions,
+    fragmentPreloadedLibraries,
+    frontFaceStencil,
+    function,
+    functionConstantsDictionary,
+    functionCount,
+    functionDescriptor,
+    functionGraphs,
+    functionHandleWithFunction_,
+    functionHandleWithFunction_stage_,
+    functionName,
+    functionNames,
+    functionType,
+    functions,
+    generateMipmapsForTexture_,
+    geometryDescriptors,
+    getBytes_bytesPerRow_bytesPerImage_fromRegion_mipmapLevel_slice_,
+    getBytes_bytesPerRow_fromRegion_mipmapLevel_,
+    getDefaultSamplePositions_count_,
+    getSamplePositions_count_,
+    getTextureAccessCounters_region_mipLevel_slice_resetCounters_countersBuffer_countersBufferOffset_,
+    gpuAddress,
+    gpuResourceID,
+    groups,
+    hasUnifiedMemory,
+    hazardTrackingMode,
+    heap,
+    heapAccelerationStructureSizeAndAlignWithDescriptor_,
+    heapAccelerationStructureSizeAndAlignWithSize_,
+    heapBufferSizeAndAlignWithLength_options_,
+    heapOffset,
+    heapTextureSizeAndAlignWithDescriptor_,
+    height,
+    horizontal,
+    horizontalSampleStorage,
+    imageblockMemoryLengthForDimensions_,
+    imageblockSampleLength,
+    index,
+    indexBuffer,
+    indexBufferIndex,
+    indexBufferOffset,
+    indexType,
+    indirectComputeCommandAtIndex_,
+    indirectRenderCommandAtIndex_,
+    inheritBuffers,
+    inheritPipelineState,
+    init,
+    initWithArgumentIndex_,
+    initWithDispatchQueue_,
+    initWithFunctionName_nodes_outputNode_attributes_,
+    initWithName_arguments_controlDependencies_,
+    initWithSampleCount_,
+    initWithSampleCount_horizontal_vertical_,
+    inputPrimitiveTopology,
+    insertDebugCaptureBoundary,
+    insertDebugSignpost_,
+    insertLibraries,
+    installName,
+    instanceCount,
+    instanceDescriptorBuffer,
+    instanceDescriptorBufferOffset,
+    instanceDescriptorStride,
+    instanceDescriptorType,
+    instancedAccelerationStructures,
+    intersectionFunctionTableDescriptor,
+    intersectionFunctionTableOffset,
+    iosurface,
+    iosurfacePlane,
+    isActive,
+    isAliasable,
+    isAlphaToCoverageEnabled,
+    isAlphaToOneEnabled,
+    isArgument,
+    isBlendingEnabled,
+    isCapturing,
+    isDepth24Stencil8PixelFormatSupported,
+    isDepthTexture,
+    isDepthWriteEnabled,
+    isFramebufferOnly,
+    isHeadless,
+    isLowPower,
+    isPatchControlPointData,
+    isPatchData,
+    isRasterizationEnabled,
+    isRemovable,
+    isShareable,
+    isSparse,
+    isTessellationFactorScaleEnabled,
+    isUsed,
+    kernelEndTime,
+    kernelStartTime,
+    label,
+    languageVersion,
+    layerAtIndex_,
+    layerCount,
+    layers,
+    layouts,
+    length,
+    level,
+    libraries,
+    libraryType,
+    line,
+    linkedFunctions,
+    loadAction,
+    loadBuffer_offset_size_sourceHandle_sourceHandleOffset_,
+    loadBytes_size_sourceHandle_sourceHandleOffset_,
+    loadTexture_slice_level_size_sourceBytesPerRow_sourceBytesPerImage_destinationOrigin_sourceHandle_sourceHandleOffset_,
+    location,
+    locationNumber,
+    lodAverage,
+    lodMaxClamp,
+    lodMinClamp,
+    logs,
+    magFilter,
+    makeAliasable,
+    mapPhysicalToScreenCoordinates_forLayer_,
+    mapScreenToPhysicalCoordinates_forLayer_,
+    maxAnisotropy,
+    maxArgumentBufferSamplerCount,
+    maxAvailableSizeWithAlignment_,
+    maxBufferLength,
+    maxCallStackDepth,
+    maxCommandBufferCount,
+    maxCommandsInFlight,
+    maxFragmentBufferBindCount,
+    maxFragmentCallStackDepth,
+    maxKernelBufferBindCount,
+    maxSampleCount,
+    maxTessellationFactor,
+    maxThreadgroupMemoryLength,
+    maxThreadsPerThreadgroup,
+    maxTotalThreadgroupsPerMeshGrid,
+    maxTotalThreadsPerMeshThreadgroup,
+    maxTotalThreadsPerObjectThreadgroup,
+    maxTotalThreadsPerThreadgroup,
+    maxTransferRate,
+    maxVertexAmplificationCount,
+    maxVertexBufferBindCount,
+    maxVertexCallStackDepth,
+    memberByName_,
+    members,
+    memoryBarrierWithResources_count_,
+    memoryBarrierWithResources_count_afterStages_beforeStages_,
+    memoryBarrierWithScope_,
+    memoryBarrierWithScope_afterStages_beforeStages_,
+    meshBindings,
+    meshBuffers,
+    meshFunction,
+    meshThreadExecutionWidth,
+    meshThreadgroupSizeIsMultipleOfThreadExecutionWidth,
+    minFilter,
+    minimumLinearTextureAlignmentForPixelFormat_,
+    minimumTextureBufferAlignmentForPixelFormat_,
+    mipFilter,
+    mipmapLevelCount,
+    motionEndBorderMode,
+    motionEndTime,
+    motionKeyframeCount,
+    motionStartBorderMode,
+    motionStartTime,
+    motionTransformBuffer,
+    motionTransformBufferOffset,
+    motionTransformCount,
+    moveTextureMappingsFromTexture_sourceSlice_sourceLevel_sourceOrigin_sourceSize_toTexture_destinationSlice_destinationLevel_destinationOrigin_,
+    mutability,
+    name,
+    newAccelerationStructureWithDescriptor_,
+    newAccelerationStructureWithDescriptor_offset_,
+    newAccelerationStructureWithSize_,
+    newAccelerationStructureWithSize_offset_,
+    newArgumentEncoderForBufferAtIndex_,
+    newArgumentEncoderWithArguments_,
+    newArgumentEncoderWithBufferBinding_,
+    newArgumentEncoderWithBufferIndex_,
+    newArgumentEncoderWithBufferIndex_reflection_,
+    newBinaryArchiveWithDescriptor_error_,
+    newBufferWithBytes_length_options_,
+    newBufferWithBytesNoCopy_length_options_deallocator_,
+    newBufferWithLength_options_,
+    newBufferWithLength_options_offset_,
+    newCaptureScopeWithCommandQueue_,
+    newCaptureScopeWithDevice_,
+    newCommandQueue,
+    newCommandQueueWithMaxCommandBufferCount_,
+    newComputePipelineStateWithAdditionalBinaryFunctions_error_,
+    newComputePipelineStateWithDescriptor_options_completionHandler_,
+    newComputePipelineStateWithDescriptor_options_reflection_error_,
+    newComputePipelineStateWithFunction_completionHandler_,
+    newComputePipelineStateWithFunction_error_,
+    newComputePipelineStateWithFunction_options_completionHandler_,
+    newComputePipelineStateWithFunction_options_reflection_error_,
+    newCounterSampleBufferWithDescriptor_error_,
+    newDefaultLibrary,
+    newDefaultLibraryWithBundle_error_,
+    newDepthStencilStateWithDescriptor_,
+    newDynamicLibrary_error_,
+    newDynamicLibraryWithURL_error_,
+    newEvent,
+    newFence,
+    newFunctionWithDescriptor_completionHandler_,
+    newFunctionWithDescriptor_error_,
+    newFunctionWithName_,
+    newFunctionWithName_constantValues_completionHandler_,
+    newFunctionWithName_constantValues_error_,
+    newHeapWithDescriptor_,
+    newIOCommandQueueWithDescriptor_error_,
+    newIOHandleWithURL_compressionMethod_error_,
+    newIOHandleWithURL_error_,
+    newIndirectCommandBufferWithDescriptor_maxCommandCount_options_,
+    newIntersectionFunctionTableWithDescriptor_,
+    newIntersectionFunctionTableWithDescriptor_stage_,
+    newIntersectionFunctionWithDescriptor_completionHandler_,
+    newIntersectionFunctionWithDescriptor_error_,
+    newLibraryWithData_error_,
+    newLibraryWithFile_error_,
+    newLibraryWithSource_options_completionHandler_,
+    newLibraryWithSource_options_error_,
+    newLibraryWithStitchedDescriptor_completionHandler_,
+    newLibraryWithStitchedDescriptor_error_,
+    newLibraryWithURL_error_,
+    newRasterizationRateMapWithDescriptor_,
+    newRemoteBufferViewForDevice_,
+    newRemoteTextureViewForDevice_,
+    newRenderPipelineStateWithAdditionalBinaryFunctions_error_,
+    newRenderPipelineStateWithDescriptor_completionHandler_,
+    newRenderPipelineStateWithDescriptor_error_,
+    newRenderPipelineStateWithDescriptor_options_completionHandler_,
+    newRenderPipelineStateWithDescriptor_options_reflection_error_,
+    newRenderPipelineStateWithMeshDescriptor_options_completionHandler_,
+    newRenderPipelineStateWithMeshDescriptor_options_reflection_error_,
+    newRenderPipelineStateWithTileDescriptor_options_completionHandler_,
+    newRenderPipelineStateWithTileDescriptor_options_reflection_error_,
+    newSamplerStateWithDescriptor_,
+    newScratchBufferWithMinimumSize_,
+    newSharedEvent,
+    newSharedEventHandle,
+    newSharedEventWithHandle_,
+    newSharedTextureHandle,
+    newSharedTextureWithDescriptor_,
+    newSharedTextureWithHandle_,
+    newTextureViewWithPixelFormat_,
+    newTextureViewWithPixelFormat_textureType_levels_slices_,
+    newTextureViewWithPixelFormat_textureType_levels_slices_swizzle_,
+    newTextureWithDescriptor_,
+    newTextureWithDescriptor_iosurface_plane_,
+    newTextureWithDescriptor_offset_,
+    newTextureWithDescriptor_offset_bytesPerRow_,
+    newVisibleFunctionTableWithDescriptor_,
+    newVisibleFunctionTableWithDescriptor_stage_,
+    nodes,
+    normalizedCoordinates,
+    notifyListener_atValue_block_,
+    objectAtIndexedSubscript_,
+    objectBindings,
+    objectBuffers,
+    objectFunction,
+    objectPayloadAlignment,
+    objectPayloadDataSize,
+    objectThreadExecutionWidth,
+    objectThreadgroupSizeIsMultipleOfThreadExecutionWidth,
+    offset,
+    opaque,
+    optimizationLevel,
+    optimizeContentsForCPUAccess_,
+    optimizeContentsForCPUAccess_slice_level_,
+    optimizeContentsForGPUAccess_,
+    optimizeContentsForGPUAccess_slice_level_,
+    optimizeIndirectCommandBuffer_withRange_,
+    options,
+    outputNode,
+    outputURL,
+    parallelRenderCommandEncoderWithDescriptor_,
+    parameterBufferSizeAndAlign,
+    parentRelativeLevel,
+    parentRelativeSlice,
+    parentTexture,
+    patchControlPointCount,
+    patchType,
+    payloadMemoryLength,
+    peerCount,
+    peerGroupID,
+    peerIndex,
+    physicalGranularity,
+    physicalSizeForLayer_,
+    pixelFormat,
+    pointerType,
+    popDebugGroup,
+    preloadedLibraries,
+    preprocessorMacros,
+    present,
+    presentAfterMinimumDuration_,
+    presentAtTime_,
+    presentDrawable_,
+    presentDrawable_afterMinimumDuration_,
+    presentDrawable_atTime_,
+    presentedTime,
+    preserveInvariance,
+    primitiveDataBuffer,
+    primitiveDataBufferOffset,
+    primitiveDataElementSize,
+    primitiveDataStride,
+    priority,
+    privateFunctions,
+    pushDebugGroup_,
+    rAddressMode,
+    rasterSampleCount,
+    rasterizationRateMap,
+    rasterizationRateMapDescriptorWithScreenSize_,
+    rasterizationRateMapDescriptorWithScreenSize_layer_,
+    rasterizationRateMapDescriptorWithScreenSize_layerCount_layers_,
+    readMask,
+    readWriteTextureSupport,
+    recommendedMaxWorkingSetSize,
+    refitAccelerationStructure_descriptor_destination_scratchBuffer_scratchBufferOffset_,
+    refitAccelerationStructure_descriptor_destination_scratchBuffer_scratchBufferOffset_options_,
+    registryID,
+    remoteStorageBuffer,
+    remoteStorageTexture,
+    removeAllDebugMarkers,
+    renderCommandEncoder,
+    renderCommandEncoderWithDescriptor_,
+    renderPassDescriptor,
+    renderTargetArrayLength,
+    renderTargetHeight,
+    renderTargetWidth,
+    replaceRegion_mipmapLevel_slice_withBytes_bytesPerRow_bytesPerImage_,
+    replaceRegion_mipmapLevel_withBytes_bytesPerRow_,
+    required,
+    reset,
+    resetCommandsInBuffer_withRange_,
+    resetTextureAccessCounters_region_mipLevel_slice_,
+    resetWithRange_,
+    resolveCounterRange_,
+    resolveCounters_inRange_destinationBuffer_destinationOffset_,
+    resolveDepthPlane,
+    resolveLevel,
+    resolveSlice,
+    resolveTexture,
+    resourceOptions,
+    resourceStateCommandEncoder,
+    resourceStateCommandEncoderWithDescriptor_,
+    resourceStatePassDescriptor,
+    retainedReferences,
+    rgbBlendOperation,
+    rootResource,
+    sAddressMode,
+    sampleBuffer,
+    sampleBufferAttachments,
+    sampleCount,
+    sampleCountersInBuffer_atSampleIndex_withBarrier_,
+    sampleTimestamps_gpuTimestamp_,
+    scratchBufferAllocator,
+    screenSize,
+    serializeToURL_error_,
+    setAccelerationStructure_atBufferIndex_,
+    setAccelerationStructure_atIndex_,
+    setAccess_,
+    setAllowDuplicateIntersectionFunctionInvocation_,
+    setAllowGPUOptimizedContents_,
+    setAlphaBlendOperation_,
+    setAlphaToCoverageEnabled_,
+    setAlphaToOneEnabled_,
+    setArgumentBuffer_offset_,
+    setArgumentBuffer_startOffset_arrayElement_,
+    setArgumentIndex_,
+    setArguments_,
+    setArrayLength_,
+    setAttributes_,
+    setBackFaceStencil_,
+    setBarrier,
+    setBinaryArchives_,
+    setBinaryFunctions_,
+    setBlendColorRed_green_blue_alpha_,
+    setBlendingEnabled_,
+    setBorderColor_,
+    setBoundingBoxBuffer_,
+    setBoundingBoxBufferOffset_,
+    setBoundingBoxBuffers_,
+    setBoundingBoxCount_,
+    setBoundingBoxStride_,
+    setBuffer_,
+    setBuffer_offset_atIndex_,
+    setBufferIndex_,
+    setBufferOffset_atIndex_,
+    setBuffers_offsets_withRange_,
+    setBytes_length_atIndex_,
+    setCaptureObject_,
+    setClearColor_,
+    setClearDepth_,
+    setClearStencil_,
+    setColorStoreAction_atIndex_,
+    setColorStoreActionOptions_atIndex_,
+    setCommandTypes_,
+    setCompareFunction_,
+    setCompressionType_,
+    setComputeFunction_,
+    setComputePipelineState_,
+    setComputePipelineState_atIndex_,
+    setComputePipelineStates_withRange_,
+    setConstantBlockAlignment_,
+    setConstantValue_type_atIndex_,
+    setConstantValue_type_withName_,
+    setConstantValues_,
+    setConstantValues_type_withRange_,
+    setControlDependencies_,
+    setCounterSet_,
+    setCpuCacheMode_,
+    setCullMode_,
+    setDataType_,
+    setDefaultCaptureScope_,
+    setDefaultRasterSampleCount_,
+    setDepth_,
+    setDepthAttachment_,
+    setDepthAttachmentPixelFormat_,
+    setDepthBias_slopeScale_clamp_,
+    setDepthClipMode_,
+    setDepthCompareFunction_,
+    setDepthFailureOperation_,
+    setDepthPlane_,
+    setDepthResolveFilter_,
+    setDepthStencilPassOperation_,
+    setDepthStencilState_,
+    setDepthStoreAction_,
+    setDepthStoreActionOptions_,
+    setDepthWriteEnabled_,
+    setDestination_,
+    setDestinationAlphaBlendFactor_,
+    setDestinationRGBBlendFactor_,
+    setDispatchType_,
+    setEndOfEncoderSampleIndex_,
+    setEndOfFragmentSampleIndex_,
+    setEndOfVertexSampleIndex_,
+    setErrorOptions_,
+    setFastMathEnabled_,
+    setFormat_,
+    setFragmentAccelerationStructure_atBufferIndex_,
+    setFragmentAdditionalBinaryFunctions_,
+    setFragmentBuffer_offset_atIndex_,
+    setFragmentBufferOffset_atIndex_,
+    setFragmentBuffers_offsets_withRange_,
+    setFragmentBytes_length_atIndex_,
+    setFragmentFunction_,
+    setFragmentIntersectionFunctionTable_atBufferIndex_,
+    setFragmentIntersectionFunctionTables_withBufferRange_,
+    setFragmentLinkedFunctions_,
+    setFragmentPreloadedLibraries_,
+    setFragmentSamplerState_atIndex_,
+    setFragmentSamplerState_lodMinClamp_lodMaxClamp_atIndex_,
+    setFragmentSamplerStates_lodMinClamps_lodMaxClamps_withRange_,
+    setFragmentSamplerStates_withRange_,
+    setFragmentTexture_atIndex_,
+    setFragmentTextures_withRange_,
+    setFragmentVisibleFunctionTable_atBufferIndex_,
+    setFragmentVisibleFunctionTables_withBufferRange_,
+    setFrontFaceStencil_,
+    setFrontFacingWinding_,
+    setFunction_atIndex_,
+    setFunctionCount_,
+    setFunctionGraphs_,
+    setFunctionName_,
+    setFunctions_,
+    setFunctions_withRange_,
+    setGeometryDescriptors_,
+    setGroups_,
+    setHazardTrackingMode_,
+    setHeight_,
+    setImageblockSampleLength_,
+    setImageblockWidth_height_,
+    setIndex_,
+    setIndexBuffer_,
+    setIndexBufferIndex_,
+    setIndexBufferOffset_,
+    setIndexType_,
+    setIndirectCommandBuffer_atIndex_,
+    setIndirectCommandBuffers_withRange_,
+    setInheritBuffers_,
+    setInheritPipelineState_,
+    setInputPrimitiveTopology_,
+    setInsertLibraries_,
+    setInstallName_,
+    setInstanceCount_,
+    setInstanceDescriptorBuffer_,
+    setInstanceDescriptorBufferOffset_,
+    setInstanceDescriptorStride_,
+    setInstanceDescriptorType_,
+    setInstancedAccelerationStructures_,
+    setIntersectionFunctionTable_atBufferIndex_,
+    setIntersectionFunctionTable_atIndex_,
+    setIntersectionFunctionTableOffset_,
+    setIntersectionFunctionTables_withBufferRange_,
+    setIntersectionFunctionTables_withRange_,
+    setKernelBuffer_offset_atIndex_,
+    setLabel_,
+    setLanguageVersion_,
+    setLayer_atIndex_,
+    setLevel_,
+    setLibraries_,
+    setLibraryType_,
+    setLinkedFunctions_,
+    setLoadAction_,
+    setLodAverage_,
+    setLodMaxClamp_,
+    setLodMinClamp_,
+    setMagFilter_,
+    setMaxAnisotropy_,
+    setMaxCallStackDepth_,
+    setMaxCommandBufferCount_,
+    setMaxCommandsInFlight_,
+    setMaxFragmentBufferBindCount_,
+    setMaxFragmentCallStackDepth_,
+    setMaxKernelBufferBindCount_,
+    setMaxTessellationFactor_,
+    setMaxTotalThreadgroupsPerMeshGrid_,
+    setMaxTotalThreadsPerMeshThreadgroup_,
+    setMaxTotalThreadsPerObjectThreadgroup_,
+    setMaxTotalThreadsPerThreadgroup_,
+    setMaxVertexAmplificationCount_,
+    setMaxVertexBufferBindCount_,
+    setMaxVertexCallStackDepth_,
+    setMeshBuffer_offset_atIndex_,
+    setMeshBufferOffset_atIndex_,
+    setMeshBuffers_offsets_withRange_,
+    setMeshBytes_length_atIndex_,
+    setMeshFunction_,
+    setMeshSamplerState_atIndex_,
+    setMeshSamplerState_lodMinClamp_lodMaxClamp_atIndex_,
+    setMeshSamplerStates_lodMinClamps_lodMaxClamps_withRange_,
+    setMeshSamplerStates_withRange_,
+    setMeshTexture_atIndex_,
+    setMeshTextures_withRange_,
+    setMeshThreadgroupSizeIsMultipleOfThreadExecutionWidth_,
+    setMinFilter_,
+    setMipFilter_,
+    setMipmapLevelCount_,
+    setMotionEndBorderMode_,
+    setMotionEndTime_,
+    setMotionKeyframeCount_,
+    setMotionStartBorderMode_,
+    setMotionStartTime_,
+    setMotionTransformBuffer_,
+    setMotionTransformBufferOffset_,
+    setMotionTransformCount_,
+    setMutability_,
+    setName_,
+    setNodes_,
+    setNormalizedCoordinates_,
+    setObject_atIndexedSubscript_,
+    setObjectBuffer_offset_atIndex_,
+    setObjectBufferOffset_atIndex_,
+    setObjectBuffers_offsets_withRange_,
+    setObjectBytes_length_atIndex_,
+    setObjectFunction_,
+    setObjectSamplerState_atIndex_,
+    setObjectSamplerState_lodMinClamp_lodMaxClamp_atIndex_,
+    setObjectSamplerStates_lodMinClamps_lodMaxClamps_withRange_,
+    setObjectSamplerStates_withRange_,
+    setObjectTexture_atIndex_,
+    setObjectTextures_withRange_,
+    setObjectThreadgroupMemoryLength_atIndex_,
+    setObjectThreadgroupSizeIsMultipleOfThreadExecutionWidth_,
+    setOffset_,
+    setOpaque_,
+    setOpaqueTriangleIntersectionFunctionWithSignature_atIndex_,
+    setOpaqueTriangleIntersectionFunctionWithSignature_withRange_,
+    setOptimizationLevel_,
+    setOptions_,
+    setOutputNode_,
+    setOutputURL_,
+    setPayloadMemoryLength_,
+    setPixelFormat_,
+    setPreloadedLibraries_,
+    setPreprocessorMacros_,
+    setPreserveInvariance_,
+    setPrimitiveDataBuffer_,
+    setPrimitiveDataBufferOffset_,
+    setPrimitiveDataElementSize_,
+    setPrimitiveDataStride_,
+    setPriority_,
+    setPrivateFunctions_,
+    setPurgeableState_,
+    setRAddressMode_,
+    setRasterSampleCount_,
+    setRasterizationEnabled_,
+    setRasterizationRateMap_,
+    setReadMask_,
+    setRenderPipelineState_,
+    setRenderPipelineState_atIndex_,
+    setRenderPipelineStates_withRange_,
+    setRenderTargetArrayLength_,
+    setRenderTargetHeight_,
+    setRenderTargetWidth_,
+    setResolveDepthPlane_,
+    setResolveLevel_,
+    setResolveSlice_,
+    setResolveTexture_,
+    setResourceOptions_,
+    setRetainedReferences_,
+    setRgbBlendOperation_,
+    setSAddressMode_,
+    setSampleBuffer_,
+    setSampleCount_,
+    setSamplePositions_count_,
+    setSamplerState_atIndex_,
+    setSamplerState_lodMinClamp_lodMaxClamp_atIndex_,
+    setSamplerStates_lodMinClamps_lodMaxClamps_withRange_,
+    setSamplerStates_withRange_,
+    setScissorRect_,
+    setScissorRects_count_,
+    setScratchBufferAllocator_,
+    setScreenSize_,
+    setSignaledValue_,
+    setSize_,
+    setSlice_,
+    setSourceAlphaBlendFactor_,
+    setSourceRGBBlendFactor_,
+    setSparsePageSize_,
+    setSpecializedName_,
+    setStageInRegion_,
+    setStageInRegionWithIndirectBuffer_indirectBufferOffset_,
+    setStageInputDescriptor_,
+    setStartOfEncoderSampleIndex_,
+    setStartOfFragmentSampleIndex_,
+    setStartOfVertexSampleIndex_,
+    setStencilAttachment_,
+    setStencilAttachmentPixelFormat_,
+    setStencilCompareFunction_,
+    setStencilFailureOperation_,
+    setStencilFrontReferenceValue_backReferenceValue_,
+    setStencilReferenceValue_,
+    setStencilResolveFilter_,
+    setStencilStoreAction_,
+    setStencilStoreActionOptions_,
+    setStepFunction_,
+    setStepRate_,
+    setStorageMode_,
+    setStoreAction_,
+    setStoreActionOptions_,
+    setStride_,
+    setSupportAddingBinaryFunctions_,
+    setSupportAddingFragmentBinaryFunctions_,
+    setSupportAddingVertexBinaryFunctions_,
+    setSupportArgumentBuffers_,
+    setSupportIndirectCommandBuffers_,
+    setSupportRayTracing_,
+    setSwizzle_,
+    setTAddressMode_,
+    setTessellationControlPointIndexType_,
+    setTessellationFactorBuffer_offset_instanceStride_,
+    setTessellationFactorFormat_,
+    setTessellationFactorScale_,
+    setTessellationFactorScaleEnabled_,
+    setTessellationFactorStepFunction_,
+    setTessellationOutputWindingOrder_,
+    setTessellationPartitionMode_,
+    setTexture_,
+    setTexture_atIndex_,
+    setTextureType_,
+    setTextures_withRange_,
+    setThreadGroupSizeIsMultipleOfThreadExecutionWidth_,
+    setThreadgroupMemoryLength_,
+    setThreadgroupMemoryLength_atIndex_,
+    setThreadgroupMemoryLength_offset_atIndex_,
+    setThreadgroupSizeMatchesTileSize_,
+    setTileAccelerationStructure_atBufferIndex_,
+    setTileAdditionalBinaryFunctions_,
+    setTileBuffer_offset_atIndex_,
+    setTileBufferOffset_atIndex_,
+    setTileBuffers_offsets_withRange_,
+    setTileBytes_length_atIndex_,
+    setTileFunction_,
+    setTileHeight_,
+    setTileIntersectionFunctionTable_atBufferIndex_,
+    setTileIntersectionFunctionTables_withBufferRange_,
+    setTileSamplerState_atIndex_,
+    setTileSamplerState_lodMinClamp_lodMaxClamp_atIndex_,
+    setTileSamplerStates_lodMinClamps_lodMaxClamps_withRange_,
+    setTileSamplerStates_withRange_,
+    setTileTexture_atIndex_,
+    setTileTextures_withRange_,
+    setTileVisibleFunctionTable_atBufferIndex_,
+    setTileVisibleFunctionTables_withBufferRange_,
+    setTileWidth_,
+    setTransformationMatrixBuffer_,
+    setTransformationMatrixBufferOffset_,
+    setTriangleCount_,
+    setTriangleFillMode_,
+    setType_,
+    setUrl_,
+    setUsage_,
+    setVertexAccelerationStructure_atBufferIndex_,
+    setVertexAdditionalBinaryFunctions_,
+    setVertexAmplificationCount_viewMappings_,
+    setVertexBuffer_,
+    setVertexBuffer_offset_atIndex_,
+    setVertexBufferOffset_,
+    setVertexBufferOffset_atIndex_,
+    setVertexBuffers_,
+    setVertexBuffers_offsets_withRange_,
+    setVertexBytes_length_atIndex_,
+    setVertexDescriptor_,
+    setVertexFormat_,
+    setVertexFunction_,
+    setVertexIntersectionFunctionTable_atBufferIndex_,
+    setVertexIntersectionFunctionTables_withBufferRange_,
+    setVertexLinkedFunctions_,
+    setVertexPreloadedLibraries_,
+    setVertexSamplerState_atIndex_,
+    setVertexSamplerState_lodMinClamp_lodMaxClamp_atIndex_,
+    setVertexSamplerStates_lodMinClamps_lodMaxClamps_withRange_,
+    setVertexSamplerStates_withRange_,
+    setVertexStride_,
+    setVertexTexture_atIndex_,
+    setVertexTextures_withRange_,
+    setVertexVisibleFunctionTable_atBufferIndex_,
+    setVertexVisibleFunctionTables_withBufferRange_,
+    setViewport_,
+    setViewports_count_,
+    setVisibilityResultBuffer_,
+    setVisibilityResultMode_offset_,
+    setVisibleFunctionTable_atBufferIndex_,
+    setVisibleFunctionTable_atIndex_,
+    setVisibleFunctionTables_withBufferRange_,
+    setVisibleFunctionTables_withRange_,
+    setWidth_,
+    setWriteMask_,
+    sharedCaptureManager,
+    signalEvent_value_,
+    signaledValue,
+    size,
+    slice,
+    sourceAlphaBlendFactor,
+    sourceRGBBlendFactor,
+    sparsePageSize,
+    sparseTileSizeInBytes,
+    sparseTileSizeInBytesForSparsePageSize_,
+    sparseTileSizeWithTextureType_pixelFormat_sampleCount_,
+    sparseTileSizeWithTextureType_pixelFormat_sampleCount_sparsePageSize_,
+    specializedName,
+    stageInputAttributes,
+    stageInputDescriptor,
+    stageInputOutputDescriptor,
+    startCaptureWithCommandQueue_,
+    startCaptureWithDescriptor_error_,
+    startCaptureWithDevice_,
+    startCaptureWithScope_,
+    startOfEncoderSampleIndex,
+    startOfFragmentSampleIndex,
+    startOfVertexSampleIndex,
+    staticThreadgroupMemoryLength,
+    status,
+    stencilAttachment,
+    stencilAttachmentPixelFormat,
+    stencilCompareFunction,
+    stencilFailureOperation,
+    stencilResolveFilter,
+    stepFunction,
+    stepRate,
+    stopCapture,
+    storageMode,
+    storeAction,
+    storeActionOptions,
+    stride,
+    structType,
+    supportAddingBinaryFunctions,
+    supportAddingFragmentBinaryFunctions,
+    supportAddingVertexBinaryFunctions,
+    supportArgumentBuffers,
+    supportIndirectCommandBuffers,
+    supportRayTracing,
+    supports32BitFloatFiltering,
+    supports32BitMSAA,
+    supportsBCTextureCompression,
+    supportsCounterSampling_,
+    supportsDestination_,
+    supportsDynamicLibraries,
+    supportsFamily_,
+    supportsFeatureSet_,
+    supportsFunctionPointers,
+    supportsFunctionPointersFromRender,
+    supportsPrimitiveMotionBlur,
+    supportsPullModelInterpolation,
+    supportsQueryTextureLOD,
+    supportsRasterizationRateMapWithLayerCount_,
+    supportsRaytracing,
+    supportsRaytracingFromRender,
+    supportsRenderDynamicLibraries,
+    supportsShaderBarycentricCoordinates,
+    supportsTextureSampleCount_,
+    supportsVertexAmplificationCount_,
+    swizzle,
+    synchronizeResource_,
+    synchronizeTexture_slice_level_,
+    tAddressMode,
+    tailSizeInBytes,
+    tessellationControlPointIndexType,
+    tessellationFactorFormat,
+    tessellationFactorStepFunction,
+    tessellationOutputWindingOrder,
+    tessellationPartitionMode,
+    texture,
+    texture2DDescriptorWithPixelFormat_width_height_mipmapped_,
+    textureBarrier,
+    textureBufferDescriptorWithPixelFormat_width_resourceOptions_usage_,
+    textureCubeDescriptorWithPixelFormat_size_mipmapped_,
+    textureDataType,
+    textureReferenceType,
+    textureType,
+    threadExecutionWidth,
+    threadGroupSizeIsMultipleOfThreadExecutionWidth,
+    threadgroupMemoryAlignment,
+    threadgroupMemoryDataSize,
+    threadgroupMemoryLength,
+    threadgroupSizeMatchesTileSize,
+    tileAdditionalBinaryFunctions,
+    tileArguments,
+    tileBindings,
+    tileBuffers,
+    tileFunction,
+    tileHeight,
+    tileWidth,
+    transformationMatrixBuffer,
+    transformationMatrixBufferOffset,
+    triangleCount,
+    tryCancel,
+    type,
+    updateFence_,
+    updateFence_afterStages_,
+    updateTextureMapping_mode_indirectBuffer_indirectBufferOffset_,
+    updateTextureMapping_mode_region_mipLevel_slice_,
+    updateTextureMappings_mode_regions_mipLevels_slices_numRegions_,
+    url,
+    usage,
+    useHeap_,
+    useHeap_stages_,
+    useHeaps_count_,
+    useHeaps_count_stages_,
+    useResource_usage_,
+    useResource_usage_stages_,
+    useResources_count_usage_,
+    useResources_count_usage_stages_,
+    usedSize,
+    vertexAdditionalBinaryFunctions,
+    vertexArguments,
+    vertexAttributes,
+    vertexBindings,
+    vertexBuffer,
+    vertexBufferOffset,
+    vertexBuffers,
+    vertexDescriptor,
+    vertexFormat,
+    vertexFunction,
+    vertexLinkedFunctions,
+    vertexPreloadedLibraries,
+    vertexStride,
+    vertical,
+    verticalSampleStorage,
+    visibilityResultBuffer,
+    visibleFunctionTableDescriptor,
+    waitForEvent_value_,
+    waitForFence_,
+    waitForFence_beforeStages_,
+    waitUntilCompleted,
+    waitUntilScheduled,
+    width,
+    writeCompactedAccelerationStructureSize_toBuffer_offset_,
+    writeCompactedAccelerationStructureSize_toBuffer_offset_sizeDataType_,
+    writeMask,
+    Count
+};
+
+extern SEL s_kTable[];
+
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+#if defined(MTL_PRIVATE_IMPLEMENTATION)
+
+namespace MTL::Private::Selector
+{
+
+alignas(64) SEL s_kTable[static_cast<std::size_t>(Index::Count)] _MTL_PRIVATE_VISIBILITY;
+
+static const char s_kTableNames[] =
+    "beginScope\0"
+    "endScope\0"
+    "GPUEndTime\0"
+    "GPUStartTime\0"
+    "URL\0"
+    "accelerationStructureCommandEncoder\0"
+    "accelerationStructureCommandEncoderWithDescriptor:\0"
+    "accelerationStructurePassDescriptor\0"
+    "accelerationStructureSizesWithDescriptor:\0"
+    "access\0"
+    "addBarrier\0"
+    "addCompletedHandler:\0"
+    "addComputePipelineFunctionsWithDescriptor:error:\0"
+    "addDebugMarker:range:\0"
+    "addFunctionWithDescriptor:library:error:\0"
+    "addPresentedHandler:\0"
+    "addRenderPipelineFunctionsWithDescriptor:error:\0"
+    "addScheduledHandler:\0"
+    "addTileRenderPipelineFunctionsWithDescriptor:error:\0"
+    "alignment\0"
+    "allocatedSize\0"
+    "allowDuplicateIntersectionFunctionInvocation\0"
+    "allowGPUOptimizedContents\0"
+    "alphaBlendOperation\0"
+    "areBarycentricCoordsSupported\0"
+    "areProgrammableSamplePositionsSupported\0"
+    "areRasterOrderGroupsSupported\0"
+    "argumentBuffersSupport\0"
+    "argumentDescriptor\0"
+    "argumentIndex\0"
+    "argumentIndexStride\0"
+    "arguments\0"
+    "arrayLength\0"
+    "arrayType\0"
+    "attributeIndex\0"
+    "attributeType\0"
+    "attributes\0"
+    "backFaceStencil\0"
+    "binaryArchives\0"
+    "binaryFunctions\0"
+    "bindings\0"
+    "blitCommandEncoder\0"
+    "blitCommandEncoderWithDescriptor:\0"
+    "blitPassDescriptor\0"
+    "borderColor\0"
+    "boundingBoxBuffer\0"
+    "boundingBoxBufferOffset\0"
+    "boundingBoxBuffers\0"
+    "boundingBoxCount\0"
+    "boundingBoxStride\0"
+    "buffer\0"
+    "bufferAlignment\0"
+    "bufferBytesPerRow\0"
+    "bufferDataSize\0"
+    "bufferDataType\0"
+    "bufferIndex\0"
+    "bufferOffset\0"
+    "bufferPointerType\0"
+    "bufferStructType\0"
+    "buffers\0"
+    "buildAccelerationStructure:descriptor:scratchBuffer:scratchBufferOffset:\0"
+    "captureObject\0"
+    "clearBarrier\0"
+    "clearColor\0"
+    "clearDepth\0"
+    "clearStencil\0"
+    "colorAttachments\0"
+    "column\0"
+    "commandBuffer\0"
+    "commandBufferWithDescriptor:\0"
+    "commandBufferWithUnretainedReferences\0"
+    "commandQueue\0"
+    "commandTypes\0"
+    "commit\0"
+    "compareFunction\0"
+    "compressionType\0"
+    "computeCommandEncoder\0"
+    "computeCommandEncoderWithDescriptor:\0"
+    "computeCommandEncoderWithDispatchType:\0"
+    "computeFunction\0"
+    "computePassDescriptor\0"
+    "concurrentDispatchThreadgroups:threadsPerThreadgroup:\0"
+    "concurrentDispatchThreads:threadsPerThreadgroup:\0"
+    "constantBlockAlignment\0"
+    "constantDataAtIndex:\0"
+    "constantValues\0"
+    "contents\0"
+    "controlDependencies\0"
+    "convertSparsePixelRegions:toTileRegions:withTileSize:alignmentMode:numRegions:\0"
+    "convertSparseTileRegions:toPixelRegions:withTileSize:numRegions:\0"
+    "copyAccelerationStructure:toAccelerationStructure:\0"
+    "copyAndCompactAccelerationStructure:toAccelerationStructure:\0"
+    "copyFromBuffer:sourceOffset:sourceBytesPerRow:sourceBytesPerImage:sourceSize:toTexture:destinationSlice:destinationLevel:destinationOrigin:\0"
+    "copyFromBuffer:sourceOffset:sourceBytesPerRow:sourceBytesPerImage:sourceSize:toTexture:destinationSlice:destinationLevel:destinationOrigin:options:\0"
+    "copyFromBuffer:sourceOffset:toBuffer:destinationOffset:size:\0"
+    "copyFromTexture:sourceSlice:sourceLevel:sourceOrigin:sourceSize:toBuffer:destinationOffset:destinationBytesPerRow:destinationBytesPerImage:\0"
+    "copyFromTexture:sourceSlice:sourceLevel:sourceOrigin:sourceSize:toBuffer:destinationOffset:destinationBytesPerRow:destinationBytesPerImage:options:\0"
+    "copyFromTexture:sourceSlice:sourceLevel:sourceOrigin:sourceSize:toTexture:destinationSlice:destinationLevel:destinationOrigin:\0"
+    "copyFromTexture:sourceSlice:sourceLevel:toTexture:destinationSlice:destinationLevel:sliceCount:levelCount:\0"
+    "copyFromTexture:toTexture:\0"
+    "copyIndirectCommandBuffer:sourceRange:destination:destinationIndex:\0"
+    "copyParameterDataToBuffer:offset:\0"
+    "copyStatusToBuffer:offset:\0"
+    "counterSet\0"
+    "counterSets\0"
+    "counters\0"
+    "cpuCacheMode\0"
+    "currentAllocatedSize\0"
+    "data\0"
+    "dataSize\0"
+    "dataType\0"
+    "dealloc\0"
+    "debugLocation\0"
+    "debugSignposts\0"
+    "defaultCaptureScope\0"
+    "defaultRasterSampleCount\0"
+    "depth\0"
+    "depthAttachment\0"
+    "depthAttachmentPixelFormat\0"
+    "depthCompareFunction\0"
+    "depthFailureOperation\0"
+    "depthPlane\0"
+    "depthResolveFilter\0"
+    "depthStencilPassOperation\0"
+    "descriptor\0"
+    "destination\0"
+    "destinationAlphaBlendFactor\0"
+    "destinationRGBBlendFactor\0"
+    "device\0"
+    "didModifyRange:\0"
+    "dispatchQueue\0"
+    "dispatchThreadgroups:threadsPerThreadgroup:\0"
+    "dispatchThreadgroupsWithIndirectBuffer:indirectBufferOffset:threadsPerThreadgroup:\0"
+    "dispatchThreads:threadsPerThreadgroup:\0"
+    "dispatchThreadsPerTile:\0"
+    "dispatchType\0"
+    "drawIndexedPatches:patchIndexBuffer:patchIndexBufferOffset:controlPointIndexBuffer:controlPointIndexBufferOffset:indirectBuffer:indirectBufferOffset:\0"
+    "drawIndexedPatches:patchStart:patchCount:patchIndexBuffer:patchIndexBufferOffset:controlPointIndexBuffer:controlPointIndexBufferOffset:instanceCount:baseInstance:\0"
+    "drawIndexedPatches:patchStart:patchCount:patchIndexBuffer:patchIndexBufferOffset:controlPointIndexBuffer:controlPointIndexBufferOffset:instanceCount:baseInstance:tessellationFactorBuffer:tessellationFactorBufferOffset:tessellationFactorBufferInstanceStride:\0"
+    "drawIndexedPrimitives:indexCount:indexType:indexBuffer:indexBufferOffset:\0"
+    "drawIndexedPrimitives:indexCount:indexType:indexBuffer:indexBufferOffset:instanceCount:\0"
+    "drawIndexedPrimitives:indexCount:indexType:indexBuffer:indexBufferOffset:instanceCount:baseVertex:baseInstance:\0"
+    "drawIndexedPrimitives:indexType:indexBuffer:indexBufferOffset:indirectBuffer:indirectBufferOffset:\0"
+    "drawMeshThreadgroups:threadsPerObjectThreadgroup:threadsPerMeshThreadgroup:\0"
+    "drawMeshThreadgroupsWithIndirectBuffer:indirectBufferOffset:threadsPerObjectThreadgroup:threadsPerMeshThreadgroup:\0"
+    "drawMeshThreads:threadsPerObjectThreadgroup:threadsPerMeshThreadgroup:\0"
+    "drawPatches:patchIndexBuffer:patchIndexBufferOffset:indirectBuffer:indirectBufferOffset:\0"
+    "drawPatches:patchStart:patchCount:patchIndexBuffer:patchIndexBufferOffset:instanceCount:baseInstance:\0"
+    "drawPatches:patchStart:patchCount:patchIndexBuffer:patchIndexBufferOffset:instanceCount:baseInstance:tessellationFactorBuffer:tessellationFactorBufferOffset:tessellationFactorBufferInstanceStride:\0"
+    "drawPrimitives:indirectBuffer:indirectBufferOffset:\0"
+    "drawPrimitives:vertexStart:vertexCount:\0"
+    "drawPrimitives:vertexStart:vertexCount:instanceCount:\0"
+    "drawPrimitives:vertexStart:vertexCount:instanceCount:baseInstance:\0"
+    "drawableID\0"
+    "elementArrayType\0"
+    "elementIsArgumentBuffer\0"
+    "elementPointerType\0"
+    "elementStructType\0"
+    "elementTextureReferenceType\0"
+    "elementType\0"
+    "encodeSignalEvent:value:\0"
+    "encodeWaitForEvent:value:\0"
+    "encodedLength\0"
+    "encoderLabel\0"
+    "endEncoding\0"
+    "endOfEncoderSampleIndex\0"
+    "endOfFragmentSampleIndex\0"
+    "endOfVertexSampleIndex\0"
+    "enqueue\0"
+    "enqueueBarrier\0"
+    "error\0"
+    "errorOptions\0"
+    "errorState\0"
+    "executeCommandsInBuffer:indirectBuffer:indirectBufferOffset:\0"
+    "executeCommandsInBuffer:withRange:\0"
+    "fastMathEnabled\0"
+    "fillBuffer:range:value:\0"
+    "firstMipmapInTail\0"
+    "format\0"
+    "fragmentAdditionalBinaryFunctions\0"
+    "fragmentArguments\0"
+    "fragmentBindings\0"
+    "fragmentBuffers\0"
+    "fragmentFunction\0"
+    "fragmentLinkedFunctions\0"
+    "fragmentPreloadedLibraries\0"
+    "frontFaceStencil\0"
+    "function\0"
+    "functionConstantsDictionary\0"
+    "functionCount\0"
+    "functionDescriptor\0"
+    "functionGraphs\0"
+    "functionHandleWithFunction:\0"
+    "functionHandleWithFunction:stage:\0"
+    "functionName\0"
+    "functionNames\0"
+    "functionType\0"
+    "functions\0"
+    "generateMipmapsForTexture:\0"
+    "geometryDescriptors\0"
+    "getBytes:bytesPerRow:bytesPerImage:fromRegion:mipmapLevel:slice:\0"
+    "getBytes:bytesPerRow:fromRegion:mipmapLevel:\0"
+    "getDefaultSamplePositions:count:\0"
+    "getSamplePositions:count:\0"
+    "getTextureAccessCounters:region:mipLevel:slice:resetCounters:countersBuffer:countersBufferOffset:\0"
+    "gpuAddress\0"
+    "gpuResourceID\0"
+    "groups\0"
+    "hasUnifiedMemory\0"
+    "hazardTrackingMode\0"
+    "heap\0"
+    "heapAccelerationStructureSizeAndAlignWithDescriptor:\0"
+    "heapAccelerationStructureSizeAndAlignWithSize:\0"
+    "heapBufferSizeAndAlignWithLength:options:\0"
+    "heapOffset\0"
+    "heapTextureSizeAndAlignWithDescriptor:\0"
+    "height\0"
+    "horizontal\0"
+    "horizontalSampleStorage\0"
+    "imageblockMemoryLengthForDimensions:\0"
+    "imageblockSampleLength\0"
+    "index\0"
+    "indexBuffer\0"
+    "indexBufferIndex\0"
+    "indexBufferOffset\0"
+    "indexType\0"
+    "indirectComputeCommandAtIndex:\0"
+    "indirectRenderCommandAtIndex:\0"
+    "inheritBuffers\0"
+    "inheritPipelineState\0"
+    "init\0"
+    "initWithArgumentIndex:\0"
+    "initWithDispatchQueue:\0"
+    "initWithFunctionName:nodes:outputNode:attributes:\0"
+    "initWithName:arguments:controlDependencies:\0"
+    "initWithSampleCount:\0"
+    "initWithSampleCount:horizontal:vertical:\0"
+    "inputPrimitiveTopology\0"
+    "insertDebugCaptureBoundary\0"
+    "insertDebugSignpost:\0"
+    "insertLibraries\0"
+    "installName\0"
+    "instanceCount\0"
+    "instanceDescriptorBuffer\0"
+    "instanceDescriptorBufferOffset\0"
+    "instanceDescriptorStride\0"
+    "instanceDescriptorType\0"
+    "instancedAccelerationStructures\0"
+    "intersectionFunctionTableDescriptor\0"
+    "intersectionFunctionTableOffset\0"
+    "iosurface\0"
+    "iosurfacePlane\0"
+    "isActive\0"
+    "isAliasable\0"
+    "isAlphaToCoverageEnabled\0"
+    "isAlphaToOneEnabled\0"
+    "isArgument\0"
+    "isBlendingEnabled\0"
+    "isCapturing\0"
+    "isDepth24Stencil8PixelFormatSupported\0"
+    "isDepthTexture\0"
+    "isDepthWriteEnabled\0"
+    "isFramebufferOnly\0"
+    "isHeadless\0"
+    "isLowPower\0"
+    "isPatchControlPointData\0"
+    "isPatchData\0"
+    "isRasterizationEnabled\0"
+    "isRemovable\0"
+    "isShareable\0"
+    "isSparse\0"
+    "isTessellationFactorScaleEnabled\0"
+    "isUsed\0"
+    "kernelEndTime\0"
+    "kernelStartTime\0"
+    "label\0"
+    "languageVersion\0"
+    "layerAtIndex:\0"
+    "layerCount\0"
+    "layers\0"
+    "layouts\0"
+    "length\0"
+    "level\0"
+    "libraries\0"
+    "libraryType\0"
+    "line\0"
+    "linkedFunctions\0"
+    "loadAction\0"
+    "loadBuffer:offset:size:sourceHandle:sourceHandleOffset:\0"
+    "loadBytes:size:sourceHandle:sourceHandleOffset:\0"
+    "loadTexture:slice:level:size:sourceBytesPerRow:sourceBytesPerImage:destinationOrigin:sourceHandle:sourceHandleOffset:\0"
+    "location\0"
+    "locationNumber\0"
+    "lodAverage\0"
+    "lodMaxClamp\0"
+    "lodMinClamp\0"
+    "logs\0"
+    "magFilter\0"
+    "makeAliasable\0"
+    "mapPhysicalToScreenCoordinates:forLayer:\0"
+    "mapScreenToPhysicalCoordinates:forLayer:\0"
+    "maxAnisotropy\0"
+    "maxArgumentBufferSamplerCount\0"
+    "maxAvailableSizeWithAlignment:\0"
+    "maxBufferLength\0"
+    "maxCallStackDepth\0"
+    "maxCommandBufferCount\0"
+    "maxCommandsInFlight\0"
+    "maxFragmentBufferBindCount\0"
+    "maxFragmentCallStackDepth\0"
+    "maxKernelBufferBindCount\0"
+    "maxSampleCount\0"
+    "maxTessellationFactor\0"
+    "maxThreadgroupMemoryLength\0"
+    "maxThreadsPerThreadgroup\0"
+    "maxTotalThreadgroupsPerMeshGrid\0"
+    "maxTotalThreadsPerMeshThreadgroup\0"
+    "maxTotalThreadsPerObjectThreadgroup\0"
+    "maxTotalThreadsPerThreadgroup\0"
+    "maxTransferRate\0"
+    "maxVertexAmplificationCount\0"
+    "maxVertexBufferBindCount\0"
+    "maxVertexCallStackDepth\0"
+    "memberByName:\0"
+    "members\0"
+    "memoryBarrierWithResources:count:\0"
+    "memoryBarrierWithResources:count:afterStages:beforeStages:\0"
+    "memoryBarrierWithScope:\0"
+    "memoryBarrierWithScope:afterStages:beforeStages:\0"
+    "meshBindings\0"
+    "meshBuffers\0"
+    "meshFunction\0"
+    "meshThreadExecutionWidth\0"
+    "meshThreadgroupSizeIsMultipleOfThreadExecutionWidth\0"
+    "minFilter\0"
+    "minimumLinearTextureAlignmentForPixelFormat:\0"
+    "minimumTextureBufferAlignmentForPixelFormat:\0"
+    "mipFilter\0"
+    "mipmapLevelCount\0"
+    "motionEndBorderMode\0"
+    "motionEndTime\0"
+    "motionKeyframeCount\0"
+    "motionStartBorderMode\0"
+    "motionStartTime\0"
+    "motionTransformBuffer\0"
+    "motionTransformBufferOffset\0"
+    "motionTransformCount\0"
+    "moveTextureMappingsFromTexture:sourceSlice:sourceLevel:sourceOrigin:sourceSize:toTexture:destinationSlice:destinationLevel:destinationOrigin:\0"
+    "mutability\0"
+    "name\0"
+    "newAccelerationStructureWithDescriptor:\0"
+    "newAccelerationStructureWithDescriptor:offset:\0"
+    "newAccelerationStructureWithSize:\0"
+    "newAccelerationStructureWithSize:offset:\0"
+    "newArgumentEncoderForBufferAtIndex:\0"
+    "newArgumentEncoderWithArguments:\0"
+    "newArgumentEncoderWithBufferBinding:\0"
+    "newArgumentEncoderWithBufferIndex:\0"
+    "newArgumentEncoderWithBufferIndex:reflection:\0"
+    "newBinaryArchiveWithDescriptor:error:\0"
+    "newBufferWithBytes:length:options:\0"
+    "newBufferWithBytesNoCopy:length:options:deallocator:\0"
+    "newBufferWithLength:options:\0"
+    "newBufferWithLength:options:offset:\0"
+    "newCaptureScopeWithCommandQueue:\0"
+    "newCaptureScopeWithDevice:\0"
+    "newCommandQueue\0"
+    "newCommandQueueWithMaxCommandBufferCount:\0"
+    "newComputePipelineStateWithAdditionalBinaryFunctions:error:\0"
+    "newComputePipelineStateWithDescriptor:options:completionHandler:\0"
+    "newComputePipelineStateWithDescriptor:options:reflection:error:\0"
+    "newComputePipelineStateWithFunction:completionHandler:\0"
+    "newComputePipelineStateWithFunction:error:\0"
+    "newComputePipelineStateWithFunction:options:completionHandler:\0"
+    "newComputePipelineStateWithFunction:options:reflection:error:\0"
+    "newCounterSampleBufferWithDescriptor:error:\0"
+    "newDefaultLibrary\0"
+    "newDefaultLibraryWithBundle:error:\0"
+    "newDepthStencilStateWithDescriptor:\0"
+    "newDynamicLibrary:error:\0"
+    "newDynamicLibraryWithURL:error:\0"
+    "newEvent\0"
+    "newFence\0"
+    "newFunctionWithDescriptor:completionHandler:\0"
+    "newFunctionWithDescriptor:error:\0"
+    "newFunctionWithName:\0"
+    "newFunctionWithName:constantValues:completionHandler:\0"
+    "newFunctionWithName:constantValues:error:\0"
+    "newHeapWithDescriptor:\0"
+    "newIOCommandQueueWithDescriptor:error:\0"
+    "newIOHandleWithURL:compressionMethod:error:\0"
+    "newIOHandleWithURL:error:\0"
+    "newIndirectCommandBufferWithDescriptor:maxCommandCount:options:\0"
+    "newIntersectionFunctionTableWithDescriptor:\0"
+    "newIntersectionFunctionTableWithDescriptor:stage:\0"
+    "newIntersectionFunctionWithDescriptor:completionHandler:\0"
+    "newIntersectionFunctionWithDescriptor:error:\0"
+    "newLibraryWithData:error:\0"
+    "newLibraryWithFile:error:\0"
+    "newLibraryWithSource:options:completionHandler:\0"
+    "newLibraryWithSource:options:error:\0"
+    "newLibraryWithStitchedDescriptor:completionHandler:\0"
+    "newLibraryWithStitchedDescriptor:error:\0"
+    "newLibraryWithURL:error:\0"
+    "newRasterizationRateMapWithDescriptor:\0"
+    "newRemoteBufferViewForDevice:\0"
+    "newRemoteTextureViewForDevice:\0"
+    "newRenderPipelineStateWithAdditionalBinaryFunctions:error:\0"
+    "newRenderPipelineStateWithDescriptor:completionHandler:\0"
+    "newRenderPipelineStateWithDescriptor:error:\0"
+    "newRenderPipelineStateWithDescriptor:options:completionHandler:\0"
+    "newRenderPipelineStateWithDescriptor:options:reflection:error:\0"
+    "newRenderPipelineStateWithMeshDescriptor:options:completionHandler:\0"
+    "newRenderPipelineStateWithMeshDescriptor:options:reflection:error:\0"
+    "newRenderPipelineStateWithTileDescriptor:options:completionHandler:\0"
+    "newRenderPipelineStateWithTileDescriptor:options:reflection:error:\0"
+    "newSamplerStateWithDescriptor:\0"
+    "newScratchBufferWithMinimumSize:\0"
+    "newSharedEvent\0"
+    "newSharedEventHandle\0"
+    "newSharedEventWithHandle:\0"
+    "newSharedTextureHandle\0"
+    "newSharedTextureWithDescriptor:\0"
+    "newSharedTextureWithHandle:\0"
+    "newTextureViewWithPixelFormat:\0"
+    "newTextureViewWithPixelFormat:textureType:levels:slices:\0"
+    "newTextureViewWithPixelFormat:textureType:levels:slices:swizzle:\0"
+    "newTextureWithDescriptor:\0"
+    "newTextureWithDescriptor:iosurface:plane:\0"
+    "newTextureWithDescriptor:offset:\0"
+    "newTextureWithDescriptor:offset:bytesPerRow:\0"
+    "newVisibleFunctionTableWithDescriptor:\0"
+    "newVisibleFunctionTableWithDescriptor:stage:\0"
+    "nodes\0"
+    "normalizedCoordinates\0"
+    "notifyListener:atValue:block:\0"
+    "objectAtIndexedSubscript:\0"
+    "objectBindings\0"
+    "objectBuffers\0"
+    "objectFunction\0"
+    "objectPayloadAlignment\0"
+    "objectPayloadDataSize\0"
+    "objectThreadExecutionWidth\0"
+    "objectThreadgroupSizeIsMultipleOfThreadExecutionWidth\0"
+    "offset\0"
+    "opaque\0"
+    "optimizationLevel\0"
+    "optimizeContentsForCPUAccess:\0"
+    "optimizeContentsForCPUAccess:slice:level:\0"
+    "optimizeContentsForGPUAccess:\0"
+    "optimizeContentsForGPUAccess:slice:level:\0"
+    "optimizeIndirectCommandBuffer:withRange:\0"
+    "options\0"
+    "outputNode\0"
+    "outputURL\0"
+    "parallelRenderCommandEncoderWithDescriptor:\0"
+    "parameterBufferSizeAndAlign\0"
+    "parentRelativeLevel\0"
+    "parentRelativeSlice\0"
+    "parentTexture\0"
+    "patchControlPointCount\0"
+    "patchType\0"
+    "payloadMemoryLength\0"
+    "peerCount\0"
+    "peerGroupID\0"
+    "peerIndex\0"
+    "physicalGranularity\0"
+    "physicalSizeForLayer:\0"
+    "pixelFormat\0"
+    "pointerType\0"
+    "popDebugGroup\0"
+    "preloadedLibraries\0"
+    "preprocessorMacros\0"
+    "present\0"
+    "presentAfterMinimumDuration:\0"
+    "presentAtTime:\0"
+    "presentDrawable:\0"
+    "presentDrawable:afterMinimumDuration:\0"
+    "presentDrawable:atTime:\0"
+    "presentedTime\0"
+    "preserveInvariance\0"
+    "primitiveDataBuffer\0"
+    "primitiveDataBufferOffset\0"
+    "primitiveDataElementSize\0"
+    "primitiveDataStride\0"
+    "priority\0"
+    "privateFunctions\0"
+    "pushDebugGroup:\0"
+    "rAddressMode\0"
+    "rasterSampleCount\0"
+    "rasterizationRateMap\0"
+    "rasterizationRateMapDescriptorWithScreenSize:\0"
+    "rasterizationRateMapDescriptorWithScreenSize:layer:\0"
+    "rasterizationRateMapDescriptorWithScreenSize:layerCount:layers:\0"
+    "readMask\0"
+    "readWriteTextureSupport\0"
+    "recommendedMaxWorkingSetSize\0"
+    "refitAccelerationStructure:descriptor:destination:scratchBuffer:scratchBufferOffset:\0"
+    "refitAccelerationStructure:descriptor:destination:scratchBuffer:scratchBufferOffset:options:\0"
+    "registryID\0"
+    "remoteStorageBuffer\0"
+    "remoteStorageTexture\0"
+    "removeAllDebugMarkers\0"
+    "renderCommandEncoder\0"
+    "renderCommandEncoderWithDescriptor:\0"
+    "renderPassDescriptor\0"
+    "renderTargetArrayLength\0"
+    "renderTargetHeight\0"
+    "renderTargetWidth\0"
+    "replaceRegion:mipmapLevel:slice:withBytes:bytesPerRow:bytesPerImage:\0"
+    "replaceRegion:mipmapLevel:withBytes:bytesPerRow:\0"
+    "required\0"
+    "reset\0"
+    "resetCommandsInBuffer:withRange:\0"
+    "resetTextureAccessCounters:region:mipLevel:slice:\0"
+    "resetWithRange:\0"
+    "resolveCounterRange:\0"
+    "resolveCounters:inRange:destinationBuffer:destinationOffset:\0"
+    "resolveDepthPlane\0"
+    "resolveLevel\0"
+    "resolveSlice\0"
+    "resolveTexture\0"
+    "resourceOptions\0"
+    "resourceStateCommandEncoder\0"
+    "resourceStateCommandEncoderWithDescriptor:\0"
+    "resourceStatePassDescriptor\0"
+    "retainedReferences\0"
+    "rgbBlendOperation\0"
+    "rootResource\0"
+    "sAddressMode\0"
+    "sampleBuffer\0"
+    "sampleBufferAttachments\0"
+    "sampleCount\0"
+    "sampleCountersInBuffer:atSampleIndex:withBarrier:\0"
+    "sampleTimestamps:gpuTimestamp:\0"
+    "scratchBufferAllocator\0"
+    "screenSize\0"
+    "serializeToURL:error:\0"
+    "setAccelerationStructure:atBufferIndex:\0"
+    "setAccelerationStructure:atIndex:\0"
+    "setAccess:\0"
+    "setAllowDuplicateIntersectionFunctionInvocation:\0"
+    "setAllowGPUOptimizedContents:\0"
+    "setAlphaBlendOperation:\0"
+    "setAlphaToCoverageEnabled:\0"
+    "setAlphaToOneEnabled:\0"
+    "setArgumentBuffer:offset:\0"
+    "setArgumentBuffer:startOffset:arrayElement:\0"
+    "setArgumentIndex:\0"
+    "setArguments:\0"
+    "setArrayLength:\0"
+    "setAttributes:\0"
+    "setBackFaceStencil:\0"
+    "setBarrier\0"
+    "setBinaryArchives:\0"
+    "setBinaryFunctions:\0"
+    "setBlendColorRed:green:blue:alpha:\0"
+    "setBlendingEnabled:\0"
+    "setBorderColor:\0"
+    "setBoundingBoxBuffer:\0"
+    "setBoundingBoxBufferOffset:\0"
+    "setBoundingBoxBuffers:\0"
+    "setBoundingBoxCount:\0"
+    "setBoundingBoxStride:\0"
+    "setBuffer:\0"
+    "setBuffer:offset:atIndex:\0"
+    "setBufferIndex:\0"
+    "setBufferOffset:atIndex:\0"
+    "setBuffers:offsets:withRange:\0"
+    "setBytes:length:atIndex:\0"
+    "setCaptureObject:\0"
+    "setClearColor:\0"
+    "setClearDepth:\0"
+    "setClearStencil:\0"
+    "setColorStoreAction:atIndex:\0"
+    "setColorStoreActionOptions:atIndex:\0"
+    "setCommandTypes:\0"
+    "setCompareFunction:\0"
+    "setCompressionType:\0"
+    "setComputeFunction:\0"
+    "setComputePipelineState:\0"
+    "setComputePipelineState:atIndex:\0"
+    "setComputePipelineStates:withRange:\0"
+    "setConstantBlockAlignment:\0"
+    "setConstantValue:type:atIndex:\0"
+    "setConstantValue:type:withName:\0"
+    "setConstantValues:\0"
+    "setConstantValues:type:withRange:\0"
+    "setControlDependencies:\0"
+    "setCounterSet:\0"
+    "setCpuCacheMode:\0"
+    "setCullMode:\0"
+    "setDataType:\0"
+    "setDefaultCaptureScope:\0"
+    "setDefaultRasterSampleCount:\0"
+    "setDepth:\0"
+    "setDepthAttachment:\0"
+    "setDepthAttachmentPixelFormat:\0"
+    "setDepthBias:slopeScale:clamp:\0"
+    "setDepthClipMode:\0"
+    "setDepthCompareFunction:\0"
+    "setDepthFailureOperation:\0"
+    "setDepthPlane:\0"
+    "setDepthResolveFilter:\0"
+    "setDepthStencilPassOperation:\0"
+    "setDepthStencilState:\0"
+    "setDepthStoreAction:\0"
+    "setDepthStoreActionOptions:\0"
+    "setDepthWriteEnabled:\0"
+    "setDestination:\0"
+    "setDestinationAlphaBlendFactor:\0"
+    "setDestinationRGBBlendFactor:\0"
+    "setDispatchType:\0"
+    "setEndOfEncoderSampleIndex:\0"
+    "setEndOfFragmentSampleIndex:\0"
+    "setEndOfVertexSampleIndex:\0"
+    "setErrorOptions:\0"
+    "setFastMathEnabled:\0"
+    "setFormat:\0"
+    "setFragmentAccelerationStructure:atBufferIndex:\0"
+    "setFragmentAdditionalBinaryFunctions:\0"
+    "setFragmentBuffer:offset:atIndex:\0"
+    "setFragmentBufferOffset:atIndex:\0"
+    "setFragmentBuffers:offsets:withRange:\0"
+    "setFragmentBytes:length:atIndex:\0"
+    "setFragmentFunction:\0"
+    "setFragmentIntersectionFunctionTable:atBufferIndex:\0"
+    "setFragmentIntersectionFunctionTables:withBufferRange:\0"
+    "setFragmentLinkedFunctions:\0"
+    "setFragmentPreloadedLibraries:\0"
+    "setFragmentSamplerState:atIndex:\0"
+    "setFragmentSamplerState:lodMinClamp:lodMaxClamp:atIndex:\0"
+    "setFragmentSamplerStates:lodMinClamps:lodMaxClamps:withRange:\0"
+    "setFragmentSamplerStates:withRange:\0"
+    "setFragmentTexture:atIndex:\0"
+    "setFragmentTextures:withRange:\0"
+    "setFragmentVisibleFunctionTable:atBufferIndex:\0"
+    "setFragmentVisibleFunctionTables:withBufferRange:\0"
+    "setFrontFaceStencil:\0"
+    "setFrontFacingWinding:\0"
+    "setFunction:atIndex:\0"
+    "setFunctionCount:\0"
+    "setFunctionGraphs:\0"
+    "setFunctionName:\0"
+    "setFunctions:\0"
+    "setFunctions:withRange:\0"
+    "setGeometryDescriptors:\0"
+    "setGroups:\0"
+    "setHazardTrackingMode:\0"
+    "setHeight:\0"
+    "setImageblockSampleLength:\0"
+    "setImageblockWidth:height:\0"
+    "setIndex:\0"
+    "setIndexBuffer:\0"
+    "setIndexBufferIndex:\0"
+    "setIndexBufferOffset:\0"
+    "setIndexType:\0"
+    "setIndirectCommandBuffer:atIndex:\0"
+    "setIndirectCommandBuffers:withRange:\0"
+    "setInheritBuffers:\0"
+    "setInheritPipelineState:\0"
+    "setInputPrimitiveTopology:\0"
+    "setInsertLibraries:\0"
+    "setInstallName:\0"
+    "setInstanceCount:\0"
+    "setInstanceDescriptorBuffer:\0"
+    "setInstanceDescriptorBufferOffset:\0"
+    "setInstanceDescriptorStride:\0"
+    "setInstanceDescriptorType:\0"
+    "setInstancedAccelerationStructures:\0"
+    "setIntersectionFunctionTable:atBufferIndex:\0"
+    "setIntersectionFunctionTable:atIndex:\0"
+    "setIntersectionFunctionTableOffset:\0"
+    "setIntersectionFunctionTables:withBufferRange:\0"
+    "setIntersectionFunctionTables:withRange:\0"
+    "setKernelBuffer:offset:atIndex:\0"
+    "setLabel:\0"
+    "setLanguageVersion:\0"
+    "setLayer:atIndex:\0"
+    "setLevel:\0"
+    "setLibraries:\0"
+    "setLibraryType:\0"
+    "setLinkedFunctions:\0"
+    "setLoadAction:\0"
+    "setLodAverage:\0"
+    "setLodMaxClamp:\0"
+    "setLodMinClamp:\0"
+    "setMagFilter:\0"
+    "setMaxAnisotropy:\0"
+    "setMaxCallStackDepth:\0"
+    "setMaxCommandBufferCount:\0"
+    "setMaxCommandsInFlight:\0"
+    "setMaxFragmentBufferBindCount:\0"
+    "setMaxFragmentCallStackDepth:\0"
+    "setMaxKernelBufferBindCount:\0"
+    "setMaxTessellationFactor:\0"
+    "setMaxTotalThreadgroupsPerMeshGrid:\0"
+    "setMaxTotalThreadsPerMeshThreadgroup:\0"
+    "setMaxTotalThreadsPerObjectThreadgroup:\0"
+    "setMaxTotalThreadsPerThreadgroup:\0"
+    "setMaxVertexAmplificationCount:\0"
+    "setMaxVertexBufferBindCount:\0"
+    "setMaxVertexCallStackDepth:\0"
+    "setMeshBuffer:offset:atIndex:\0"
+    "setMeshBufferOffset:atIndex:\0"
+    "setMeshBuffers:offsets:withRange:\0"
+    "setMeshBytes:length:atIndex:\0"
+    "setMeshFunction:\0"
+    "setMeshSamplerState:atIndex:\0"
+    "setMeshSamplerState:lodMinClamp:lodMaxClamp:atIndex:\0"
+    "setMeshSamplerStates:lodMinClamps:lodMaxClamps:withRange:\0"
+    "setMeshSamplerStates:withRange:\0"
+    "setMeshTexture:atIndex:\0"
+    "setMeshTextures:withRange:\0"
+    "setMeshThreadgroupSizeIsMultipleOfThreadExecutionWidth:\0"
+    "setMinFilter:\0"
+    "setMipFilter:\0"
+    "setMipmapLevelCount:\0"
+    "setMotionEndBorderMode:\0"
+    "setMotionEndTime:\0"
+    "setMotionKeyframeCount:\0"
+    "setMotionStartBorderMode:\0"
+    "setMotionStartTime:\0"
+    "setMotionTransformBuffer:\0"
+    "setMotionTransformBufferOffset:\0"
+    "setMotionTransformCount:\0"
+    "setMutability:\0"
+    "setName:\0"
+    "setNodes:\0"
+    "setNormalizedCoordinates:\0"
+    "setObject:atIndexedSubscript:\0"
+    "setObjectBuffer:offset:atIndex:\0"
+    "setObjectBufferOffset:atIndex:\0"
+    "setObjectBuffers:offsets:withRange:\0"
+    "setObjectBytes:length:atIndex:\0"
+    "setObjectFunction:\0"
+    "setObjectSamplerState:atIndex:\0"
+    "setObjectSamplerState:lodMinClamp:lodMaxClamp:atIndex:\0"
+    "setObjectSamplerStates:lodMinClamps:lodMaxClamps:withRange:\0"
+    "setObjectSamplerStates:withRange:\0"
+    "setObjectTexture:atIndex:\0"
+    "setObjectTextures:withRange:\0"
+    "setObjectThreadgroupMemoryLength:atIndex:\0"
+    "setObjectThreadgroupSizeIsMultipleOfThreadExecutionWidth:\0"
+    "setOffset:\0"
+    "setOpaque:\0"
+    "setOpaqueTriangleIntersectionFunctionWithSignature:atIndex:\0"
+    "setOpaqueTriangleIntersectionFunctionWithSignature:withRange:\0"
+    "setOptimizationLevel:\0"
+    "setOptions:\0"
+    "setOutputNode:\0"
+    "setOutputURL:\0"
+    "setPayloadMemoryLength:\0"
+    "setPixelFormat:\0"
+    "setPreloadedLibraries:\0"
+    "setPreprocessorMacros:\0"
+    "setPreserveInvariance:\0"
+    "setPrimitiveDataBuffer:\0"
+    "setPrimitiveDataBufferOffset:\0"
+    "setPrimitiveDataElementSize:\0"
+    "setPrimitiveDataStride:\0"
+    "setPriority:\0"
+    "setPrivateFunctions:\0"
+    "setPurgeableState:\0"
+    "setRAddressMode:\0"
+    "setRasterSampleCount:\0"
+    "setRasterizationEnabled:\0"
+    "setRasterizationRateMap:\0"
+    "setReadMask:\0"
+    "setRenderPipelineState:\0"
+    "setRenderPipelineState:atIndex:\0"
+    "setRenderPipelineStates:withRange:\0"
+    "setRenderTargetArrayLength:\0"
+    "setRenderTargetHeight:\0"
+    "setRenderTargetWidth:\0"
+    "setResolveDepthPlane:\0"
+    "setResolveLevel:\0"
+    "setResolveSlice:\0"
+    "setResolveTexture:\0"
+    "setResourceOptions:\0"
+    "setRetainedReferences:\0"
+    "setRgbBlendOperation:\0"
+    "setSAddressMode:\0"
+    "setSampleBuffer:\0"
+    "setSampleCount:\0"
+    "setSamplePositions:count:\0"
+    "setSamplerState:atIndex:\0"
+    "setSamplerState:lodMinClamp:lodMaxClamp:atIndex:\0"
+    "setSamplerStates:lodMinClamps:lodMaxClamps:withRange:\0"
+    "setSamplerStates:withRange:\0"
+    "setScissorRect:\0"
+    "setScissorRects:count:\0"
+    "setScratchBufferAllocator:\0"
+    "setScreenSize:\0"
+    "setSignaledValue:\0"
+    "setSize:\0"
+    "setSlice:\0"
+    "setSourceAlphaBlendFactor:\0"
+    "setSourceRGBBlendFactor:\0"
+    "setSparsePageSize:\0"
+    "setSpecializedName:\0"
+    "setStageInRegion:\0"
+    "setStageInRegionWithIndirectBuffer:indirectBufferOffset:\0"
+    "setStageInputDescriptor:\0"
+    "setStartOfEncoderSampleIndex:\0"
+    "setStartOfFragmentSampleIndex:\0"
+    "setStartOfVertexSampleIndex:\0"
+    "setStencilAttachment:\0"
+    "setStencilAttachmentPixelFormat:\0"
+    "setStencilCompareFunction:\0"
+    "setStencilFailureOperation:\0"
+    "setStencilFrontReferenceValue:backReferenceValue:\0"
+    "setStencilReferenceValue:\0"
+    "setStencilResolveFilter:\0"
+    "setStencilStoreAction:\0"
+    "setStencilStoreActionOptions:\0"
+    "setStepFunction:\0"
+    "setStepRate:\0"
+    "setStorageMode:\0"
+    "setStoreAction:\0"
+    "setStoreActionOptions:\0"
+    "setStride:\0"
+    "setSupportAddingBinaryFunctions:\0"
+    "setSupportAddingFragmentBinaryFunctions:\0"
+    "setSupportAddingVertexBinaryFunctions:\0"
+    "setSupportArgumentBuffers:\0"
+    "setSupportIndirectCommandBuffers:\0"
+    "setSupportRayTracing:\0"
+    "setSwizzle:\0"
+    "setTAddressMode:\0"
+    "setTessellationControlPointIndexType:\0"
+    "setTessellationFactorBuffer:offset:instanceStride:\0"
+    "setTessellationFactorFormat:\0"
+    "setTessellationFactorScale:\0"
+    "setTessellationFactorScaleEnabled:\0"
+    "setTessellationFactorStepFunction:\0"
+    "setTessellationOutputWindingOrder:\0"
+    "setTessellationPartitionMode:\0"
+    "setTexture:\0"
+    "setTexture:atIndex:\0"
+    "setTextureType:\0"
+    "setTextures:withRange:\0"
+    "setThreadGroupSizeIsMultipleOfThreadExecutionWidth:\0"
+    "setThreadgroupMemoryLength:\0"
+    "setThreadgroupMemoryLength:atIndex:\0"
+    "setThreadgroupMemoryLength:offset:atIndex:\0"
+    "setThreadgroupSizeMatchesTileSize:\0"
+    "setTileAccelerationStructure:atBufferIndex:\0"
+    "setTileAdditionalBinaryFunctions:\0"
+    "setTileBuffer:offset:atIndex:\0"
+    "setTileBufferOffset:atIndex:\0"
+    "setTileBuffers:offsets:withRange:\0"
+    "setTileBytes:length:atIndex:\0"
+    "setTileFunction:\0"
+    "setTileHeight:\0"
+    "setTileIntersectionFunctionTable:atBufferIndex:\0"
+    "setTileIntersectionFunctionTables:withBufferRange:\0"
+    "setTileSamplerState:atIndex:\0"
+    "setTileSamplerState:lodMinClamp:lodMaxClamp:atIndex:\0"
+    "setTileSamplerStates:lodMinClamps:lodMaxClamps:withRange:\0"
+    "setTileSamplerStates:withRange:\0"
+    "setTileTexture:atIndex:\0"
+    "setTileTextures:withRange:\0"
+    "setTileVisibleFunctionTable:atBufferIndex:\0"
+    "setTileVisibleFunctionTables:withBufferRange:\0"
+    "setTileWidth:\0"
+    "setTransformationMatrixBuffer:\0"
+    "setTransformationMatrixBufferOffset:\0"
+    "setTriangleCount:\0"
+    "setTriangleFillMode:\0"
+    "setType:\0"
+    "setUrl:\0"
+    "setUsage:\0"
+    "setVertexAccelerationStructure:atBufferIndex:\0"
+    "setVertexAdditionalBinaryFunctions:\0"
+    "setVertexAmplificationCount:viewMappings:\0"
+    "setVertexBuffer:\0"
+    "setVertexBuffer:offset:atIndex:\0"
+    "setVertexBufferOffset:\0"
+    "setVertexBufferOffset:atIndex:\0"
+    "setVertexBuffers:\0"
+    "setVertexBuffers:offsets:withRange:\0"
+    "setVertexBytes:length:atIndex:\0"
+    "setVertexDescriptor:\0"
+    "setVertexFormat:\0"
+    "setVertexFunction:\0"
+    "setVertexIntersectionFunctionTable:atBufferIndex:\0"
+    "setVertexIntersectionFunctionTables:withBufferRange:\0"
+    "setVertexLinkedFunctions:\0"
+    "setVertexPreloadedLibraries:\0"
+    "setVertexSamplerState:atIndex:\0"
+    "setVertexSamplerState:lodMinClamp:lodMaxClamp:atIndex:\0"
+    "setVertexSamplerStates:lodMinClamps:lodMaxClamps:withRange:\0"
+    "setVertexSamplerStates:withRange:\0"
+    "setVertexStride:\0"
+    "setVertexTexture:atIndex:\0"
+    "setVertexTextures:withRange:\0"
+    "setVertexVisibleFunctionTable:atBufferIndex:\0"
+    "setVertexVisibleFunctionTables:withBufferRange:\0"
+    "setViewport:\0"
+    "setViewports:count:\0"
+    "setVisibilityResultBuffer:\0"
+    "setVisibilityResultMode:offset:\0"
+    "setVisibleFunctionTable:atBufferIndex:\0"
+    "setVisibleFunctionTable:atIndex:\0"
+    "setVisibleFunctionTables:withBufferRange:\0"
+    "setVisibleFunctionTables:withRange:\0"
+    "setWidth:\0"
+    "setWriteMask:\0"
+    "sharedCaptureManager\0"
+    "signalEvent:value:\0"
+    "signaledValue\0"
+    "size\0"
+    "slice\0"
+    "sourceAlphaBlendFactor\0"
+    "sourceRGBBlendFactor\0"
+    "sparsePageSize\0"
+    "sparseTileSizeInBytes\0"
+    "sparseTileSizeInBytesForSparsePageSize:\0"
+    "sparseTileSizeWithTextureType:pixelFormat:sampleCount:\0"
+    "sparseTileSizeWithTextureType:pixelFormat:sampleCount:sparsePageSize:\0"
+    "specializedName\0"
+    "stageInputAttributes\0"
+    "stageInputDescriptor\0"
+    "stageInputOutputDescriptor\0"
+    "startCaptureWithCommandQueue:\0"
+    "startCaptureWithDescriptor:error:\0"
+    "startCaptureWithDevice:\0"
+    "startCaptureWithScope:\0"
+    "startOfEncoderSampleIndex\0"
+    "startOfFragmentSampleIndex\0"
+    "startOfVertexSampleIndex\0"
+    "staticThreadgroupMemoryLength\0"
+    "status\0"
+    "stencilAttachment\0"
+    "stencilAttachmentPixelFormat\0"
+    "stencilCompareFunction\0"
+    "stencilFailureOperation\0"
+    "stencilResolveFilter\0"
+    "stepFunction\0"
+    "stepRate\0"
+    "stopCapture\0"
+    "storageMode\0"
+    "storeAction\0"
+    "storeActionOptions\0"
+    "stride\0"
+    "structType\0"
+    "supportAddingBinaryFunctions\0"
+    "supportAddingFragmentBinaryFunctions\0"
+    "supportAddingVertexBinaryFunctions\0"
+    "supportArgumentBuffers\0"
+    "supportIndirectCommandBuffers\0"
+    "supportRayTracing\0"
+    "supports32BitFloatFiltering\0"
+    "supports32BitMSAA\0"
+    "supportsBCTextureCompression\0"
+    "supportsCounterSampling:\0"
+    "supportsDestination:\0"
+    "supportsDynamicLibraries\0"
+    "supportsFamily:\0"
+    "supportsFeatureSet:\0"
+    "supportsFunctionPointers\0"
+    "supportsFunctionPointersFromRender\0"
+    "supportsPrimitiveMotionBlur\0"
+    "supportsPullModelInterpolation\0"
+    "supportsQueryTextureLOD\0"
+    "supportsRasterizationRateMapWithLayerCount:\0"
+    "supportsRaytracing\0"
+    "supportsRaytracingFromRender\0"
+    "supportsRenderDynamicLibraries\0"
+    "supportsShaderBarycentricCoordinates\0"
+    "supportsTextureSampleCount:\0"
+    "supportsVertexAmplificationCount:\0"
+    "swizzle\0"
+    "synchronizeResource:\0"
+    "synchronizeTexture:slice:level:\0"
+    "tAddressMode\0"
+    "tailSizeInBytes\0"
+    "tessellationControlPointIndexType\0"
+    "tessellationFactorFormat\0"
+    "tessellationFactorStepFunction\0"
+    "tessellationOutputWindingOrder\0"
+    "tessellationPartitionMode\0"
+    "texture\0"
+    "texture2DDescriptorWithPixelFormat:width:height:mipmapped:\0"
+    "textureBarrier\0"
+    "textureBufferDescriptorWithPixelFormat:width:resourceOptions:usage:\0"
+    "textureCubeDescriptorWithPixelFormat:size:mipmapped:\0"
+    "textureDataType\0"
+    "textureReferenceType\0"
+    "textureType\0"
+    "threadExecutionWidth\0"
+    "threadGroupSizeIsMultipleOfThreadExecutionWidth\0"
+    "threadgroupMemoryAlignment\0"
+    "threadgroupMemoryDataSize\0"
+    "threadgroupMemoryLength\0"
+    "threadgroupSizeMatchesTileSize\0"
+    "tileAdditionalBinaryFunctions\0"
+    "tileArguments\0"
+    "tileBindings\0"
+    "tileBuffers\0"
+    "tileFunction\0"
+    "tileHeight\0"
+    "tileWidth\0"
+    "transformationMatrixBuffer\0"
+    "transformationMatrixBufferOffset\0"
+    "triangleCount\0"
+    "tryCancel\0"
+    "type\0"
+    "updateFence:\0"
+    "updateFence:afterStages:\0"
+    "updateTextureMapping:mode:indirectBuffer:indirectBufferOffset:\0"
+    "updateTextureMapping:mode:region:mipLevel:slice:\0"
+    "updateTextureMappings:mode:regions:mipLevels:slices:numRegions:\0"
+    "url\0"
+    "usage\0"
+    "useHeap:\0"
+    "useHeap:stages:\0"
+    "useHeaps:count:\0"
+    "useHeaps:count:stages:\0"
+    "useResource:usage:\0"
+    "useResource:usage:stages:\0"
+    "useResources:count:usage:\0"
+    "useResources:count:usage:stages:\0"
+    "usedSize\0"
+    "vertexAdditionalBinaryFunctions\0"
+    "vertexArguments\0"
+    "vertexAttributes\0"
+    "vertexBindings\0"
+    "vertexBuffer\0"
+    "vertexBufferOffset\0"
+    "vertexBuffers\0"
+    "vertexDescriptor\0"
+    "vertexFormat\0"
+    "vertexFunction\0"
+    "vertexLinkedFunctions\0"
+    "vertexPreloadedLibraries\0"
+    "vertexStride\0"
+    "vertical\0"
+    "verticalSampleStorage\0"
+    "visibilityResultBuffer\0"
+    "visibleFunctionTableDescriptor\0"
+    "waitForEvent:value:\0"
+    "waitForFence:\0"
+    "waitForFence:beforeStages:\0"
+    "waitUntilCompleted\0"
+    "waitUntilScheduled\0"
+    "width\0"
+    "writeCompactedAccelerationStructureSize:toBuffer:offset:\0"
+    "writeCompactedAccelerationStructureSize:toBuffer:offset:sizeDataType:\0"
+    "writeMask\0";
+
+static bool RegisterTable()
+{
+    const char* pName = s_kTableNames;
+
+    for (std::size_t i = 0; i < static_cast<std::size_t>(Index::Count); ++i)
+    {
+        s_kTable[i] = sel_registerName(pName);
+        pName += std::strlen(pName) + 1;
+    }
+
+    return true;
+}
+
+static const bool s_kTableRegistered = RegisterTable();
+
+}
+
+#endif // MTL_PRIVATE_IMPLEMENTATION
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -25,6 +25,7 @@
 #include "MTLAccelerationStructure.hpp"
 #include "MTLAccelerationStructureCommandEncoder.hpp"
 #include "MTLAccelerationStructureTypes.hpp"
+#include "MTLAllocationHooks.hpp"
 #include "MTLArgument.hpp"
 #include "MTLArgumentEncoder.hpp"
 #include "MTLBinaryArchive.hpp"
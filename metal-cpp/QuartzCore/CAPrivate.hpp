@@ -24,12 +24,21 @@
 
 #include "CADefines.hpp"
 
+#ifdef METALCPP_LAZY_REGISTRATION
+#include "../Foundation/NSPrivate.hpp"
+#endif // METALCPP_LAZY_REGISTRATION
+
 #include <objc/runtime.h>
 
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------
 
+#ifdef METALCPP_LAZY_REGISTRATION
+#define _CA_PRIVATE_CLS(symbol) (Private::Class::s_l##symbol.get())
+#define _CA_PRIVATE_SEL(accessor) (Private::Selector::s_l##accessor.get())
+#else
 #define _CA_PRIVATE_CLS(symbol) (Private::Class::s_k##symbol)
 #define _CA_PRIVATE_SEL(accessor) (Private::Selector::s_k##accessor)
+#endif // METALCPP_LAZY_REGISTRATION
 
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -51,18 +60,30 @@
 #define _CA_PRIVATE_OBJC_GET_PROTOCOL(symbol) objc_getProtocol(#symbol)
 #endif // __OBJC__
 
+#ifdef METALCPP_LAZY_REGISTRATION
+#define _CA_PRIVATE_DEF_CLS(symbol) NS::Private::LazyClass s_l##symbol _CA_PRIVATE_VISIBILITY = { #symbol }
+#define _CA_PRIVATE_DEF_PRO(symbol) NS::Private::LazyProtocol s_l##symbol _CA_PRIVATE_VISIBILITY = { #symbol }
+#define _CA_PRIVATE_DEF_SEL(accessor, symbol) NS::Private::LazySelector s_l##accessor _CA_PRIVATE_VISIBILITY = { symbol }
+#else
 #define _CA_PRIVATE_DEF_CLS(symbol) void* s_k##symbol _CA_PRIVATE_VISIBILITY = _CA_PRIVATE_OBJC_LOOKUP_CLASS(symbol)
 #define _CA_PRIVATE_DEF_PRO(symbol) void* s_k##symbol _CA_PRIVATE_VISIBILITY = _CA_PRIVATE_OBJC_GET_PROTOCOL(symbol)
 #define _CA_PRIVATE_DEF_SEL(accessor, symbol) SEL s_k##accessor _CA_PRIVATE_VISIBILITY = sel_registerName(symbol)
+#endif // METALCPP_LAZY_REGISTRATION
 #define _CA_PRIVATE_DEF_STR(type, symbol)                \
     _CA_EXTERN type const CA##symbol _CA_PRIVATE_IMPORT; \
     type const                       CA::symbol = (nullptr != &CA##symbol) ? CA##symbol : nullptr
 
 #else
 
+#ifdef METALCPP_LAZY_REGISTRATION
+#define _CA_PRIVATE_DEF_CLS(symbol) extern NS::Private::LazyClass s_l##symbol
+#define _CA_PRIVATE_DEF_PRO(symbol) extern NS::Private::LazyProtocol s_l##symbol
+#define _CA_PRIVATE_DEF_SEL(accessor, symbol) extern NS::Private::LazySelector s_l##accessor
+#else
 #define _CA_PRIVATE_DEF_CLS(symbol) extern void* s_k##symbol
 #define _CA_PRIVATE_DEF_PRO(symbol) extern void* s_k##symbol
 #define _CA_PRIVATE_DEF_SEL(accessor, symbol) extern SEL s_k##accessor
+#endif // METALCPP_LAZY_REGISTRATION
 #define _CA_PRIVATE_DEF_STR(type, symbol) extern type const CA::symbol
 
 #endif // CA_PRIVATE_IMPLEMENTATION
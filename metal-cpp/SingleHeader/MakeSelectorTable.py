@@ -0,0 +1,257 @@
+#!/usr/bin/env python3
+
+#--------------------------------------------------------------------------------------------------------------------------------------------------------------
+#
+# SingleHeader/MakeSelectorTable.py
+#
+# Copyright 2020-2022 Apple Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+#--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+import argparse
+import logging
+import os
+import re
+import sys
+
+#--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+class SelectorTable( object ):
+	__template_prefix	= ( '//{separator}\n'
+							'//\n'
+							'// {file}\n'
+							'//\n'
+							'// Autogenerated by SingleHeader/MakeSelectorTable.py from {sources}. Do not edit.\n'
+							'//\n'
+							'// Copyright 2020-2022 Apple Inc.\n'
+							'//\n'
+							'// Licensed under the Apache License, Version 2.0 (the "License");\n'
+							'// you may not use this file except in compliance with the License.\n'
+							'// You may obtain a copy of the License at\n'
+							'//\n'
+							'//     http://www.apache.org/licenses/LICENSE-2.0\n'
+							'//\n'
+							'// Unless required by applicable law or agreed to in writing, software\n'
+							'// distributed under the License is distributed on an "AS IS" BASIS,\n'
+							'// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.\n'
+							'// See the License for the specific language governing permissions and\n'
+							'// limitations under the License.\n'
+							'//\n'
+							'//{separator}\n'
+							'\n'
+							'#pragma once\n'
+							'\n'
+							'//{separator}\n'
+							'\n'
+							'#include <objc/runtime.h>\n'
+							'\n'
+							'#include <cstddef>\n'
+							'#include <cstdint>\n'
+							'#include <cstring>\n'
+							'\n'
+							'//{separator}\n'
+							'\n' )
+
+	__template_enum		= ( 'namespace {namespace}::Private::Selector\n'
+							'{{\n'
+							'\n'
+							'enum class Index : std::uint16_t\n'
+							'{{\n'
+							'{entries}'
+							'    Count\n'
+							'}};\n'
+							'\n'
+							'extern SEL s_kTable[];\n'
+							'\n'
+							'}}\n'
+							'\n'
+							'//{separator}\n'
+							'\n' )
+
+	__template_impl		= ( '#if defined({namespace}_PRIVATE_IMPLEMENTATION)\n'
+							'\n'
+							'namespace {namespace}::Private::Selector\n'
+							'{{\n'
+							'\n'
+							'alignas(64) SEL s_kTable[static_cast<std::size_t>(Index::Count)] _{namespace}_PRIVATE_VISIBILITY;\n'
+							'\n'
+							'static const char s_kTableNames[] =\n'
+							'{names};\n'
+							'\n'
+							'static bool RegisterTable()\n'
+							'{{\n'
+							'    const char* pName = s_kTableNames;\n'
+							'\n'
+							'    for (std::size_t i = 0; i < static_cast<std::size_t>(Index::Count); ++i)\n'
+							'    {{\n'
+							'        s_kTable[i] = sel_registerName(pName);\n'
+							'        pName += std::strlen(pName) + 1;\n'
+							'    }}\n'
+							'\n'
+							'    return true;\n'
+							'}}\n'
+							'\n'
+							'static const bool s_kTableRegistered = RegisterTable();\n'
+							'\n'
+							'}}\n'
+							'\n'
+							'#endif // {namespace}_PRIVATE_IMPLEMENTATION\n'
+							'\n'
+							'//{separator}\n' )
+
+	__separator			= '-' * 157
+
+	__def_sel_pattern	= '_{namespace}_PRIVATE_DEF_SEL\\(\\s*(?P<ACCESSOR>\\w+)\\s*,\\s*"(?P<SYMBOL>[^"]*)"\\s*\\)'
+
+	def __init__( self, namespace, output_path ):
+		self.__namespace	= namespace
+		self.__output_path	= output_path
+		self.__header_paths	= list()
+		self.__selectors	= list()
+		self.__symbols		= dict()
+
+	def __str__( self ):
+		return self.process()
+
+	def append( self, header_path ):
+		self.__header_paths.append( header_path )
+
+	def process( self ):
+		for header_path in self.__header_paths:
+			self.__process_header( header_path )
+
+		if len( self.__selectors ) >= ( 1 << 16 ):
+			raise RuntimeError( 'Too many selectors for a 16-bit index!' )
+
+		return self.__make_prefix() + self.__make_enum() + self.__make_impl()
+
+	def __read_header( self, path ):
+		path = os.path.realpath( path )
+
+		try:
+			f = open( path, 'r' )
+		except:
+			raise RuntimeError( 'Failed to open file \"' + path + '\" for read!' )
+
+		return f.read()
+
+	def __process_header( self, header_path ):
+		logging.info( 'Processing \"' + header_path + '\"...' )
+
+		header	= self.__read_header( header_path )
+		pattern	= self.__def_sel_pattern.format( namespace = self.__namespace )
+
+		for match in re.finditer( pattern, header ):
+			accessor	= match.group( 'ACCESSOR' )
+			symbol		= match.group( 'SYMBOL' )
+
+			if accessor in self.__symbols:
+				if self.__symbols[accessor] != symbol:
+					raise RuntimeError( 'Selector \"' + accessor + '\" is defined with different symbols!' )
+
+				logging.info( '\tSkipping duplicate \"' + accessor + '\"...' )
+				continue
+
+			self.__symbols[accessor] = symbol
+			self.__selectors.append( accessor )
+
+	def __make_prefix( self ):
+		sources = ', '.join( os.path.basename( path ) for path in self.__header_paths )
+
+		return self.__template_prefix.format( separator = self.__separator, file = self.__output_path, sources = sources )
+
+	def __make_enum( self ):
+		entries = ''.join( '    ' + accessor + ',\n' for accessor in self.__selectors )
+
+		return self.__template_enum.format( namespace = self.__namespace, entries = entries, separator = self.__separator )
+
+	def __make_impl( self ):
+		names = '\n'.join( '    "' + self.__symbols[accessor] + '\\0"' for accessor in self.__selectors )
+
+		return self.__template_impl.format( namespace = self.__namespace, names = names, separator = self.__separator )
+
+#--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+def create_argument_parser():
+	parser 			= argparse.ArgumentParser()
+	base_path 		= os.path.dirname( os.path.realpath( __file__ ) )
+	output_path		= os.path.join( base_path, '..', 'Metal', 'MTLSelectorTable.hpp' )
+
+	parser.add_argument( '-o', '--output',    dest = 'output_path', metavar = 'PATH', default = output_path, help = 'Output path for the selector table header.' )
+	parser.add_argument( '-n', '--namespace', dest = 'namespace', metavar = 'NAME', default = 'MTL', help = 'Namespace (and macro prefix) of the selectors.' )
+	parser.add_argument( '-v', '--verbose',   action = 'store_true',  help = 'Show verbose output.' )
+	parser.add_argument( dest = 'header_paths', metavar = 'HEADER_FILE', nargs='+', help = 'Input header file.' )
+
+	return parser
+
+#--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+def parse_arguments():
+	parser	= create_argument_parser()
+	args	= parser.parse_args()
+
+	if args.verbose:
+		logging.getLogger().setLevel( logging.INFO )
+	else:
+		logging.getLogger().setLevel( logging.ERROR )
+
+	return args
+
+#--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+def make_table( args ):
+	output_name	= os.path.join( args.namespace if args.namespace != 'MTL' else 'Metal', os.path.basename( args.output_path ) )
+	table		= SelectorTable( args.namespace, output_name )
+
+	for header_path in args.header_paths:
+		table.append( header_path )
+
+	return str( table )
+
+#--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+def write_table( args, content ):
+	path = os.path.realpath( args.output_path )
+
+	logging.info( 'Writing \"' + path + '\"...' )
+
+	try:
+		f = open( path, 'w' )
+	except:
+		raise RuntimeError( 'Failed to open file \"' + path + '\" for write!' )
+
+	f.write( content )
+
+#--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+if __name__ == '__main__':
+	result = -1
+
+	try:
+		args 	= parse_arguments()
+		table 	= make_table( args )
+
+		write_table( args, table )
+
+		result = 0
+
+	except ( KeyboardInterrupt, SystemExit ):
+	 	pass
+	except:
+	 	raise
+
+	sys.exit( result )
+
+#--------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -1,7 +1,7 @@
 //
 // Metal.hpp
 //
-// Autogenerated on January 22, 2023.
+// Autogenerated from commit 70c90b90f41bdbe11793a835affa6af5e27befe3.
 //
 // Copyright 2020-2022 Apple Inc.
 //
@@ -42,8 +42,13 @@
 
 #include <objc/runtime.h>
 
+#ifdef METALCPP_LAZY_REGISTRATION
+#define _NS_PRIVATE_CLS(symbol) (Private::Class::s_l##symbol.get())
+#define _NS_PRIVATE_SEL(accessor) (Private::Selector::s_l##accessor.get())
+#else
 #define _NS_PRIVATE_CLS(symbol) (Private::Class::s_k##symbol)
 #define _NS_PRIVATE_SEL(accessor) (Private::Selector::s_k##accessor)
+#endif // METALCPP_LAZY_REGISTRATION
 
 #if defined(NS_PRIVATE_IMPLEMENTATION)
 
@@ -63,22 +68,117 @@
 #define _NS_PRIVATE_OBJC_GET_PROTOCOL(symbol) objc_getProtocol(#symbol)
 #endif // __OBJC__
 
+#ifdef METALCPP_LAZY_REGISTRATION
+#define _NS_PRIVATE_DEF_CLS(symbol) NS::Private::LazyClass s_l##symbol _NS_PRIVATE_VISIBILITY = { #symbol }
+#define _NS_PRIVATE_DEF_PRO(symbol) NS::Private::LazyProtocol s_l##symbol _NS_PRIVATE_VISIBILITY = { #symbol }
+#define _NS_PRIVATE_DEF_SEL(accessor, symbol) NS::Private::LazySelector s_l##accessor _NS_PRIVATE_VISIBILITY = { symbol }
+#else
 #define _NS_PRIVATE_DEF_CLS(symbol) void* s_k##symbol _NS_PRIVATE_VISIBILITY = _NS_PRIVATE_OBJC_LOOKUP_CLASS(symbol)
 #define _NS_PRIVATE_DEF_PRO(symbol) void* s_k##symbol _NS_PRIVATE_VISIBILITY = _NS_PRIVATE_OBJC_GET_PROTOCOL(symbol)
 #define _NS_PRIVATE_DEF_SEL(accessor, symbol) SEL s_k##accessor _NS_PRIVATE_VISIBILITY = sel_registerName(symbol)
+#endif // METALCPP_LAZY_REGISTRATION
 #define _NS_PRIVATE_DEF_CONST(type, symbol)              \
     _NS_EXTERN type const NS##symbol _NS_PRIVATE_IMPORT; \
     type const                       NS::symbol = (nullptr != &NS##symbol) ? NS##symbol : nullptr
 
 #else
 
+#ifdef METALCPP_LAZY_REGISTRATION
+#define _NS_PRIVATE_DEF_CLS(symbol) extern NS::Private::LazyClass s_l##symbol
+#define _NS_PRIVATE_DEF_PRO(symbol) extern NS::Private::LazyProtocol s_l##symbol
+#define _NS_PRIVATE_DEF_SEL(accessor, symbol) extern NS::Private::LazySelector s_l##accessor
+#else
 #define _NS_PRIVATE_DEF_CLS(symbol) extern void* s_k##symbol
 #define _NS_PRIVATE_DEF_PRO(symbol) extern void* s_k##symbol
 #define _NS_PRIVATE_DEF_SEL(accessor, symbol) extern SEL s_k##accessor
+#endif // METALCPP_LAZY_REGISTRATION
 #define _NS_PRIVATE_DEF_CONST(type, symbol) extern type const NS::symbol
 
 #endif // NS_PRIVATE_IMPLEMENTATION
 
+#ifdef METALCPP_LAZY_REGISTRATION
+
+#include <atomic>
+
+namespace NS
+{
+namespace Private
+{
+    template <typename _Type, _Type (*_Resolve)(const char*)>
+    class LazySymbol
+    {
+    public:
+        constexpr LazySymbol(const char* pName)
+            : m_pName(pName)
+            , m_symbol(nullptr)
+        {
+        }
+
+        _Type get();
+
+    private:
+        _Type resolve();
+
+        const char*        m_pName;
+        std::atomic<_Type> m_symbol;
+    };
+
+    inline void* LookUpClass(const char* pName)
+    {
+#ifdef __OBJC__
+        return (__bridge void*)objc_lookUpClass(pName);
+#else
+        return objc_lookUpClass(pName);
+#endif // __OBJC__
+    }
+
+    inline void* GetProtocol(const char* pName)
+    {
+#ifdef __OBJC__
+        return (__bridge void*)objc_getProtocol(pName);
+#else
+        return objc_getProtocol(pName);
+#endif // __OBJC__
+    }
+
+    using LazySelector = LazySymbol<SEL, &sel_registerName>;
+    using LazyClass = LazySymbol<void*, &LookUpClass>;
+    using LazyProtocol = LazySymbol<void*, &GetProtocol>;
+} // Private
+} // NS
+
+template <typename _Type, _Type (*_Resolve)(const char*)>
+inline __attribute__((always_inline)) _Type NS::Private::LazySymbol<_Type, _Resolve>::get()
+{
+    _Type symbol = m_symbol.load(std::memory_order_acquire);
+
+    if (__builtin_expect(nullptr != symbol, 1))
+    {
+        return symbol;
+    }
+
+    return resolve();
+}
+
+template <typename _Type, _Type (*_Resolve)(const char*)>
+__attribute__((noinline)) _Type NS::Private::LazySymbol<_Type, _Resolve>::resolve()
+{
+    // The runtime interns selectors and classes, so racing threads all store the same value and no lock is needed.
+    //
+    // A failed class or protocol lookup is stored as nullptr and so is retried on the next get(). That is deliberate:
+    // unlike a symbol resolved at static initialization, a lazy one can still find a class that a bundle loaded later
+    // or the program itself registers after the first lookup. A retry costs one runtime lookup, and only code that
+    // keeps using a class the system doesn't have pays it.
+
+    _Type symbol = (*_Resolve)(m_pName);
+
+    m_symbol.store(symbol, std::memory_order_release);
+
+    return symbol;
+}
+
+#endif // METALCPP_LAZY_REGISTRATION
+
 namespace NS
 {
 namespace Private
@@ -236,6 +336,8 @@ namespace Private
             "floatValue");
         _NS_PRIVATE_DEF_SEL(fullUserName,
             "fullUserName");
+        _NS_PRIVATE_DEF_SEL(getObjects_range_,
+            "getObjects:range:");
         _NS_PRIVATE_DEF_SEL(getValue_size_,
             "getValue:size:");
         _NS_PRIVATE_DEF_SEL(globallyUniqueString,
@@ -535,10 +637,35 @@ struct OperatingSystemVersion
 #include <objc/message.h>
 #include <objc/runtime.h>
 
+#include <atomic>
 #include <type_traits>
 
+#ifdef METALCPP_IMP_CACHE
+#define _NS_PRIVATE_IMP_CACHE_SITE() ([]() -> NS::Private::ImpCache* { static NS::Private::ImpCache s_cache; return &s_cache; }())
+#else
+#define _NS_PRIVATE_IMP_CACHE_SITE() (static_cast<NS::Private::ImpCache*>(nullptr))
+#endif // METALCPP_IMP_CACHE
+
 namespace NS
 {
+namespace Private
+{
+    class ImpCache
+    {
+    public:
+        constexpr ImpCache() = default;
+
+        IMP lookup(const void* pObj, SEL selector);
+
+    private:
+        IMP refill(::Class cls, SEL selector, std::uint32_t sequence);
+
+        std::atomic<std::uint32_t> m_sequence = { 0 };
+        std::atomic<::Class>       m_class = { nullptr };
+        std::atomic<IMP>           m_imp = { nullptr };
+    };
+} // Private
+
 template <class _Class, class _Base = class Object>
 class _NS_EXPORT Referencing : public _Base
 {
@@ -592,6 +719,8 @@ protected:
     static _Ret sendMessage(const void* pObj, SEL selector, _Args... args);
     template <typename _Ret, typename... _Args>
     static _Ret sendMessageSafe(const void* pObj, SEL selector, _Args... args);
+    template <typename _Ret, typename... _Args>
+    static _Ret sendMessageCached(Private::ImpCache* pCache, const void* pObj, SEL selector, _Args... args);
 
 private:
     Object() = delete;
@@ -703,6 +832,65 @@ _NS_INLINE _Ret NS::Object::sendMessage(const void* pObj, SEL selector, _Args...
     }
 }
 
+_NS_INLINE IMP NS::Private::ImpCache::lookup(const void* pObj, SEL selector)
+{
+    ::Class       cls = object_getClass(static_cast<id>(const_cast<void*>(pObj)));
+    std::uint32_t sequence = m_sequence.load(std::memory_order_acquire);
+
+    if (__builtin_expect((sequence & 1) == 0, 1))
+    {
+        ::Class cachedClass = m_class.load(std::memory_order_relaxed);
+        IMP     cachedImp = m_imp.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (__builtin_expect((cachedClass == cls) && (m_sequence.load(std::memory_order_relaxed) == sequence), 1))
+        {
+            return cachedImp;
+        }
+    }
+
+    return refill(cls, selector, sequence);
+}
+
+inline IMP NS::Private::ImpCache::refill(::Class cls, SEL selector, std::uint32_t sequence)
+{
+    // Only one writer refills the entry at a time, a losing writer simply uses the IMP it resolved without publishing it.
+
+    IMP imp = class_getMethodImplementation(cls, selector);
+
+    if (((sequence & 1) == 0) && m_sequence.compare_exchange_strong(sequence, sequence + 1, std::memory_order_acquire, std::memory_order_relaxed))
+    {
+        std::atomic_thread_fence(std::memory_order_release);
+
+        m_class.store(cls, std::memory_order_relaxed);
+        m_imp.store(imp, std::memory_order_relaxed);
+        m_sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    return imp;
+}
+
+template <typename _Ret, typename... _Args>
+_NS_INLINE _Ret NS::Object::sendMessageCached(Private::ImpCache* pCache, const void* pObj, SEL selector, _Args... args)
+{
+    // Methods returning large structs go through the _stret entry points, which IMP lookup can't express portably.
+
+    if constexpr (!doesRequireMsgSendStret<_Ret>())
+    {
+        if (pCache && pObj)
+        {
+            using MethodProc = _Ret (*)(const void*, SEL, _Args...);
+
+            const MethodProc pProc = reinterpret_cast<MethodProc>(pCache->lookup(pObj, selector));
+
+            return (*pProc)(pObj, selector, args...);
+        }
+    }
+
+    return sendMessage<_Ret>(pObj, selector, args...);
+}
+
 _NS_INLINE NS::MethodSignature* NS::Object::methodSignatureForSelector(const void* pObj, SEL selector)
 {
     return sendMessage<MethodSignature*>(pObj, _NS_PRIVATE_SEL(methodSignatureForSelector_), selector);
@@ -765,236 +953,253 @@ _NS_INLINE NS::String* NS::Object::debugDescription() const
     return sendMessageSafe<String*>(this, _NS_PRIVATE_SEL(debugDescription));
 }
 
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+
 namespace NS
 {
-class Array : public Copying<Array>
+struct FastEnumerationState
+{
+    unsigned long  state;
+    Object**       itemsPtr;
+    unsigned long* mutationsPtr;
+    unsigned long  extra[5];
+} _NS_PACKED;
+
+class FastEnumeration : public Referencing<FastEnumeration>
 {
 public:
-    static Array* array();
-    static Array* array(const Object* pObject);
-    static Array* array(const Object* const* pObjects, UInteger count);
+    NS::UInteger countByEnumerating(FastEnumerationState* pState, Object** pBuffer, NS::UInteger len);
+};
 
-    static Array* alloc();
+template <class _ObjectType>
+class Enumerator : public Referencing<Enumerator<_ObjectType>, FastEnumeration>
+{
+public:
+    _ObjectType* nextObject();
+    class Array* allObjects();
+};
 
-    Array*        init();
-    Array*        init(const Object* const* pObjects, UInteger count);
-    Array*        init(const class Coder* pCoder);
+/**
+ * Input iterator over any collection that implements NSFastEnumeration.
+ * Objects are fetched in batches through countByEnumeratingWithState:objects:count:, so walking a collection costs one
+ * message per batch rather than one per element. Arrays usually hand out their whole backing store in the first batch.
+ * Dictionaries enumerate their keys. The collection must not be mutated while it is being iterated.
+ * As with any input iterator, a copy (such as the one postfix ++ returns) can still be dereferenced, but only one copy
+ * may go on advancing.
+ */
+template <class _ObjectType>
+class FastEnumerationIterator
+{
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = _ObjectType*;
+    using difference_type = std::ptrdiff_t;
+    using pointer = _ObjectType* const*;
+    using reference = _ObjectType*;
 
-    template <class _Object = Object>
-    _Object* object(UInteger index) const;
-    UInteger count() const;
+    static constexpr UInteger BatchSize = 16;
+
+    /**
+     * Create an end iterator.
+     */
+    FastEnumerationIterator();
+
+    /**
+     * Create an iterator at the first object of pCollection.
+     */
+    explicit FastEnumerationIterator(const Object* pCollection);
+
+    FastEnumerationIterator(const FastEnumerationIterator& other);
+    FastEnumerationIterator& operator=(const FastEnumerationIterator& other);
+
+    _ObjectType*             operator*() const;
+    FastEnumerationIterator& operator++();
+    FastEnumerationIterator  operator++(int);
+
+    bool                     operator==(const FastEnumerationIterator& other) const;
+    bool                     operator!=(const FastEnumerationIterator& other) const;
+
+private:
+    void                     fetch();
+
+    const Object*            m_pCollection;
+    FastEnumerationState     m_state;
+    Object*                  m_buffer[BatchSize];
+    UInteger                 m_index;
+    UInteger                 m_count;
+    unsigned long            m_mutations;
 };
-}
 
-_NS_INLINE NS::Array* NS::Array::array()
+/**
+ * Range over a fast-enumerable collection, for use with range-based for loops.
+ */
+template <class _ObjectType>
+class FastEnumerationRange
 {
-    return Object::sendMessage<Array*>(_NS_PRIVATE_CLS(NSArray), _NS_PRIVATE_SEL(array));
-}
+public:
+    explicit FastEnumerationRange(const Object* pCollection);
 
-_NS_INLINE NS::Array* NS::Array::array(const Object* pObject)
-{
-    return Object::sendMessage<Array*>(_NS_PRIVATE_CLS(NSArray), _NS_PRIVATE_SEL(arrayWithObject_), pObject);
-}
+    FastEnumerationIterator<_ObjectType> begin() const;
+    FastEnumerationIterator<_ObjectType> end() const;
 
-_NS_INLINE NS::Array* NS::Array::array(const Object* const* pObjects, UInteger count)
-{
-    return Object::sendMessage<Array*>(_NS_PRIVATE_CLS(NSArray), _NS_PRIVATE_SEL(arrayWithObjects_count_), pObjects, count);
+private:
+    const Object* m_pCollection;
+};
 }
 
-_NS_INLINE NS::Array* NS::Array::alloc()
+_NS_INLINE NS::UInteger NS::FastEnumeration::countByEnumerating(FastEnumerationState* pState, Object** pBuffer, NS::UInteger len)
 {
-    return NS::Object::alloc<Array>(_NS_PRIVATE_CLS(NSArray));
+    return Object::sendMessage<UInteger>(this, _NS_PRIVATE_SEL(countByEnumeratingWithState_objects_count_), pState, pBuffer, len);
 }
 
-_NS_INLINE NS::Array* NS::Array::init()
+template <class _ObjectType>
+_NS_INLINE _ObjectType* NS::Enumerator<_ObjectType>::nextObject()
 {
-    return NS::Object::init<Array>();
+    return Object::sendMessage<_ObjectType*>(this, _NS_PRIVATE_SEL(nextObject));
 }
 
-_NS_INLINE NS::Array* NS::Array::init(const Object* const* pObjects, UInteger count)
+template <class _ObjectType>
+_NS_INLINE NS::Array* NS::Enumerator<_ObjectType>::allObjects()
 {
-    return Object::sendMessage<Array*>(this, _NS_PRIVATE_SEL(initWithObjects_count_), pObjects, count);
+    return Object::sendMessage<Array*>(this, _NS_PRIVATE_SEL(allObjects));
 }
 
-_NS_INLINE NS::Array* NS::Array::init(const class Coder* pCoder)
+template <class _ObjectType>
+_NS_INLINE NS::FastEnumerationIterator<_ObjectType>::FastEnumerationIterator()
+    : m_pCollection(nullptr)
+    , m_state {}
+    , m_buffer {}
+    , m_index(0)
+    , m_count(0)
+    , m_mutations(0)
 {
-    return Object::sendMessage<Array*>(this, _NS_PRIVATE_SEL(initWithCoder_), pCoder);
 }
 
-_NS_INLINE NS::UInteger NS::Array::count() const
-{
-    return Object::sendMessage<UInteger>(this, _NS_PRIVATE_SEL(count));
+template <class _ObjectType>
+_NS_INLINE NS::FastEnumerationIterator<_ObjectType>::FastEnumerationIterator(const Object* pCollection)
+    : m_pCollection(pCollection)
+    , m_state {}
+    , m_buffer {}
+    , m_index(0)
+    , m_count(0)
+    , m_mutations(0)
+{
+    if (m_pCollection)
+    {
+        fetch();
+        m_mutations = m_pCollection ? *m_state.mutationsPtr : 0;
+    }
 }
 
-template <class _Object>
-_NS_INLINE _Object* NS::Array::object(UInteger index) const
+template <class _ObjectType>
+_NS_INLINE NS::FastEnumerationIterator<_ObjectType>::FastEnumerationIterator(const FastEnumerationIterator& other)
 {
-    return Object::sendMessage<_Object*>(this, _NS_PRIVATE_SEL(objectAtIndex_), index);
+    *this = other;
 }
 
-namespace NS
-{
-class AutoreleasePool : public Object
+template <class _ObjectType>
+_NS_INLINE NS::FastEnumerationIterator<_ObjectType>& NS::FastEnumerationIterator<_ObjectType>::operator=(const FastEnumerationIterator& other)
 {
-public:
-    static AutoreleasePool* alloc();
-    AutoreleasePool*        init();
+    if (this != &other)
+    {
+        m_pCollection = other.m_pCollection;
+        m_state = other.m_state;
+        m_index = other.m_index;
+        m_count = other.m_count;
+        m_mutations = other.m_mutations;
 
-    void                    drain();
+        for (UInteger i = 0; i < BatchSize; ++i)
+        {
+            m_buffer[i] = other.m_buffer[i];
+        }
 
-    void                    addObject(Object* pObject);
+        // The batch may live in the other iterator's buffer rather than in the collection.
+        if (other.m_state.itemsPtr == other.m_buffer)
+        {
+            m_state.itemsPtr = m_buffer;
+        }
+    }
 
-    static void             showPools();
-};
+    return *this;
 }
 
-_NS_INLINE NS::AutoreleasePool* NS::AutoreleasePool::alloc()
+template <class _ObjectType>
+_NS_INLINE _ObjectType* NS::FastEnumerationIterator<_ObjectType>::operator*() const
 {
-    return NS::Object::alloc<AutoreleasePool>(_NS_PRIVATE_CLS(NSAutoreleasePool));
-}
+    assert(m_pCollection && (*m_state.mutationsPtr == m_mutations));
 
-_NS_INLINE NS::AutoreleasePool* NS::AutoreleasePool::init()
-{
-    return NS::Object::init<AutoreleasePool>();
+    return reinterpret_cast<_ObjectType*>(m_state.itemsPtr[m_index]);
 }
 
-_NS_INLINE void NS::AutoreleasePool::drain()
+template <class _ObjectType>
+_NS_INLINE NS::FastEnumerationIterator<_ObjectType>& NS::FastEnumerationIterator<_ObjectType>::operator++()
 {
-    Object::sendMessage<void>(this, _NS_PRIVATE_SEL(drain));
-}
+    if (++m_index == m_count)
+    {
+        fetch();
+    }
 
-_NS_INLINE void NS::AutoreleasePool::addObject(Object* pObject)
-{
-    Object::sendMessage<void>(this, _NS_PRIVATE_SEL(addObject_), pObject);
+    return *this;
 }
 
-_NS_INLINE void NS::AutoreleasePool::showPools()
+template <class _ObjectType>
+_NS_INLINE NS::FastEnumerationIterator<_ObjectType> NS::FastEnumerationIterator<_ObjectType>::operator++(int)
 {
-    Object::sendMessage<void>(_NS_PRIVATE_CLS(NSAutoreleasePool), _NS_PRIVATE_SEL(showPools));
+    FastEnumerationIterator previous(*this);
+
+    ++(*this);
+
+    return previous;
 }
 
-namespace NS
-{
-struct FastEnumerationState
+template <class _ObjectType>
+_NS_INLINE bool NS::FastEnumerationIterator<_ObjectType>::operator==(const FastEnumerationIterator& other) const
 {
-    unsigned long  state;
-    Object**       itemsPtr;
-    unsigned long* mutationsPtr;
-    unsigned long  extra[5];
-} _NS_PACKED;
+    return (m_pCollection == other.m_pCollection) && (m_index == other.m_index) && (m_count == other.m_count)
+        && (m_state.state == other.m_state.state);
+}
 
-class FastEnumeration : public Referencing<FastEnumeration>
+template <class _ObjectType>
+_NS_INLINE bool NS::FastEnumerationIterator<_ObjectType>::operator!=(const FastEnumerationIterator& other) const
 {
-public:
-    NS::UInteger countByEnumerating(FastEnumerationState* pState, Object** pBuffer, NS::UInteger len);
-};
+    return !(*this == other);
+}
 
 template <class _ObjectType>
-class Enumerator : public Referencing<Enumerator<_ObjectType>, FastEnumeration>
+_NS_INLINE void NS::FastEnumerationIterator<_ObjectType>::fetch()
 {
-public:
-    _ObjectType* nextObject();
-    class Array* allObjects();
-};
+    m_index = 0;
+    m_count = reinterpret_cast<FastEnumeration*>(const_cast<Object*>(m_pCollection))->countByEnumerating(&m_state, m_buffer, BatchSize);
+
+    if (0 == m_count)
+    {
+        *this = FastEnumerationIterator();
+    }
 }
 
-_NS_INLINE NS::UInteger NS::FastEnumeration::countByEnumerating(FastEnumerationState* pState, Object** pBuffer, NS::UInteger len)
+template <class _ObjectType>
+_NS_INLINE NS::FastEnumerationRange<_ObjectType>::FastEnumerationRange(const Object* pCollection)
+    : m_pCollection(pCollection)
 {
-    return Object::sendMessage<UInteger>(this, _NS_PRIVATE_SEL(countByEnumeratingWithState_objects_count_), pState, pBuffer, len);
 }
 
 template <class _ObjectType>
-_NS_INLINE _ObjectType* NS::Enumerator<_ObjectType>::nextObject()
+_NS_INLINE NS::FastEnumerationIterator<_ObjectType> NS::FastEnumerationRange<_ObjectType>::begin() const
 {
-    return Object::sendMessage<_ObjectType*>(this, _NS_PRIVATE_SEL(nextObject));
+    return FastEnumerationIterator<_ObjectType>(m_pCollection);
 }
 
 template <class _ObjectType>
-_NS_INLINE NS::Array* NS::Enumerator<_ObjectType>::allObjects()
+_NS_INLINE NS::FastEnumerationIterator<_ObjectType> NS::FastEnumerationRange<_ObjectType>::end() const
 {
-    return Object::sendMessage<Array*>(this, _NS_PRIVATE_SEL(allObjects));
+    return FastEnumerationIterator<_ObjectType>();
 }
 
 namespace NS
 {
-class Dictionary : public NS::Copying<Dictionary>
-{
-public:
-    static Dictionary* dictionary();
-    static Dictionary* dictionary(const Object* pObject, const Object* pKey);
-    static Dictionary* dictionary(const Object* const* pObjects, const Object* const* pKeys, UInteger count);
-
-    static Dictionary* alloc();
-
-    Dictionary*        init();
-    Dictionary*        init(const Object* const* pObjects, const Object* const* pKeys, UInteger count);
-    Dictionary*        init(const class Coder* pCoder);
-
-    template <class _KeyType = Object>
-    Enumerator<_KeyType>* keyEnumerator() const;
-
-    template <class _Object = Object>
-    _Object* object(const Object* pKey) const;
-    UInteger count() const;
-};
-}
-
-_NS_INLINE NS::Dictionary* NS::Dictionary::dictionary()
-{
-    return Object::sendMessage<Dictionary*>(_NS_PRIVATE_CLS(NSDictionary), _NS_PRIVATE_SEL(dictionary));
-}
-
-_NS_INLINE NS::Dictionary* NS::Dictionary::dictionary(const Object* pObject, const Object* pKey)
-{
-    return Object::sendMessage<Dictionary*>(_NS_PRIVATE_CLS(NSDictionary), _NS_PRIVATE_SEL(dictionaryWithObject_forKey_), pObject, pKey);
-}
-
-_NS_INLINE NS::Dictionary* NS::Dictionary::dictionary(const Object* const* pObjects, const Object* const* pKeys, UInteger count)
-{
-    return Object::sendMessage<Dictionary*>(_NS_PRIVATE_CLS(NSDictionary), _NS_PRIVATE_SEL(dictionaryWithObjects_forKeys_count_),
-        pObjects, pKeys, count);
-}
-
-_NS_INLINE NS::Dictionary* NS::Dictionary::alloc()
-{
-    return NS::Object::alloc<Dictionary>(_NS_PRIVATE_CLS(NSDictionary));
-}
-
-_NS_INLINE NS::Dictionary* NS::Dictionary::init()
-{
-    return NS::Object::init<Dictionary>();
-}
-
-_NS_INLINE NS::Dictionary* NS::Dictionary::init(const Object* const* pObjects, const Object* const* pKeys, UInteger count)
-{
-    return Object::sendMessage<Dictionary*>(this, _NS_PRIVATE_SEL(initWithObjects_forKeys_count_), pObjects, pKeys, count);
-}
-
-_NS_INLINE NS::Dictionary* NS::Dictionary::init(const class Coder* pCoder)
-{
-    return Object::sendMessage<Dictionary*>(this, _NS_PRIVATE_SEL(initWithCoder_), pCoder);
-}
-
-template <class _KeyType>
-_NS_INLINE NS::Enumerator<_KeyType>* NS::Dictionary::keyEnumerator() const
-{
-    return Object::sendMessage<Enumerator<_KeyType>*>(this, _NS_PRIVATE_SEL(keyEnumerator));
-}
-
-template <class _Object>
-_NS_INLINE _Object* NS::Dictionary::object(const Object* pKey) const
-{
-    return Object::sendMessage<_Object*>(this, _NS_PRIVATE_SEL(objectForKey_), pKey);
-}
-
-_NS_INLINE NS::UInteger NS::Dictionary::count() const
-{
-    return Object::sendMessage<UInteger>(this, _NS_PRIVATE_SEL(count));
-}
-
-namespace NS
-{
-struct Range
+struct Range
 {
     static Range Make(UInteger loc, UInteger len);
 
@@ -1035,663 +1240,1882 @@ _NS_INLINE NS::UInteger NS::Range::Max() const
     return location + length;
 }
 
+#if __cplusplus >= 202002L
+#include <algorithm>
+#include <ranges>
+#include <span>
+#endif // __cplusplus >= 202002L
+
 namespace NS
 {
-_NS_ENUM(NS::UInteger, StringEncoding) {
-    ASCIIStringEncoding = 1,
-    NEXTSTEPStringEncoding = 2,
-    JapaneseEUCStringEncoding = 3,
-    UTF8StringEncoding = 4,
-    ISOLatin1StringEncoding = 5,
-    SymbolStringEncoding = 6,
-    NonLossyASCIIStringEncoding = 7,
-    ShiftJISStringEncoding = 8,
-    ISOLatin2StringEncoding = 9,
-    UnicodeStringEncoding = 10,
-    WindowsCP1251StringEncoding = 11,
-    WindowsCP1252StringEncoding = 12,
-    WindowsCP1253StringEncoding = 13,
-    WindowsCP1254StringEncoding = 14,
-    WindowsCP1250StringEncoding = 15,
-    ISO2022JPStringEncoding = 21,
-    MacOSRomanStringEncoding = 30,
-
-    UTF16StringEncoding = UnicodeStringEncoding,
-
-    UTF16BigEndianStringEncoding = 0x90000100,
-    UTF16LittleEndianStringEncoding = 0x94000100,
-
-    UTF32StringEncoding = 0x8c000100,
-    UTF32BigEndianStringEncoding = 0x98000100,
-    UTF32LittleEndianStringEncoding = 0x9c000100
-};
-
-_NS_OPTIONS(NS::UInteger, StringCompareOptions) {
-    CaseInsensitiveSearch = 1,
-    LiteralSearch = 2,
-    BackwardsSearch = 4,
-    AnchoredSearch = 8,
-    NumericSearch = 64,
-    DiacriticInsensitiveSearch = 128,
-    WidthInsensitiveSearch = 256,
-    ForcedOrderingSearch = 512,
-    RegularExpressionSearch = 1024
-};
-
-using unichar = unsigned short;
-
-class String : public Copying<String>
+class Array : public Copying<Array>
 {
 public:
-    static String* string();
-    static String* string(const String* pString);
-    static String* string(const char* pString, StringEncoding encoding);
+    static Array* array();
+    static Array* array(const Object* pObject);
+    static Array* array(const Object* const* pObjects, UInteger count);
 
-    static String* alloc();
-    String*        init();
-    String*        init(const String* pString);
-    String*        init(const char* pString, StringEncoding encoding);
-    String*        init(void* pBytes, UInteger len, StringEncoding encoding, bool freeBuffer);
+    static Array* alloc();
 
-    unichar        character(UInteger index) const;
-    UInteger       length() const;
+    Array*        init();
+    Array*        init(const Object* const* pObjects, UInteger count);
+    Array*        init(const class Coder* pCoder);
 
-    const char*    cString(StringEncoding encoding) const;
-    const char*    utf8String() const;
-    UInteger       maximumLengthOfBytes(StringEncoding encoding) const;
-    UInteger       lengthOfBytes(StringEncoding encoding) const;
+    template <class _Object = Object>
+    _Object* object(UInteger index) const;
+    UInteger count() const;
 
-    bool           isEqualToString(const String* pString) const;
-    Range          rangeOfString(const String* pString, StringCompareOptions options) const;
+    void     getObjects(Object** pObjects, Range range) const;
+#if __cplusplus >= 202002L
+    template <class _Object = Object, std::size_t _Extent = std::dynamic_extent>
+    UInteger getObjects(std::span<_Object*, _Extent> objects, UInteger location = 0) const;
 
-    const char*    fileSystemRepresentation() const;
+    template <class _Range>
+        requires std::ranges::contiguous_range<_Range> && std::ranges::sized_range<_Range>
+    UInteger getObjects(_Range&& objects, UInteger location = 0) const;
+#endif // __cplusplus >= 202002L
 
-    String*        stringByAppendingString(const String* pString) const;
+    template <class _Object = Object>
+    FastEnumerationRange<_Object>   objects() const;
+    FastEnumerationIterator<Object> begin() const;
+    FastEnumerationIterator<Object> end() const;
 };
-
-#define MTLSTR( literal ) (NS::String *)__builtin___CFStringMakeConstantString( "" literal "" )
-
-template< std::size_t _StringLen >
-[[deprecated("please use MTLSTR(str)")]]
-constexpr const String* MakeConstantString( const char ( &str )[_StringLen] )
-{
-    return reinterpret_cast< const String* >( __CFStringMakeConstantString( str ) );
 }
 
-}
-
-_NS_INLINE NS::String* NS::String::string()
+_NS_INLINE NS::Array* NS::Array::array()
 {
-    return Object::sendMessage<String*>(_NS_PRIVATE_CLS(NSString), _NS_PRIVATE_SEL(string));
+    return Object::sendMessage<Array*>(_NS_PRIVATE_CLS(NSArray), _NS_PRIVATE_SEL(array));
 }
 
-_NS_INLINE NS::String* NS::String::string(const String* pString)
+_NS_INLINE NS::Array* NS::Array::array(const Object* pObject)
 {
-    return Object::sendMessage<String*>(_NS_PRIVATE_CLS(NSString), _NS_PRIVATE_SEL(stringWithString_), pString);
+    return Object::sendMessage<Array*>(_NS_PRIVATE_CLS(NSArray), _NS_PRIVATE_SEL(arrayWithObject_), pObject);
 }
 
-_NS_INLINE NS::String* NS::String::string(const char* pString, StringEncoding encoding)
+_NS_INLINE NS::Array* NS::Array::array(const Object* const* pObjects, UInteger count)
 {
-    return Object::sendMessage<String*>(_NS_PRIVATE_CLS(NSString), _NS_PRIVATE_SEL(stringWithCString_encoding_), pString, encoding);
+    return Object::sendMessage<Array*>(_NS_PRIVATE_CLS(NSArray), _NS_PRIVATE_SEL(arrayWithObjects_count_), pObjects, count);
 }
 
-_NS_INLINE NS::String* NS::String::alloc()
+_NS_INLINE NS::Array* NS::Array::alloc()
 {
-    return Object::alloc<String>(_NS_PRIVATE_CLS(NSString));
+    return NS::Object::alloc<Array>(_NS_PRIVATE_CLS(NSArray));
 }
 
-_NS_INLINE NS::String* NS::String::init()
+_NS_INLINE NS::Array* NS::Array::init()
 {
-    return Object::init<String>();
+    return NS::Object::init<Array>();
 }
 
-_NS_INLINE NS::String* NS::String::init(const String* pString)
+_NS_INLINE NS::Array* NS::Array::init(const Object* const* pObjects, UInteger count)
 {
-    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(initWithString_), pString);
+    return Object::sendMessage<Array*>(this, _NS_PRIVATE_SEL(initWithObjects_count_), pObjects, count);
 }
 
-_NS_INLINE NS::String* NS::String::init(const char* pString, StringEncoding encoding)
+_NS_INLINE NS::Array* NS::Array::init(const class Coder* pCoder)
 {
-    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(initWithCString_encoding_), pString, encoding);
+    return Object::sendMessage<Array*>(this, _NS_PRIVATE_SEL(initWithCoder_), pCoder);
 }
 
-_NS_INLINE NS::String* NS::String::init(void* pBytes, UInteger len, StringEncoding encoding, bool freeBuffer)
+_NS_INLINE NS::UInteger NS::Array::count() const
 {
-    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(initWithBytesNoCopy_length_encoding_freeWhenDone_), pBytes, len, encoding, freeBuffer);
+    return Object::sendMessage<UInteger>(this, _NS_PRIVATE_SEL(count));
 }
 
-_NS_INLINE NS::unichar NS::String::character(UInteger index) const
+template <class _Object>
+_NS_INLINE _Object* NS::Array::object(UInteger index) const
 {
-    return Object::sendMessage<unichar>(this, _NS_PRIVATE_SEL(characterAtIndex_), index);
+    return Object::sendMessage<_Object*>(this, _NS_PRIVATE_SEL(objectAtIndex_), index);
 }
 
-_NS_INLINE NS::UInteger NS::String::length() const
+_NS_INLINE void NS::Array::getObjects(Object** pObjects, Range range) const
 {
-    return Object::sendMessage<UInteger>(this, _NS_PRIVATE_SEL(length));
+    Object::sendMessage<void>(this, _NS_PRIVATE_SEL(getObjects_range_), pObjects, range);
 }
 
-_NS_INLINE const char* NS::String::cString(StringEncoding encoding) const
+#if __cplusplus >= 202002L
+template <class _Object, std::size_t _Extent>
+_NS_INLINE NS::UInteger NS::Array::getObjects(std::span<_Object*, _Extent> objects, UInteger location) const
 {
-    return Object::sendMessage<const char*>(this, _NS_PRIVATE_SEL(cStringUsingEncoding_), encoding);
-}
+    const UInteger available = count();
+    const UInteger length = (location < available) ? std::min<UInteger>(available - location, objects.size()) : 0;
 
-_NS_INLINE const char* NS::String::utf8String() const
-{
-    return Object::sendMessage<const char*>(this, _NS_PRIVATE_SEL(UTF8String));
-}
+    if (length)
+    {
+        getObjects(reinterpret_cast<Object**>(objects.data()), Range::Make(location, length));
+    }
 
-_NS_INLINE NS::UInteger NS::String::maximumLengthOfBytes(StringEncoding encoding) const
-{
-    return Object::sendMessage<UInteger>(this, _NS_PRIVATE_SEL(maximumLengthOfBytesUsingEncoding_), encoding);
+    return length;
 }
 
-_NS_INLINE NS::UInteger NS::String::lengthOfBytes(StringEncoding encoding) const
+template <class _Range>
+    requires std::ranges::contiguous_range<_Range> && std::ranges::sized_range<_Range>
+_NS_INLINE NS::UInteger NS::Array::getObjects(_Range&& objects, UInteger location) const
 {
-    return Object::sendMessage<UInteger>(this, _NS_PRIVATE_SEL(lengthOfBytesUsingEncoding_), encoding);
+    // A std::vector or std::array of pointers doesn't deduce _Object through the span overload, so make the span here.
+    return getObjects(std::span(std::ranges::data(objects), std::ranges::size(objects)), location);
 }
 
-_NS_INLINE bool NS::String::isEqualToString(const NS::String* pString) const
-{
-    return Object::sendMessage<bool>(this, _NS_PRIVATE_SEL(isEqualToString_), pString);
-}
+#endif // __cplusplus >= 202002L
 
-_NS_INLINE NS::Range NS::String::rangeOfString(const NS::String* pString, NS::StringCompareOptions options) const
+template <class _Object>
+_NS_INLINE NS::FastEnumerationRange<_Object> NS::Array::objects() const
 {
-    return Object::sendMessage<Range>(this, _NS_PRIVATE_SEL(rangeOfString_options_), pString, options);
+    return FastEnumerationRange<_Object>(this);
 }
 
-_NS_INLINE const char* NS::String::fileSystemRepresentation() const
+_NS_INLINE NS::FastEnumerationIterator<NS::Object> NS::Array::begin() const
 {
-    return Object::sendMessage<const char*>(this, _NS_PRIVATE_SEL(fileSystemRepresentation));
+    return FastEnumerationIterator<Object>(this);
 }
 
-_NS_INLINE NS::String* NS::String::stringByAppendingString(const String* pString) const
+_NS_INLINE NS::FastEnumerationIterator<NS::Object> NS::Array::end() const
 {
-    return Object::sendMessage<NS::String*>(this, _NS_PRIVATE_SEL(stringByAppendingString_), pString);
+    return FastEnumerationIterator<Object>();
 }
 
-#include <functional>
+#include <cstdint>
+
+#if __has_include(<mach/vm_param.h>)
+#include <mach/vm_param.h>
+#endif // __has_include(<mach/vm_param.h>)
+
+#ifndef METALCPP_AUTORELEASE_STATS
+#ifdef NDEBUG
+#define METALCPP_AUTORELEASE_STATS 0
+#else
+#define METALCPP_AUTORELEASE_STATS 1
+#endif // NDEBUG
+#endif // METALCPP_AUTORELEASE_STATS
 
 namespace NS
 {
-using NotificationName = class String*;
-
-class Notification : public NS::Referencing<Notification>
+class AutoreleasePool : public Object
 {
 public:
-    NS::String*     name() const;
-    NS::Object*     object() const;
-    NS::Dictionary* userInfo() const;
-};
+    static AutoreleasePool* alloc();
+    AutoreleasePool*        init();
 
-using ObserverBlock = void(^)(Notification*);
-using ObserverFunction = std::function<void(Notification*)>;
+    void                    drain();
 
-class NotificationCenter : public NS::Referencing<NotificationCenter>
-{
-    public:
-        static class NotificationCenter* defaultCenter();
-        Object* addObserver(NotificationName name, Object* pObj, void* pQueue, ObserverBlock block);
-        Object* addObserver(NotificationName name, Object* pObj, void* pQueue, ObserverFunction &handler);
-        void removeObserver(Object* pObserver);
+    void                    addObject(Object* pObject);
 
+    static void             showPools();
 };
-}
 
-_NS_INLINE NS::String* NS::Notification::name() const
+struct AutoreleaseScopeStats
 {
-    return Object::sendMessage<NS::String*>(this, _NS_PRIVATE_SEL(name));
-}
-
-_NS_INLINE NS::Object* NS::Notification::object() const
-{
-    return Object::sendMessage<NS::Object*>(this, _NS_PRIVATE_SEL(object));
-}
-
-_NS_INLINE NS::Dictionary* NS::Notification::userInfo() const
-{
-    return Object::sendMessage<NS::Dictionary*>(this, _NS_PRIVATE_SEL(userInfo));
-}
-
-_NS_INLINE NS::NotificationCenter* NS::NotificationCenter::defaultCenter()
-{
-    return NS::Object::sendMessage<NS::NotificationCenter*>(_NS_PRIVATE_CLS(NSNotificationCenter), _NS_PRIVATE_SEL(defaultCenter));
-}
-
-_NS_INLINE NS::Object* NS::NotificationCenter::addObserver(NS::NotificationName name, Object* pObj, void* pQueue, NS::ObserverBlock block)
-{
-    return NS::Object::sendMessage<Object*>(this, _NS_PRIVATE_SEL(addObserverName_object_queue_block_), name, pObj, pQueue, block);
-}
-
-_NS_INLINE NS::Object* NS::NotificationCenter::addObserver(NS::NotificationName name, Object* pObj, void* pQueue, NS::ObserverFunction &handler)
-{
-    __block ObserverFunction blockFunction = handler;
-
-    return addObserver(name, pObj, pQueue, ^(NS::Notification* pNotif) {blockFunction(pNotif);});
-}
-
-_NS_INLINE void NS::NotificationCenter::removeObserver(Object* pObserver)
-{
-    return NS::Object::sendMessage<void>(this, _NS_PRIVATE_SEL(removeObserver_), pObserver);
-}
-
-namespace NS
-{
-_NS_CONST(NotificationName, BundleDidLoadNotification);
-_NS_CONST(NotificationName, BundleResourceRequestLowDiskSpaceNotification);
-
-class String* LocalizedString(const String* pKey, const String*);
-class String* LocalizedStringFromTable(const String* pKey, const String* pTbl, const String*);
-class String* LocalizedStringFromTableInBundle(const String* pKey, const String* pTbl, const class Bundle* pBdle, const String*);
-class String* LocalizedStringWithDefaultValue(const String* pKey, const String* pTbl, const class Bundle* pBdle, const String* pVal, const String*);
+    UInteger scopes = 0;
+    UInteger drainedObjects = 0;
+    UInteger peakDrainedObjects = 0;
+    UInteger uncountedScopes = 0;
+};
 
-class Bundle : public Referencing<Bundle>
+/**
+ * Frame-scoped autorelease pool.
+ * Pushes a pool boundary on construction and pops it on destruction, the same way @autoreleasepool does. No
+ * NSAutoreleasePool object is allocated, so scopes nest at the cost of one runtime call each. drain() pops and
+ * re-pushes, which lets one scope live across a render loop and be emptied once per frame.
+ * When METALCPP_AUTORELEASE_STATS is non-zero (the default unless NDEBUG is defined) every drain counts the objects
+ * it released, accumulates them in per-thread statistics and passes them to the report handler. The count is best
+ * effort: it reads the distance between pool boundaries, which relies on the Objective-C runtime's private pool page
+ * layout, and it is reported as UncountedObjects whenever that layout can't be trusted.
+ */
+class AutoreleaseScope
 {
 public:
-    static Bundle*    mainBundle();
+    using ReportHandler = void (*)(const char* pName, UInteger drainedObjects);
 
-    static Bundle*    bundle(const class String* pPath);
-    static Bundle*    bundle(const class URL* pURL);
-
-    static Bundle*    alloc();
+    static constexpr UInteger UncountedObjects = UIntegerMax;
 
-    Bundle*           init(const class String* pPath);
-    Bundle*           init(const class URL* pURL);
-
-    class Array*      allBundles() const;
-    class Array*      allFrameworks() const;
+    explicit AutoreleaseScope(const char* pName = nullptr);
+    ~AutoreleaseScope();
 
-    bool              load();
-    bool              unload();
+    AutoreleaseScope(const AutoreleaseScope&) = delete;
+    AutoreleaseScope& operator=(const AutoreleaseScope&) = delete;
 
-    bool              isLoaded() const;
+    /**
+     * Release every object autoreleased since construction or the previous drain, and keep the scope open.
+     * Returns the number of objects released, 0 when statistics are off, or UncountedObjects when the objects spilled
+     * onto another runtime pool page and the count could not be taken.
+     */
+    UInteger drain();
 
-    bool              preflightAndReturnError(class Error** pError) const;
-    bool              loadAndReturnError(class Error** pError);
+    /**
+     * Number of objects currently waiting in this scope. Same return convention as drain().
+     */
+    UInteger pendingObjects() const;
 
-    class URL*        bundleURL() const;
-    class URL*        resourceURL() const;
-    class URL*        executableURL() const;
-    class URL*        URLForAuxiliaryExecutable(const class String* pExecutableName) const;
+    const char* name() const;
 
-    class URL*        privateFrameworksURL() const;
-    class URL*        sharedFrameworksURL() const;
-    class URL*        sharedSupportURL() const;
-    class URL*        builtInPlugInsURL() const;
-    class URL*        appStoreReceiptURL() const;
+    /**
+     * Totals for every scope popped or drained on the calling thread.
+     */
+    static const AutoreleaseScopeStats& stats();
+    static void                         resetStats();
 
-    class String*     bundlePath() const;
-    class String*     resourcePath() const;
-    class String*     executablePath() const;
-    class String*     pathForAuxiliaryExecutable(const class String* pExecutableName) const;
+    /**
+     * Called with the scope name and object count on every pop or drain. Shared by all threads; set it at startup.
+     */
+    static void                         setReportHandler(ReportHandler handler);
 
-    class String*     privateFrameworksPath() const;
-    class String*     sharedFrameworksPath() const;
-    class String*     sharedSupportPath() const;
-    class String*     builtInPlugInsPath() const;
+private:
+    UInteger                            pop();
 
-    class String*     bundleIdentifier() const;
-    class Dictionary* infoDictionary() const;
-    class Dictionary* localizedInfoDictionary() const;
-    class Object*     objectForInfoDictionaryKey(const class String* pKey);
+    static UInteger                     countSince(void* pToken);
+    static ReportHandler&               reportHandler();
+    static AutoreleaseScopeStats&       threadStats();
 
-    class String*     localizedString(const class String* pKey, const class String* pValue = nullptr, const class String* pTableName = nullptr) const;
+    void*       m_pOuterToken;
+    void*       m_pToken;
+    const char* m_pName;
 };
 }
 
-_NS_PRIVATE_DEF_CONST(NS::NotificationName, BundleDidLoadNotification);
-_NS_PRIVATE_DEF_CONST(NS::NotificationName, BundleResourceRequestLowDiskSpaceNotification);
+extern "C" void* objc_autoreleasePoolPush(void);
+extern "C" void  objc_autoreleasePoolPop(void* pToken);
 
-_NS_INLINE NS::String* NS::LocalizedString(const String* pKey, const String*)
+_NS_INLINE NS::AutoreleasePool* NS::AutoreleasePool::alloc()
 {
-    return Bundle::mainBundle()->localizedString(pKey, nullptr, nullptr);
+    return NS::Object::alloc<AutoreleasePool>(_NS_PRIVATE_CLS(NSAutoreleasePool));
 }
 
-_NS_INLINE NS::String* NS::LocalizedStringFromTable(const String* pKey, const String* pTbl, const String*)
+_NS_INLINE NS::AutoreleasePool* NS::AutoreleasePool::init()
 {
-    return Bundle::mainBundle()->localizedString(pKey, nullptr, pTbl);
+    return NS::Object::init<AutoreleasePool>();
 }
 
-_NS_INLINE NS::String* NS::LocalizedStringFromTableInBundle(const String* pKey, const String* pTbl, const Bundle* pBdl, const String*)
+_NS_INLINE void NS::AutoreleasePool::drain()
 {
-    return pBdl->localizedString(pKey, nullptr, pTbl);
+    Object::sendMessage<void>(this, _NS_PRIVATE_SEL(drain));
 }
 
-_NS_INLINE NS::String* NS::LocalizedStringWithDefaultValue(const String* pKey, const String* pTbl, const Bundle* pBdl, const String* pVal, const String*)
+_NS_INLINE void NS::AutoreleasePool::addObject(Object* pObject)
 {
-    return pBdl->localizedString(pKey, pVal, pTbl);
+    Object::sendMessage<void>(this, _NS_PRIVATE_SEL(addObject_), pObject);
 }
 
-_NS_INLINE NS::Bundle* NS::Bundle::mainBundle()
+_NS_INLINE void NS::AutoreleasePool::showPools()
 {
-    return Object::sendMessage<Bundle*>(_NS_PRIVATE_CLS(NSBundle), _NS_PRIVATE_SEL(mainBundle));
+    Object::sendMessage<void>(_NS_PRIVATE_CLS(NSAutoreleasePool), _NS_PRIVATE_SEL(showPools));
 }
 
-_NS_INLINE NS::Bundle* NS::Bundle::bundle(const class String* pPath)
+_NS_INLINE NS::AutoreleaseScope::AutoreleaseScope(const char* pName)
+    : m_pOuterToken(nullptr)
+    , m_pToken(objc_autoreleasePoolPush())
+    , m_pName(pName)
 {
-    return Object::sendMessage<Bundle*>(_NS_PRIVATE_CLS(NSBundle), _NS_PRIVATE_SEL(bundleWithPath_), pPath);
+#if METALCPP_AUTORELEASE_STATS
+    // The first push on a thread with no pool page returns a placeholder instead of a boundary address, and nothing can
+    // be measured from it. Pushing again allocates the page, so this scope gets a real boundary to count from.
+    if (m_pToken == reinterpret_cast<void*>(1))
+    {
+        m_pOuterToken = m_pToken;
+        m_pToken = objc_autoreleasePoolPush();
+    }
+#endif // METALCPP_AUTORELEASE_STATS
 }
 
-_NS_INLINE NS::Bundle* NS::Bundle::bundle(const class URL* pURL)
+_NS_INLINE NS::AutoreleaseScope::~AutoreleaseScope()
 {
-    return Object::sendMessage<Bundle*>(_NS_PRIVATE_CLS(NSBundle), _NS_PRIVATE_SEL(bundleWithURL_), pURL);
-}
+    pop();
 
-_NS_INLINE NS::Bundle* NS::Bundle::alloc()
-{
-    return Object::sendMessage<Bundle*>(_NS_PRIVATE_CLS(NSBundle), _NS_PRIVATE_SEL(alloc));
+    if (m_pOuterToken)
+    {
+        objc_autoreleasePoolPop(m_pOuterToken);
+    }
 }
 
-_NS_INLINE NS::Bundle* NS::Bundle::init(const String* pPath)
+_NS_INLINE NS::UInteger NS::AutoreleaseScope::drain()
 {
-    return Object::sendMessage<Bundle*>(this, _NS_PRIVATE_SEL(initWithPath_), pPath);
+    const UInteger drained = pop();
+    m_pToken = objc_autoreleasePoolPush();
+    return drained;
 }
 
-_NS_INLINE NS::Bundle* NS::Bundle::init(const URL* pURL)
+_NS_INLINE NS::UInteger NS::AutoreleaseScope::pendingObjects() const
 {
-    return Object::sendMessage<Bundle*>(this, _NS_PRIVATE_SEL(initWithURL_), pURL);
+#if METALCPP_AUTORELEASE_STATS
+    return countSince(m_pToken);
+#else
+    return 0;
+#endif // METALCPP_AUTORELEASE_STATS
 }
 
-_NS_INLINE NS::Array* NS::Bundle::allBundles() const
+_NS_INLINE const char* NS::AutoreleaseScope::name() const
 {
-    return Object::sendMessage<Array*>(this, _NS_PRIVATE_SEL(allBundles));
+    return m_pName;
 }
 
-_NS_INLINE NS::Array* NS::Bundle::allFrameworks() const
+_NS_INLINE const NS::AutoreleaseScopeStats& NS::AutoreleaseScope::stats()
 {
-    return Object::sendMessage<Array*>(this, _NS_PRIVATE_SEL(allFrameworks));
+    return threadStats();
 }
 
-_NS_INLINE bool NS::Bundle::load()
+_NS_INLINE void NS::AutoreleaseScope::resetStats()
 {
-    return Object::sendMessage<bool>(this, _NS_PRIVATE_SEL(load));
+    threadStats() = AutoreleaseScopeStats();
 }
 
-_NS_INLINE bool NS::Bundle::unload()
+_NS_INLINE void NS::AutoreleaseScope::setReportHandler(ReportHandler handler)
 {
-    return Object::sendMessage<bool>(this, _NS_PRIVATE_SEL(unload));
+    reportHandler() = handler;
 }
 
-_NS_INLINE bool NS::Bundle::isLoaded() const
+_NS_INLINE NS::UInteger NS::AutoreleaseScope::pop()
 {
-    return Object::sendMessage<bool>(this, _NS_PRIVATE_SEL(isLoaded));
-}
+    UInteger drained = 0;
 
-_NS_INLINE bool NS::Bundle::preflightAndReturnError(Error** pError) const
-{
-    return Object::sendMessage<bool>(this, _NS_PRIVATE_SEL(preflightAndReturnError_), pError);
-}
+#if METALCPP_AUTORELEASE_STATS
+    AutoreleaseScopeStats& stats = threadStats();
 
-_NS_INLINE bool NS::Bundle::loadAndReturnError(Error** pError)
-{
-    return Object::sendMessage<bool>(this, _NS_PRIVATE_SEL(loadAndReturnError_), pError);
+    drained = countSince(m_pToken);
+
+    stats.scopes++;
+    if (drained == UncountedObjects)
+    {
+        stats.uncountedScopes++;
+    }
+    else
+    {
+        stats.drainedObjects += drained;
+        stats.peakDrainedObjects = drained > stats.peakDrainedObjects ? drained : stats.peakDrainedObjects;
+    }
+
+    if (ReportHandler handler = reportHandler())
+    {
+        handler(m_pName, drained);
+    }
+#endif // METALCPP_AUTORELEASE_STATS
+
+    objc_autoreleasePoolPop(m_pToken);
+
+    return drained;
 }
 
-_NS_INLINE NS::URL* NS::Bundle::bundleURL() const
+_NS_INLINE NS::UInteger NS::AutoreleaseScope::countSince(void* pToken)
 {
-    return Object::sendMessage<URL*>(this, _NS_PRIVATE_SEL(bundleURL));
+    // A push returns the address of the boundary slot it wrote, and the slots between two boundaries on the same pool
+    // page hold the pending objects. Pool pages are aligned to their size, which is at most PAGE_MAX_SIZE (16 KiB on
+    // arm64). Once the pool spills onto another page the distance means nothing, so the count is reported as unknown.
+#ifdef PAGE_MAX_SIZE
+    constexpr std::uintptr_t kPageMask = ~std::uintptr_t(PAGE_MAX_SIZE - 1);
+#else
+    constexpr std::uintptr_t kPageMask = ~std::uintptr_t(16384 - 1);
+#endif // PAGE_MAX_SIZE
+
+    if (pToken == reinterpret_cast<void*>(1))
+    {
+        return UncountedObjects;
+    }
+
+    void* const pProbe = objc_autoreleasePoolPush();
+    objc_autoreleasePoolPop(pProbe);
+
+    const std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(pToken);
+    const std::uintptr_t end = reinterpret_cast<std::uintptr_t>(pProbe);
+
+    if ((begin & kPageMask) != (end & kPageMask) || end <= begin)
+    {
+        return UncountedObjects;
+    }
+
+    return (end - begin) / sizeof(void*) - 1;
 }
 
-_NS_INLINE NS::URL* NS::Bundle::resourceURL() const
+_NS_INLINE NS::AutoreleaseScope::ReportHandler& NS::AutoreleaseScope::reportHandler()
 {
-    return Object::sendMessage<URL*>(this, _NS_PRIVATE_SEL(resourceURL));
+    static ReportHandler handler = nullptr;
+
+    return handler;
 }
 
-_NS_INLINE NS::URL* NS::Bundle::executableURL() const
+_NS_INLINE NS::AutoreleaseScopeStats& NS::AutoreleaseScope::threadStats()
 {
-    return Object::sendMessage<URL*>(this, _NS_PRIVATE_SEL(executableURL));
+    static thread_local AutoreleaseScopeStats stats;
+
+    return stats;
 }
 
-_NS_INLINE NS::URL* NS::Bundle::URLForAuxiliaryExecutable(const String* pExecutableName) const
+namespace NS
 {
-    return Object::sendMessage<URL*>(this, _NS_PRIVATE_SEL(URLForAuxiliaryExecutable_), pExecutableName);
+class Dictionary : public NS::Copying<Dictionary>
+{
+public:
+    static Dictionary* dictionary();
+    static Dictionary* dictionary(const Object* pObject, const Object* pKey);
+    static Dictionary* dictionary(const Object* const* pObjects, const Object* const* pKeys, UInteger count);
+
+    static Dictionary* alloc();
+
+    Dictionary*        init();
+    Dictionary*        init(const Object* const* pObjects, const Object* const* pKeys, UInteger count);
+    Dictionary*        init(const class Coder* pCoder);
+
+    template <class _KeyType = Object>
+    Enumerator<_KeyType>* keyEnumerator() const;
+
+    template <class _KeyType = Object>
+    FastEnumerationRange<_KeyType>  keys() const;
+    FastEnumerationIterator<Object> begin() const;
+    FastEnumerationIterator<Object> end() const;
+
+    template <class _Object = Object>
+    _Object* object(const Object* pKey) const;
+    UInteger count() const;
+};
 }
 
-_NS_INLINE NS::URL* NS::Bundle::privateFrameworksURL() const
+_NS_INLINE NS::Dictionary* NS::Dictionary::dictionary()
 {
-    return Object::sendMessage<URL*>(this, _NS_PRIVATE_SEL(privateFrameworksURL));
+    return Object::sendMessage<Dictionary*>(_NS_PRIVATE_CLS(NSDictionary), _NS_PRIVATE_SEL(dictionary));
 }
 
-_NS_INLINE NS::URL* NS::Bundle::sharedFrameworksURL() const
+_NS_INLINE NS::Dictionary* NS::Dictionary::dictionary(const Object* pObject, const Object* pKey)
 {
-    return Object::sendMessage<URL*>(this, _NS_PRIVATE_SEL(sharedFrameworksURL));
+    return Object::sendMessage<Dictionary*>(_NS_PRIVATE_CLS(NSDictionary), _NS_PRIVATE_SEL(dictionaryWithObject_forKey_), pObject, pKey);
 }
 
-_NS_INLINE NS::URL* NS::Bundle::sharedSupportURL() const
+_NS_INLINE NS::Dictionary* NS::Dictionary::dictionary(const Object* const* pObjects, const Object* const* pKeys, UInteger count)
 {
-    return Object::sendMessage<URL*>(this, _NS_PRIVATE_SEL(sharedSupportURL));
+    return Object::sendMessage<Dictionary*>(_NS_PRIVATE_CLS(NSDictionary), _NS_PRIVATE_SEL(dictionaryWithObjects_forKeys_count_),
+        pObjects, pKeys, count);
 }
 
-_NS_INLINE NS::URL* NS::Bundle::builtInPlugInsURL() const
+_NS_INLINE NS::Dictionary* NS::Dictionary::alloc()
 {
-    return Object::sendMessage<URL*>(this, _NS_PRIVATE_SEL(builtInPlugInsURL));
+    return NS::Object::alloc<Dictionary>(_NS_PRIVATE_CLS(NSDictionary));
 }
 
-_NS_INLINE NS::URL* NS::Bundle::appStoreReceiptURL() const
+_NS_INLINE NS::Dictionary* NS::Dictionary::init()
 {
-    return Object::sendMessage<URL*>(this, _NS_PRIVATE_SEL(appStoreReceiptURL));
+    return NS::Object::init<Dictionary>();
 }
 
-_NS_INLINE NS::String* NS::Bundle::bundlePath() const
+_NS_INLINE NS::Dictionary* NS::Dictionary::init(const Object* const* pObjects, const Object* const* pKeys, UInteger count)
 {
-    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(bundlePath));
+    return Object::sendMessage<Dictionary*>(this, _NS_PRIVATE_SEL(initWithObjects_forKeys_count_), pObjects, pKeys, count);
 }
 
-_NS_INLINE NS::String* NS::Bundle::resourcePath() const
+_NS_INLINE NS::Dictionary* NS::Dictionary::init(const class Coder* pCoder)
 {
-    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(resourcePath));
+    return Object::sendMessage<Dictionary*>(this, _NS_PRIVATE_SEL(initWithCoder_), pCoder);
 }
 
-_NS_INLINE NS::String* NS::Bundle::executablePath() const
+template <class _KeyType>
+_NS_INLINE NS::Enumerator<_KeyType>* NS::Dictionary::keyEnumerator() const
 {
-    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(executablePath));
+    return Object::sendMessage<Enumerator<_KeyType>*>(this, _NS_PRIVATE_SEL(keyEnumerator));
 }
 
-_NS_INLINE NS::String* NS::Bundle::pathForAuxiliaryExecutable(const String* pExecutableName) const
+template <class _Object>
+_NS_INLINE _Object* NS::Dictionary::object(const Object* pKey) const
 {
-    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(pathForAuxiliaryExecutable_), pExecutableName);
+    return Object::sendMessage<_Object*>(this, _NS_PRIVATE_SEL(objectForKey_), pKey);
 }
 
-_NS_INLINE NS::String* NS::Bundle::privateFrameworksPath() const
+_NS_INLINE NS::UInteger NS::Dictionary::count() const
 {
-    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(privateFrameworksPath));
+    return Object::sendMessage<UInteger>(this, _NS_PRIVATE_SEL(count));
 }
 
-_NS_INLINE NS::String* NS::Bundle::sharedFrameworksPath() const
+template <class _KeyType>
+_NS_INLINE NS::FastEnumerationRange<_KeyType> NS::Dictionary::keys() const
 {
-    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(sharedFrameworksPath));
+    return FastEnumerationRange<_KeyType>(this);
 }
 
-_NS_INLINE NS::String* NS::Bundle::sharedSupportPath() const
+_NS_INLINE NS::FastEnumerationIterator<NS::Object> NS::Dictionary::begin() const
 {
-    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(sharedSupportPath));
+    return FastEnumerationIterator<Object>(this);
 }
 
-_NS_INLINE NS::String* NS::Bundle::builtInPlugInsPath() const
+_NS_INLINE NS::FastEnumerationIterator<NS::Object> NS::Dictionary::end() const
 {
-    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(builtInPlugInsPath));
+    return FastEnumerationIterator<Object>();
 }
 
-_NS_INLINE NS::String* NS::Bundle::bundleIdentifier() const
-{
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+
+namespace NS
+{
+_NS_ENUM(NS::UInteger, StringEncoding) {
+    ASCIIStringEncoding = 1,
+    NEXTSTEPStringEncoding = 2,
+    JapaneseEUCStringEncoding = 3,
+    UTF8StringEncoding = 4,
+    ISOLatin1StringEncoding = 5,
+    SymbolStringEncoding = 6,
+    NonLossyASCIIStringEncoding = 7,
+    ShiftJISStringEncoding = 8,
+    ISOLatin2StringEncoding = 9,
+    UnicodeStringEncoding = 10,
+    WindowsCP1251StringEncoding = 11,
+    WindowsCP1252StringEncoding = 12,
+    WindowsCP1253StringEncoding = 13,
+    WindowsCP1254StringEncoding = 14,
+    WindowsCP1250StringEncoding = 15,
+    ISO2022JPStringEncoding = 21,
+    MacOSRomanStringEncoding = 30,
+
+    UTF16StringEncoding = UnicodeStringEncoding,
+
+    UTF16BigEndianStringEncoding = 0x90000100,
+    UTF16LittleEndianStringEncoding = 0x94000100,
+
+    UTF32StringEncoding = 0x8c000100,
+    UTF32BigEndianStringEncoding = 0x98000100,
+    UTF32LittleEndianStringEncoding = 0x9c000100
+};
+
+_NS_OPTIONS(NS::UInteger, StringCompareOptions) {
+    CaseInsensitiveSearch = 1,
+    LiteralSearch = 2,
+    BackwardsSearch = 4,
+    AnchoredSearch = 8,
+    NumericSearch = 64,
+    DiacriticInsensitiveSearch = 128,
+    WidthInsensitiveSearch = 256,
+    ForcedOrderingSearch = 512,
+    RegularExpressionSearch = 1024
+};
+
+using unichar = unsigned short;
+
+class String : public Copying<String>
+{
+public:
+    static String* string();
+    static String* string(const String* pString);
+    static String* string(const char* pString, StringEncoding encoding);
+
+    static String* alloc();
+    String*        init();
+    String*        init(const String* pString);
+    String*        init(const char* pString, StringEncoding encoding);
+    String*        init(void* pBytes, UInteger len, StringEncoding encoding, bool freeBuffer);
+
+    unichar        character(UInteger index) const;
+    UInteger       length() const;
+
+    const char*    cString(StringEncoding encoding) const;
+    const char*    utf8String() const;
+    UInteger       maximumLengthOfBytes(StringEncoding encoding) const;
+    UInteger       lengthOfBytes(StringEncoding encoding) const;
+
+    /**
+     * View the string as UTF-8 without copying when its storage already is contiguous UTF-8 (or ASCII). Otherwise the
+     * bytes are converted into pBuffer, and the view points there. Strings that do not fit into pBuffer, or any string
+     * when pBuffer is null or bufferLength is 0, fall back to utf8String(), which allocates an autoreleased buffer. The
+     * view is only valid while the string and pBuffer live.
+     */
+    std::string_view utf8View(char* pBuffer, UInteger bufferLength) const;
+
+    template <std::size_t _BufferLength>
+    std::string_view utf8View(char (&buffer)[_BufferLength]) const;
+
+    bool           isEqualToString(const String* pString) const;
+    Range          rangeOfString(const String* pString, StringCompareOptions options) const;
+
+    const char*    fileSystemRepresentation() const;
+
+    String*        stringByAppendingString(const String* pString) const;
+};
+
+#define MTLSTR( literal ) (NS::String *)__builtin___CFStringMakeConstantString( "" literal "" )
+
+template< std::size_t _StringLen >
+[[deprecated("please use MTLSTR(str)")]]
+constexpr const String* MakeConstantString( const char ( &str )[_StringLen] )
+{
+    return reinterpret_cast< const String* >( __CFStringMakeConstantString( str ) );
+}
+
+}
+
+_NS_INLINE NS::String* NS::String::string()
+{
+    return Object::sendMessage<String*>(_NS_PRIVATE_CLS(NSString), _NS_PRIVATE_SEL(string));
+}
+
+_NS_INLINE NS::String* NS::String::string(const String* pString)
+{
+    return Object::sendMessage<String*>(_NS_PRIVATE_CLS(NSString), _NS_PRIVATE_SEL(stringWithString_), pString);
+}
+
+_NS_INLINE NS::String* NS::String::string(const char* pString, StringEncoding encoding)
+{
+    return Object::sendMessage<String*>(_NS_PRIVATE_CLS(NSString), _NS_PRIVATE_SEL(stringWithCString_encoding_), pString, encoding);
+}
+
+_NS_INLINE NS::String* NS::String::alloc()
+{
+    return Object::alloc<String>(_NS_PRIVATE_CLS(NSString));
+}
+
+_NS_INLINE NS::String* NS::String::init()
+{
+    return Object::init<String>();
+}
+
+_NS_INLINE NS::String* NS::String::init(const String* pString)
+{
+    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(initWithString_), pString);
+}
+
+_NS_INLINE NS::String* NS::String::init(const char* pString, StringEncoding encoding)
+{
+    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(initWithCString_encoding_), pString, encoding);
+}
+
+_NS_INLINE NS::String* NS::String::init(void* pBytes, UInteger len, StringEncoding encoding, bool freeBuffer)
+{
+    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(initWithBytesNoCopy_length_encoding_freeWhenDone_), pBytes, len, encoding, freeBuffer);
+}
+
+_NS_INLINE NS::unichar NS::String::character(UInteger index) const
+{
+    return Object::sendMessage<unichar>(this, _NS_PRIVATE_SEL(characterAtIndex_), index);
+}
+
+_NS_INLINE NS::UInteger NS::String::length() const
+{
+    return Object::sendMessage<UInteger>(this, _NS_PRIVATE_SEL(length));
+}
+
+_NS_INLINE const char* NS::String::cString(StringEncoding encoding) const
+{
+    return Object::sendMessage<const char*>(this, _NS_PRIVATE_SEL(cStringUsingEncoding_), encoding);
+}
+
+_NS_INLINE const char* NS::String::utf8String() const
+{
+    return Object::sendMessage<const char*>(this, _NS_PRIVATE_SEL(UTF8String));
+}
+
+_NS_INLINE NS::UInteger NS::String::maximumLengthOfBytes(StringEncoding encoding) const
+{
+    return Object::sendMessage<UInteger>(this, _NS_PRIVATE_SEL(maximumLengthOfBytesUsingEncoding_), encoding);
+}
+
+_NS_INLINE NS::UInteger NS::String::lengthOfBytes(StringEncoding encoding) const
+{
+    return Object::sendMessage<UInteger>(this, _NS_PRIVATE_SEL(lengthOfBytesUsingEncoding_), encoding);
+}
+
+_NS_INLINE std::string_view NS::String::utf8View(char* pBuffer, UInteger bufferLength) const
+{
+    const CFStringRef cfString = reinterpret_cast<CFStringRef>(const_cast<String*>(this));
+
+    if (const char* pDirect = CFStringGetCStringPtr(cfString, kCFStringEncodingUTF8))
+    {
+        return std::string_view(pDirect, std::strlen(pDirect));
+    }
+
+    // CFStringGetBytes only measures when given no buffer, so that case must not take the converted path.
+    if (pBuffer && bufferLength)
+    {
+        const CFIndex characterCount = CFStringGetLength(cfString);
+        CFIndex       byteCount = 0;
+        const CFIndex convertedCount = CFStringGetBytes(cfString, CFRangeMake(0, characterCount), kCFStringEncodingUTF8, 0, false,
+            reinterpret_cast<UInt8*>(pBuffer), static_cast<CFIndex>(bufferLength), &byteCount);
+
+        if (convertedCount == characterCount)
+        {
+            return std::string_view(pBuffer, static_cast<std::size_t>(byteCount));
+        }
+    }
+
+    const char* pString = utf8String();
+
+    return pString ? std::string_view(pString, std::strlen(pString)) : std::string_view();
+}
+
+template <std::size_t _BufferLength>
+_NS_INLINE std::string_view NS::String::utf8View(char (&buffer)[_BufferLength]) const
+{
+    return utf8View(buffer, _BufferLength);
+}
+
+_NS_INLINE bool NS::String::isEqualToString(const NS::String* pString) const
+{
+    return Object::sendMessage<bool>(this, _NS_PRIVATE_SEL(isEqualToString_), pString);
+}
+
+_NS_INLINE NS::Range NS::String::rangeOfString(const NS::String* pString, NS::StringCompareOptions options) const
+{
+    return Object::sendMessage<Range>(this, _NS_PRIVATE_SEL(rangeOfString_options_), pString, options);
+}
+
+_NS_INLINE const char* NS::String::fileSystemRepresentation() const
+{
+    return Object::sendMessage<const char*>(this, _NS_PRIVATE_SEL(fileSystemRepresentation));
+}
+
+_NS_INLINE NS::String* NS::String::stringByAppendingString(const String* pString) const
+{
+    return Object::sendMessage<NS::String*>(this, _NS_PRIVATE_SEL(stringByAppendingString_), pString);
+}
+
+#include <functional>
+
+namespace NS
+{
+using NotificationName = class String*;
+
+class Notification : public NS::Referencing<Notification>
+{
+public:
+    NS::String*     name() const;
+    NS::Object*     object() const;
+    NS::Dictionary* userInfo() const;
+};
+
+using ObserverBlock = void(^)(Notification*);
+using ObserverFunction = std::function<void(Notification*)>;
+
+class NotificationCenter : public NS::Referencing<NotificationCenter>
+{
+    public:
+        static class NotificationCenter* defaultCenter();
+        Object* addObserver(NotificationName name, Object* pObj, void* pQueue, ObserverBlock block);
+        Object* addObserver(NotificationName name, Object* pObj, void* pQueue, ObserverFunction &handler);
+        void removeObserver(Object* pObserver);
+
+};
+}
+
+_NS_INLINE NS::String* NS::Notification::name() const
+{
+    return Object::sendMessage<NS::String*>(this, _NS_PRIVATE_SEL(name));
+}
+
+_NS_INLINE NS::Object* NS::Notification::object() const
+{
+    return Object::sendMessage<NS::Object*>(this, _NS_PRIVATE_SEL(object));
+}
+
+_NS_INLINE NS::Dictionary* NS::Notification::userInfo() const
+{
+    return Object::sendMessage<NS::Dictionary*>(this, _NS_PRIVATE_SEL(userInfo));
+}
+
+_NS_INLINE NS::NotificationCenter* NS::NotificationCenter::defaultCenter()
+{
+    return NS::Object::sendMessage<NS::NotificationCenter*>(_NS_PRIVATE_CLS(NSNotificationCenter), _NS_PRIVATE_SEL(defaultCenter));
+}
+
+_NS_INLINE NS::Object* NS::NotificationCenter::addObserver(NS::NotificationName name, Object* pObj, void* pQueue, NS::ObserverBlock block)
+{
+    return NS::Object::sendMessage<Object*>(this, _NS_PRIVATE_SEL(addObserverName_object_queue_block_), name, pObj, pQueue, block);
+}
+
+_NS_INLINE NS::Object* NS::NotificationCenter::addObserver(NS::NotificationName name, Object* pObj, void* pQueue, NS::ObserverFunction &handler)
+{
+    __block ObserverFunction blockFunction = handler;
+
+    return addObserver(name, pObj, pQueue, ^(NS::Notification* pNotif) {blockFunction(pNotif);});
+}
+
+_NS_INLINE void NS::NotificationCenter::removeObserver(Object* pObserver)
+{
+    return NS::Object::sendMessage<void>(this, _NS_PRIVATE_SEL(removeObserver_), pObserver);
+}
+
+namespace NS
+{
+_NS_CONST(NotificationName, BundleDidLoadNotification);
+_NS_CONST(NotificationName, BundleResourceRequestLowDiskSpaceNotification);
+
+class String* LocalizedString(const String* pKey, const String*);
+class String* LocalizedStringFromTable(const String* pKey, const String* pTbl, const String*);
+class String* LocalizedStringFromTableInBundle(const String* pKey, const String* pTbl, const class Bundle* pBdle, const String*);
+class String* LocalizedStringWithDefaultValue(const String* pKey, const String* pTbl, const class Bundle* pBdle, const String* pVal, const String*);
+
+class Bundle : public Referencing<Bundle>
+{
+public:
+    static Bundle*    mainBundle();
+
+    static Bundle*    bundle(const class String* pPath);
+    static Bundle*    bundle(const class URL* pURL);
+
+    static Bundle*    alloc();
+
+    Bundle*           init(const class String* pPath);
+    Bundle*           init(const class URL* pURL);
+
+    class Array*      allBundles() const;
+    class Array*      allFrameworks() const;
+
+    bool              load();
+    bool              unload();
+
+    bool              isLoaded() const;
+
+    bool              preflightAndReturnError(class Error** pError) const;
+    bool              loadAndReturnError(class Error** pError);
+
+    class URL*        bundleURL() const;
+    class URL*        resourceURL() const;
+    class URL*        executableURL() const;
+    class URL*        URLForAuxiliaryExecutable(const class String* pExecutableName) const;
+
+    class URL*        privateFrameworksURL() const;
+    class URL*        sharedFrameworksURL() const;
+    class URL*        sharedSupportURL() const;
+    class URL*        builtInPlugInsURL() const;
+    class URL*        appStoreReceiptURL() const;
+
+    class String*     bundlePath() const;
+    class String*     resourcePath() const;
+    class String*     executablePath() const;
+    class String*     pathForAuxiliaryExecutable(const class String* pExecutableName) const;
+
+    class String*     privateFrameworksPath() const;
+    class String*     sharedFrameworksPath() const;
+    class String*     sharedSupportPath() const;
+    class String*     builtInPlugInsPath() const;
+
+    class String*     bundleIdentifier() const;
+    class Dictionary* infoDictionary() const;
+    class Dictionary* localizedInfoDictionary() const;
+    class Object*     objectForInfoDictionaryKey(const class String* pKey);
+
+    class String*     localizedString(const class String* pKey, const class String* pValue = nullptr, const class String* pTableName = nullptr) const;
+};
+}
+
+_NS_PRIVATE_DEF_CONST(NS::NotificationName, BundleDidLoadNotification);
+_NS_PRIVATE_DEF_CONST(NS::NotificationName, BundleResourceRequestLowDiskSpaceNotification);
+
+_NS_INLINE NS::String* NS::LocalizedString(const String* pKey, const String*)
+{
+    return Bundle::mainBundle()->localizedString(pKey, nullptr, nullptr);
+}
+
+_NS_INLINE NS::String* NS::LocalizedStringFromTable(const String* pKey, const String* pTbl, const String*)
+{
+    return Bundle::mainBundle()->localizedString(pKey, nullptr, pTbl);
+}
+
+_NS_INLINE NS::String* NS::LocalizedStringFromTableInBundle(const String* pKey, const String* pTbl, const Bundle* pBdl, const String*)
+{
+    return pBdl->localizedString(pKey, nullptr, pTbl);
+}
+
+_NS_INLINE NS::String* NS::LocalizedStringWithDefaultValue(const String* pKey, const String* pTbl, const Bundle* pBdl, const String* pVal, const String*)
+{
+    return pBdl->localizedString(pKey, pVal, pTbl);
+}
+
+_NS_INLINE NS::Bundle* NS::Bundle::mainBundle()
+{
+    return Object::sendMessage<Bundle*>(_NS_PRIVATE_CLS(NSBundle), _NS_PRIVATE_SEL(mainBundle));
+}
+
+_NS_INLINE NS::Bundle* NS::Bundle::bundle(const class String* pPath)
+{
+    return Object::sendMessage<Bundle*>(_NS_PRIVATE_CLS(NSBundle), _NS_PRIVATE_SEL(bundleWithPath_), pPath);
+}
+
+_NS_INLINE NS::Bundle* NS::Bundle::bundle(const class URL* pURL)
+{
+    return Object::sendMessage<Bundle*>(_NS_PRIVATE_CLS(NSBundle), _NS_PRIVATE_SEL(bundleWithURL_), pURL);
+}
+
+_NS_INLINE NS::Bundle* NS::Bundle::alloc()
+{
+    return Object::sendMessage<Bundle*>(_NS_PRIVATE_CLS(NSBundle), _NS_PRIVATE_SEL(alloc));
+}
+
+_NS_INLINE NS::Bundle* NS::Bundle::init(const String* pPath)
+{
+    return Object::sendMessage<Bundle*>(this, _NS_PRIVATE_SEL(initWithPath_), pPath);
+}
+
+_NS_INLINE NS::Bundle* NS::Bundle::init(const URL* pURL)
+{
+    return Object::sendMessage<Bundle*>(this, _NS_PRIVATE_SEL(initWithURL_), pURL);
+}
+
+_NS_INLINE NS::Array* NS::Bundle::allBundles() const
+{
+    return Object::sendMessage<Array*>(this, _NS_PRIVATE_SEL(allBundles));
+}
+
+_NS_INLINE NS::Array* NS::Bundle::allFrameworks() const
+{
+    return Object::sendMessage<Array*>(this, _NS_PRIVATE_SEL(allFrameworks));
+}
+
+_NS_INLINE bool NS::Bundle::load()
+{
+    return Object::sendMessage<bool>(this, _NS_PRIVATE_SEL(load));
+}
+
+_NS_INLINE bool NS::Bundle::unload()
+{
+    return Object::sendMessage<bool>(this, _NS_PRIVATE_SEL(unload));
+}
+
+_NS_INLINE bool NS::Bundle::isLoaded() const
+{
+    return Object::sendMessage<bool>(this, _NS_PRIVATE_SEL(isLoaded));
+}
+
+_NS_INLINE bool NS::Bundle::preflightAndReturnError(Error** pError) const
+{
+    return Object::sendMessage<bool>(this, _NS_PRIVATE_SEL(preflightAndReturnError_), pError);
+}
+
+_NS_INLINE bool NS::Bundle::loadAndReturnError(Error** pError)
+{
+    return Object::sendMessage<bool>(this, _NS_PRIVATE_SEL(loadAndReturnError_), pError);
+}
+
+_NS_INLINE NS::URL* NS::Bundle::bundleURL() const
+{
+    return Object::sendMessage<URL*>(this, _NS_PRIVATE_SEL(bundleURL));
+}
+
+_NS_INLINE NS::URL* NS::Bundle::resourceURL() const
+{
+    return Object::sendMessage<URL*>(this, _NS_PRIVATE_SEL(resourceURL));
+}
+
+_NS_INLINE NS::URL* NS::Bundle::executableURL() const
+{
+    return Object::sendMessage<URL*>(this, _NS_PRIVATE_SEL(executableURL));
+}
+
+_NS_INLINE NS::URL* NS::Bundle::URLForAuxiliaryExecutable(const String* pExecutableName) const
+{
+    return Object::sendMessage<URL*>(this, _NS_PRIVATE_SEL(URLForAuxiliaryExecutable_), pExecutableName);
+}
+
+_NS_INLINE NS::URL* NS::Bundle::privateFrameworksURL() const
+{
+    return Object::sendMessage<URL*>(this, _NS_PRIVATE_SEL(privateFrameworksURL));
+}
+
+_NS_INLINE NS::URL* NS::Bundle::sharedFrameworksURL() const
+{
+    return Object::sendMessage<URL*>(this, _NS_PRIVATE_SEL(sharedFrameworksURL));
+}
+
+_NS_INLINE NS::URL* NS::Bundle::sharedSupportURL() const
+{
+    return Object::sendMessage<URL*>(this, _NS_PRIVATE_SEL(sharedSupportURL));
+}
+
+_NS_INLINE NS::URL* NS::Bundle::builtInPlugInsURL() const
+{
+    return Object::sendMessage<URL*>(this, _NS_PRIVATE_SEL(builtInPlugInsURL));
+}
+
+_NS_INLINE NS::URL* NS::Bundle::appStoreReceiptURL() const
+{
+    return Object::sendMessage<URL*>(this, _NS_PRIVATE_SEL(appStoreReceiptURL));
+}
+
+_NS_INLINE NS::String* NS::Bundle::bundlePath() const
+{
+    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(bundlePath));
+}
+
+_NS_INLINE NS::String* NS::Bundle::resourcePath() const
+{
+    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(resourcePath));
+}
+
+_NS_INLINE NS::String* NS::Bundle::executablePath() const
+{
+    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(executablePath));
+}
+
+_NS_INLINE NS::String* NS::Bundle::pathForAuxiliaryExecutable(const String* pExecutableName) const
+{
+    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(pathForAuxiliaryExecutable_), pExecutableName);
+}
+
+_NS_INLINE NS::String* NS::Bundle::privateFrameworksPath() const
+{
+    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(privateFrameworksPath));
+}
+
+_NS_INLINE NS::String* NS::Bundle::sharedFrameworksPath() const
+{
+    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(sharedFrameworksPath));
+}
+
+_NS_INLINE NS::String* NS::Bundle::sharedSupportPath() const
+{
+    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(sharedSupportPath));
+}
+
+_NS_INLINE NS::String* NS::Bundle::builtInPlugInsPath() const
+{
+    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(builtInPlugInsPath));
+}
+
+_NS_INLINE NS::String* NS::Bundle::bundleIdentifier() const
+{
     return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(bundleIdentifier));
 }
 
-_NS_INLINE NS::Dictionary* NS::Bundle::infoDictionary() const
+_NS_INLINE NS::Dictionary* NS::Bundle::infoDictionary() const
+{
+    return Object::sendMessage<Dictionary*>(this, _NS_PRIVATE_SEL(infoDictionary));
+}
+
+_NS_INLINE NS::Dictionary* NS::Bundle::localizedInfoDictionary() const
+{
+    return Object::sendMessage<Dictionary*>(this, _NS_PRIVATE_SEL(localizedInfoDictionary));
+}
+
+_NS_INLINE NS::Object* NS::Bundle::objectForInfoDictionaryKey(const String* pKey)
+{
+    return Object::sendMessage<Object*>(this, _NS_PRIVATE_SEL(objectForInfoDictionaryKey_), pKey);
+}
+
+_NS_INLINE NS::String* NS::Bundle::localizedString(const String* pKey, const String* pValue /* = nullptr */, const String* pTableName /* = nullptr */) const
+{
+    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(localizedStringForKey_value_table_), pKey, pValue, pTableName);
+}
+
+namespace NS
+{
+class Data : public Copying<Data>
+{
+public:
+    void*    mutableBytes() const;
+    UInteger length() const;
+};
+}
+
+_NS_INLINE void* NS::Data::mutableBytes() const
+{
+    return Object::sendMessage<void*>(this, _NS_PRIVATE_SEL(mutableBytes));
+}
+
+_NS_INLINE NS::UInteger NS::Data::length() const
+{
+    return Object::sendMessage<UInteger>(this, _NS_PRIVATE_SEL(length));
+}
+
+namespace NS
+{
+
+using TimeInterval = double;
+
+class Date : public Copying<Date>
+{
+public:
+    static Date* dateWithTimeIntervalSinceNow(TimeInterval secs);
+};
+
+} // NS
+
+_NS_INLINE NS::Date* NS::Date::dateWithTimeIntervalSinceNow(NS::TimeInterval secs)
+{
+    return NS::Object::sendMessage<NS::Date*>(_NS_PRIVATE_CLS(NSDate), _NS_PRIVATE_SEL(dateWithTimeIntervalSinceNow_), secs);
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace NS
+{
+using ErrorDomain = class String*;
+
+_NS_CONST(ErrorDomain, CocoaErrorDomain);
+_NS_CONST(ErrorDomain, POSIXErrorDomain);
+_NS_CONST(ErrorDomain, OSStatusErrorDomain);
+_NS_CONST(ErrorDomain, MachErrorDomain);
+
+using ErrorUserInfoKey = class String*;
+
+_NS_CONST(ErrorUserInfoKey, UnderlyingErrorKey);
+_NS_CONST(ErrorUserInfoKey, LocalizedDescriptionKey);
+_NS_CONST(ErrorUserInfoKey, LocalizedFailureReasonErrorKey);
+_NS_CONST(ErrorUserInfoKey, LocalizedRecoverySuggestionErrorKey);
+_NS_CONST(ErrorUserInfoKey, LocalizedRecoveryOptionsErrorKey);
+_NS_CONST(ErrorUserInfoKey, RecoveryAttempterErrorKey);
+_NS_CONST(ErrorUserInfoKey, HelpAnchorErrorKey);
+_NS_CONST(ErrorUserInfoKey, DebugDescriptionErrorKey);
+_NS_CONST(ErrorUserInfoKey, LocalizedFailureErrorKey);
+_NS_CONST(ErrorUserInfoKey, StringEncodingErrorKey);
+_NS_CONST(ErrorUserInfoKey, URLErrorKey);
+_NS_CONST(ErrorUserInfoKey, FilePathErrorKey);
+
+class Error : public Copying<Error>
+{
+public:
+    static Error*     error(ErrorDomain domain, Integer code, class Dictionary* pDictionary);
+
+    static Error*     alloc();
+    Error*            init();
+    Error*            init(ErrorDomain domain, Integer code, class Dictionary* pDictionary);
+
+    Integer           code() const;
+    ErrorDomain       domain() const;
+    class Dictionary* userInfo() const;
+
+    class String*     localizedDescription() const;
+    class Array*      localizedRecoveryOptions() const;
+    class String*     localizedRecoverySuggestion() const;
+    class String*     localizedFailureReason() const;
+};
+}
+
+_NS_PRIVATE_DEF_CONST(NS::ErrorDomain, CocoaErrorDomain);
+_NS_PRIVATE_DEF_CONST(NS::ErrorDomain, POSIXErrorDomain);
+_NS_PRIVATE_DEF_CONST(NS::ErrorDomain, OSStatusErrorDomain);
+_NS_PRIVATE_DEF_CONST(NS::ErrorDomain, MachErrorDomain);
+
+_NS_PRIVATE_DEF_CONST(NS::ErrorUserInfoKey, UnderlyingErrorKey);
+_NS_PRIVATE_DEF_CONST(NS::ErrorUserInfoKey, LocalizedDescriptionKey);
+_NS_PRIVATE_DEF_CONST(NS::ErrorUserInfoKey, LocalizedFailureReasonErrorKey);
+_NS_PRIVATE_DEF_CONST(NS::ErrorUserInfoKey, LocalizedRecoverySuggestionErrorKey);
+_NS_PRIVATE_DEF_CONST(NS::ErrorUserInfoKey, LocalizedRecoveryOptionsErrorKey);
+_NS_PRIVATE_DEF_CONST(NS::ErrorUserInfoKey, RecoveryAttempterErrorKey);
+_NS_PRIVATE_DEF_CONST(NS::ErrorUserInfoKey, HelpAnchorErrorKey);
+_NS_PRIVATE_DEF_CONST(NS::ErrorUserInfoKey, DebugDescriptionErrorKey);
+_NS_PRIVATE_DEF_CONST(NS::ErrorUserInfoKey, LocalizedFailureErrorKey);
+_NS_PRIVATE_DEF_CONST(NS::ErrorUserInfoKey, StringEncodingErrorKey);
+_NS_PRIVATE_DEF_CONST(NS::ErrorUserInfoKey, URLErrorKey);
+_NS_PRIVATE_DEF_CONST(NS::ErrorUserInfoKey, FilePathErrorKey);
+
+_NS_INLINE NS::Error* NS::Error::error(ErrorDomain domain, Integer code, class Dictionary* pDictionary)
+{
+    return Object::sendMessage<Error*>(_NS_PRIVATE_CLS(NSError), _NS_PRIVATE_SEL(errorWithDomain_code_userInfo_), domain, code, pDictionary);
+}
+
+_NS_INLINE NS::Error* NS::Error::alloc()
+{
+    return Object::alloc<Error>(_NS_PRIVATE_CLS(NSError));
+}
+
+_NS_INLINE NS::Error* NS::Error::init()
+{
+    return Object::init<Error>();
+}
+
+_NS_INLINE NS::Error* NS::Error::init(ErrorDomain domain, Integer code, class Dictionary* pDictionary)
+{
+    return Object::sendMessage<Error*>(this, _NS_PRIVATE_SEL(initWithDomain_code_userInfo_), domain, code, pDictionary);
+}
+
+_NS_INLINE NS::Integer NS::Error::code() const
+{
+    return Object::sendMessage<Integer>(this, _NS_PRIVATE_SEL(code));
+}
+
+_NS_INLINE NS::ErrorDomain NS::Error::domain() const
+{
+    return Object::sendMessage<ErrorDomain>(this, _NS_PRIVATE_SEL(domain));
+}
+
+_NS_INLINE NS::Dictionary* NS::Error::userInfo() const
+{
+    return Object::sendMessage<Dictionary*>(this, _NS_PRIVATE_SEL(userInfo));
+}
+
+_NS_INLINE NS::String* NS::Error::localizedDescription() const
+{
+    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(localizedDescription));
+}
+
+_NS_INLINE NS::Array* NS::Error::localizedRecoveryOptions() const
+{
+    return Object::sendMessage<Array*>(this, _NS_PRIVATE_SEL(localizedRecoveryOptions));
+}
+
+_NS_INLINE NS::String* NS::Error::localizedRecoverySuggestion() const
+{
+    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(localizedRecoverySuggestion));
+}
+
+_NS_INLINE NS::String* NS::Error::localizedFailureReason() const
+{
+    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(localizedFailureReason));
+}
+
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace NS
+{
+namespace Private
+{
+    class InternTable
+    {
+    public:
+        static InternTable& shared();
+
+        String*             intern(std::string_view string);
+
+    private:
+        std::mutex                                    m_mutex;
+        std::deque<std::string>                       m_storage;
+        std::unordered_map<std::string_view, String*> m_strings;
+    };
+} // Private
+
+/**
+ * Return the process-wide String for a UTF-8 label, creating it on first use.
+ * The first call for a given label copies the bytes once into storage that lives as long as the process, and wraps
+ * them in a String with initWithBytesNoCopy. Every later call returns the same object without allocating or
+ * autoreleasing. The returned String is never released, so do not retain or release it.
+ * For string literals, MTLSTR() is cheaper still: it makes a constant string at compile time.
+ */
+String* InternString(const char* pString, UInteger length);
+String* InternString(const char* pString);
+}
+
+_NS_INLINE NS::Private::InternTable& NS::Private::InternTable::shared()
+{
+    // Never destroyed, so labels stay valid for code that still uses them while other static objects are destroyed.
+    static InternTable* pTable = new InternTable;
+
+    return *pTable;
+}
+
+_NS_INLINE NS::String* NS::Private::InternTable::intern(std::string_view string)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_strings.find(string);
+    if (it != m_strings.end())
+    {
+        return it->second;
+    }
+
+    // Deque elements never move, so the stored bytes stay valid for the no-copy String and the map key.
+    const std::string& stored = m_storage.emplace_back(string);
+    String* pString = String::alloc()->init(const_cast<char*>(stored.data()), stored.size(), UTF8StringEncoding, false);
+
+    m_strings.emplace(std::string_view(stored), pString);
+
+    return pString;
+}
+
+_NS_INLINE NS::String* NS::InternString(const char* pString, UInteger length)
+{
+    return Private::InternTable::shared().intern(std::string_view(pString, length));
+}
+
+_NS_INLINE NS::String* NS::InternString(const char* pString)
+{
+    return Private::InternTable::shared().intern(std::string_view(pString, std::strlen(pString)));
+}
+
+#pragma once
+
+#pragma once
+
+namespace NS
+{
+template <class _Class>
+class SharedPtr
+{
+public:
+    /**
+     * Create a new null pointer.
+     */
+    SharedPtr();
+
+    /**
+     * Destroy this SharedPtr, decreasing the reference count.
+     */
+    ~SharedPtr();
+
+    /**
+     * SharedPtr copy constructor.
+     */
+    SharedPtr(const SharedPtr<_Class>& other) noexcept;
+
+    /**
+     * Construction from another pointee type.
+     */
+    template <class _OtherClass>
+    SharedPtr(const SharedPtr<_OtherClass>& other, typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>> * = nullptr) noexcept;
+
+    /**
+     * SharedPtr move constructor.
+     */
+    SharedPtr(SharedPtr<_Class>&& other) noexcept;
+
+    /**
+     * Move from another pointee type.
+     */
+    template <class _OtherClass>
+    SharedPtr(SharedPtr<_OtherClass>&& other, typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>> * = nullptr) noexcept;
+
+    /**
+     * Copy assignment operator.
+     * Copying increases reference count. Only releases previous pointee if objects are different.
+     */
+    SharedPtr& operator=(const SharedPtr<_Class>& other);
+
+    /**
+     * Copy-assignment from different pointee.
+     * Copying increases reference count. Only releases previous pointee if objects are different.
+     */
+    template <class _OtherClass>
+    typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>, SharedPtr &>
+    operator=(const SharedPtr<_OtherClass>& other);
+
+    /**
+     * Move assignment operator.
+     * Move without affecting reference counts, unless pointees are equal. Moved-from object is reset to nullptr.
+     */
+    SharedPtr& operator=(SharedPtr<_Class>&& other);
+
+    /**
+     * Move-asignment from different pointee.
+     * Move without affecting reference counts, unless pointees are equal. Moved-from object is reset to nullptr.
+     */
+    template <class _OtherClass>
+    typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>, SharedPtr &>
+    operator=(SharedPtr<_OtherClass>&& other);
+
+    /**
+     * Access raw pointee.
+     * @warning Avoid wrapping the returned value again, as it may lead double frees unless this object becomes detached.
+     */
+    _Class* get() const;
+
+    /**
+     * Call operations directly on the pointee.
+     */
+    _Class* operator->() const;
+
+    /**
+     * Implicit cast to bool.
+     */
+    explicit operator bool() const;
+
+    /**
+     * Reset this SharedPtr to null, decreasing the reference count.
+     */
+    void reset();
+
+    /**
+     * Detach the SharedPtr from the pointee, without decreasing the reference count.
+     */
+    void detach();
+
+    template <class _OtherClass>
+    friend SharedPtr<_OtherClass> RetainPtr(_OtherClass* ptr);
+
+    template <class _OtherClass>
+    friend SharedPtr<_OtherClass> TransferPtr(_OtherClass* ptr);
+
+private:
+    _Class* m_pObject;
+};
+
+/**
+ * Create a SharedPtr by retaining an existing raw pointer.
+ * Increases the reference count of the passed-in object.
+ * If the passed-in object was in an AutoreleasePool, it will be removed from it.
+ */
+template <class _Class>
+_NS_INLINE NS::SharedPtr<_Class> RetainPtr(_Class* pObject)
+{
+    NS::SharedPtr<_Class> ret;
+    ret.m_pObject = pObject->retain();
+    return ret;
+}
+
+/*
+ * Create a SharedPtr by transfering the ownership of an existing raw pointer to SharedPtr.
+ * Does not increase the reference count of the passed-in pointer, it is assumed to be >= 1.
+ * This method does not remove objects from an AutoreleasePool.
+*/
+template <class _Class>
+_NS_INLINE NS::SharedPtr<_Class> TransferPtr(_Class* pObject)
+{
+    NS::SharedPtr<_Class> ret;
+    ret.m_pObject = pObject;
+    return ret;
+}
+
+}
+
+template <class _Class>
+_NS_INLINE NS::SharedPtr<_Class>::SharedPtr()
+    : m_pObject(nullptr)
 {
-    return Object::sendMessage<Dictionary*>(this, _NS_PRIVATE_SEL(infoDictionary));
 }
 
-_NS_INLINE NS::Dictionary* NS::Bundle::localizedInfoDictionary() const
+template <class _Class>
+_NS_INLINE NS::SharedPtr<_Class>::~SharedPtr()
 {
-    return Object::sendMessage<Dictionary*>(this, _NS_PRIVATE_SEL(localizedInfoDictionary));
+    if (m_pObject)
+    {
+        m_pObject->release();
+    }
 }
 
-_NS_INLINE NS::Object* NS::Bundle::objectForInfoDictionaryKey(const String* pKey)
+template <class _Class>
+_NS_INLINE NS::SharedPtr<_Class>::SharedPtr(const NS::SharedPtr<_Class>& other) noexcept
+    : m_pObject(other.m_pObject->retain())
 {
-    return Object::sendMessage<Object*>(this, _NS_PRIVATE_SEL(objectForInfoDictionaryKey_), pKey);
 }
 
-_NS_INLINE NS::String* NS::Bundle::localizedString(const String* pKey, const String* pValue /* = nullptr */, const String* pTableName /* = nullptr */) const
+template <class _Class>
+template <class _OtherClass>
+_NS_INLINE NS::SharedPtr<_Class>::SharedPtr(const NS::SharedPtr<_OtherClass>& other, typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>> *) noexcept
+    : m_pObject(reinterpret_cast<_Class*>(other.get()->retain()))
 {
-    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(localizedStringForKey_value_table_), pKey, pValue, pTableName);
+}
+
+template <class _Class>
+_NS_INLINE NS::SharedPtr<_Class>::SharedPtr(NS::SharedPtr<_Class>&& other) noexcept
+    : m_pObject(other.m_pObject)
+{
+    other.m_pObject = nullptr;
+}
+
+template <class _Class>
+template <class _OtherClass>
+_NS_INLINE NS::SharedPtr<_Class>::SharedPtr(NS::SharedPtr<_OtherClass>&& other, typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>> *) noexcept
+    : m_pObject(reinterpret_cast<_Class*>(other.get()))
+{
+    other.detach();
+}
+
+template <class _Class>
+_NS_INLINE _Class* NS::SharedPtr<_Class>::get() const
+{
+    return m_pObject;
+}
+
+template <class _Class>
+_NS_INLINE _Class* NS::SharedPtr<_Class>::operator->() const
+{
+    return m_pObject;
+}
+
+template <class _Class>
+_NS_INLINE NS::SharedPtr<_Class>::operator bool() const
+{
+    return nullptr != m_pObject;
+}
+
+template <class _Class>
+_NS_INLINE void NS::SharedPtr<_Class>::reset()
+{
+    m_pObject->release();
+    m_pObject = nullptr;
+}
+
+template <class _Class>
+_NS_INLINE void NS::SharedPtr<_Class>::detach()
+{
+    m_pObject = nullptr;
+}
+
+template <class _Class>
+_NS_INLINE NS::SharedPtr<_Class>& NS::SharedPtr<_Class>::operator=(const SharedPtr<_Class>& other)
+{
+    if (m_pObject != other.m_pObject)
+    {
+        if (m_pObject)
+        {
+            m_pObject->release();
+        }
+        m_pObject = other.m_pObject->retain();
+    }
+    return *this;
+}
+
+template <class _Class>
+template <class _OtherClass>
+typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>, NS::SharedPtr<_Class> &>
+_NS_INLINE NS::SharedPtr<_Class>::operator=(const SharedPtr<_OtherClass>& other)
+{
+    if (m_pObject != other.get())
+    {
+        if (m_pObject)
+        {
+            m_pObject->release();
+        }
+        m_pObject = reinterpret_cast<_Class*>(other.get()->retain());
+    }
+    return *this;
+}
+
+template <class _Class>
+_NS_INLINE NS::SharedPtr<_Class>& NS::SharedPtr<_Class>::operator=(SharedPtr<_Class>&& other)
+{
+    if (m_pObject != other.m_pObject)
+    {
+        if (m_pObject)
+        {
+            m_pObject->release();
+        }
+        m_pObject = other.m_pObject;
+    }
+    else
+    {
+        m_pObject = other.m_pObject;
+        other.m_pObject->release();
+    }
+    other.m_pObject = nullptr;
+    return *this;
+}
+
+template <class _Class>
+template <class _OtherClass>
+typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>, NS::SharedPtr<_Class> &>
+_NS_INLINE NS::SharedPtr<_Class>::operator=(SharedPtr<_OtherClass>&& other)
+{
+    if (m_pObject != other.get())
+    {
+        if (m_pObject)
+        {
+            m_pObject->release();
+        }
+        m_pObject = reinterpret_cast<_Class*>(other.get());
+        other.detach();
+    }
+    else
+    {
+        m_pObject = other.get();
+        other.reset();
+    }
+    return *this;
+}
+
+template <class _ClassLhs, class _ClassRhs>
+_NS_INLINE bool operator==(const NS::SharedPtr<_ClassLhs>& lhs, const NS::SharedPtr<_ClassRhs>& rhs)
+{
+    return lhs.get() == rhs.get();
+}
+
+template <class _ClassLhs, class _ClassRhs>
+_NS_INLINE bool operator!=(const NS::SharedPtr<_ClassLhs>& lhs, const NS::SharedPtr<_ClassRhs>& rhs)
+{
+    return lhs.get() != rhs.get();
 }
 
 namespace NS
 {
-class Data : public Copying<Data>
+namespace Private
+{
+    struct LocalPtrBlock
+    {
+        Object*  pObject;
+        UInteger count;
+    };
+} // Private
+
+/**
+ * Single-threaded shared ownership of an Objective-C object.
+ * All LocalPtr copies of one object share a plain, non-atomic C++ reference count. The object itself is retained
+ * once when ownership enters the LocalPtr family and released once when the last copy goes away, so copying,
+ * moving and destroying copies never sends a message.
+ * @warning A LocalPtr and its copies must stay on one thread. Use share() to hand the object to another thread.
+ */
+template <class _Class>
+class LocalPtr
 {
 public:
-    void*    mutableBytes() const;
-    UInteger length() const;
+    /**
+     * Create a new null pointer.
+     */
+    LocalPtr();
+
+    /**
+     * Destroy this LocalPtr. Releases the pointee if this was the last copy.
+     */
+    ~LocalPtr();
+
+    /**
+     * LocalPtr copy constructor. Increments the local count only.
+     */
+    LocalPtr(const LocalPtr<_Class>& other) noexcept;
+
+    /**
+     * Construction from another pointee type. Shares the other pointer's count.
+     */
+    template <class _OtherClass>
+    LocalPtr(const LocalPtr<_OtherClass>& other, typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>> * = nullptr) noexcept;
+
+    /**
+     * LocalPtr move constructor. Moved-from object is reset to nullptr.
+     */
+    LocalPtr(LocalPtr<_Class>&& other) noexcept;
+
+    /**
+     * Move from another pointee type. Moved-from object is reset to nullptr.
+     */
+    template <class _OtherClass>
+    LocalPtr(LocalPtr<_OtherClass>&& other, typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>> * = nullptr) noexcept;
+
+    /**
+     * Copy assignment operator. Touches local counts only, unless the previous pointee loses its last copy.
+     */
+    LocalPtr& operator=(const LocalPtr<_Class>& other) noexcept;
+
+    /**
+     * Copy-assignment from different pointee.
+     */
+    template <class _OtherClass>
+    typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>, LocalPtr &>
+    operator=(const LocalPtr<_OtherClass>& other) noexcept;
+
+    /**
+     * Move assignment operator. Moved-from object is reset to nullptr.
+     */
+    LocalPtr& operator=(LocalPtr<_Class>&& other) noexcept;
+
+    /**
+     * Move-assignment from different pointee. Moved-from object is reset to nullptr.
+     */
+    template <class _OtherClass>
+    typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>, LocalPtr &>
+    operator=(LocalPtr<_OtherClass>&& other) noexcept;
+
+    /**
+     * Access raw pointee.
+     */
+    _Class* get() const;
+
+    /**
+     * Call operations directly on the pointee.
+     */
+    _Class* operator->() const;
+
+    /**
+     * Implicit cast to bool.
+     */
+    explicit operator bool() const;
+
+    /**
+     * Reset this LocalPtr to null. Releases the pointee if this was the last copy.
+     */
+    void reset();
+
+    /**
+     * Number of LocalPtr copies sharing the pointee.
+     */
+    UInteger useCount() const;
+
+    /**
+     * Create a SharedPtr to the pointee, retaining it. Use this when ownership leaves the current thread or scope.
+     */
+    SharedPtr<_Class> share() const;
+
+    template <class _OtherClass>
+    friend class LocalPtr;
+
+    template <class _OtherClass>
+    friend LocalPtr<_OtherClass> RetainLocalPtr(_OtherClass* ptr);
+
+    template <class _OtherClass>
+    friend LocalPtr<_OtherClass> TransferLocalPtr(_OtherClass* ptr);
+
+private:
+    Private::LocalPtrBlock* m_pBlock;
 };
+
+/**
+ * Create a LocalPtr by retaining an existing raw pointer.
+ * Increases the reference count of the passed-in object once, regardless of how many copies are made later.
+ */
+template <class _Class>
+_NS_INLINE NS::LocalPtr<_Class> RetainLocalPtr(_Class* pObject)
+{
+    NS::LocalPtr<_Class> ret;
+    if (pObject)
+    {
+        ret.m_pBlock = new Private::LocalPtrBlock { reinterpret_cast<Object*>(pObject->retain()), 1 };
+    }
+    return ret;
+}
+
+/*
+ * Create a LocalPtr by transfering the ownership of an existing raw pointer to LocalPtr.
+ * Does not increase the reference count of the passed-in pointer, it is assumed to be >= 1.
+ */
+template <class _Class>
+_NS_INLINE NS::LocalPtr<_Class> TransferLocalPtr(_Class* pObject)
+{
+    NS::LocalPtr<_Class> ret;
+    if (pObject)
+    {
+        ret.m_pBlock = new Private::LocalPtrBlock { reinterpret_cast<Object*>(pObject), 1 };
+    }
+    return ret;
 }
 
-_NS_INLINE void* NS::Data::mutableBytes() const
-{
-    return Object::sendMessage<void*>(this, _NS_PRIVATE_SEL(mutableBytes));
 }
 
-_NS_INLINE NS::UInteger NS::Data::length() const
+template <class _Class>
+_NS_INLINE NS::LocalPtr<_Class>::LocalPtr()
+    : m_pBlock(nullptr)
 {
-    return Object::sendMessage<UInteger>(this, _NS_PRIVATE_SEL(length));
 }
 
-namespace NS
+template <class _Class>
+_NS_INLINE NS::LocalPtr<_Class>::~LocalPtr()
 {
+    reset();
+}
 
-using TimeInterval = double;
-
-class Date : public Copying<Date>
+template <class _Class>
+_NS_INLINE NS::LocalPtr<_Class>::LocalPtr(const NS::LocalPtr<_Class>& other) noexcept
+    : m_pBlock(other.m_pBlock)
 {
-public:
-    static Date* dateWithTimeIntervalSinceNow(TimeInterval secs);
-};
-
-} // NS
+    if (m_pBlock)
+    {
+        ++m_pBlock->count;
+    }
+}
 
-_NS_INLINE NS::Date* NS::Date::dateWithTimeIntervalSinceNow(NS::TimeInterval secs)
+template <class _Class>
+template <class _OtherClass>
+_NS_INLINE NS::LocalPtr<_Class>::LocalPtr(const NS::LocalPtr<_OtherClass>& other, typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>> *) noexcept
+    : m_pBlock(other.m_pBlock)
 {
-    return NS::Object::sendMessage<NS::Date*>(_NS_PRIVATE_CLS(NSDate), _NS_PRIVATE_SEL(dateWithTimeIntervalSinceNow_), secs);
+    if (m_pBlock)
+    {
+        ++m_pBlock->count;
+    }
 }
 
-//-------------------------------------------------------------------------------------------------------------------------------------------------------------
-
-namespace NS
+template <class _Class>
+_NS_INLINE NS::LocalPtr<_Class>::LocalPtr(NS::LocalPtr<_Class>&& other) noexcept
+    : m_pBlock(other.m_pBlock)
 {
-using ErrorDomain = class String*;
-
-_NS_CONST(ErrorDomain, CocoaErrorDomain);
-_NS_CONST(ErrorDomain, POSIXErrorDomain);
-_NS_CONST(ErrorDomain, OSStatusErrorDomain);
-_NS_CONST(ErrorDomain, MachErrorDomain);
-
-using ErrorUserInfoKey = class String*;
-
-_NS_CONST(ErrorUserInfoKey, UnderlyingErrorKey);
-_NS_CONST(ErrorUserInfoKey, LocalizedDescriptionKey);
-_NS_CONST(ErrorUserInfoKey, LocalizedFailureReasonErrorKey);
-_NS_CONST(ErrorUserInfoKey, LocalizedRecoverySuggestionErrorKey);
-_NS_CONST(ErrorUserInfoKey, LocalizedRecoveryOptionsErrorKey);
-_NS_CONST(ErrorUserInfoKey, RecoveryAttempterErrorKey);
-_NS_CONST(ErrorUserInfoKey, HelpAnchorErrorKey);
-_NS_CONST(ErrorUserInfoKey, DebugDescriptionErrorKey);
-_NS_CONST(ErrorUserInfoKey, LocalizedFailureErrorKey);
-_NS_CONST(ErrorUserInfoKey, StringEncodingErrorKey);
-_NS_CONST(ErrorUserInfoKey, URLErrorKey);
-_NS_CONST(ErrorUserInfoKey, FilePathErrorKey);
+    other.m_pBlock = nullptr;
+}
 
-class Error : public Copying<Error>
+template <class _Class>
+template <class _OtherClass>
+_NS_INLINE NS::LocalPtr<_Class>::LocalPtr(NS::LocalPtr<_OtherClass>&& other, typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>> *) noexcept
+    : m_pBlock(other.m_pBlock)
 {
-public:
-    static Error*     error(ErrorDomain domain, Integer code, class Dictionary* pDictionary);
-
-    static Error*     alloc();
-    Error*            init();
-    Error*            init(ErrorDomain domain, Integer code, class Dictionary* pDictionary);
-
-    Integer           code() const;
-    ErrorDomain       domain() const;
-    class Dictionary* userInfo() const;
-
-    class String*     localizedDescription() const;
-    class Array*      localizedRecoveryOptions() const;
-    class String*     localizedRecoverySuggestion() const;
-    class String*     localizedFailureReason() const;
-};
+    other.m_pBlock = nullptr;
 }
 
-_NS_PRIVATE_DEF_CONST(NS::ErrorDomain, CocoaErrorDomain);
-_NS_PRIVATE_DEF_CONST(NS::ErrorDomain, POSIXErrorDomain);
-_NS_PRIVATE_DEF_CONST(NS::ErrorDomain, OSStatusErrorDomain);
-_NS_PRIVATE_DEF_CONST(NS::ErrorDomain, MachErrorDomain);
-
-_NS_PRIVATE_DEF_CONST(NS::ErrorUserInfoKey, UnderlyingErrorKey);
-_NS_PRIVATE_DEF_CONST(NS::ErrorUserInfoKey, LocalizedDescriptionKey);
-_NS_PRIVATE_DEF_CONST(NS::ErrorUserInfoKey, LocalizedFailureReasonErrorKey);
-_NS_PRIVATE_DEF_CONST(NS::ErrorUserInfoKey, LocalizedRecoverySuggestionErrorKey);
-_NS_PRIVATE_DEF_CONST(NS::ErrorUserInfoKey, LocalizedRecoveryOptionsErrorKey);
-_NS_PRIVATE_DEF_CONST(NS::ErrorUserInfoKey, RecoveryAttempterErrorKey);
-_NS_PRIVATE_DEF_CONST(NS::ErrorUserInfoKey, HelpAnchorErrorKey);
-_NS_PRIVATE_DEF_CONST(NS::ErrorUserInfoKey, DebugDescriptionErrorKey);
-_NS_PRIVATE_DEF_CONST(NS::ErrorUserInfoKey, LocalizedFailureErrorKey);
-_NS_PRIVATE_DEF_CONST(NS::ErrorUserInfoKey, StringEncodingErrorKey);
-_NS_PRIVATE_DEF_CONST(NS::ErrorUserInfoKey, URLErrorKey);
-_NS_PRIVATE_DEF_CONST(NS::ErrorUserInfoKey, FilePathErrorKey);
+template <class _Class>
+_NS_INLINE NS::LocalPtr<_Class>& NS::LocalPtr<_Class>::operator=(const LocalPtr<_Class>& other) noexcept
+{
+    if (m_pBlock != other.m_pBlock)
+    {
+        if (other.m_pBlock)
+        {
+            ++other.m_pBlock->count;
+        }
+        reset();
+        m_pBlock = other.m_pBlock;
+    }
+    return *this;
+}
 
-_NS_INLINE NS::Error* NS::Error::error(ErrorDomain domain, Integer code, class Dictionary* pDictionary)
+template <class _Class>
+template <class _OtherClass>
+typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>, NS::LocalPtr<_Class> &>
+_NS_INLINE NS::LocalPtr<_Class>::operator=(const LocalPtr<_OtherClass>& other) noexcept
 {
-    return Object::sendMessage<Error*>(_NS_PRIVATE_CLS(NSError), _NS_PRIVATE_SEL(errorWithDomain_code_userInfo_), domain, code, pDictionary);
+    if (m_pBlock != other.m_pBlock)
+    {
+        if (other.m_pBlock)
+        {
+            ++other.m_pBlock->count;
+        }
+        reset();
+        m_pBlock = other.m_pBlock;
+    }
+    return *this;
 }
 
-_NS_INLINE NS::Error* NS::Error::alloc()
+template <class _Class>
+_NS_INLINE NS::LocalPtr<_Class>& NS::LocalPtr<_Class>::operator=(LocalPtr<_Class>&& other) noexcept
 {
-    return Object::alloc<Error>(_NS_PRIVATE_CLS(NSError));
+    if (this != &other)
+    {
+        reset();
+        m_pBlock = other.m_pBlock;
+        other.m_pBlock = nullptr;
+    }
+    return *this;
 }
 
-_NS_INLINE NS::Error* NS::Error::init()
+template <class _Class>
+template <class _OtherClass>
+typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>, NS::LocalPtr<_Class> &>
+_NS_INLINE NS::LocalPtr<_Class>::operator=(LocalPtr<_OtherClass>&& other) noexcept
 {
-    return Object::init<Error>();
+    // Distinct types, so other can't be this object; a shared block just gives up other's count.
+    reset();
+    m_pBlock = other.m_pBlock;
+    other.m_pBlock = nullptr;
+    return *this;
 }
 
-_NS_INLINE NS::Error* NS::Error::init(ErrorDomain domain, Integer code, class Dictionary* pDictionary)
+template <class _Class>
+_NS_INLINE _Class* NS::LocalPtr<_Class>::get() const
 {
-    return Object::sendMessage<Error*>(this, _NS_PRIVATE_SEL(initWithDomain_code_userInfo_), domain, code, pDictionary);
+    return m_pBlock ? reinterpret_cast<_Class*>(m_pBlock->pObject) : nullptr;
 }
 
-_NS_INLINE NS::Integer NS::Error::code() const
+template <class _Class>
+_NS_INLINE _Class* NS::LocalPtr<_Class>::operator->() const
 {
-    return Object::sendMessage<Integer>(this, _NS_PRIVATE_SEL(code));
+    return get();
 }
 
-_NS_INLINE NS::ErrorDomain NS::Error::domain() const
+template <class _Class>
+_NS_INLINE NS::LocalPtr<_Class>::operator bool() const
 {
-    return Object::sendMessage<ErrorDomain>(this, _NS_PRIVATE_SEL(domain));
+    return nullptr != m_pBlock;
 }
 
-_NS_INLINE NS::Dictionary* NS::Error::userInfo() const
+template <class _Class>
+_NS_INLINE void NS::LocalPtr<_Class>::reset()
 {
-    return Object::sendMessage<Dictionary*>(this, _NS_PRIVATE_SEL(userInfo));
+    if (m_pBlock && (0 == --m_pBlock->count))
+    {
+        m_pBlock->pObject->release();
+        delete m_pBlock;
+    }
+    m_pBlock = nullptr;
 }
 
-_NS_INLINE NS::String* NS::Error::localizedDescription() const
+template <class _Class>
+_NS_INLINE NS::UInteger NS::LocalPtr<_Class>::useCount() const
 {
-    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(localizedDescription));
+    return m_pBlock ? m_pBlock->count : 0;
 }
 
-_NS_INLINE NS::Array* NS::Error::localizedRecoveryOptions() const
+template <class _Class>
+_NS_INLINE NS::SharedPtr<_Class> NS::LocalPtr<_Class>::share() const
 {
-    return Object::sendMessage<Array*>(this, _NS_PRIVATE_SEL(localizedRecoveryOptions));
+    return m_pBlock ? NS::RetainPtr(get()) : NS::SharedPtr<_Class>();
 }
 
-_NS_INLINE NS::String* NS::Error::localizedRecoverySuggestion() const
+template <class _ClassLhs, class _ClassRhs>
+_NS_INLINE bool operator==(const NS::LocalPtr<_ClassLhs>& lhs, const NS::LocalPtr<_ClassRhs>& rhs)
 {
-    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(localizedRecoverySuggestion));
+    return lhs.get() == rhs.get();
 }
 
-_NS_INLINE NS::String* NS::Error::localizedFailureReason() const
+template <class _ClassLhs, class _ClassRhs>
+_NS_INLINE bool operator!=(const NS::LocalPtr<_ClassLhs>& lhs, const NS::LocalPtr<_ClassRhs>& rhs)
 {
-    return Object::sendMessage<String*>(this, _NS_PRIVATE_SEL(localizedFailureReason));
+    return lhs.get() != rhs.get();
 }
 
 namespace NS
@@ -2386,126 +3810,47 @@ _NS_INLINE bool NS::ProcessInfo::isMacCatalystApp() const
     return Object::sendMessageSafe<bool>(this, _NS_PRIVATE_SEL(isMacCatalystApp));
 }
 
-/*****Immutable Set*******/
-
-namespace NS
-{
-    class Set : public NS::Copying <Set>
-    {
-        public:
-            UInteger count() const;
-            Enumerator<Object>* objectEnumerator() const;
-
-            static Set* alloc();
-
-            Set* init();
-            Set* init(const Object* const* pObjects, UInteger count);
-            Set* init(const class Coder* pCoder);
-
-    };
-}
-
-_NS_INLINE NS::UInteger NS::Set::count() const
-{
-    return NS::Object::sendMessage<NS::UInteger>(this, _NS_PRIVATE_SEL(count));
-}
-
-_NS_INLINE NS::Enumerator<NS::Object>* NS::Set::objectEnumerator() const
-{
-    return NS::Object::sendMessage<Enumerator<NS::Object>*>(this, _NS_PRIVATE_SEL(objectEnumerator));
-}
-
-_NS_INLINE NS::Set* NS::Set::alloc()
-{
-    return NS::Object::alloc<Set>(_NS_PRIVATE_CLS(NSSet));
-}
-
-_NS_INLINE NS::Set* NS::Set::init()
-{
-    return NS::Object::init<Set>();
-}
-
-_NS_INLINE NS::Set* NS::Set::init(const Object* const* pObjects, NS::UInteger count)
-{
-    return NS::Object::sendMessage<Set*>(this, _NS_PRIVATE_SEL(initWithObjects_count_), pObjects, count);
-}
-
-_NS_INLINE NS::Set* NS::Set::init(const class Coder* pCoder)
-{
-    return Object::sendMessage<Set*>(this, _NS_PRIVATE_SEL(initWithCoder_), pCoder);
-}
-
 #pragma once
 
 namespace NS
 {
+/**
+ * Borrowed, non-owning view of an object owned elsewhere.
+ * A Ref never touches the reference count. It is as cheap to copy as a raw pointer and only documents that the
+ * holder does not own the pointee. The owner must outlive every Ref made from it.
+ */
 template <class _Class>
-class SharedPtr
+class Ref
 {
 public:
     /**
-     * Create a new null pointer.
-     */
-    SharedPtr();
-
-    /**
-     * Destroy this SharedPtr, decreasing the reference count.
-     */
-    ~SharedPtr();
-
-    /**
-     * SharedPtr copy constructor.
-     */
-    SharedPtr(const SharedPtr<_Class>& other) noexcept;
-
-    /**
-     * Construction from another pointee type.
-     */
-    template <class _OtherClass>
-    SharedPtr(const SharedPtr<_OtherClass>& other, typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>> * = nullptr) noexcept;
-
-    /**
-     * SharedPtr move constructor.
-     */
-    SharedPtr(SharedPtr<_Class>&& other) noexcept;
-
-    /**
-     * Move from another pointee type.
+     * Create a null reference.
      */
-    template <class _OtherClass>
-    SharedPtr(SharedPtr<_OtherClass>&& other, typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>> * = nullptr) noexcept;
+    Ref();
 
     /**
-     * Copy assignment operator.
-     * Copying increases reference count. Only releases previous pointee if objects are different.
+     * Borrow a raw pointer.
      */
-    SharedPtr& operator=(const SharedPtr<_Class>& other);
+    Ref(_Class* pObject);
 
     /**
-     * Copy-assignment from different pointee.
-     * Copying increases reference count. Only releases previous pointee if objects are different.
+     * Borrow the pointee of a SharedPtr.
      */
-    template <class _OtherClass>
-    typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>, SharedPtr &>
-    operator=(const SharedPtr<_OtherClass>& other);
+    Ref(const SharedPtr<_Class>& owner);
 
     /**
-     * Move assignment operator.
-     * Move without affecting reference counts, unless pointees are equal. Moved-from object is reset to nullptr.
+     * Borrow the pointee of a LocalPtr.
      */
-    SharedPtr& operator=(SharedPtr<_Class>&& other);
+    Ref(const LocalPtr<_Class>& owner);
 
     /**
-     * Move-asignment from different pointee.
-     * Move without affecting reference counts, unless pointees are equal. Moved-from object is reset to nullptr.
+     * Borrowing from a temporary owner would dangle as soon as the full expression ends.
      */
-    template <class _OtherClass>
-    typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>, SharedPtr &>
-    operator=(SharedPtr<_OtherClass>&& other);
+    Ref(SharedPtr<_Class>&& owner) = delete;
+    Ref(LocalPtr<_Class>&& owner) = delete;
 
     /**
      * Access raw pointee.
-     * @warning Avoid wrapping the returned value again, as it may lead double frees unless this object becomes detached.
      */
     _Class* get() const;
 
@@ -2519,210 +3864,155 @@ public:
      */
     explicit operator bool() const;
 
-    /**
-     * Reset this SharedPtr to null, decreasing the reference count.
-     */
-    void reset();
-
-    /**
-     * Detach the SharedPtr from the pointee, without decreasing the reference count.
-     */
-    void detach();
-
-    template <class _OtherClass>
-    friend SharedPtr<_OtherClass> RetainPtr(_OtherClass* ptr);
+    /**
+     * Take shared ownership of the pointee, increasing its reference count.
+     */
+    SharedPtr<_Class> retain() const;
 
-    template <class _OtherClass>
-    friend SharedPtr<_OtherClass> TransferPtr(_OtherClass* ptr);
+    /**
+     * Take single-threaded ownership of the pointee, increasing its reference count once.
+     */
+    LocalPtr<_Class> retainLocal() const;
 
 private:
     _Class* m_pObject;
 };
+}
 
-/**
- * Create a SharedPtr by retaining an existing raw pointer.
- * Increases the reference count of the passed-in object.
- * If the passed-in object was in an AutoreleasePool, it will be removed from it.
- */
 template <class _Class>
-_NS_INLINE NS::SharedPtr<_Class> RetainPtr(_Class* pObject)
+_NS_INLINE NS::Ref<_Class>::Ref()
+    : m_pObject(nullptr)
 {
-    NS::SharedPtr<_Class> ret;
-    ret.m_pObject = pObject->retain();
-    return ret;
 }
 
-/*
- * Create a SharedPtr by transfering the ownership of an existing raw pointer to SharedPtr.
- * Does not increase the reference count of the passed-in pointer, it is assumed to be >= 1.
- * This method does not remove objects from an AutoreleasePool.
-*/
 template <class _Class>
-_NS_INLINE NS::SharedPtr<_Class> TransferPtr(_Class* pObject)
+_NS_INLINE NS::Ref<_Class>::Ref(_Class* pObject)
+    : m_pObject(pObject)
 {
-    NS::SharedPtr<_Class> ret;
-    ret.m_pObject = pObject;
-    return ret;
 }
 
+template <class _Class>
+_NS_INLINE NS::Ref<_Class>::Ref(const NS::SharedPtr<_Class>& owner)
+    : m_pObject(owner.get())
+{
 }
 
 template <class _Class>
-_NS_INLINE NS::SharedPtr<_Class>::SharedPtr()
-    : m_pObject(nullptr)
+_NS_INLINE NS::Ref<_Class>::Ref(const NS::LocalPtr<_Class>& owner)
+    : m_pObject(owner.get())
 {
 }
 
 template <class _Class>
-_NS_INLINE NS::SharedPtr<_Class>::~SharedPtr()
+_NS_INLINE _Class* NS::Ref<_Class>::get() const
 {
-    if (m_pObject)
-    {
-        m_pObject->release();
-    }
+    return m_pObject;
 }
 
 template <class _Class>
-_NS_INLINE NS::SharedPtr<_Class>::SharedPtr(const NS::SharedPtr<_Class>& other) noexcept
-    : m_pObject(other.m_pObject->retain())
+_NS_INLINE _Class* NS::Ref<_Class>::operator->() const
 {
+    return m_pObject;
 }
 
 template <class _Class>
-template <class _OtherClass>
-_NS_INLINE NS::SharedPtr<_Class>::SharedPtr(const NS::SharedPtr<_OtherClass>& other, typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>> *) noexcept
-    : m_pObject(reinterpret_cast<_Class*>(other.get()->retain()))
+_NS_INLINE NS::Ref<_Class>::operator bool() const
 {
+    return nullptr != m_pObject;
 }
 
 template <class _Class>
-_NS_INLINE NS::SharedPtr<_Class>::SharedPtr(NS::SharedPtr<_Class>&& other) noexcept
-    : m_pObject(other.m_pObject)
+_NS_INLINE NS::SharedPtr<_Class> NS::Ref<_Class>::retain() const
 {
-    other.m_pObject = nullptr;
+    return m_pObject ? NS::RetainPtr(m_pObject) : NS::SharedPtr<_Class>();
 }
 
 template <class _Class>
-template <class _OtherClass>
-_NS_INLINE NS::SharedPtr<_Class>::SharedPtr(NS::SharedPtr<_OtherClass>&& other, typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>> *) noexcept
-    : m_pObject(reinterpret_cast<_Class*>(other.get()))
+_NS_INLINE NS::LocalPtr<_Class> NS::Ref<_Class>::retainLocal() const
 {
-    other.detach();
+    return NS::RetainLocalPtr(m_pObject);
 }
 
-template <class _Class>
-_NS_INLINE _Class* NS::SharedPtr<_Class>::get() const
+template <class _ClassLhs, class _ClassRhs>
+_NS_INLINE bool operator==(const NS::Ref<_ClassLhs>& lhs, const NS::Ref<_ClassRhs>& rhs)
 {
-    return m_pObject;
+    return lhs.get() == rhs.get();
 }
 
-template <class _Class>
-_NS_INLINE _Class* NS::SharedPtr<_Class>::operator->() const
+template <class _ClassLhs, class _ClassRhs>
+_NS_INLINE bool operator!=(const NS::Ref<_ClassLhs>& lhs, const NS::Ref<_ClassRhs>& rhs)
 {
-    return m_pObject;
+    return lhs.get() != rhs.get();
 }
 
-template <class _Class>
-_NS_INLINE NS::SharedPtr<_Class>::operator bool() const
+/*****Immutable Set*******/
+
+namespace NS
 {
-    return nullptr != m_pObject;
+    class Set : public NS::Copying <Set>
+    {
+        public:
+            UInteger count() const;
+            Enumerator<Object>* objectEnumerator() const;
+
+            template <class _Object = Object>
+            FastEnumerationRange<_Object> objects() const;
+            FastEnumerationIterator<Object> begin() const;
+            FastEnumerationIterator<Object> end() const;
+
+            static Set* alloc();
+
+            Set* init();
+            Set* init(const Object* const* pObjects, UInteger count);
+            Set* init(const class Coder* pCoder);
+
+    };
 }
 
-template <class _Class>
-_NS_INLINE void NS::SharedPtr<_Class>::reset()
+_NS_INLINE NS::UInteger NS::Set::count() const
 {
-    m_pObject->release();
-    m_pObject = nullptr;
+    return NS::Object::sendMessage<NS::UInteger>(this, _NS_PRIVATE_SEL(count));
 }
 
-template <class _Class>
-_NS_INLINE void NS::SharedPtr<_Class>::detach()
+_NS_INLINE NS::Enumerator<NS::Object>* NS::Set::objectEnumerator() const
 {
-    m_pObject = nullptr;
+    return NS::Object::sendMessage<Enumerator<NS::Object>*>(this, _NS_PRIVATE_SEL(objectEnumerator));
 }
 
-template <class _Class>
-_NS_INLINE NS::SharedPtr<_Class>& NS::SharedPtr<_Class>::operator=(const SharedPtr<_Class>& other)
+_NS_INLINE NS::Set* NS::Set::alloc()
 {
-    if (m_pObject != other.m_pObject)
-    {
-        if (m_pObject)
-        {
-            m_pObject->release();
-        }
-        m_pObject = other.m_pObject->retain();
-    }
-    return *this;
+    return NS::Object::alloc<Set>(_NS_PRIVATE_CLS(NSSet));
 }
 
-template <class _Class>
-template <class _OtherClass>
-typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>, NS::SharedPtr<_Class> &>
-_NS_INLINE NS::SharedPtr<_Class>::operator=(const SharedPtr<_OtherClass>& other)
+_NS_INLINE NS::Set* NS::Set::init()
 {
-    if (m_pObject != other.get())
-    {
-        if (m_pObject)
-        {
-            m_pObject->release();
-        }
-        m_pObject = reinterpret_cast<_Class*>(other.get()->retain());
-    }
-    return *this;
+    return NS::Object::init<Set>();
 }
 
-template <class _Class>
-_NS_INLINE NS::SharedPtr<_Class>& NS::SharedPtr<_Class>::operator=(SharedPtr<_Class>&& other)
+_NS_INLINE NS::Set* NS::Set::init(const Object* const* pObjects, NS::UInteger count)
 {
-    if (m_pObject != other.m_pObject)
-    {
-        if (m_pObject)
-        {
-            m_pObject->release();
-        }
-        m_pObject = other.m_pObject;
-    }
-    else
-    {
-        m_pObject = other.m_pObject;
-        other.m_pObject->release();
-    }
-    other.m_pObject = nullptr;
-    return *this;
+    return NS::Object::sendMessage<Set*>(this, _NS_PRIVATE_SEL(initWithObjects_count_), pObjects, count);
 }
 
-template <class _Class>
-template <class _OtherClass>
-typename std::enable_if_t<std::is_convertible_v<_OtherClass *, _Class *>, NS::SharedPtr<_Class> &>
-_NS_INLINE NS::SharedPtr<_Class>::operator=(SharedPtr<_OtherClass>&& other)
+_NS_INLINE NS::Set* NS::Set::init(const class Coder* pCoder)
 {
-    if (m_pObject != other.get())
-    {
-        if (m_pObject)
-        {
-            m_pObject->release();
-        }
-        m_pObject = reinterpret_cast<_Class*>(other.get());
-        other.detach();
-    }
-    else
-    {
-        m_pObject = other.get();
-        other.reset();
-    }
-    return *this;
+    return Object::sendMessage<Set*>(this, _NS_PRIVATE_SEL(initWithCoder_), pCoder);
 }
 
-template <class _ClassLhs, class _ClassRhs>
-_NS_INLINE bool operator==(const NS::SharedPtr<_ClassLhs>& lhs, const NS::SharedPtr<_ClassRhs>& rhs)
+template <class _Object>
+_NS_INLINE NS::FastEnumerationRange<_Object> NS::Set::objects() const
 {
-    return lhs.get() == rhs.get();
+    return NS::FastEnumerationRange<_Object>(this);
 }
 
-template <class _ClassLhs, class _ClassRhs>
-_NS_INLINE bool operator!=(const NS::SharedPtr<_ClassLhs>& lhs, const NS::SharedPtr<_ClassRhs>& rhs)
+_NS_INLINE NS::FastEnumerationIterator<NS::Object> NS::Set::begin() const
 {
-    return lhs.get() != rhs.get();
+    return NS::FastEnumerationIterator<NS::Object>(this);
+}
+
+_NS_INLINE NS::FastEnumerationIterator<NS::Object> NS::Set::end() const
+{
+    return NS::FastEnumerationIterator<NS::Object>();
 }
 
 namespace NS
@@ -2787,10 +4077,19 @@ _NS_INLINE const char* NS::URL::fileSystemRepresentation() const
 
 #pragma once
 
+#ifdef METALCPP_LAZY_REGISTRATION
+
+#endif // METALCPP_LAZY_REGISTRATION
+
 #include <objc/runtime.h>
 
+#ifdef METALCPP_LAZY_REGISTRATION
+#define _MTL_PRIVATE_CLS(symbol) (Private::Class::s_l##symbol.get())
+#define _MTL_PRIVATE_SEL(accessor) (Private::Selector::s_l##accessor.get())
+#else
 #define _MTL_PRIVATE_CLS(symbol) (Private::Class::s_k##symbol)
 #define _MTL_PRIVATE_SEL(accessor) (Private::Selector::s_k##accessor)
+#endif // METALCPP_LAZY_REGISTRATION
 
 #if defined(MTL_PRIVATE_IMPLEMENTATION)
 
@@ -2810,9 +4109,15 @@ _NS_INLINE const char* NS::URL::fileSystemRepresentation() const
 #define _MTL_PRIVATE_OBJC_GET_PROTOCOL(symbol) objc_getProtocol(#symbol)
 #endif // __OBJC__
 
+#ifdef METALCPP_LAZY_REGISTRATION
+#define _MTL_PRIVATE_DEF_CLS(symbol) NS::Private::LazyClass s_l##symbol _MTL_PRIVATE_VISIBILITY = { #symbol }
+#define _MTL_PRIVATE_DEF_PRO(symbol) NS::Private::LazyProtocol s_l##symbol _MTL_PRIVATE_VISIBILITY = { #symbol }
+#define _MTL_PRIVATE_DEF_SEL(accessor, symbol) NS::Private::LazySelector s_l##accessor _MTL_PRIVATE_VISIBILITY = { symbol }
+#else
 #define _MTL_PRIVATE_DEF_CLS(symbol) void* s_k##symbol _MTL_PRIVATE_VISIBILITY = _MTL_PRIVATE_OBJC_LOOKUP_CLASS(symbol)
 #define _MTL_PRIVATE_DEF_PRO(symbol) void* s_k##symbol _MTL_PRIVATE_VISIBILITY = _MTL_PRIVATE_OBJC_GET_PROTOCOL(symbol)
 #define _MTL_PRIVATE_DEF_SEL(accessor, symbol) SEL s_k##accessor _MTL_PRIVATE_VISIBILITY = sel_registerName(symbol)
+#endif // METALCPP_LAZY_REGISTRATION
 
 #include <dlfcn.h>
 #define MTL_DEF_FUNC( name, signature ) \
@@ -2860,15 +4165,2181 @@ namespace MTL::Private
 
 #else
 
+#ifdef METALCPP_LAZY_REGISTRATION
+#define _MTL_PRIVATE_DEF_CLS(symbol) extern NS::Private::LazyClass s_l##symbol
+#define _MTL_PRIVATE_DEF_PRO(symbol) extern NS::Private::LazyProtocol s_l##symbol
+#define _MTL_PRIVATE_DEF_SEL(accessor, symbol) extern NS::Private::LazySelector s_l##accessor
+#else
 #define _MTL_PRIVATE_DEF_CLS(symbol) extern void* s_k##symbol
 #define _MTL_PRIVATE_DEF_PRO(symbol) extern void* s_k##symbol
 #define _MTL_PRIVATE_DEF_SEL(accessor, symbol) extern SEL s_k##accessor
+#endif // METALCPP_LAZY_REGISTRATION
 #define _MTL_PRIVATE_DEF_STR(type, symbol) extern type const MTL::symbol
 #define _MTL_PRIVATE_DEF_CONST(type, symbol) extern type const MTL::symbol
 #define _MTL_PRIVATE_DEF_WEAK_CONST(type, symbol) extern type const MTL::symbol
 
 #endif // MTL_PRIVATE_IMPLEMENTATION
 
+#ifdef METALCPP_SELECTOR_TABLE
+
+#ifdef METALCPP_LAZY_REGISTRATION
+#error "METALCPP_SELECTOR_TABLE and METALCPP_LAZY_REGISTRATION can't be combined."
+#endif // METALCPP_LAZY_REGISTRATION
+#include <objc/runtime.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace MTL::Private::Selector
+{
+
+enum class Index : std::uint16_t
+{
+    beginScope,
+    endScope,
+    GPUEndTime,
+    GPUStartTime,
+    URL,
+    accelerationStructureCommandEncoder,
+    accelerationStructureCommandEncoderWithDescriptor_,
+    accelerationStructurePassDescriptor,
+    accelerationStructureSizesWithDescriptor_,
+    access,
+    addBarrier,
+    addCompletedHandler_,
+    addComputePipelineFunctionsWithDescriptor_error_,
+    addDebugMarker_range_,
+    addFunctionWithDescriptor_library_error_,
+    addPresentedHandler_,
+    addRenderPipelineFunctionsWithDescriptor_error_,
+    addScheduledHandler_,
+    addTileRenderPipelineFunctionsWithDescriptor_error_,
+    alignment,
+    allocatedSize,
+    allowDuplicateIntersectionFunctionInvocation,
+    allowGPUOptimizedContents,
+    alphaBlendOperation,
+    areBarycentricCoordsSupported,
+    areProgrammableSamplePositionsSupported,
+    areRasterOrderGroupsSupported,
+    argumentBuffersSupport,
+    argumentDescriptor,
+    argumentIndex,
+    argumentIndexStride,
+    arguments,
+    arrayLength,
+    arrayType,
+    attributeIndex,
+    attributeType,
+    attributes,
+    backFaceStencil,
+    binaryArchives,
+    binaryFunctions,
+    bindings,
+    blitCommandEncoder,
+    blitCommandEncoderWithDescriptor_,
+    blitPassDescriptor,
+    borderColor,
+    boundingBoxBuffer,
+    boundingBoxBufferOffset,
+    boundingBoxBuffers,
+    boundingBoxCount,
+    boundingBoxStride,
+    buffer,
+    bufferAlignment,
+    bufferBytesPerRow,
+    bufferDataSize,
+    bufferDataType,
+    bufferIndex,
+    bufferOffset,
+    bufferPointerType,
+    bufferStructType,
+    buffers,
+    buildAccelerationStructure_descriptor_scratchBuffer_scratchBufferOffset_,
+    captureObject,
+    clearBarrier,
+    clearColor,
+    clearDepth,
+    clearStencil,
+    colorAttachments,
+    column,
+    commandBuffer,
+    commandBufferWithDescriptor_,
+    commandBufferWithUnretainedReferences,
+    commandQueue,
+    commandTypes,
+    commit,
+    compareFunction,
+    compressionType,
+    computeCommandEncoder,
+    computeCommandEncoderWithDescriptor_,
+    computeCommandEncoderWithDispatchType_,
+    computeFunction,
+    computePassDescriptor,
+    concurrentDispatchThreadgroups_threadsPerThreadgroup_,
+    concurrentDispatchThreads_threadsPerThreadgroup_,
+    constantBlockAlignment,
+    constantDataAtIndex_,
+    constantValues,
+    contents,
+    controlDependencies,
+    convertSparsePixelRegions_toTileRegions_withTileSize_alignmentMode_numRegions_,
+    convertSparseTileRegions_toPixelRegions_withTileSize_numRegions_,
+    copyAccelerationStructure_toAccelerationStructure_,
+    copyAndCompactAccelerationStructure_toAccelerationStructure_,
+    copyFromBuffer_sourceOffset_sourceBytesPerRow_sourceBytesPerImage_sourceSize_toTexture_destinationSlice_destinationLevel_destinationOrigin_,
+    copyFromBuffer_sourceOffset_sourceBytesPerRow_sourceBytesPerImage_sourceSize_toTexture_destinationSlice_destinationLevel_destinationOrigin_options_,
+    copyFromBuffer_sourceOffset_toBuffer_destinationOffset_size_,
+    copyFromTexture_sourceSlice_sourceLevel_sourceOrigin_sourceSize_toBuffer_destinationOffset_destinationBytesPerRow_destinationBytesPerImage_,
+    copyFromTexture_sourceSlice_sourceLevel_sourceOrigin_sourceSize_toBuffer_destinationOffset_destinationBytesPerRow_destinationBytesPerImage_options_,
+    copyFromTexture_sourceSlice_sourceLevel_sourceOrigin_sourceSize_toTexture_destinationSlice_destinationLevel_destinationOrigin_,
+    copyFromTexture_sourceSlice_sourceLevel_toTexture_destinationSlice_destinationLevel_sliceCount_levelCount_,
+    copyFromTexture_toTexture_,
+    copyIndirectCommandBuffer_sourceRange_destination_destinationIndex_,
+    copyParameterDataToBuffer_offset_,
+    copyStatusToBuffer_offset_,
+    counterSet,
+    counterSets,
+    counters,
+    cpuCacheMode,
+    currentAllocatedSize,
+    data,
+    dataSize,
+    dataType,
+    dealloc,
+    debugLocation,
+    debugSignposts,
+    defaultCaptureScope,
+    defaultRasterSampleCount,
+    depth,
+    depthAttachment,
+    depthAttachmentPixelFormat,
+    depthCompareFunction,
+    depthFailureOperation,
+    depthPlane,
+    depthResolveFilter,
+    depthStencilPassOperation,
+    descriptor,
+    destination,
+    destinationAlphaBlendFactor,
+    destinationRGBBlendFactor,
+    device,
+    didModifyRange_,
+    dispatchQueue,
+    dispatchThreadgroups_threadsPerThreadgroup_,
+    dispatchThreadgroupsWithIndirectBuffer_indirectBufferOffset_threadsPerThreadgroup_,
+    dispatchThreads_threadsPerThreadgroup_,
+    dispatchThreadsPerTile_,
+    dispatchType,
+    drawIndexedPatches_patchIndexBuffer_patchIndexBufferOffset_controlPointIndexBuffer_controlPointIndexBufferOffset_indirectBuffer_indirectBufferOffset_,
+    drawIndexedPatches_patchStart_patchCount_patchIndexBuffer_patchIndexBufferOffset_controlPointIndexBuffer_controlPointIndexBufferOffset_instanceCount_baseInstance_,
+    drawIndexedPatches_patchStart_patchCount_patchIndexBuffer_patchIndexBufferOffset_controlPointIndexBuffer_controlPointIndexBufferOffset_instanceCount_baseInstance_tessellationFactorBuffer_tessellationFactorBufferOffset_tessellationFactorBufferInstanceStride_,
+    drawIndexedPrimitives_indexCount_indexType_indexBuffer_indexBufferOffset_,
+    drawIndexedPrimitives_indexCount_indexType_indexBuffer_indexBufferOffset_instanceCount_,
+    drawIndexedPrimitives_indexCount_indexType_indexBuffer_indexBufferOffset_instanceCount_baseVertex_baseInstance_,
+    drawIndexedPrimitives_indexType_indexBuffer_indexBufferOffset_indirectBuffer_indirectBufferOffset_,
+    drawMeshThreadgroups_threadsPerObjectThreadgroup_threadsPerMeshThreadgroup_,
+    drawMeshThreadgroupsWithIndirectBuffer_indirectBufferOffset_threadsPerObjectThreadgroup_threadsPerMeshThreadgroup_,
+    drawMeshThreads_threadsPerObjectThreadgroup_threadsPerMeshThreadgroup_,
+    drawPatches_patchIndexBuffer_patchIndexBufferOffset_indirectBuffer_indirectBufferOffset_,
+    drawPatches_patchStart_patchCount_patchIndexBuffer_patchIndexBufferOffset_instanceCount_baseInstance_,
+    drawPatches_patchStart_patchCount_patchIndexBuffer_patchIndexBufferOffset_instanceCount_baseInstance_tessellationFactorBuffer_tessellationFactorBufferOffset_tessellationFactorBufferInstanceStride_,
+    drawPrimitives_indirectBuffer_indirectBufferOffset_,
+    drawPrimitives_vertexStart_vertexCount_,
+    drawPrimitives_vertexStart_vertexCount_instanceCount_,
+    drawPrimitives_vertexStart_vertexCount_instanceCount_baseInstance_,
+    drawableID,
+    elementArrayType,
+    elementIsArgumentBuffer,
+    elementPointerType,
+    elementStructType,
+    elementTextureReferenceType,
+    elementType,
+    encodeSignalEvent_value_,
+    encodeWaitForEvent_value_,
+    encodedLength,
+    encoderLabel,
+    endEncoding,
+    endOfEncoderSampleIndex,
+    endOfFragmentSampleIndex,
+    endOfVertexSampleIndex,
+    enqueue,
+    enqueueBarrier,
+    error,
+    errorOptions,
+    errorState,
+    executeCommandsInBuffer_indirectBuffer_indirectBufferOffset_,
+    executeCommandsInBuffer_withRange_,
+    fastMathEnabled,
+    fillBuffer_range_value_,
+    firstMipmapInTail,
+    format,
+    fragmentAdditionalBinaryFunctions,
+    fragmentArguments,
+    fragmentBindings,
+    fragmentBuffers,
+    fragmentFunction,
+    fragmentLinkedFunctions,
+    fragmentPreloadedLibraries,
+    frontFaceStencil,
+    function,
+    functionConstantsDictionary,
+    functionCount,
+    functionDescriptor,
+    functionGraphs,
+    functionHandleWithFunction_,
+    functionHandleWithFunction_stage_,
+    functionName,
+    functionNames,
+    functionType,
+    functions,
+    generateMipmapsForTexture_,
+    geometryDescriptors,
+    getBytes_bytesPerRow_bytesPerImage_fromRegion_mipmapLevel_slice_,
+    getBytes_bytesPerRow_fromRegion_mipmapLevel_,
+    getDefaultSamplePositions_count_,
+    getSamplePositions_count_,
+    getTextureAccessCounters_region_mipLevel_slice_resetCounters_countersBuffer_countersBufferOffset_,
+    gpuAddress,
+    gpuResourceID,
+    groups,
+    hasUnifiedMemory,
+    hazardTrackingMode,
+    heap,
+    heapAccelerationStructureSizeAndAlignWithDescriptor_,
+    heapAccelerationStructureSizeAndAlignWithSize_,
+    heapBufferSizeAndAlignWithLength_options_,
+    heapOffset,
+    heapTextureSizeAndAlignWithDescriptor_,
+    height,
+    horizontal,
+    horizontalSampleStorage,
+    imageblockMemoryLengthForDimensions_,
+    imageblockSampleLength,
+    index,
+    indexBuffer,
+    indexBufferIndex,
+    indexBufferOffset,
+    indexType,
+    indirectComputeCommandAtIndex_,
+    indirectRenderCommandAtIndex_,
+    inheritBuffers,
+    inheritPipelineState,
+    init,
+    initWithArgumentIndex_,
+    initWithDispatchQueue_,
+    initWithFunctionName_nodes_outputNode_attributes_,
+    initWithName_arguments_controlDependencies_,
+    initWithSampleCount_,
+    initWithSampleCount_horizontal_vertical_,
+    inputPrimitiveTopology,
+    insertDebugCaptureBoundary,
+    insertDebugSignpost_,
+    insertLibraries,
+    installName,
+    instanceCount,
+    instanceDescriptorBuffer,
+    instanceDescriptorBufferOffset,
+    instanceDescriptorStride,
+    instanceDescriptorType,
+    instancedAccelerationStructures,
+    intersectionFunctionTableDescriptor,
+    intersectionFunctionTableOffset,
+    iosurface,
+    iosurfacePlane,
+    isActive,
+    isAliasable,
+    isAlphaToCoverageEnabled,
+    isAlphaToOneEnabled,
+    isArgument,
+    isBlendingEnabled,
+    isCapturing,
+    isDepth24Stencil8PixelFormatSupported,
+    isDepthTexture,
+    isDepthWriteEnabled,
+    isFramebufferOnly,
+    isHeadless,
+    isLowPower,
+    isPatchControlPointData,
+    isPatchData,
+    isRasterizationEnabled,
+    isRemovable,
+    isShareable,
+    isSparse,
+    isTessellationFactorScaleEnabled,
+    isUsed,
+    kernelEndTime,
+    kernelStartTime,
+    label,
+    languageVersion,
+    layerAtIndex_,
+    layerCount,
+    layers,
+    layouts,
+    length,
+    level,
+    libraries,
+    libraryType,
+    line,
+    linkedFunctions,
+    loadAction,
+    loadBuffer_offset_size_sourceHandle_sourceHandleOffset_,
+    loadBytes_size_sourceHandle_sourceHandleOffset_,
+    loadTexture_slice_level_size_sourceBytesPerRow_sourceBytesPerImage_destinationOrigin_sourceHandle_sourceHandleOffset_,
+    location,
+    locationNumber,
+    lodAverage,
+    lodMaxClamp,
+    lodMinClamp,
+    logs,
+    magFilter,
+    makeAliasable,
+    mapPhysicalToScreenCoordinates_forLayer_,
+    mapScreenToPhysicalCoordinates_forLayer_,
+    maxAnisotropy,
+    maxArgumentBufferSamplerCount,
+    maxAvailableSizeWithAlignment_,
+    maxBufferLength,
+    maxCallStackDepth,
+    maxCommandBufferCount,
+    maxCommandsInFlight,
+    maxFragmentBufferBindCount,
+    maxFragmentCallStackDepth,
+    maxKernelBufferBindCount,
+    maxSampleCount,
+    maxTessellationFactor,
+    maxThreadgroupMemoryLength,
+    maxThreadsPerThreadgroup,
+    maxTotalThreadgroupsPerMeshGrid,
+    maxTotalThreadsPerMeshThreadgroup,
+    maxTotalThreadsPerObjectThreadgroup,
+    maxTotalThreadsPerThreadgroup,
+    maxTransferRate,
+    maxVertexAmplificationCount,
+    maxVertexBufferBindCount,
+    maxVertexCallStackDepth,
+    memberByName_,
+    members,
+    memoryBarrierWithResources_count_,
+    memoryBarrierWithResources_count_afterStages_beforeStages_,
+    memoryBarrierWithScope_,
+    memoryBarrierWithScope_afterStages_beforeStages_,
+    meshBindings,
+    meshBuffers,
+    meshFunction,
+    meshThreadExecutionWidth,
+    meshThreadgroupSizeIsMultipleOfThreadExecutionWidth,
+    minFilter,
+    minimumLinearTextureAlignmentForPixelFormat_,
+    minimumTextureBufferAlignmentForPixelFormat_,
+    mipFilter,
+    mipmapLevelCount,
+    motionEndBorderMode,
+    motionEndTime,
+    motionKeyframeCount,
+    motionStartBorderMode,
+    motionStartTime,
+    motionTransformBuffer,
+    motionTransformBufferOffset,
+    motionTransformCount,
+    moveTextureMappingsFromTexture_sourceSlice_sourceLevel_sourceOrigin_sourceSize_toTexture_destinationSlice_destinationLevel_destinationOrigin_,
+    mutability,
+    name,
+    newAccelerationStructureWithDescriptor_,
+    newAccelerationStructureWithDescriptor_offset_,
+    newAccelerationStructureWithSize_,
+    newAccelerationStructureWithSize_offset_,
+    newArgumentEncoderForBufferAtIndex_,
+    newArgumentEncoderWithArguments_,
+    newArgumentEncoderWithBufferBinding_,
+    newArgumentEncoderWithBufferIndex_,
+    newArgumentEncoderWithBufferIndex_reflection_,
+    newBinaryArchiveWithDescriptor_error_,
+    newBufferWithBytes_length_options_,
+    newBufferWithBytesNoCopy_length_options_deallocator_,
+    newBufferWithLength_options_,
+    newBufferWithLength_options_offset_,
+    newCaptureScopeWithCommandQueue_,
+    newCaptureScopeWithDevice_,
+    newCommandQueue,
+    newCommandQueueWithMaxCommandBufferCount_,
+    newComputePipelineStateWithAdditionalBinaryFunctions_error_,
+    newComputePipelineStateWithDescriptor_options_completionHandler_,
+    newComputePipelineStateWithDescriptor_options_reflection_error_,
+    newComputePipelineStateWithFunction_completionHandler_,
+    newComputePipelineStateWithFunction_error_,
+    newComputePipelineStateWithFunction_options_completionHandler_,
+    newComputePipelineStateWithFunction_options_reflection_error_,
+    newCounterSampleBufferWithDescriptor_error_,
+    newDefaultLibrary,
+    newDefaultLibraryWithBundle_error_,
+    newDepthStencilStateWithDescriptor_,
+    newDynamicLibrary_error_,
+    newDynamicLibraryWithURL_error_,
+    newEvent,
+    newFence,
+    newFunctionWithDescriptor_completionHandler_,
+    newFunctionWithDescriptor_error_,
+    newFunctionWithName_,
+    newFunctionWithName_constantValues_completionHandler_,
+    newFunctionWithName_constantValues_error_,
+    newHeapWithDescriptor_,
+    newIOCommandQueueWithDescriptor_error_,
+    newIOHandleWithURL_compressionMethod_error_,
+    newIOHandleWithURL_error_,
+    newIndirectCommandBufferWithDescriptor_maxCommandCount_options_,
+    newIntersectionFunctionTableWithDescriptor_,
+    newIntersectionFunctionTableWithDescriptor_stage_,
+    newIntersectionFunctionWithDescriptor_completionHandler_,
+    newIntersectionFunctionWithDescriptor_error_,
+    newLibraryWithData_error_,
+    newLibraryWithFile_error_,
+    newLibraryWithSource_options_completionHandler_,
+    newLibraryWithSource_options_error_,
+    newLibraryWithStitchedDescriptor_completionHandler_,
+    newLibraryWithStitchedDescriptor_error_,
+    newLibraryWithURL_error_,
+    newRasterizationRateMapWithDescriptor_,
+    newRemoteBufferViewForDevice_,
+    newRemoteTextureViewForDevice_,
+    newRenderPipelineStateWithAdditionalBinaryFunctions_error_,
+    newRenderPipelineStateWithDescriptor_completionHandler_,
+    newRenderPipelineStateWithDescriptor_error_,
+    newRenderPipelineStateWithDescriptor_options_completionHandler_,
+    newRenderPipelineStateWithDescriptor_options_reflection_error_,
+    newRenderPipelineStateWithMeshDescriptor_options_completionHandler_,
+    newRenderPipelineStateWithMeshDescriptor_options_reflection_error_,
+    newRenderPipelineStateWithTileDescriptor_options_completionHandler_,
+    newRenderPipelineStateWithTileDescriptor_options_reflection_error_,
+    newSamplerStateWithDescriptor_,
+    newScratchBufferWithMinimumSize_,
+    newSharedEvent,
+    newSharedEventHandle,
+    newSharedEventWithHandle_,
+    newSharedTextureHandle,
+    newSharedTextureWithDescriptor_,
+    newSharedTextureWithHandle_,
+    newTextureViewWithPixelFormat_,
+    newTextureViewWithPixelFormat_textureType_levels_slices_,
+    newTextureViewWithPixelFormat_textureType_levels_slices_swizzle_,
+    newTextureWithDescriptor_,
+    newTextureWithDescriptor_iosurface_plane_,
+    newTextureWithDescriptor_offset_,
+    newTextureWithDescriptor_offset_bytesPerRow_,
+    newVisibleFunctionTableWithDescriptor_,
+    newVisibleFunctionTableWithDescriptor_stage_,
+    nodes,
+    normalizedCoordinates,
+    notifyListener_atValue_block_,
+    objectAtIndexedSubscript_,
+    objectBindings,
+    objectBuffers,
+    objectFunction,
+    objectPayloadAlignment,
+    objectPayloadDataSize,
+    objectThreadExecutionWidth,
+    objectThreadgroupSizeIsMultipleOfThreadExecutionWidth,
+    offset,
+    opaque,
+    optimizationLevel,
+    optimizeContentsForCPUAccess_,
+    optimizeContentsForCPUAccess_slice_level_,
+    optimizeContentsForGPUAccess_,
+    optimizeContentsForGPUAccess_slice_level_,
+    optimizeIndirectCommandBuffer_withRange_,
+    options,
+    outputNode,
+    outputURL,
+    parallelRenderCommandEncoderWithDescriptor_,
+    parameterBufferSizeAndAlign,
+    parentRelativeLevel,
+    parentRelativeSlice,
+    parentTexture,
+    patchControlPointCount,
+    patchType,
+    payloadMemoryLength,
+    peerCount,
+    peerGroupID,
+    peerIndex,
+    physicalGranularity,
+    physicalSizeForLayer_,
+    pixelFormat,
+    pointerType,
+    popDebugGroup,
+    preloadedLibraries,
+    preprocessorMacros,
+    present,
+    presentAfterMinimumDuration_,
+    presentAtTime_,
+    presentDrawable_,
+    presentDrawable_afterMinimumDuration_,
+    presentDrawable_atTime_,
+    presentedTime,
+    preserveInvariance,
+    primitiveDataBuffer,
+    primitiveDataBufferOffset,
+    primitiveDataElementSize,
+    primitiveDataStride,
+    priority,
+    privateFunctions,
+    pushDebugGroup_,
+    rAddressMode,
+    rasterSampleCount,
+    rasterizationRateMap,
+    rasterizationRateMapDescriptorWithScreenSize_,
+    rasterizationRateMapDescriptorWithScreenSize_layer_,
+    rasterizationRateMapDescriptorWithScreenSize_layerCount_layers_,
+    readMask,
+    readWriteTextureSupport,
+    recommendedMaxWorkingSetSize,
+    refitAccelerationStructure_descriptor_destination_scratchBuffer_scratchBufferOffset_,
+    refitAccelerationStructure_descriptor_destination_scratchBuffer_scratchBufferOffset_options_,
+    registryID,
+    remoteStorageBuffer,
+    remoteStorageTexture,
+    removeAllDebugMarkers,
+    renderCommandEncoder,
+    renderCommandEncoderWithDescriptor_,
+    renderPassDescriptor,
+    renderTargetArrayLength,
+    renderTargetHeight,
+    renderTargetWidth,
+    replaceRegion_mipmapLevel_slice_withBytes_bytesPerRow_bytesPerImage_,
+    replaceRegion_mipmapLevel_withBytes_bytesPerRow_,
+    required,
+    reset,
+    resetCommandsInBuffer_withRange_,
+    resetTextureAccessCounters_region_mipLevel_slice_,
+    resetWithRange_,
+    resolveCounterRange_,
+    resolveCounters_inRange_destinationBuffer_destinationOffset_,
+    resolveDepthPlane,
+    resolveLevel,
+    resolveSlice,
+    resolveTexture,
+    resourceOptions,
+    resourceStateCommandEncoder,
+    resourceStateCommandEncoderWithDescriptor_,
+    resourceStatePassDescriptor,
+    retainedReferences,
+    rgbBlendOperation,
+    rootResource,
+    sAddressMode,
+    sampleBuffer,
+    sampleBufferAttachments,
+    sampleCount,
+    sampleCountersInBuffer_atSampleIndex_withBarrier_,
+    sampleTimestamps_gpuTimestamp_,
+    scratchBufferAllocator,
+    screenSize,
+    serializeToURL_error_,
+    setAccelerationStructure_atBufferIndex_,
+    setAccelerationStructure_atIndex_,
+    setAccess_,
+    setAllowDuplicateIntersectionFunctionInvocation_,
+    setAllowGPUOptimizedContents_,
+    setAlphaBlendOperation_,
+    setAlphaToCoverageEnabled_,
+    setAlphaToOneEnabled_,
+    setArgumentBuffer_offset_,
+    setArgumentBuffer_startOffset_arrayElement_,
+    setArgumentIndex_,
+    setArguments_,
+    setArrayLength_,
+    setAttributes_,
+    setBackFaceStencil_,
+    setBarrier,
+    setBinaryArchives_,
+    setBinaryFunctions_,
+    setBlendColorRed_green_blue_alpha_,
+    setBlendingEnabled_,
+    setBorderColor_,
+    setBoundingBoxBuffer_,
+    setBoundingBoxBufferOffset_,
+    setBoundingBoxBuffers_,
+    setBoundingBoxCount_,
+    setBoundingBoxStride_,
+    setBuffer_,
+    setBuffer_offset_atIndex_,
+    setBufferIndex_,
+    setBufferOffset_atIndex_,
+    setBuffers_offsets_withRange_,
+    setBytes_length_atIndex_,
+    setCaptureObject_,
+    setClearColor_,
+    setClearDepth_,
+    setClearStencil_,
+    setColorStoreAction_atIndex_,
+    setColorStoreActionOptions_atIndex_,
+    setCommandTypes_,
+    setCompareFunction_,
+    setCompressionType_,
+    setComputeFunction_,
+    setComputePipelineState_,
+    setComputePipelineState_atIndex_,
+    setComputePipelineStates_withRange_,
+    setConstantBlockAlignment_,
+    setConstantValue_type_atIndex_,
+    setConstantValue_type_withName_,
+    setConstantValues_,
+    setConstantValues_type_withRange_,
+    setControlDependencies_,
+    setCounterSet_,
+    setCpuCacheMode_,
+    setCullMode_,
+    setDataType_,
+    setDefaultCaptureScope_,
+    setDefaultRasterSampleCount_,
+    setDepth_,
+    setDepthAttachment_,
+    setDepthAttachmentPixelFormat_,
+    setDepthBias_slopeScale_clamp_,
+    setDepthClipMode_,
+    setDepthCompareFunction_,
+    setDepthFailureOperation_,
+    setDepthPlane_,
+    setDepthResolveFilter_,
+    setDepthStencilPassOperation_,
+    setDepthStencilState_,
+    setDepthStoreAction_,
+    setDepthStoreActionOptions_,
+    setDepthWriteEnabled_,
+    setDestination_,
+    setDestinationAlphaBlendFactor_,
+    setDestinationRGBBlendFactor_,
+    setDispatchType_,
+    setEndOfEncoderSampleIndex_,
+    setEndOfFragmentSampleIndex_,
+    setEndOfVertexSampleIndex_,
+    setErrorOptions_,
+    setFastMathEnabled_,
+    setFormat_,
+    setFragmentAccelerationStructure_atBufferIndex_,
+    setFragmentAdditionalBinaryFunctions_,
+    setFragmentBuffer_offset_atIndex_,
+    setFragmentBufferOffset_atIndex_,
+    setFragmentBuffers_offsets_withRange_,
+    setFragmentBytes_length_atIndex_,
+    setFragmentFunction_,
+    setFragmentIntersectionFunctionTable_atBufferIndex_,
+    setFragmentIntersectionFunctionTables_withBufferRange_,
+    setFragmentLinkedFunctions_,
+    setFragmentPreloadedLibraries_,
+    setFragmentSamplerState_atIndex_,
+    setFragmentSamplerState_lodMinClamp_lodMaxClamp_atIndex_,
+    setFragmentSamplerStates_lodMinClamps_lodMaxClamps_withRange_,
+    setFragmentSamplerStates_withRange_,
+    setFragmentTexture_atIndex_,
+    setFragmentTextures_withRange_,
+    setFragmentVisibleFunctionTable_atBufferIndex_,
+    setFragmentVisibleFunctionTables_withBufferRange_,
+    setFrontFaceStencil_,
+    setFrontFacingWinding_,
+    setFunction_atIndex_,
+    setFunctionCount_,
+    setFunctionGraphs_,
+    setFunctionName_,
+    setFunctions_,
+    setFunctions_withRange_,
+    setGeometryDescriptors_,
+    setGroups_,
+    setHazardTrackingMode_,
+    setHeight_,
+    setImageblockSampleLength_,
+    setImageblockWidth_height_,
+    setIndex_,
+    setIndexBuffer_,
+    setIndexBufferIndex_,
+    setIndexBufferOffset_,
+    setIndexType_,
+    setIndirectCommandBuffer_atIndex_,
+    setIndirectCommandBuffers_withRange_,
+    setInheritBuffers_,
+    setInheritPipelineState_,
+    setInputPrimitiveTopology_,
+    setInsertLibraries_,
+    setInstallName_,
+    setInstanceCount_,
+    setInstanceDescriptorBuffer_,
+    setInstanceDescriptorBufferOffset_,
+    setInstanceDescriptorStride_,
+    setInstanceDescriptorType_,
+    setInstancedAccelerationStructures_,
+    setIntersectionFunctionTable_atBufferIndex_,
+    setIntersectionFunctionTable_atIndex_,
+    setIntersectionFunctionTableOffset_,
+    setIntersectionFunctionTables_withBufferRange_,
+    setIntersectionFunctionTables_withRange_,
+    setKernelBuffer_offset_atIndex_,
+    setLabel_,
+    setLanguageVersion_,
+    setLayer_atIndex_,
+    setLevel_,
+    setLibraries_,
+    setLibraryType_,
+    setLinkedFunctions_,
+    setLoadAction_,
+    setLodAverage_,
+    setLodMaxClamp_,
+    setLodMinClamp_,
+    setMagFilter_,
+    setMaxAnisotropy_,
+    setMaxCallStackDepth_,
+    setMaxCommandBufferCount_,
+    setMaxCommandsInFlight_,
+    setMaxFragmentBufferBindCount_,
+    setMaxFragmentCallStackDepth_,
+    setMaxKernelBufferBindCount_,
+    setMaxTessellationFactor_,
+    setMaxTotalThreadgroupsPerMeshGrid_,
+    setMaxTotalThreadsPerMeshThreadgroup_,
+    setMaxTotalThreadsPerObjectThreadgroup_,
+    setMaxTotalThreadsPerThreadgroup_,
+    setMaxVertexAmplificationCount_,
+    setMaxVertexBufferBindCount_,
+    setMaxVertexCallStackDepth_,
+    setMeshBuffer_offset_atIndex_,
+    setMeshBufferOffset_atIndex_,
+    setMeshBuffers_offsets_withRange_,
+    setMeshBytes_length_atIndex_,
+    setMeshFunction_,
+    setMeshSamplerState_atIndex_,
+    setMeshSamplerState_lodMinClamp_lodMaxClamp_atIndex_,
+    setMeshSamplerStates_lodMinClamps_lodMaxClamps_withRange_,
+    setMeshSamplerStates_withRange_,
+    setMeshTexture_atIndex_,
+    setMeshTextures_withRange_,
+    setMeshThreadgroupSizeIsMultipleOfThreadExecutionWidth_,
+    setMinFilter_,
+    setMipFilter_,
+    setMipmapLevelCount_,
+    setMotionEndBorderMode_,
+    setMotionEndTime_,
+    setMotionKeyframeCount_,
+    setMotionStartBorderMode_,
+    setMotionStartTime_,
+    setMotionTransformBuffer_,
+    setMotionTransformBufferOffset_,
+    setMotionTransformCount_,
+    setMutability_,
+    setName_,
+    setNodes_,
+    setNormalizedCoordinates_,
+    setObject_atIndexedSubscript_,
+    setObjectBuffer_offset_atIndex_,
+    setObjectBufferOffset_atIndex_,
+    setObjectBuffers_offsets_withRange_,
+    setObjectBytes_length_atIndex_,
+    setObjectFunction_,
+    setObjectSamplerState_atIndex_,
+    setObjectSamplerState_lodMinClamp_lodMaxClamp_atIndex_,
+    setObjectSamplerStates_lodMinClamps_lodMaxClamps_withRange_,
+    setObjectSamplerStates_withRange_,
+    setObjectTexture_atIndex_,
+    setObjectTextures_withRange_,
+    setObjectThreadgroupMemoryLength_atIndex_,
+    setObjectThreadgroupSizeIsMultipleOfThreadExecutionWidth_,
+    setOffset_,
+    setOpaque_,
+    setOpaqueTriangleIntersectionFunctionWithSignature_atIndex_,
+    setOpaqueTriangleIntersectionFunctionWithSignature_withRange_,
+    setOptimizationLevel_,
+    setOptions_,
+    setOutputNode_,
+    setOutputURL_,
+    setPayloadMemoryLength_,
+    setPixelFormat_,
+    setPreloadedLibraries_,
+    setPreprocessorMacros_,
+    setPreserveInvariance_,
+    setPrimitiveDataBuffer_,
+    setPrimitiveDataBufferOffset_,
+    setPrimitiveDataElementSize_,
+    setPrimitiveDataStride_,
+    setPriority_,
+    setPrivateFunctions_,
+    setPurgeableState_,
+    setRAddressMode_,
+    setRasterSampleCount_,
+    setRasterizationEnabled_,
+    setRasterizationRateMap_,
+    setReadMask_,
+    setRenderPipelineState_,
+    setRenderPipelineState_atIndex_,
+    setRenderPipelineStates_withRange_,
+    setRenderTargetArrayLength_,
+    setRenderTargetHeight_,
+    setRenderTargetWidth_,
+    setResolveDepthPlane_,
+    setResolveLevel_,
+    setResolveSlice_,
+    setResolveTexture_,
+    setResourceOptions_,
+    setRetainedReferences_,
+    setRgbBlendOperation_,
+    setSAddressMode_,
+    setSampleBuffer_,
+    setSampleCount_,
+    setSamplePositions_count_,
+    setSamplerState_atIndex_,
+    setSamplerState_lodMinClamp_lodMaxClamp_atIndex_,
+    setSamplerStates_lodMinClamps_lodMaxClamps_withRange_,
+    setSamplerStates_withRange_,
+    setScissorRect_,
+    setScissorRects_count_,
+    setScratchBufferAllocator_,
+    setScreenSize_,
+    setSignaledValue_,
+    setSize_,
+    setSlice_,
+    setSourceAlphaBlendFactor_,
+    setSourceRGBBlendFactor_,
+    setSparsePageSize_,
+    setSpecializedName_,
+    setStageInRegion_,
+    setStageInRegionWithIndirectBuffer_indirectBufferOffset_,
+    setStageInputDescriptor_,
+    setStartOfEncoderSampleIndex_,
+    setStartOfFragmentSampleIndex_,
+    setStartOfVertexSampleIndex_,
+    setStencilAttachment_,
+    setStencilAttachmentPixelFormat_,
+    setStencilCompareFunction_,
+    setStencilFailureOperation_,
+    setStencilFrontReferenceValue_backReferenceValue_,
+    setStencilReferenceValue_,
+    setStencilResolveFilter_,
+    setStencilStoreAction_,
+    setStencilStoreActionOptions_,
+    setStepFunction_,
+    setStepRate_,
+    setStorageMode_,
+    setStoreAction_,
+    setStoreActionOptions_,
+    setStride_,
+    setSupportAddingBinaryFunctions_,
+    setSupportAddingFragmentBinaryFunctions_,
+    setSupportAddingVertexBinaryFunctions_,
+    setSupportArgumentBuffers_,
+    setSupportIndirectCommandBuffers_,
+    setSupportRayTracing_,
+    setSwizzle_,
+    setTAddressMode_,
+    setTessellationControlPointIndexType_,
+    setTessellationFactorBuffer_offset_instanceStride_,
+    setTessellationFactorFormat_,
+    setTessellationFactorScale_,
+    setTessellationFactorScaleEnabled_,
+    setTessellationFactorStepFunction_,
+    setTessellationOutputWindingOrder_,
+    setTessellationPartitionMode_,
+    setTexture_,
+    setTexture_atIndex_,
+    setTextureType_,
+    setTextures_withRange_,
+    setThreadGroupSizeIsMultipleOfThreadExecutionWidth_,
+    setThreadgroupMemoryLength_,
+    setThreadgroupMemoryLength_atIndex_,
+    setThreadgroupMemoryLength_offset_atIndex_,
+    setThreadgroupSizeMatchesTileSize_,
+    setTileAccelerationStructure_atBufferIndex_,
+    setTileAdditionalBinaryFunctions_,
+    setTileBuffer_offset_atIndex_,
+    setTileBufferOffset_atIndex_,
+    setTileBuffers_offsets_withRange_,
+    setTileBytes_length_atIndex_,
+    setTileFunction_,
+    setTileHeight_,
+    setTileIntersectionFunctionTable_atBufferIndex_,
+    setTileIntersectionFunctionTables_withBufferRange_,
+    setTileSamplerState_atIndex_,
+    setTileSamplerState_lodMinClamp_lodMaxClamp_atIndex_,
+    setTileSamplerStates_lodMinClamps_lodMaxClamps_withRange_,
+    setTileSamplerStates_withRange_,
+    setTileTexture_atIndex_,
+    setTileTextures_withRange_,
+    setTileVisibleFunctionTable_atBufferIndex_,
+    setTileVisibleFunctionTables_withBufferRange_,
+    setTileWidth_,
+    setTransformationMatrixBuffer_,
+    setTransformationMatrixBufferOffset_,
+    setTriangleCount_,
+    setTriangleFillMode_,
+    setType_,
+    setUrl_,
+    setUsage_,
+    setVertexAccelerationStructure_atBufferIndex_,
+    setVertexAdditionalBinaryFunctions_,
+    setVertexAmplificationCount_viewMappings_,
+    setVertexBuffer_,
+    setVertexBuffer_offset_atIndex_,
+    setVertexBufferOffset_,
+    setVertexBufferOffset_atIndex_,
+    setVertexBuffers_,
+    setVertexBuffers_offsets_withRange_,
+    setVertexBytes_length_atIndex_,
+    setVertexDescriptor_,
+    setVertexFormat_,
+    setVertexFunction_,
+    setVertexIntersectionFunctionTable_atBufferIndex_,
+    setVertexIntersectionFunctionTables_withBufferRange_,
+    setVertexLinkedFunctions_,
+    setVertexPreloadedLibraries_,
+    setVertexSamplerState_atIndex_,
+    setVertexSamplerState_lodMinClamp_lodMaxClamp_atIndex_,
+    setVertexSamplerStates_lodMinClamps_lodMaxClamps_withRange_,
+    setVertexSamplerStates_withRange_,
+    setVertexStride_,
+    setVertexTexture_atIndex_,
+    setVertexTextures_withRange_,
+    setVertexVisibleFunctionTable_atBufferIndex_,
+    setVertexVisibleFunctionTables_withBufferRange_,
+    setViewport_,
+    setViewports_count_,
+    setVisibilityResultBuffer_,
+    setVisibilityResultMode_offset_,
+    setVisibleFunctionTable_atBufferIndex_,
+    setVisibleFunctionTable_atIndex_,
+    setVisibleFunctionTables_withBufferRange_,
+    setVisibleFunctionTables_withRange_,
+    setWidth_,
+    setWriteMask_,
+    sharedCaptureManager,
+    signalEvent_value_,
+    signaledValue,
+    size,
+    slice,
+    sourceAlphaBlendFactor,
+    sourceRGBBlendFactor,
+    sparsePageSize,
+    sparseTileSizeInBytes,
+    sparseTileSizeInBytesForSparsePageSize_,
+    sparseTileSizeWithTextureType_pixelFormat_sampleCount_,
+    sparseTileSizeWithTextureType_pixelFormat_sampleCount_sparsePageSize_,
+    specializedName,
+    stageInputAttributes,
+    stageInputDescriptor,
+    stageInputOutputDescriptor,
+    startCaptureWithCommandQueue_,
+    startCaptureWithDescriptor_error_,
+    startCaptureWithDevice_,
+    startCaptureWithScope_,
+    startOfEncoderSampleIndex,
+    startOfFragmentSampleIndex,
+    startOfVertexSampleIndex,
+    staticThreadgroupMemoryLength,
+    status,
+    stencilAttachment,
+    stencilAttachmentPixelFormat,
+    stencilCompareFunction,
+    stencilFailureOperation,
+    stencilResolveFilter,
+    stepFunction,
+    stepRate,
+    stopCapture,
+    storageMode,
+    storeAction,
+    storeActionOptions,
+    stride,
+    structType,
+    supportAddingBinaryFunctions,
+    supportAddingFragmentBinaryFunctions,
+    supportAddingVertexBinaryFunctions,
+    supportArgumentBuffers,
+    supportIndirectCommandBuffers,
+    supportRayTracing,
+    supports32BitFloatFiltering,
+    supports32BitMSAA,
+    supportsBCTextureCompression,
+    supportsCounterSampling_,
+    supportsDestination_,
+    supportsDynamicLibraries,
+    supportsFamily_,
+    supportsFeatureSet_,
+    supportsFunctionPointers,
+    supportsFunctionPointersFromRender,
+    supportsPrimitiveMotionBlur,
+    supportsPullModelInterpolation,
+    supportsQueryTextureLOD,
+    supportsRasterizationRateMapWithLayerCount_,
+    supportsRaytracing,
+    supportsRaytracingFromRender,
+    supportsRenderDynamicLibraries,
+    supportsShaderBarycentricCoordinates,
+    supportsTextureSampleCount_,
+    supportsVertexAmplificationCount_,
+    swizzle,
+    synchronizeResource_,
+    synchronizeTexture_slice_level_,
+    tAddressMode,
+    tailSizeInBytes,
+    tessellationControlPointIndexType,
+    tessellationFactorFormat,
+    tessellationFactorStepFunction,
+    tessellationOutputWindingOrder,
+    tessellationPartitionMode,
+    texture,
+    texture2DDescriptorWithPixelFormat_width_height_mipmapped_,
+    textureBarrier,
+    textureBufferDescriptorWithPixelFormat_width_resourceOptions_usage_,
+    textureCubeDescriptorWithPixelFormat_size_mipmapped_,
+    textureDataType,
+    textureReferenceType,
+    textureType,
+    threadExecutionWidth,
+    threadGroupSizeIsMultipleOfThreadExecutionWidth,
+    threadgroupMemoryAlignment,
+    threadgroupMemoryDataSize,
+    threadgroupMemoryLength,
+    threadgroupSizeMatchesTileSize,
+    tileAdditionalBinaryFunctions,
+    tileArguments,
+    tileBindings,
+    tileBuffers,
+    tileFunction,
+    tileHeight,
+    tileWidth,
+    transformationMatrixBuffer,
+    transformationMatrixBufferOffset,
+    triangleCount,
+    tryCancel,
+    type,
+    updateFence_,
+    updateFence_afterStages_,
+    updateTextureMapping_mode_indirectBuffer_indirectBufferOffset_,
+    updateTextureMapping_mode_region_mipLevel_slice_,
+    updateTextureMappings_mode_regions_mipLevels_slices_numRegions_,
+    url,
+    usage,
+    useHeap_,
+    useHeap_stages_,
+    useHeaps_count_,
+    useHeaps_count_stages_,
+    useResource_usage_,
+    useResource_usage_stages_,
+    useResources_count_usage_,
+    useResources_count_usage_stages_,
+    usedSize,
+    vertexAdditionalBinaryFunctions,
+    vertexArguments,
+    vertexAttributes,
+    vertexBindings,
+    vertexBuffer,
+    vertexBufferOffset,
+    vertexBuffers,
+    vertexDescriptor,
+    vertexFormat,
+    vertexFunction,
+    vertexLinkedFunctions,
+    vertexPreloadedLibraries,
+    vertexStride,
+    vertical,
+    verticalSampleStorage,
+    visibilityResultBuffer,
+    visibleFunctionTableDescriptor,
+    waitForEvent_value_,
+    waitForFence_,
+    waitForFence_beforeStages_,
+    waitUntilCompleted,
+    waitUntilScheduled,
+    width,
+    writeCompactedAccelerationStructureSize_toBuffer_offset_,
+    writeCompactedAccelerationStructureSize_toBuffer_offset_sizeDataType_,
+    writeMask,
+    Count
+};
+
+extern SEL s_kTable[];
+
+}
+
+#if defined(MTL_PRIVATE_IMPLEMENTATION)
+
+namespace MTL::Private::Selector
+{
+
+alignas(64) SEL s_kTable[static_cast<std::size_t>(Index::Count)] _MTL_PRIVATE_VISIBILITY;
+
+static const char s_kTableNames[] =
+    "beginScope\0"
+    "endScope\0"
+    "GPUEndTime\0"
+    "GPUStartTime\0"
+    "URL\0"
+    "accelerationStructureCommandEncoder\0"
+    "accelerationStructureCommandEncoderWithDescriptor:\0"
+    "accelerationStructurePassDescriptor\0"
+    "accelerationStructureSizesWithDescriptor:\0"
+    "access\0"
+    "addBarrier\0"
+    "addCompletedHandler:\0"
+    "addComputePipelineFunctionsWithDescriptor:error:\0"
+    "addDebugMarker:range:\0"
+    "addFunctionWithDescriptor:library:error:\0"
+    "addPresentedHandler:\0"
+    "addRenderPipelineFunctionsWithDescriptor:error:\0"
+    "addScheduledHandler:\0"
+    "addTileRenderPipelineFunctionsWithDescriptor:error:\0"
+    "alignment\0"
+    "allocatedSize\0"
+    "allowDuplicateIntersectionFunctionInvocation\0"
+    "allowGPUOptimizedContents\0"
+    "alphaBlendOperation\0"
+    "areBarycentricCoordsSupported\0"
+    "areProgrammableSamplePositionsSupported\0"
+    "areRasterOrderGroupsSupported\0"
+    "argumentBuffersSupport\0"
+    "argumentDescriptor\0"
+    "argumentIndex\0"
+    "argumentIndexStride\0"
+    "arguments\0"
+    "arrayLength\0"
+    "arrayType\0"
+    "attributeIndex\0"
+    "attributeType\0"
+    "attributes\0"
+    "backFaceStencil\0"
+    "binaryArchives\0"
+    "binaryFunctions\0"
+    "bindings\0"
+    "blitCommandEncoder\0"
+    "blitCommandEncoderWithDescriptor:\0"
+    "blitPassDescriptor\0"
+    "borderColor\0"
+    "boundingBoxBuffer\0"
+    "boundingBoxBufferOffset\0"
+    "boundingBoxBuffers\0"
+    "boundingBoxCount\0"
+    "boundingBoxStride\0"
+    "buffer\0"
+    "bufferAlignment\0"
+    "bufferBytesPerRow\0"
+    "bufferDataSize\0"
+    "bufferDataType\0"
+    "bufferIndex\0"
+    "bufferOffset\0"
+    "bufferPointerType\0"
+    "bufferStructType\0"
+    "buffers\0"
+    "buildAccelerationStructure:descriptor:scratchBuffer:scratchBufferOffset:\0"
+    "captureObject\0"
+    "clearBarrier\0"
+    "clearColor\0"
+    "clearDepth\0"
+    "clearStencil\0"
+    "colorAttachments\0"
+    "column\0"
+    "commandBuffer\0"
+    "commandBufferWithDescriptor:\0"
+    "commandBufferWithUnretainedReferences\0"
+    "commandQueue\0"
+    "commandTypes\0"
+    "commit\0"
+    "compareFunction\0"
+    "compressionType\0"
+    "computeCommandEncoder\0"
+    "computeCommandEncoderWithDescriptor:\0"
+    "computeCommandEncoderWithDispatchType:\0"
+    "computeFunction\0"
+    "computePassDescriptor\0"
+    "concurrentDispatchThreadgroups:threadsPerThreadgroup:\0"
+    "concurrentDispatchThreads:threadsPerThreadgroup:\0"
+    "constantBlockAlignment\0"
+    "constantDataAtIndex:\0"
+    "constantValues\0"
+    "contents\0"
+    "controlDependencies\0"
+    "convertSparsePixelRegions:toTileRegions:withTileSize:alignmentMode:numRegions:\0"
+    "convertSparseTileRegions:toPixelRegions:withTileSize:numRegions:\0"
+    "copyAccelerationStructure:toAccelerationStructure:\0"
+    "copyAndCompactAccelerationStructure:toAccelerationStructure:\0"
+    "copyFromBuffer:sourceOffset:sourceBytesPerRow:sourceBytesPerImage:sourceSize:toTexture:destinationSlice:destinationLevel:destinationOrigin:\0"
+    "copyFromBuffer:sourceOffset:sourceBytesPerRow:sourceBytesPerImage:sourceSize:toTexture:destinationSlice:destinationLevel:destinationOrigin:options:\0"
+    "copyFromBuffer:sourceOffset:toBuffer:destinationOffset:size:\0"
+    "copyFromTexture:sourceSlice:sourceLevel:sourceOrigin:sourceSize:toBuffer:destinationOffset:destinationBytesPerRow:destinationBytesPerImage:\0"
+    "copyFromTexture:sourceSlice:sourceLevel:sourceOrigin:sourceSize:toBuffer:destinationOffset:destinationBytesPerRow:destinationBytesPerImage:options:\0"
+    "copyFromTexture:sourceSlice:sourceLevel:sourceOrigin:sourceSize:toTexture:destinationSlice:destinationLevel:destinationOrigin:\0"
+    "copyFromTexture:sourceSlice:sourceLevel:toTexture:destinationSlice:destinationLevel:sliceCount:levelCount:\0"
+    "copyFromTexture:toTexture:\0"
+    "copyIndirectCommandBuffer:sourceRange:destination:destinationIndex:\0"
+    "copyParameterDataToBuffer:offset:\0"
+    "copyStatusToBuffer:offset:\0"
+    "counterSet\0"
+    "counterSets\0"
+    "counters\0"
+    "cpuCacheMode\0"
+    "currentAllocatedSize\0"
+    "data\0"
+    "dataSize\0"
+    "dataType\0"
+    "dealloc\0"
+    "debugLocation\0"
+    "debugSignposts\0"
+    "defaultCaptureScope\0"
+    "defaultRasterSampleCount\0"
+    "depth\0"
+    "depthAttachment\0"
+    "depthAttachmentPixelFormat\0"
+    "depthCompareFunction\0"
+    "depthFailureOperation\0"
+    "depthPlane\0"
+    "depthResolveFilter\0"
+    "depthStencilPassOperation\0"
+    "descriptor\0"
+    "destination\0"
+    "destinationAlphaBlendFactor\0"
+    "destinationRGBBlendFactor\0"
+    "device\0"
+    "didModifyRange:\0"
+    "dispatchQueue\0"
+    "dispatchThreadgroups:threadsPerThreadgroup:\0"
+    "dispatchThreadgroupsWithIndirectBuffer:indirectBufferOffset:threadsPerThreadgroup:\0"
+    "dispatchThreads:threadsPerThreadgroup:\0"
+    "dispatchThreadsPerTile:\0"
+    "dispatchType\0"
+    "drawIndexedPatches:patchIndexBuffer:patchIndexBufferOffset:controlPointIndexBuffer:controlPointIndexBufferOffset:indirectBuffer:indirectBufferOffset:\0"
+    "drawIndexedPatches:patchStart:patchCount:patchIndexBuffer:patchIndexBufferOffset:controlPointIndexBuffer:controlPointIndexBufferOffset:instanceCount:baseInstance:\0"
+    "drawIndexedPatches:patchStart:patchCount:patchIndexBuffer:patchIndexBufferOffset:controlPointIndexBuffer:controlPointIndexBufferOffset:instanceCount:baseInstance:tessellationFactorBuffer:tessellationFactorBufferOffset:tessellationFactorBufferInstanceStride:\0"
+    "drawIndexedPrimitives:indexCount:indexType:indexBuffer:indexBufferOffset:\0"
+    "drawIndexedPrimitives:indexCount:indexType:indexBuffer:indexBufferOffset:instanceCount:\0"
+    "drawIndexedPrimitives:indexCount:indexType:indexBuffer:indexBufferOffset:instanceCount:baseVertex:baseInstance:\0"
+    "drawIndexedPrimitives:indexType:indexBuffer:indexBufferOffset:indirectBuffer:indirectBufferOffset:\0"
+    "drawMeshThreadgroups:threadsPerObjectThreadgroup:threadsPerMeshThreadgroup:\0"
+    "drawMeshThreadgroupsWithIndirectBuffer:indirectBufferOffset:threadsPerObjectThreadgroup:threadsPerMeshThreadgroup:\0"
+    "drawMeshThreads:threadsPerObjectThreadgroup:threadsPerMeshThreadgroup:\0"
+    "drawPatches:patchIndexBuffer:patchIndexBufferOffset:indirectBuffer:indirectBufferOffset:\0"
+    "drawPatches:patchStart:patchCount:patchIndexBuffer:patchIndexBufferOffset:instanceCount:baseInstance:\0"
+    "drawPatches:patchStart:patchCount:patchIndexBuffer:patchIndexBufferOffset:instanceCount:baseInstance:tessellationFactorBuffer:tessellationFactorBufferOffset:tessellationFactorBufferInstanceStride:\0"
+    "drawPrimitives:indirectBuffer:indirectBufferOffset:\0"
+    "drawPrimitives:vertexStart:vertexCount:\0"
+    "drawPrimitives:vertexStart:vertexCount:instanceCount:\0"
+    "drawPrimitives:vertexStart:vertexCount:instanceCount:baseInstance:\0"
+    "drawableID\0"
+    "elementArrayType\0"
+    "elementIsArgumentBuffer\0"
+    "elementPointerType\0"
+    "elementStructType\0"
+    "elementTextureReferenceType\0"
+    "elementType\0"
+    "encodeSignalEvent:value:\0"
+    "encodeWaitForEvent:value:\0"
+    "encodedLength\0"
+    "encoderLabel\0"
+    "endEncoding\0"
+    "endOfEncoderSampleIndex\0"
+    "endOfFragmentSampleIndex\0"
+    "endOfVertexSampleIndex\0"
+    "enqueue\0"
+    "enqueueBarrier\0"
+    "error\0"
+    "errorOptions\0"
+    "errorState\0"
+    "executeCommandsInBuffer:indirectBuffer:indirectBufferOffset:\0"
+    "executeCommandsInBuffer:withRange:\0"
+    "fastMathEnabled\0"
+    "fillBuffer:range:value:\0"
+    "firstMipmapInTail\0"
+    "format\0"
+    "fragmentAdditionalBinaryFunctions\0"
+    "fragmentArguments\0"
+    "fragmentBindings\0"
+    "fragmentBuffers\0"
+    "fragmentFunction\0"
+    "fragmentLinkedFunctions\0"
+    "fragmentPreloadedLibraries\0"
+    "frontFaceStencil\0"
+    "function\0"
+    "functionConstantsDictionary\0"
+    "functionCount\0"
+    "functionDescriptor\0"
+    "functionGraphs\0"
+    "functionHandleWithFunction:\0"
+    "functionHandleWithFunction:stage:\0"
+    "functionName\0"
+    "functionNames\0"
+    "functionType\0"
+    "functions\0"
+    "generateMipmapsForTexture:\0"
+    "geometryDescriptors\0"
+    "getBytes:bytesPerRow:bytesPerImage:fromRegion:mipmapLevel:slice:\0"
+    "getBytes:bytesPerRow:fromRegion:mipmapLevel:\0"
+    "getDefaultSamplePositions:count:\0"
+    "getSamplePositions:count:\0"
+    "getTextureAccessCounters:region:mipLevel:slice:resetCounters:countersBuffer:countersBufferOffset:\0"
+    "gpuAddress\0"
+    "gpuResourceID\0"
+    "groups\0"
+    "hasUnifiedMemory\0"
+    "hazardTrackingMode\0"
+    "heap\0"
+    "heapAccelerationStructureSizeAndAlignWithDescriptor:\0"
+    "heapAccelerationStructureSizeAndAlignWithSize:\0"
+    "heapBufferSizeAndAlignWithLength:options:\0"
+    "heapOffset\0"
+    "heapTextureSizeAndAlignWithDescriptor:\0"
+    "height\0"
+    "horizontal\0"
+    "horizontalSampleStorage\0"
+    "imageblockMemoryLengthForDimensions:\0"
+    "imageblockSampleLength\0"
+    "index\0"
+    "indexBuffer\0"
+    "indexBufferIndex\0"
+    "indexBufferOffset\0"
+    "indexType\0"
+    "indirectComputeCommandAtIndex:\0"
+    "indirectRenderCommandAtIndex:\0"
+    "inheritBuffers\0"
+    "inheritPipelineState\0"
+    "init\0"
+    "initWithArgumentIndex:\0"
+    "initWithDispatchQueue:\0"
+    "initWithFunctionName:nodes:outputNode:attributes:\0"
+    "initWithName:arguments:controlDependencies:\0"
+    "initWithSampleCount:\0"
+    "initWithSampleCount:horizontal:vertical:\0"
+    "inputPrimitiveTopology\0"
+    "insertDebugCaptureBoundary\0"
+    "insertDebugSignpost:\0"
+    "insertLibraries\0"
+    "installName\0"
+    "instanceCount\0"
+    "instanceDescriptorBuffer\0"
+    "instanceDescriptorBufferOffset\0"
+    "instanceDescriptorStride\0"
+    "instanceDescriptorType\0"
+    "instancedAccelerationStructures\0"
+    "intersectionFunctionTableDescriptor\0"
+    "intersectionFunctionTableOffset\0"
+    "iosurface\0"
+    "iosurfacePlane\0"
+    "isActive\0"
+    "isAliasable\0"
+    "isAlphaToCoverageEnabled\0"
+    "isAlphaToOneEnabled\0"
+    "isArgument\0"
+    "isBlendingEnabled\0"
+    "isCapturing\0"
+    "isDepth24Stencil8PixelFormatSupported\0"
+    "isDepthTexture\0"
+    "isDepthWriteEnabled\0"
+    "isFramebufferOnly\0"
+    "isHeadless\0"
+    "isLowPower\0"
+    "isPatchControlPointData\0"
+    "isPatchData\0"
+    "isRasterizationEnabled\0"
+    "isRemovable\0"
+    "isShareable\0"
+    "isSparse\0"
+    "isTessellationFactorScaleEnabled\0"
+    "isUsed\0"
+    "kernelEndTime\0"
+    "kernelStartTime\0"
+    "label\0"
+    "languageVersion\0"
+    "layerAtIndex:\0"
+    "layerCount\0"
+    "layers\0"
+    "layouts\0"
+    "length\0"
+    "level\0"
+    "libraries\0"
+    "libraryType\0"
+    "line\0"
+    "linkedFunctions\0"
+    "loadAction\0"
+    "loadBuffer:offset:size:sourceHandle:sourceHandleOffset:\0"
+    "loadBytes:size:sourceHandle:sourceHandleOffset:\0"
+    "loadTexture:slice:level:size:sourceBytesPerRow:sourceBytesPerImage:destinationOrigin:sourceHandle:sourceHandleOffset:\0"
+    "location\0"
+    "locationNumber\0"
+    "lodAverage\0"
+    "lodMaxClamp\0"
+    "lodMinClamp\0"
+    "logs\0"
+    "magFilter\0"
+    "makeAliasable\0"
+    "mapPhysicalToScreenCoordinates:forLayer:\0"
+    "mapScreenToPhysicalCoordinates:forLayer:\0"
+    "maxAnisotropy\0"
+    "maxArgumentBufferSamplerCount\0"
+    "maxAvailableSizeWithAlignment:\0"
+    "maxBufferLength\0"
+    "maxCallStackDepth\0"
+    "maxCommandBufferCount\0"
+    "maxCommandsInFlight\0"
+    "maxFragmentBufferBindCount\0"
+    "maxFragmentCallStackDepth\0"
+    "maxKernelBufferBindCount\0"
+    "maxSampleCount\0"
+    "maxTessellationFactor\0"
+    "maxThreadgroupMemoryLength\0"
+    "maxThreadsPerThreadgroup\0"
+    "maxTotalThreadgroupsPerMeshGrid\0"
+    "maxTotalThreadsPerMeshThreadgroup\0"
+    "maxTotalThreadsPerObjectThreadgroup\0"
+    "maxTotalThreadsPerThreadgroup\0"
+    "maxTransferRate\0"
+    "maxVertexAmplificationCount\0"
+    "maxVertexBufferBindCount\0"
+    "maxVertexCallStackDepth\0"
+    "memberByName:\0"
+    "members\0"
+    "memoryBarrierWithResources:count:\0"
+    "memoryBarrierWithResources:count:afterStages:beforeStages:\0"
+    "memoryBarrierWithScope:\0"
+    "memoryBarrierWithScope:afterStages:beforeStages:\0"
+    "meshBindings\0"
+    "meshBuffers\0"
+    "meshFunction\0"
+    "meshThreadExecutionWidth\0"
+    "meshThreadgroupSizeIsMultipleOfThreadExecutionWidth\0"
+    "minFilter\0"
+    "minimumLinearTextureAlignmentForPixelFormat:\0"
+    "minimumTextureBufferAlignmentForPixelFormat:\0"
+    "mipFilter\0"
+    "mipmapLevelCount\0"
+    "motionEndBorderMode\0"
+    "motionEndTime\0"
+    "motionKeyframeCount\0"
+    "motionStartBorderMode\0"
+    "motionStartTime\0"
+    "motionTransformBuffer\0"
+    "motionTransformBufferOffset\0"
+    "motionTransformCount\0"
+    "moveTextureMappingsFromTexture:sourceSlice:sourceLevel:sourceOrigin:sourceSize:toTexture:destinationSlice:destinationLevel:destinationOrigin:\0"
+    "mutability\0"
+    "name\0"
+    "newAccelerationStructureWithDescriptor:\0"
+    "newAccelerationStructureWithDescriptor:offset:\0"
+    "newAccelerationStructureWithSize:\0"
+    "newAccelerationStructureWithSize:offset:\0"
+    "newArgumentEncoderForBufferAtIndex:\0"
+    "newArgumentEncoderWithArguments:\0"
+    "newArgumentEncoderWithBufferBinding:\0"
+    "newArgumentEncoderWithBufferIndex:\0"
+    "newArgumentEncoderWithBufferIndex:reflection:\0"
+    "newBinaryArchiveWithDescriptor:error:\0"
+    "newBufferWithBytes:length:options:\0"
+    "newBufferWithBytesNoCopy:length:options:deallocator:\0"
+    "newBufferWithLength:options:\0"
+    "newBufferWithLength:options:offset:\0"
+    "newCaptureScopeWithCommandQueue:\0"
+    "newCaptureScopeWithDevice:\0"
+    "newCommandQueue\0"
+    "newCommandQueueWithMaxCommandBufferCount:\0"
+    "newComputePipelineStateWithAdditionalBinaryFunctions:error:\0"
+    "newComputePipelineStateWithDescriptor:options:completionHandler:\0"
+    "newComputePipelineStateWithDescriptor:options:reflection:error:\0"
+    "newComputePipelineStateWithFunction:completionHandler:\0"
+    "newComputePipelineStateWithFunction:error:\0"
+    "newComputePipelineStateWithFunction:options:completionHandler:\0"
+    "newComputePipelineStateWithFunction:options:reflection:error:\0"
+    "newCounterSampleBufferWithDescriptor:error:\0"
+    "newDefaultLibrary\0"
+    "newDefaultLibraryWithBundle:error:\0"
+    "newDepthStencilStateWithDescriptor:\0"
+    "newDynamicLibrary:error:\0"
+    "newDynamicLibraryWithURL:error:\0"
+    "newEvent\0"
+    "newFence\0"
+    "newFunctionWithDescriptor:completionHandler:\0"
+    "newFunctionWithDescriptor:error:\0"
+    "newFunctionWithName:\0"
+    "newFunctionWithName:constantValues:completionHandler:\0"
+    "newFunctionWithName:constantValues:error:\0"
+    "newHeapWithDescriptor:\0"
+    "newIOCommandQueueWithDescriptor:error:\0"
+    "newIOHandleWithURL:compressionMethod:error:\0"
+    "newIOHandleWithURL:error:\0"
+    "newIndirectCommandBufferWithDescriptor:maxCommandCount:options:\0"
+    "newIntersectionFunctionTableWithDescriptor:\0"
+    "newIntersectionFunctionTableWithDescriptor:stage:\0"
+    "newIntersectionFunctionWithDescriptor:completionHandler:\0"
+    "newIntersectionFunctionWithDescriptor:error:\0"
+    "newLibraryWithData:error:\0"
+    "newLibraryWithFile:error:\0"
+    "newLibraryWithSource:options:completionHandler:\0"
+    "newLibraryWithSource:options:error:\0"
+    "newLibraryWithStitchedDescriptor:completionHandler:\0"
+    "newLibraryWithStitchedDescriptor:error:\0"
+    "newLibraryWithURL:error:\0"
+    "newRasterizationRateMapWithDescriptor:\0"
+    "newRemoteBufferViewForDevice:\0"
+    "newRemoteTextureViewForDevice:\0"
+    "newRenderPipelineStateWithAdditionalBinaryFunctions:error:\0"
+    "newRenderPipelineStateWithDescriptor:completionHandler:\0"
+    "newRenderPipelineStateWithDescriptor:error:\0"
+    "newRenderPipelineStateWithDescriptor:options:completionHandler:\0"
+    "newRenderPipelineStateWithDescriptor:options:reflection:error:\0"
+    "newRenderPipelineStateWithMeshDescriptor:options:completionHandler:\0"
+    "newRenderPipelineStateWithMeshDescriptor:options:reflection:error:\0"
+    "newRenderPipelineStateWithTileDescriptor:options:completionHandler:\0"
+    "newRenderPipelineStateWithTileDescriptor:options:reflection:error:\0"
+    "newSamplerStateWithDescriptor:\0"
+    "newScratchBufferWithMinimumSize:\0"
+    "newSharedEvent\0"
+    "newSharedEventHandle\0"
+    "newSharedEventWithHandle:\0"
+    "newSharedTextureHandle\0"
+    "newSharedTextureWithDescriptor:\0"
+    "newSharedTextureWithHandle:\0"
+    "newTextureViewWithPixelFormat:\0"
+    "newTextureViewWithPixelFormat:textureType:levels:slices:\0"
+    "newTextureViewWithPixelFormat:textureType:levels:slices:swizzle:\0"
+    "newTextureWithDescriptor:\0"
+    "newTextureWithDescriptor:iosurface:plane:\0"
+    "newTextureWithDescriptor:offset:\0"
+    "newTextureWithDescriptor:offset:bytesPerRow:\0"
+    "newVisibleFunctionTableWithDescriptor:\0"
+    "newVisibleFunctionTableWithDescriptor:stage:\0"
+    "nodes\0"
+    "normalizedCoordinates\0"
+    "notifyListener:atValue:block:\0"
+    "objectAtIndexedSubscript:\0"
+    "objectBindings\0"
+    "objectBuffers\0"
+    "objectFunction\0"
+    "objectPayloadAlignment\0"
+    "objectPayloadDataSize\0"
+    "objectThreadExecutionWidth\0"
+    "objectThreadgroupSizeIsMultipleOfThreadExecutionWidth\0"
+    "offset\0"
+    "opaque\0"
+    "optimizationLevel\0"
+    "optimizeContentsForCPUAccess:\0"
+    "optimizeContentsForCPUAccess:slice:level:\0"
+    "optimizeContentsForGPUAccess:\0"
+    "optimizeContentsForGPUAccess:slice:level:\0"
+    "optimizeIndirectCommandBuffer:withRange:\0"
+    "options\0"
+    "outputNode\0"
+    "outputURL\0"
+    "parallelRenderCommandEncoderWithDescriptor:\0"
+    "parameterBufferSizeAndAlign\0"
+    "parentRelativeLevel\0"
+    "parentRelativeSlice\0"
+    "parentTexture\0"
+    "patchControlPointCount\0"
+    "patchType\0"
+    "payloadMemoryLength\0"
+    "peerCount\0"
+    "peerGroupID\0"
+    "peerIndex\0"
+    "physicalGranularity\0"
+    "physicalSizeForLayer:\0"
+    "pixelFormat\0"
+    "pointerType\0"
+    "popDebugGroup\0"
+    "preloadedLibraries\0"
+    "preprocessorMacros\0"
+    "present\0"
+    "presentAfterMinimumDuration:\0"
+    "presentAtTime:\0"
+    "presentDrawable:\0"
+    "presentDrawable:afterMinimumDuration:\0"
+    "presentDrawable:atTime:\0"
+    "presentedTime\0"
+    "preserveInvariance\0"
+    "primitiveDataBuffer\0"
+    "primitiveDataBufferOffset\0"
+    "primitiveDataElementSize\0"
+    "primitiveDataStride\0"
+    "priority\0"
+    "privateFunctions\0"
+    "pushDebugGroup:\0"
+    "rAddressMode\0"
+    "rasterSampleCount\0"
+    "rasterizationRateMap\0"
+    "rasterizationRateMapDescriptorWithScreenSize:\0"
+    "rasterizationRateMapDescriptorWithScreenSize:layer:\0"
+    "rasterizationRateMapDescriptorWithScreenSize:layerCount:layers:\0"
+    "readMask\0"
+    "readWriteTextureSupport\0"
+    "recommendedMaxWorkingSetSize\0"
+    "refitAccelerationStructure:descriptor:destination:scratchBuffer:scratchBufferOffset:\0"
+    "refitAccelerationStructure:descriptor:destination:scratchBuffer:scratchBufferOffset:options:\0"
+    "registryID\0"
+    "remoteStorageBuffer\0"
+    "remoteStorageTexture\0"
+    "removeAllDebugMarkers\0"
+    "renderCommandEncoder\0"
+    "renderCommandEncoderWithDescriptor:\0"
+    "renderPassDescriptor\0"
+    "renderTargetArrayLength\0"
+    "renderTargetHeight\0"
+    "renderTargetWidth\0"
+    "replaceRegion:mipmapLevel:slice:withBytes:bytesPerRow:bytesPerImage:\0"
+    "replaceRegion:mipmapLevel:withBytes:bytesPerRow:\0"
+    "required\0"
+    "reset\0"
+    "resetCommandsInBuffer:withRange:\0"
+    "resetTextureAccessCounters:region:mipLevel:slice:\0"
+    "resetWithRange:\0"
+    "resolveCounterRange:\0"
+    "resolveCounters:inRange:destinationBuffer:destinationOffset:\0"
+    "resolveDepthPlane\0"
+    "resolveLevel\0"
+    "resolveSlice\0"
+    "resolveTexture\0"
+    "resourceOptions\0"
+    "resourceStateCommandEncoder\0"
+    "resourceStateCommandEncoderWithDescriptor:\0"
+    "resourceStatePassDescriptor\0"
+    "retainedReferences\0"
+    "rgbBlendOperation\0"
+    "rootResource\0"
+    "sAddressMode\0"
+    "sampleBuffer\0"
+    "sampleBufferAttachments\0"
+    "sampleCount\0"
+    "sampleCountersInBuffer:atSampleIndex:withBarrier:\0"
+    "sampleTimestamps:gpuTimestamp:\0"
+    "scratchBufferAllocator\0"
+    "screenSize\0"
+    "serializeToURL:error:\0"
+    "setAccelerationStructure:atBufferIndex:\0"
+    "setAccelerationStructure:atIndex:\0"
+    "setAccess:\0"
+    "setAllowDuplicateIntersectionFunctionInvocation:\0"
+    "setAllowGPUOptimizedContents:\0"
+    "setAlphaBlendOperation:\0"
+    "setAlphaToCoverageEnabled:\0"
+    "setAlphaToOneEnabled:\0"
+    "setArgumentBuffer:offset:\0"
+    "setArgumentBuffer:startOffset:arrayElement:\0"
+    "setArgumentIndex:\0"
+    "setArguments:\0"
+    "setArrayLength:\0"
+    "setAttributes:\0"
+    "setBackFaceStencil:\0"
+    "setBarrier\0"
+    "setBinaryArchives:\0"
+    "setBinaryFunctions:\0"
+    "setBlendColorRed:green:blue:alpha:\0"
+    "setBlendingEnabled:\0"
+    "setBorderColor:\0"
+    "setBoundingBoxBuffer:\0"
+    "setBoundingBoxBufferOffset:\0"
+    "setBoundingBoxBuffers:\0"
+    "setBoundingBoxCount:\0"
+    "setBoundingBoxStride:\0"
+    "setBuffer:\0"
+    "setBuffer:offset:atIndex:\0"
+    "setBufferIndex:\0"
+    "setBufferOffset:atIndex:\0"
+    "setBuffers:offsets:withRange:\0"
+    "setBytes:length:atIndex:\0"
+    "setCaptureObject:\0"
+    "setClearColor:\0"
+    "setClearDepth:\0"
+    "setClearStencil:\0"
+    "setColorStoreAction:atIndex:\0"
+    "setColorStoreActionOptions:atIndex:\0"
+    "setCommandTypes:\0"
+    "setCompareFunction:\0"
+    "setCompressionType:\0"
+    "setComputeFunction:\0"
+    "setComputePipelineState:\0"
+    "setComputePipelineState:atIndex:\0"
+    "setComputePipelineStates:withRange:\0"
+    "setConstantBlockAlignment:\0"
+    "setConstantValue:type:atIndex:\0"
+    "setConstantValue:type:withName:\0"
+    "setConstantValues:\0"
+    "setConstantValues:type:withRange:\0"
+    "setControlDependencies:\0"
+    "setCounterSet:\0"
+    "setCpuCacheMode:\0"
+    "setCullMode:\0"
+    "setDataType:\0"
+    "setDefaultCaptureScope:\0"
+    "setDefaultRasterSampleCount:\0"
+    "setDepth:\0"
+    "setDepthAttachment:\0"
+    "setDepthAttachmentPixelFormat:\0"
+    "setDepthBias:slopeScale:clamp:\0"
+    "setDepthClipMode:\0"
+    "setDepthCompareFunction:\0"
+    "setDepthFailureOperation:\0"
+    "setDepthPlane:\0"
+    "setDepthResolveFilter:\0"
+    "setDepthStencilPassOperation:\0"
+    "setDepthStencilState:\0"
+    "setDepthStoreAction:\0"
+    "setDepthStoreActionOptions:\0"
+    "setDepthWriteEnabled:\0"
+    "setDestination:\0"
+    "setDestinationAlphaBlendFactor:\0"
+    "setDestinationRGBBlendFactor:\0"
+    "setDispatchType:\0"
+    "setEndOfEncoderSampleIndex:\0"
+    "setEndOfFragmentSampleIndex:\0"
+    "setEndOfVertexSampleIndex:\0"
+    "setErrorOptions:\0"
+    "setFastMathEnabled:\0"
+    "setFormat:\0"
+    "setFragmentAccelerationStructure:atBufferIndex:\0"
+    "setFragmentAdditionalBinaryFunctions:\0"
+    "setFragmentBuffer:offset:atIndex:\0"
+    "setFragmentBufferOffset:atIndex:\0"
+    "setFragmentBuffers:offsets:withRange:\0"
+    "setFragmentBytes:length:atIndex:\0"
+    "setFragmentFunction:\0"
+    "setFragmentIntersectionFunctionTable:atBufferIndex:\0"
+    "setFragmentIntersectionFunctionTables:withBufferRange:\0"
+    "setFragmentLinkedFunctions:\0"
+    "setFragmentPreloadedLibraries:\0"
+    "setFragmentSamplerState:atIndex:\0"
+    "setFragmentSamplerState:lodMinClamp:lodMaxClamp:atIndex:\0"
+    "setFragmentSamplerStates:lodMinClamps:lodMaxClamps:withRange:\0"
+    "setFragmentSamplerStates:withRange:\0"
+    "setFragmentTexture:atIndex:\0"
+    "setFragmentTextures:withRange:\0"
+    "setFragmentVisibleFunctionTable:atBufferIndex:\0"
+    "setFragmentVisibleFunctionTables:withBufferRange:\0"
+    "setFrontFaceStencil:\0"
+    "setFrontFacingWinding:\0"
+    "setFunction:atIndex:\0"
+    "setFunctionCount:\0"
+    "setFunctionGraphs:\0"
+    "setFunctionName:\0"
+    "setFunctions:\0"
+    "setFunctions:withRange:\0"
+    "setGeometryDescriptors:\0"
+    "setGroups:\0"
+    "setHazardTrackingMode:\0"
+    "setHeight:\0"
+    "setImageblockSampleLength:\0"
+    "setImageblockWidth:height:\0"
+    "setIndex:\0"
+    "setIndexBuffer:\0"
+    "setIndexBufferIndex:\0"
+    "setIndexBufferOffset:\0"
+    "setIndexType:\0"
+    "setIndirectCommandBuffer:atIndex:\0"
+    "setIndirectCommandBuffers:withRange:\0"
+    "setInheritBuffers:\0"
+    "setInheritPipelineState:\0"
+    "setInputPrimitiveTopology:\0"
+    "setInsertLibraries:\0"
+    "setInstallName:\0"
+    "setInstanceCount:\0"
+    "setInstanceDescriptorBuffer:\0"
+    "setInstanceDescriptorBufferOffset:\0"
+    "setInstanceDescriptorStride:\0"
+    "setInstanceDescriptorType:\0"
+    "setInstancedAccelerationStructures:\0"
+    "setIntersectionFunctionTable:atBufferIndex:\0"
+    "setIntersectionFunctionTable:atIndex:\0"
+    "setIntersectionFunctionTableOffset:\0"
+    "setIntersectionFunctionTables:withBufferRange:\0"
+    "setIntersectionFunctionTables:withRange:\0"
+    "setKernelBuffer:offset:atIndex:\0"
+    "setLabel:\0"
+    "setLanguageVersion:\0"
+    "setLayer:atIndex:\0"
+    "setLevel:\0"
+    "setLibraries:\0"
+    "setLibraryType:\0"
+    "setLinkedFunctions:\0"
+    "setLoadAction:\0"
+    "setLodAverage:\0"
+    "setLodMaxClamp:\0"
+    "setLodMinClamp:\0"
+    "setMagFilter:\0"
+    "setMaxAnisotropy:\0"
+    "setMaxCallStackDepth:\0"
+    "setMaxCommandBufferCount:\0"
+    "setMaxCommandsInFlight:\0"
+    "setMaxFragmentBufferBindCount:\0"
+    "setMaxFragmentCallStackDepth:\0"
+    "setMaxKernelBufferBindCount:\0"
+    "setMaxTessellationFactor:\0"
+    "setMaxTotalThreadgroupsPerMeshGrid:\0"
+    "setMaxTotalThreadsPerMeshThreadgroup:\0"
+    "setMaxTotalThreadsPerObjectThreadgroup:\0"
+    "setMaxTotalThreadsPerThreadgroup:\0"
+    "setMaxVertexAmplificationCount:\0"
+    "setMaxVertexBufferBindCount:\0"
+    "setMaxVertexCallStackDepth:\0"
+    "setMeshBuffer:offset:atIndex:\0"
+    "setMeshBufferOffset:atIndex:\0"
+    "setMeshBuffers:offsets:withRange:\0"
+    "setMeshBytes:length:atIndex:\0"
+    "setMeshFunction:\0"
+    "setMeshSamplerState:atIndex:\0"
+    "setMeshSamplerState:lodMinClamp:lodMaxClamp:atIndex:\0"
+    "setMeshSamplerStates:lodMinClamps:lodMaxClamps:withRange:\0"
+    "setMeshSamplerStates:withRange:\0"
+    "setMeshTexture:atIndex:\0"
+    "setMeshTextures:withRange:\0"
+    "setMeshThreadgroupSizeIsMultipleOfThreadExecutionWidth:\0"
+    "setMinFilter:\0"
+    "setMipFilter:\0"
+    "setMipmapLevelCount:\0"
+    "setMotionEndBorderMode:\0"
+    "setMotionEndTime:\0"
+    "setMotionKeyframeCount:\0"
+    "setMotionStartBorderMode:\0"
+    "setMotionStartTime:\0"
+    "setMotionTransformBuffer:\0"
+    "setMotionTransformBufferOffset:\0"
+    "setMotionTransformCount:\0"
+    "setMutability:\0"
+    "setName:\0"
+    "setNodes:\0"
+    "setNormalizedCoordinates:\0"
+    "setObject:atIndexedSubscript:\0"
+    "setObjectBuffer:offset:atIndex:\0"
+    "setObjectBufferOffset:atIndex:\0"
+    "setObjectBuffers:offsets:withRange:\0"
+    "setObjectBytes:length:atIndex:\0"
+    "setObjectFunction:\0"
+    "setObjectSamplerState:atIndex:\0"
+    "setObjectSamplerState:lodMinClamp:lodMaxClamp:atIndex:\0"
+    "setObjectSamplerStates:lodMinClamps:lodMaxClamps:withRange:\0"
+    "setObjectSamplerStates:withRange:\0"
+    "setObjectTexture:atIndex:\0"
+    "setObjectTextures:withRange:\0"
+    "setObjectThreadgroupMemoryLength:atIndex:\0"
+    "setObjectThreadgroupSizeIsMultipleOfThreadExecutionWidth:\0"
+    "setOffset:\0"
+    "setOpaque:\0"
+    "setOpaqueTriangleIntersectionFunctionWithSignature:atIndex:\0"
+    "setOpaqueTriangleIntersectionFunctionWithSignature:withRange:\0"
+    "setOptimizationLevel:\0"
+    "setOptions:\0"
+    "setOutputNode:\0"
+    "setOutputURL:\0"
+    "setPayloadMemoryLength:\0"
+    "setPixelFormat:\0"
+    "setPreloadedLibraries:\0"
+    "setPreprocessorMacros:\0"
+    "setPreserveInvariance:\0"
+    "setPrimitiveDataBuffer:\0"
+    "setPrimitiveDataBufferOffset:\0"
+    "setPrimitiveDataElementSize:\0"
+    "setPrimitiveDataStride:\0"
+    "setPriority:\0"
+    "setPrivateFunctions:\0"
+    "setPurgeableState:\0"
+    "setRAddressMode:\0"
+    "setRasterSampleCount:\0"
+    "setRasterizationEnabled:\0"
+    "setRasterizationRateMap:\0"
+    "setReadMask:\0"
+    "setRenderPipelineState:\0"
+    "setRenderPipelineState:atIndex:\0"
+    "setRenderPipelineStates:withRange:\0"
+    "setRenderTargetArrayLength:\0"
+    "setRenderTargetHeight:\0"
+    "setRenderTargetWidth:\0"
+    "setResolveDepthPlane:\0"
+    "setResolveLevel:\0"
+    "setResolveSlice:\0"
+    "setResolveTexture:\0"
+    "setResourceOptions:\0"
+    "setRetainedReferences:\0"
+    "setRgbBlendOperation:\0"
+    "setSAddressMode:\0"
+    "setSampleBuffer:\0"
+    "setSampleCount:\0"
+    "setSamplePositions:count:\0"
+    "setSamplerState:atIndex:\0"
+    "setSamplerState:lodMinClamp:lodMaxClamp:atIndex:\0"
+    "setSamplerStates:lodMinClamps:lodMaxClamps:withRange:\0"
+    "setSamplerStates:withRange:\0"
+    "setScissorRect:\0"
+    "setScissorRects:count:\0"
+    "setScratchBufferAllocator:\0"
+    "setScreenSize:\0"
+    "setSignaledValue:\0"
+    "setSize:\0"
+    "setSlice:\0"
+    "setSourceAlphaBlendFactor:\0"
+    "setSourceRGBBlendFactor:\0"
+    "setSparsePageSize:\0"
+    "setSpecializedName:\0"
+    "setStageInRegion:\0"
+    "setStageInRegionWithIndirectBuffer:indirectBufferOffset:\0"
+    "setStageInputDescriptor:\0"
+    "setStartOfEncoderSampleIndex:\0"
+    "setStartOfFragmentSampleIndex:\0"
+    "setStartOfVertexSampleIndex:\0"
+    "setStencilAttachment:\0"
+    "setStencilAttachmentPixelFormat:\0"
+    "setStencilCompareFunction:\0"
+    "setStencilFailureOperation:\0"
+    "setStencilFrontReferenceValue:backReferenceValue:\0"
+    "setStencilReferenceValue:\0"
+    "setStencilResolveFilter:\0"
+    "setStencilStoreAction:\0"
+    "setStencilStoreActionOptions:\0"
+    "setStepFunction:\0"
+    "setStepRate:\0"
+    "setStorageMode:\0"
+    "setStoreAction:\0"
+    "setStoreActionOptions:\0"
+    "setStride:\0"
+    "setSupportAddingBinaryFunctions:\0"
+    "setSupportAddingFragmentBinaryFunctions:\0"
+    "setSupportAddingVertexBinaryFunctions:\0"
+    "setSupportArgumentBuffers:\0"
+    "setSupportIndirectCommandBuffers:\0"
+    "setSupportRayTracing:\0"
+    "setSwizzle:\0"
+    "setTAddressMode:\0"
+    "setTessellationControlPointIndexType:\0"
+    "setTessellationFactorBuffer:offset:instanceStride:\0"
+    "setTessellationFactorFormat:\0"
+    "setTessellationFactorScale:\0"
+    "setTessellationFactorScaleEnabled:\0"
+    "setTessellationFactorStepFunction:\0"
+    "setTessellationOutputWindingOrder:\0"
+    "setTessellationPartitionMode:\0"
+    "setTexture:\0"
+    "setTexture:atIndex:\0"
+    "setTextureType:\0"
+    "setTextures:withRange:\0"
+    "setThreadGroupSizeIsMultipleOfThreadExecutionWidth:\0"
+    "setThreadgroupMemoryLength:\0"
+    "setThreadgroupMemoryLength:atIndex:\0"
+    "setThreadgroupMemoryLength:offset:atIndex:\0"
+    "setThreadgroupSizeMatchesTileSize:\0"
+    "setTileAccelerationStructure:atBufferIndex:\0"
+    "setTileAdditionalBinaryFunctions:\0"
+    "setTileBuffer:offset:atIndex:\0"
+    "setTileBufferOffset:atIndex:\0"
+    "setTileBuffers:offsets:withRange:\0"
+    "setTileBytes:length:atIndex:\0"
+    "setTileFunction:\0"
+    "setTileHeight:\0"
+    "setTileIntersectionFunctionTable:atBufferIndex:\0"
+    "setTileIntersectionFunctionTables:withBufferRange:\0"
+    "setTileSamplerState:atIndex:\0"
+    "setTileSamplerState:lodMinClamp:lodMaxClamp:atIndex:\0"
+    "setTileSamplerStates:lodMinClamps:lodMaxClamps:withRange:\0"
+    "setTileSamplerStates:withRange:\0"
+    "setTileTexture:atIndex:\0"
+    "setTileTextures:withRange:\0"
+    "setTileVisibleFunctionTable:atBufferIndex:\0"
+    "setTileVisibleFunctionTables:withBufferRange:\0"
+    "setTileWidth:\0"
+    "setTransformationMatrixBuffer:\0"
+    "setTransformationMatrixBufferOffset:\0"
+    "setTriangleCount:\0"
+    "setTriangleFillMode:\0"
+    "setType:\0"
+    "setUrl:\0"
+    "setUsage:\0"
+    "setVertexAccelerationStructure:atBufferIndex:\0"
+    "setVertexAdditionalBinaryFunctions:\0"
+    "setVertexAmplificationCount:viewMappings:\0"
+    "setVertexBuffer:\0"
+    "setVertexBuffer:offset:atIndex:\0"
+    "setVertexBufferOffset:\0"
+    "setVertexBufferOffset:atIndex:\0"
+    "setVertexBuffers:\0"
+    "setVertexBuffers:offsets:withRange:\0"
+    "setVertexBytes:length:atIndex:\0"
+    "setVertexDescriptor:\0"
+    "setVertexFormat:\0"
+    "setVertexFunction:\0"
+    "setVertexIntersectionFunctionTable:atBufferIndex:\0"
+    "setVertexIntersectionFunctionTables:withBufferRange:\0"
+    "setVertexLinkedFunctions:\0"
+    "setVertexPreloadedLibraries:\0"
+    "setVertexSamplerState:atIndex:\0"
+    "setVertexSamplerState:lodMinClamp:lodMaxClamp:atIndex:\0"
+    "setVertexSamplerStates:lodMinClamps:lodMaxClamps:withRange:\0"
+    "setVertexSamplerStates:withRange:\0"
+    "setVertexStride:\0"
+    "setVertexTexture:atIndex:\0"
+    "setVertexTextures:withRange:\0"
+    "setVertexVisibleFunctionTable:atBufferIndex:\0"
+    "setVertexVisibleFunctionTables:withBufferRange:\0"
+    "setViewport:\0"
+    "setViewports:count:\0"
+    "setVisibilityResultBuffer:\0"
+    "setVisibilityResultMode:offset:\0"
+    "setVisibleFunctionTable:atBufferIndex:\0"
+    "setVisibleFunctionTable:atIndex:\0"
+    "setVisibleFunctionTables:withBufferRange:\0"
+    "setVisibleFunctionTables:withRange:\0"
+    "setWidth:\0"
+    "setWriteMask:\0"
+    "sharedCaptureManager\0"
+    "signalEvent:value:\0"
+    "signaledValue\0"
+    "size\0"
+    "slice\0"
+    "sourceAlphaBlendFactor\0"
+    "sourceRGBBlendFactor\0"
+    "sparsePageSize\0"
+    "sparseTileSizeInBytes\0"
+    "sparseTileSizeInBytesForSparsePageSize:\0"
+    "sparseTileSizeWithTextureType:pixelFormat:sampleCount:\0"
+    "sparseTileSizeWithTextureType:pixelFormat:sampleCount:sparsePageSize:\0"
+    "specializedName\0"
+    "stageInputAttributes\0"
+    "stageInputDescriptor\0"
+    "stageInputOutputDescriptor\0"
+    "startCaptureWithCommandQueue:\0"
+    "startCaptureWithDescriptor:error:\0"
+    "startCaptureWithDevice:\0"
+    "startCaptureWithScope:\0"
+    "startOfEncoderSampleIndex\0"
+    "startOfFragmentSampleIndex\0"
+    "startOfVertexSampleIndex\0"
+    "staticThreadgroupMemoryLength\0"
+    "status\0"
+    "stencilAttachment\0"
+    "stencilAttachmentPixelFormat\0"
+    "stencilCompareFunction\0"
+    "stencilFailureOperation\0"
+    "stencilResolveFilter\0"
+    "stepFunction\0"
+    "stepRate\0"
+    "stopCapture\0"
+    "storageMode\0"
+    "storeAction\0"
+    "storeActionOptions\0"
+    "stride\0"
+    "structType\0"
+    "supportAddingBinaryFunctions\0"
+    "supportAddingFragmentBinaryFunctions\0"
+    "supportAddingVertexBinaryFunctions\0"
+    "supportArgumentBuffers\0"
+    "supportIndirectCommandBuffers\0"
+    "supportRayTracing\0"
+    "supports32BitFloatFiltering\0"
+    "supports32BitMSAA\0"
+    "supportsBCTextureCompression\0"
+    "supportsCounterSampling:\0"
+    "supportsDestination:\0"
+    "supportsDynamicLibraries\0"
+    "supportsFamily:\0"
+    "supportsFeatureSet:\0"
+    "supportsFunctionPointers\0"
+    "supportsFunctionPointersFromRender\0"
+    "supportsPrimitiveMotionBlur\0"
+    "supportsPullModelInterpolation\0"
+    "supportsQueryTextureLOD\0"
+    "supportsRasterizationRateMapWithLayerCount:\0"
+    "supportsRaytracing\0"
+    "supportsRaytracingFromRender\0"
+    "supportsRenderDynamicLibraries\0"
+    "supportsShaderBarycentricCoordinates\0"
+    "supportsTextureSampleCount:\0"
+    "supportsVertexAmplificationCount:\0"
+    "swizzle\0"
+    "synchronizeResource:\0"
+    "synchronizeTexture:slice:level:\0"
+    "tAddressMode\0"
+    "tailSizeInBytes\0"
+    "tessellationControlPointIndexType\0"
+    "tessellationFactorFormat\0"
+    "tessellationFactorStepFunction\0"
+    "tessellationOutputWindingOrder\0"
+    "tessellationPartitionMode\0"
+    "texture\0"
+    "texture2DDescriptorWithPixelFormat:width:height:mipmapped:\0"
+    "textureBarrier\0"
+    "textureBufferDescriptorWithPixelFormat:width:resourceOptions:usage:\0"
+    "textureCubeDescriptorWithPixelFormat:size:mipmapped:\0"
+    "textureDataType\0"
+    "textureReferenceType\0"
+    "textureType\0"
+    "threadExecutionWidth\0"
+    "threadGroupSizeIsMultipleOfThreadExecutionWidth\0"
+    "threadgroupMemoryAlignment\0"
+    "threadgroupMemoryDataSize\0"
+    "threadgroupMemoryLength\0"
+    "threadgroupSizeMatchesTileSize\0"
+    "tileAdditionalBinaryFunctions\0"
+    "tileArguments\0"
+    "tileBindings\0"
+    "tileBuffers\0"
+    "tileFunction\0"
+    "tileHeight\0"
+    "tileWidth\0"
+    "transformationMatrixBuffer\0"
+    "transformationMatrixBufferOffset\0"
+    "triangleCount\0"
+    "tryCancel\0"
+    "type\0"
+    "updateFence:\0"
+    "updateFence:afterStages:\0"
+    "updateTextureMapping:mode:indirectBuffer:indirectBufferOffset:\0"
+    "updateTextureMapping:mode:region:mipLevel:slice:\0"
+    "updateTextureMappings:mode:regions:mipLevels:slices:numRegions:\0"
+    "url\0"
+    "usage\0"
+    "useHeap:\0"
+    "useHeap:stages:\0"
+    "useHeaps:count:\0"
+    "useHeaps:count:stages:\0"
+    "useResource:usage:\0"
+    "useResource:usage:stages:\0"
+    "useResources:count:usage:\0"
+    "useResources:count:usage:stages:\0"
+    "usedSize\0"
+    "vertexAdditionalBinaryFunctions\0"
+    "vertexArguments\0"
+    "vertexAttributes\0"
+    "vertexBindings\0"
+    "vertexBuffer\0"
+    "vertexBufferOffset\0"
+    "vertexBuffers\0"
+    "vertexDescriptor\0"
+    "vertexFormat\0"
+    "vertexFunction\0"
+    "vertexLinkedFunctions\0"
+    "vertexPreloadedLibraries\0"
+    "vertexStride\0"
+    "vertical\0"
+    "verticalSampleStorage\0"
+    "visibilityResultBuffer\0"
+    "visibleFunctionTableDescriptor\0"
+    "waitForEvent:value:\0"
+    "waitForFence:\0"
+    "waitForFence:beforeStages:\0"
+    "waitUntilCompleted\0"
+    "waitUntilScheduled\0"
+    "width\0"
+    "writeCompactedAccelerationStructureSize:toBuffer:offset:\0"
+    "writeCompactedAccelerationStructureSize:toBuffer:offset:sizeDataType:\0"
+    "writeMask\0";
+
+static bool RegisterTable()
+{
+    const char* pName = s_kTableNames;
+
+    for (std::size_t i = 0; i < static_cast<std::size_t>(Index::Count); ++i)
+    {
+        s_kTable[i] = sel_registerName(pName);
+        pName += std::strlen(pName) + 1;
+    }
+
+    return true;
+}
+
+static const bool s_kTableRegistered = RegisterTable();
+
+}
+
+#endif // MTL_PRIVATE_IMPLEMENTATION
+
+#undef _MTL_PRIVATE_SEL
+#undef _MTL_PRIVATE_DEF_SEL
+#define _MTL_PRIVATE_SEL(accessor) (Private::Selector::s_kTable[static_cast<std::size_t>(Private::Selector::Index::accessor)])
+#define _MTL_PRIVATE_DEF_SEL(accessor, symbol) static_assert(Index::accessor < Index::Count, "Regenerate MTLSelectorTable.hpp: " symbol)
+
+#endif // METALCPP_SELECTOR_TABLE
+
 namespace MTL
 {
 namespace Private
@@ -6269,10 +9740,19 @@ _MTL_INLINE MTL::Texture* MTL::Texture::newTextureView(MTL::PixelFormat pixelFor
 #define _CA_VALIDATE_SIZE(ns, name) _NS_VALIDATE_SIZE(ns, name)
 #define _CA_VALIDATE_ENUM(ns, name) _NS_VALIDATE_ENUM(ns, name)
 
+#ifdef METALCPP_LAZY_REGISTRATION
+
+#endif // METALCPP_LAZY_REGISTRATION
+
 #include <objc/runtime.h>
 
+#ifdef METALCPP_LAZY_REGISTRATION
+#define _CA_PRIVATE_CLS(symbol) (Private::Class::s_l##symbol.get())
+#define _CA_PRIVATE_SEL(accessor) (Private::Selector::s_l##accessor.get())
+#else
 #define _CA_PRIVATE_CLS(symbol) (Private::Class::s_k##symbol)
 #define _CA_PRIVATE_SEL(accessor) (Private::Selector::s_k##accessor)
+#endif // METALCPP_LAZY_REGISTRATION
 
 #if defined(CA_PRIVATE_IMPLEMENTATION)
 
@@ -6292,18 +9772,30 @@ _MTL_INLINE MTL::Texture* MTL::Texture::newTextureView(MTL::PixelFormat pixelFor
 #define _CA_PRIVATE_OBJC_GET_PROTOCOL(symbol) objc_getProtocol(#symbol)
 #endif // __OBJC__
 
+#ifdef METALCPP_LAZY_REGISTRATION
+#define _CA_PRIVATE_DEF_CLS(symbol) NS::Private::LazyClass s_l##symbol _CA_PRIVATE_VISIBILITY = { #symbol }
+#define _CA_PRIVATE_DEF_PRO(symbol) NS::Private::LazyProtocol s_l##symbol _CA_PRIVATE_VISIBILITY = { #symbol }
+#define _CA_PRIVATE_DEF_SEL(accessor, symbol) NS::Private::LazySelector s_l##accessor _CA_PRIVATE_VISIBILITY = { symbol }
+#else
 #define _CA_PRIVATE_DEF_CLS(symbol) void* s_k##symbol _CA_PRIVATE_VISIBILITY = _CA_PRIVATE_OBJC_LOOKUP_CLASS(symbol)
 #define _CA_PRIVATE_DEF_PRO(symbol) void* s_k##symbol _CA_PRIVATE_VISIBILITY = _CA_PRIVATE_OBJC_GET_PROTOCOL(symbol)
 #define _CA_PRIVATE_DEF_SEL(accessor, symbol) SEL s_k##accessor _CA_PRIVATE_VISIBILITY = sel_registerName(symbol)
+#endif // METALCPP_LAZY_REGISTRATION
 #define _CA_PRIVATE_DEF_STR(type, symbol)                \
     _CA_EXTERN type const CA##symbol _CA_PRIVATE_IMPORT; \
     type const                       CA::symbol = (nullptr != &CA##symbol) ? CA##symbol : nullptr
 
 #else
 
+#ifdef METALCPP_LAZY_REGISTRATION
+#define _CA_PRIVATE_DEF_CLS(symbol) extern NS::Private::LazyClass s_l##symbol
+#define _CA_PRIVATE_DEF_PRO(symbol) extern NS::Private::LazyProtocol s_l##symbol
+#define _CA_PRIVATE_DEF_SEL(accessor, symbol) extern NS::Private::LazySelector s_l##accessor
+#else
 #define _CA_PRIVATE_DEF_CLS(symbol) extern void* s_k##symbol
 #define _CA_PRIVATE_DEF_PRO(symbol) extern void* s_k##symbol
 #define _CA_PRIVATE_DEF_SEL(accessor, symbol) extern SEL s_k##accessor
+#endif // METALCPP_LAZY_REGISTRATION
 #define _CA_PRIVATE_DEF_STR(type, symbol) extern type const CA::symbol
 
 #endif // CA_PRIVATE_IMPLEMENTATION
@@ -8915,6 +12407,71 @@ _MTL_INLINE MTL::AccelerationStructurePassSampleBufferAttachmentDescriptorArray*
     return Object::sendMessage<MTL::AccelerationStructurePassSampleBufferAttachmentDescriptorArray*>(this, _MTL_PRIVATE_SEL(sampleBufferAttachments));
 }
 
+#ifndef METALCPP_ALLOCATION_HOOKS
+#define METALCPP_ALLOCATION_HOOKS 0
+#endif // METALCPP_ALLOCATION_HOOKS
+
+namespace MTL
+{
+class Heap;
+
+_MTL_ENUM(NS::UInteger, AllocationKind) {
+    AllocationKindBuffer = 0,
+    AllocationKindTexture = 1,
+    AllocationKindHeap = 2,
+};
+
+/**
+ * Called with every buffer, texture and heap created through Device::newBuffer, Device::newTexture, Device::newHeap,
+ * Heap::newBuffer and Heap::newTexture, right after creation. pHeap is the heap a resource was placed in, or nullptr.
+ * Only compiled in when METALCPP_ALLOCATION_HOOKS is non-zero; otherwise the factories are untouched and the handler is
+ * never called. Shared by all threads; set it at startup.
+ */
+using AllocationHandler = void (*)(void* pObject, AllocationKind kind, Heap* pHeap);
+
+void setAllocationHandler(AllocationHandler handler);
+
+namespace Private
+{
+    AllocationHandler& allocationHandler();
+
+    template <typename _Object>
+    _Object* reportAllocation(_Object* pObject, AllocationKind kind, Heap* pHeap);
+}
+}
+
+#if METALCPP_ALLOCATION_HOOKS
+#define _MTL_REPORT_ALLOCATION(object, kind, heap) MTL::Private::reportAllocation(object, kind, heap)
+#else
+#define _MTL_REPORT_ALLOCATION(object, kind, heap) (object)
+#endif // METALCPP_ALLOCATION_HOOKS
+
+_MTL_INLINE void MTL::setAllocationHandler(AllocationHandler handler)
+{
+    Private::allocationHandler() = handler;
+}
+
+_MTL_INLINE MTL::AllocationHandler& MTL::Private::allocationHandler()
+{
+    static AllocationHandler handler = nullptr;
+
+    return handler;
+}
+
+template <typename _Object>
+_MTL_INLINE _Object* MTL::Private::reportAllocation(_Object* pObject, AllocationKind kind, Heap* pHeap)
+{
+    if (pObject)
+    {
+        if (AllocationHandler handler = allocationHandler())
+        {
+            handler(pObject, kind, pHeap);
+        }
+    }
+
+    return pObject;
+}
+
 #pragma once
 
 namespace MTL
@@ -9559,12 +13116,12 @@ public:
 
 _MTL_INLINE NS::UInteger MTL::Buffer::length() const
 {
-    return Object::sendMessage<NS::UInteger>(this, _MTL_PRIVATE_SEL(length));
+    return Object::sendMessageCached<NS::UInteger>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(length));
 }
 
 _MTL_INLINE void* MTL::Buffer::contents()
 {
-    return Object::sendMessage<void*>(this, _MTL_PRIVATE_SEL(contents));
+    return Object::sendMessageCached<void*>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(contents));
 }
 
 _MTL_INLINE void MTL::Buffer::didModifyRange(NS::Range range)
@@ -10385,22 +13942,22 @@ _MTL_INLINE MTL::DispatchType MTL::ComputeCommandEncoder::dispatchType() const
 
 _MTL_INLINE void MTL::ComputeCommandEncoder::setComputePipelineState(const MTL::ComputePipelineState* state)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setComputePipelineState_), state);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setComputePipelineState_), state);
 }
 
 _MTL_INLINE void MTL::ComputeCommandEncoder::setBytes(const void* bytes, NS::UInteger length, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setBytes_length_atIndex_), bytes, length, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setBytes_length_atIndex_), bytes, length, index);
 }
 
 _MTL_INLINE void MTL::ComputeCommandEncoder::setBuffer(const MTL::Buffer* buffer, NS::UInteger offset, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setBuffer_offset_atIndex_), buffer, offset, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setBuffer_offset_atIndex_), buffer, offset, index);
 }
 
 _MTL_INLINE void MTL::ComputeCommandEncoder::setBufferOffset(NS::UInteger offset, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setBufferOffset_atIndex_), offset, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setBufferOffset_atIndex_), offset, index);
 }
 
 _MTL_INLINE void MTL::ComputeCommandEncoder::setBuffers(const MTL::Buffer* const buffers[], const NS::UInteger offsets[], NS::Range range)
@@ -10435,7 +13992,7 @@ _MTL_INLINE void MTL::ComputeCommandEncoder::setAccelerationStructure(const MTL:
 
 _MTL_INLINE void MTL::ComputeCommandEncoder::setTexture(const MTL::Texture* texture, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setTexture_atIndex_), texture, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setTexture_atIndex_), texture, index);
 }
 
 _MTL_INLINE void MTL::ComputeCommandEncoder::setTextures(const MTL::Texture* const textures[], NS::Range range)
@@ -10445,7 +14002,7 @@ _MTL_INLINE void MTL::ComputeCommandEncoder::setTextures(const MTL::Texture* con
 
 _MTL_INLINE void MTL::ComputeCommandEncoder::setSamplerState(const MTL::SamplerState* sampler, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setSamplerState_atIndex_), sampler, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setSamplerState_atIndex_), sampler, index);
 }
 
 _MTL_INLINE void MTL::ComputeCommandEncoder::setSamplerStates(const MTL::SamplerState* const samplers[], NS::Range range)
@@ -10455,7 +14012,7 @@ _MTL_INLINE void MTL::ComputeCommandEncoder::setSamplerStates(const MTL::Sampler
 
 _MTL_INLINE void MTL::ComputeCommandEncoder::setSamplerState(const MTL::SamplerState* sampler, float lodMinClamp, float lodMaxClamp, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setSamplerState_lodMinClamp_lodMaxClamp_atIndex_), sampler, lodMinClamp, lodMaxClamp, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setSamplerState_lodMinClamp_lodMaxClamp_atIndex_), sampler, lodMinClamp, lodMaxClamp, index);
 }
 
 _MTL_INLINE void MTL::ComputeCommandEncoder::setSamplerStates(const MTL::SamplerState* const samplers[], const float lodMinClamps[], const float lodMaxClamps[], NS::Range range)
@@ -10485,17 +14042,17 @@ _MTL_INLINE void MTL::ComputeCommandEncoder::setStageInRegion(const MTL::Buffer*
 
 _MTL_INLINE void MTL::ComputeCommandEncoder::dispatchThreadgroups(MTL::Size threadgroupsPerGrid, MTL::Size threadsPerThreadgroup)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(dispatchThreadgroups_threadsPerThreadgroup_), threadgroupsPerGrid, threadsPerThreadgroup);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(dispatchThreadgroups_threadsPerThreadgroup_), threadgroupsPerGrid, threadsPerThreadgroup);
 }
 
 _MTL_INLINE void MTL::ComputeCommandEncoder::dispatchThreadgroups(const MTL::Buffer* indirectBuffer, NS::UInteger indirectBufferOffset, MTL::Size threadsPerThreadgroup)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(dispatchThreadgroupsWithIndirectBuffer_indirectBufferOffset_threadsPerThreadgroup_), indirectBuffer, indirectBufferOffset, threadsPerThreadgroup);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(dispatchThreadgroupsWithIndirectBuffer_indirectBufferOffset_threadsPerThreadgroup_), indirectBuffer, indirectBufferOffset, threadsPerThreadgroup);
 }
 
 _MTL_INLINE void MTL::ComputeCommandEncoder::dispatchThreads(MTL::Size threadsPerGrid, MTL::Size threadsPerThreadgroup)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(dispatchThreads_threadsPerThreadgroup_), threadsPerGrid, threadsPerThreadgroup);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(dispatchThreads_threadsPerThreadgroup_), threadsPerGrid, threadsPerThreadgroup);
 }
 
 _MTL_INLINE void MTL::ComputeCommandEncoder::updateFence(const MTL::Fence* fence)
@@ -12233,22 +15790,22 @@ _MTL_INLINE MTL::SizeAndAlign MTL::Device::heapBufferSizeAndAlign(NS::UInteger l
 
 _MTL_INLINE MTL::Heap* MTL::Device::newHeap(const MTL::HeapDescriptor* descriptor)
 {
-    return Object::sendMessage<MTL::Heap*>(this, _MTL_PRIVATE_SEL(newHeapWithDescriptor_), descriptor);
+    return _MTL_REPORT_ALLOCATION(Object::sendMessage<MTL::Heap*>(this, _MTL_PRIVATE_SEL(newHeapWithDescriptor_), descriptor), MTL::AllocationKindHeap, nullptr);
 }
 
 _MTL_INLINE MTL::Buffer* MTL::Device::newBuffer(NS::UInteger length, MTL::ResourceOptions options)
 {
-    return Object::sendMessage<MTL::Buffer*>(this, _MTL_PRIVATE_SEL(newBufferWithLength_options_), length, options);
+    return _MTL_REPORT_ALLOCATION(Object::sendMessage<MTL::Buffer*>(this, _MTL_PRIVATE_SEL(newBufferWithLength_options_), length, options), MTL::AllocationKindBuffer, nullptr);
 }
 
 _MTL_INLINE MTL::Buffer* MTL::Device::newBuffer(const void* pointer, NS::UInteger length, MTL::ResourceOptions options)
 {
-    return Object::sendMessage<MTL::Buffer*>(this, _MTL_PRIVATE_SEL(newBufferWithBytes_length_options_), pointer, length, options);
+    return _MTL_REPORT_ALLOCATION(Object::sendMessage<MTL::Buffer*>(this, _MTL_PRIVATE_SEL(newBufferWithBytes_length_options_), pointer, length, options), MTL::AllocationKindBuffer, nullptr);
 }
 
 _MTL_INLINE MTL::Buffer* MTL::Device::newBuffer(const void* pointer, NS::UInteger length, MTL::ResourceOptions options, void (^deallocator)(void*, NS::UInteger))
 {
-    return Object::sendMessage<MTL::Buffer*>(this, _MTL_PRIVATE_SEL(newBufferWithBytesNoCopy_length_options_deallocator_), pointer, length, options, deallocator);
+    return _MTL_REPORT_ALLOCATION(Object::sendMessage<MTL::Buffer*>(this, _MTL_PRIVATE_SEL(newBufferWithBytesNoCopy_length_options_deallocator_), pointer, length, options, deallocator), MTL::AllocationKindBuffer, nullptr);
 }
 
 _MTL_INLINE MTL::DepthStencilState* MTL::Device::newDepthStencilState(const MTL::DepthStencilDescriptor* descriptor)
@@ -12258,12 +15815,12 @@ _MTL_INLINE MTL::DepthStencilState* MTL::Device::newDepthStencilState(const MTL:
 
 _MTL_INLINE MTL::Texture* MTL::Device::newTexture(const MTL::TextureDescriptor* descriptor)
 {
-    return Object::sendMessage<MTL::Texture*>(this, _MTL_PRIVATE_SEL(newTextureWithDescriptor_), descriptor);
+    return _MTL_REPORT_ALLOCATION(Object::sendMessage<MTL::Texture*>(this, _MTL_PRIVATE_SEL(newTextureWithDescriptor_), descriptor), MTL::AllocationKindTexture, nullptr);
 }
 
 _MTL_INLINE MTL::Texture* MTL::Device::newTexture(const MTL::TextureDescriptor* descriptor, const IOSurfaceRef iosurface, NS::UInteger plane)
 {
-    return Object::sendMessage<MTL::Texture*>(this, _MTL_PRIVATE_SEL(newTextureWithDescriptor_iosurface_plane_), descriptor, iosurface, plane);
+    return _MTL_REPORT_ALLOCATION(Object::sendMessage<MTL::Texture*>(this, _MTL_PRIVATE_SEL(newTextureWithDescriptor_iosurface_plane_), descriptor, iosurface, plane), MTL::AllocationKindTexture, nullptr);
 }
 
 _MTL_INLINE MTL::Texture* MTL::Device::newSharedTexture(const MTL::TextureDescriptor* descriptor)
@@ -12706,6 +16263,8 @@ _MTL_INLINE bool MTL::DynamicLibrary::serializeToURL(const NS::URL* url, NS::Err
 
 #pragma once
 
+#include <functional>
+
 namespace MTL
 {
 class Event : public NS::Referencing<Event>
@@ -12731,11 +16290,15 @@ public:
 
 using SharedEventNotificationBlock = void (^)(SharedEvent* pEvent, std::uint64_t value);
 
+using SharedEventNotificationFunction = std::function<void(SharedEvent* pEvent, std::uint64_t value)>;
+
 class SharedEvent : public NS::Referencing<SharedEvent, Event>
 {
 public:
     void                     notifyListener(const class SharedEventListener* listener, uint64_t value, const MTL::SharedEventNotificationBlock block);
 
+    void                     notifyListener(const class SharedEventListener* listener, uint64_t value, const MTL::SharedEventNotificationFunction& function);
+
     class SharedEventHandle* newSharedEventHandle();
 
     uint64_t                 signaledValue() const;
@@ -12794,6 +16357,13 @@ _MTL_INLINE void MTL::SharedEvent::notifyListener(const MTL::SharedEventListener
     Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(notifyListener_atValue_block_), listener, value, block);
 }
 
+_MTL_INLINE void MTL::SharedEvent::notifyListener(const MTL::SharedEventListener* listener, uint64_t value, const MTL::SharedEventNotificationFunction& function)
+{
+    __block MTL::SharedEventNotificationFunction blockFunction = function;
+
+    notifyListener(listener, value, ^(MTL::SharedEvent* pEvent, std::uint64_t notifiedValue) { blockFunction(pEvent, notifiedValue); });
+}
+
 _MTL_INLINE MTL::SharedEventHandle* MTL::SharedEvent::newSharedEventHandle()
 {
     return Object::sendMessage<MTL::SharedEventHandle*>(this, _MTL_PRIVATE_SEL(newSharedEventHandle));
@@ -14173,12 +17743,12 @@ _MTL_INLINE NS::UInteger MTL::Heap::maxAvailableSize(NS::UInteger alignment)
 
 _MTL_INLINE MTL::Buffer* MTL::Heap::newBuffer(NS::UInteger length, MTL::ResourceOptions options)
 {
-    return Object::sendMessage<MTL::Buffer*>(this, _MTL_PRIVATE_SEL(newBufferWithLength_options_), length, options);
+    return _MTL_REPORT_ALLOCATION(Object::sendMessage<MTL::Buffer*>(this, _MTL_PRIVATE_SEL(newBufferWithLength_options_), length, options), MTL::AllocationKindBuffer, this);
 }
 
 _MTL_INLINE MTL::Texture* MTL::Heap::newTexture(const MTL::TextureDescriptor* desc)
 {
-    return Object::sendMessage<MTL::Texture*>(this, _MTL_PRIVATE_SEL(newTextureWithDescriptor_), desc);
+    return _MTL_REPORT_ALLOCATION(Object::sendMessage<MTL::Texture*>(this, _MTL_PRIVATE_SEL(newTextureWithDescriptor_), desc), MTL::AllocationKindTexture, this);
 }
 
 _MTL_INLINE MTL::PurgeableState MTL::Heap::setPurgeableState(MTL::PurgeableState state)
@@ -14193,12 +17763,12 @@ _MTL_INLINE MTL::HeapType MTL::Heap::type() const
 
 _MTL_INLINE MTL::Buffer* MTL::Heap::newBuffer(NS::UInteger length, MTL::ResourceOptions options, NS::UInteger offset)
 {
-    return Object::sendMessage<MTL::Buffer*>(this, _MTL_PRIVATE_SEL(newBufferWithLength_options_offset_), length, options, offset);
+    return _MTL_REPORT_ALLOCATION(Object::sendMessage<MTL::Buffer*>(this, _MTL_PRIVATE_SEL(newBufferWithLength_options_offset_), length, options, offset), MTL::AllocationKindBuffer, this);
 }
 
 _MTL_INLINE MTL::Texture* MTL::Heap::newTexture(const MTL::TextureDescriptor* descriptor, NS::UInteger offset)
 {
-    return Object::sendMessage<MTL::Texture*>(this, _MTL_PRIVATE_SEL(newTextureWithDescriptor_offset_), descriptor, offset);
+    return _MTL_REPORT_ALLOCATION(Object::sendMessage<MTL::Texture*>(this, _MTL_PRIVATE_SEL(newTextureWithDescriptor_offset_), descriptor, offset), MTL::AllocationKindTexture, this);
 }
 
 _MTL_INLINE MTL::AccelerationStructure* MTL::Heap::newAccelerationStructure(NS::UInteger size)
@@ -15459,22 +19029,22 @@ public:
 
 _MTL_INLINE void MTL::RenderCommandEncoder::setRenderPipelineState(const MTL::RenderPipelineState* pipelineState)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setRenderPipelineState_), pipelineState);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setRenderPipelineState_), pipelineState);
 }
 
 _MTL_INLINE void MTL::RenderCommandEncoder::setVertexBytes(const void* bytes, NS::UInteger length, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setVertexBytes_length_atIndex_), bytes, length, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setVertexBytes_length_atIndex_), bytes, length, index);
 }
 
 _MTL_INLINE void MTL::RenderCommandEncoder::setVertexBuffer(const MTL::Buffer* buffer, NS::UInteger offset, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setVertexBuffer_offset_atIndex_), buffer, offset, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setVertexBuffer_offset_atIndex_), buffer, offset, index);
 }
 
 _MTL_INLINE void MTL::RenderCommandEncoder::setVertexBufferOffset(NS::UInteger offset, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setVertexBufferOffset_atIndex_), offset, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setVertexBufferOffset_atIndex_), offset, index);
 }
 
 _MTL_INLINE void MTL::RenderCommandEncoder::setVertexBuffers(const MTL::Buffer* const buffers[], const NS::UInteger offsets[], NS::Range range)
@@ -15484,7 +19054,7 @@ _MTL_INLINE void MTL::RenderCommandEncoder::setVertexBuffers(const MTL::Buffer*
 
 _MTL_INLINE void MTL::RenderCommandEncoder::setVertexTexture(const MTL::Texture* texture, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setVertexTexture_atIndex_), texture, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setVertexTexture_atIndex_), texture, index);
 }
 
 _MTL_INLINE void MTL::RenderCommandEncoder::setVertexTextures(const MTL::Texture* const textures[], NS::Range range)
@@ -15494,7 +19064,7 @@ _MTL_INLINE void MTL::RenderCommandEncoder::setVertexTextures(const MTL::Texture
 
 _MTL_INLINE void MTL::RenderCommandEncoder::setVertexSamplerState(const MTL::SamplerState* sampler, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setVertexSamplerState_atIndex_), sampler, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setVertexSamplerState_atIndex_), sampler, index);
 }
 
 _MTL_INLINE void MTL::RenderCommandEncoder::setVertexSamplerStates(const MTL::SamplerState* const samplers[], NS::Range range)
@@ -15504,7 +19074,7 @@ _MTL_INLINE void MTL::RenderCommandEncoder::setVertexSamplerStates(const MTL::Sa
 
 _MTL_INLINE void MTL::RenderCommandEncoder::setVertexSamplerState(const MTL::SamplerState* sampler, float lodMinClamp, float lodMaxClamp, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setVertexSamplerState_lodMinClamp_lodMaxClamp_atIndex_), sampler, lodMinClamp, lodMaxClamp, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setVertexSamplerState_lodMinClamp_lodMaxClamp_atIndex_), sampler, lodMinClamp, lodMaxClamp, index);
 }
 
 _MTL_INLINE void MTL::RenderCommandEncoder::setVertexSamplerStates(const MTL::SamplerState* const samplers[], const float lodMinClamps[], const float lodMaxClamps[], NS::Range range)
@@ -15539,7 +19109,7 @@ _MTL_INLINE void MTL::RenderCommandEncoder::setVertexAccelerationStructure(const
 
 _MTL_INLINE void MTL::RenderCommandEncoder::setViewport(MTL::Viewport viewport)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setViewport_), viewport);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setViewport_), viewport);
 }
 
 _MTL_INLINE void MTL::RenderCommandEncoder::setViewports(const MTL::Viewport* viewports, NS::UInteger count)
@@ -15559,7 +19129,7 @@ _MTL_INLINE void MTL::RenderCommandEncoder::setVertexAmplificationCount(NS::UInt
 
 _MTL_INLINE void MTL::RenderCommandEncoder::setCullMode(MTL::CullMode cullMode)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setCullMode_), cullMode);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setCullMode_), cullMode);
 }
 
 _MTL_INLINE void MTL::RenderCommandEncoder::setDepthClipMode(MTL::DepthClipMode depthClipMode)
@@ -15574,7 +19144,7 @@ _MTL_INLINE void MTL::RenderCommandEncoder::setDepthBias(float depthBias, float
 
 _MTL_INLINE void MTL::RenderCommandEncoder::setScissorRect(MTL::ScissorRect rect)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setScissorRect_), rect);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setScissorRect_), rect);
 }
 
 _MTL_INLINE void MTL::RenderCommandEncoder::setScissorRects(const MTL::ScissorRect* scissorRects, NS::UInteger count)
@@ -15589,17 +19159,17 @@ _MTL_INLINE void MTL::RenderCommandEncoder::setTriangleFillMode(MTL::TriangleFil
 
 _MTL_INLINE void MTL::RenderCommandEncoder::setFragmentBytes(const void* bytes, NS::UInteger length, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setFragmentBytes_length_atIndex_), bytes, length, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setFragmentBytes_length_atIndex_), bytes, length, index);
 }
 
 _MTL_INLINE void MTL::RenderCommandEncoder::setFragmentBuffer(const MTL::Buffer* buffer, NS::UInteger offset, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setFragmentBuffer_offset_atIndex_), buffer, offset, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setFragmentBuffer_offset_atIndex_), buffer, offset, index);
 }
 
 _MTL_INLINE void MTL::RenderCommandEncoder::setFragmentBufferOffset(NS::UInteger offset, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setFragmentBufferOffset_atIndex_), offset, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setFragmentBufferOffset_atIndex_), offset, index);
 }
 
 _MTL_INLINE void MTL::RenderCommandEncoder::setFragmentBuffers(const MTL::Buffer* const buffers[], const NS::UInteger offsets[], NS::Range range)
@@ -15609,7 +19179,7 @@ _MTL_INLINE void MTL::RenderCommandEncoder::setFragmentBuffers(const MTL::Buffer
 
 _MTL_INLINE void MTL::RenderCommandEncoder::setFragmentTexture(const MTL::Texture* texture, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setFragmentTexture_atIndex_), texture, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setFragmentTexture_atIndex_), texture, index);
 }
 
 _MTL_INLINE void MTL::RenderCommandEncoder::setFragmentTextures(const MTL::Texture* const textures[], NS::Range range)
@@ -15619,7 +19189,7 @@ _MTL_INLINE void MTL::RenderCommandEncoder::setFragmentTextures(const MTL::Textu
 
 _MTL_INLINE void MTL::RenderCommandEncoder::setFragmentSamplerState(const MTL::SamplerState* sampler, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setFragmentSamplerState_atIndex_), sampler, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setFragmentSamplerState_atIndex_), sampler, index);
 }
 
 _MTL_INLINE void MTL::RenderCommandEncoder::setFragmentSamplerStates(const MTL::SamplerState* const samplers[], NS::Range range)
@@ -15629,7 +19199,7 @@ _MTL_INLINE void MTL::RenderCommandEncoder::setFragmentSamplerStates(const MTL::
 
 _MTL_INLINE void MTL::RenderCommandEncoder::setFragmentSamplerState(const MTL::SamplerState* sampler, float lodMinClamp, float lodMaxClamp, NS::UInteger index)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setFragmentSamplerState_lodMinClamp_lodMaxClamp_atIndex_), sampler, lodMinClamp, lodMaxClamp, index);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setFragmentSamplerState_lodMinClamp_lodMaxClamp_atIndex_), sampler, lodMinClamp, lodMaxClamp, index);
 }
 
 _MTL_INLINE void MTL::RenderCommandEncoder::setFragmentSamplerStates(const MTL::SamplerState* const samplers[], const float lodMinClamps[], const float lodMaxClamps[], NS::Range range)
@@ -15669,7 +19239,7 @@ _MTL_INLINE void MTL::RenderCommandEncoder::setBlendColor(float red, float green
 
 _MTL_INLINE void MTL::RenderCommandEncoder::setDepthStencilState(const MTL::DepthStencilState* depthStencilState)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(setDepthStencilState_), depthStencilState);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(setDepthStencilState_), depthStencilState);
 }
 
 _MTL_INLINE void MTL::RenderCommandEncoder::setStencilReferenceValue(uint32_t referenceValue)
@@ -15839,42 +19409,42 @@ _MTL_INLINE void MTL::RenderCommandEncoder::drawMeshThreadgroups(const MTL::Buff
 
 _MTL_INLINE void MTL::RenderCommandEncoder::drawPrimitives(MTL::PrimitiveType primitiveType, NS::UInteger vertexStart, NS::UInteger vertexCount, NS::UInteger instanceCount)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(drawPrimitives_vertexStart_vertexCount_instanceCount_), primitiveType, vertexStart, vertexCount, instanceCount);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(drawPrimitives_vertexStart_vertexCount_instanceCount_), primitiveType, vertexStart, vertexCount, instanceCount);
 }
 
 _MTL_INLINE void MTL::RenderCommandEncoder::drawPrimitives(MTL::PrimitiveType primitiveType, NS::UInteger vertexStart, NS::UInteger vertexCount)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(drawPrimitives_vertexStart_vertexCount_), primitiveType, vertexStart, vertexCount);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(drawPrimitives_vertexStart_vertexCount_), primitiveType, vertexStart, vertexCount);
 }
 
 _MTL_INLINE void MTL::RenderCommandEncoder::drawIndexedPrimitives(MTL::PrimitiveType primitiveType, NS::UInteger indexCount, MTL::IndexType indexType, const MTL::Buffer* indexBuffer, NS::UInteger indexBufferOffset, NS::UInteger instanceCount)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(drawIndexedPrimitives_indexCount_indexType_indexBuffer_indexBufferOffset_instanceCount_), primitiveType, indexCount, indexType, indexBuffer, indexBufferOffset, instanceCount);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(drawIndexedPrimitives_indexCount_indexType_indexBuffer_indexBufferOffset_instanceCount_), primitiveType, indexCount, indexType, indexBuffer, indexBufferOffset, instanceCount);
 }
 
 _MTL_INLINE void MTL::RenderCommandEncoder::drawIndexedPrimitives(MTL::PrimitiveType primitiveType, NS::UInteger indexCount, MTL::IndexType indexType, const MTL::Buffer* indexBuffer, NS::UInteger indexBufferOffset)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(drawIndexedPrimitives_indexCount_indexType_indexBuffer_indexBufferOffset_), primitiveType, indexCount, indexType, indexBuffer, indexBufferOffset);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(drawIndexedPrimitives_indexCount_indexType_indexBuffer_indexBufferOffset_), primitiveType, indexCount, indexType, indexBuffer, indexBufferOffset);
 }
 
 _MTL_INLINE void MTL::RenderCommandEncoder::drawPrimitives(MTL::PrimitiveType primitiveType, NS::UInteger vertexStart, NS::UInteger vertexCount, NS::UInteger instanceCount, NS::UInteger baseInstance)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(drawPrimitives_vertexStart_vertexCount_instanceCount_baseInstance_), primitiveType, vertexStart, vertexCount, instanceCount, baseInstance);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(drawPrimitives_vertexStart_vertexCount_instanceCount_baseInstance_), primitiveType, vertexStart, vertexCount, instanceCount, baseInstance);
 }
 
 _MTL_INLINE void MTL::RenderCommandEncoder::drawIndexedPrimitives(MTL::PrimitiveType primitiveType, NS::UInteger indexCount, MTL::IndexType indexType, const MTL::Buffer* indexBuffer, NS::UInteger indexBufferOffset, NS::UInteger instanceCount, NS::Integer baseVertex, NS::UInteger baseInstance)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(drawIndexedPrimitives_indexCount_indexType_indexBuffer_indexBufferOffset_instanceCount_baseVertex_baseInstance_), primitiveType, indexCount, indexType, indexBuffer, indexBufferOffset, instanceCount, baseVertex, baseInstance);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(drawIndexedPrimitives_indexCount_indexType_indexBuffer_indexBufferOffset_instanceCount_baseVertex_baseInstance_), primitiveType, indexCount, indexType, indexBuffer, indexBufferOffset, instanceCount, baseVertex, baseInstance);
 }
 
 _MTL_INLINE void MTL::RenderCommandEncoder::drawPrimitives(MTL::PrimitiveType primitiveType, const MTL::Buffer* indirectBuffer, NS::UInteger indirectBufferOffset)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(drawPrimitives_indirectBuffer_indirectBufferOffset_), primitiveType, indirectBuffer, indirectBufferOffset);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(drawPrimitives_indirectBuffer_indirectBufferOffset_), primitiveType, indirectBuffer, indirectBufferOffset);
 }
 
 _MTL_INLINE void MTL::RenderCommandEncoder::drawIndexedPrimitives(MTL::PrimitiveType primitiveType, MTL::IndexType indexType, const MTL::Buffer* indexBuffer, NS::UInteger indexBufferOffset, const MTL::Buffer* indirectBuffer, NS::UInteger indirectBufferOffset)
 {
-    Object::sendMessage<void>(this, _MTL_PRIVATE_SEL(drawIndexedPrimitives_indexType_indexBuffer_indexBufferOffset_indirectBuffer_indirectBufferOffset_), primitiveType, indexType, indexBuffer, indexBufferOffset, indirectBuffer, indirectBufferOffset);
+    Object::sendMessageCached<void>(_NS_PRIVATE_IMP_CACHE_SITE(), this, _MTL_PRIVATE_SEL(drawIndexedPrimitives_indexType_indexBuffer_indexBufferOffset_indirectBuffer_indirectBufferOffset_), primitiveType, indexType, indexBuffer, indexBufferOffset, indirectBuffer, indirectBufferOffset);
 }
 
 _MTL_INLINE void MTL::RenderCommandEncoder::textureBarrier()
@@ -0,0 +1,95 @@
+//
+//  autorelease_scope_test.cpp
+//  Metal-Guide
+//
+
+// Counting is off by default in builds with NDEBUG.
+#define METALCPP_AUTORELEASE_STATS 1
+#include <Foundation/NSAutoreleasePool.hpp>
+#include <Foundation/NSObject.hpp>
+
+#include "test.hpp"
+
+#include <thread>
+#include <vector>
+
+namespace {
+
+NS::Object* makeObject() {
+    return reinterpret_cast<NS::Object*>(class_createInstance(objc_lookUpClass("NSObject"), 0));
+}
+
+void autoreleaseObjects(std::size_t count) {
+    for (std::size_t i = 0; i < count; i++) {
+        makeObject()->autorelease();
+    }
+}
+
+// Each case runs on a fresh thread, so its first scope starts from the runtime's empty-pool placeholder.
+template <typename Body>
+void onNewThread(Body body) {
+    std::thread thread(body);
+    thread.join();
+}
+
+}
+
+TEST_CASE("the first scope on a thread is counted") {
+    onNewThread([] {
+        NS::AutoreleaseScope::resetStats();
+        {
+            NS::AutoreleaseScope scope("outer");
+            autoreleaseObjects(5);
+            CHECK(scope.pendingObjects() == 5);
+            CHECK(scope.drain() == 5);
+            autoreleaseObjects(2);
+        }
+        CHECK(NS::AutoreleaseScope::stats().scopes == 2);
+        CHECK(NS::AutoreleaseScope::stats().drainedObjects == 7);
+        CHECK(NS::AutoreleaseScope::stats().uncountedScopes == 0);
+    });
+}
+
+TEST_CASE("nested scopes count only their own objects") {
+    onNewThread([] {
+        NS::AutoreleaseScope outer("outer");
+        autoreleaseObjects(3);
+        {
+            NS::AutoreleaseScope inner("inner");
+            autoreleaseObjects(4);
+            CHECK(inner.pendingObjects() == 4);
+        }
+        CHECK(outer.pendingObjects() == 3);
+    });
+}
+
+TEST_CASE("objects spilling onto another pool page are reported as uncounted") {
+    onNewThread([] {
+        NS::AutoreleaseScope::resetStats();
+        {
+            NS::AutoreleaseScope scope("spill");
+            autoreleaseObjects(10000);
+            CHECK(scope.pendingObjects() == NS::AutoreleaseScope::UncountedObjects);
+        }
+        CHECK(NS::AutoreleaseScope::stats().uncountedScopes == 1);
+
+        // The pool is usable and countable again afterwards.
+        NS::AutoreleaseScope scope("after");
+        autoreleaseObjects(6);
+        CHECK(scope.pendingObjects() == 6);
+    });
+}
+
+TEST_CASE("scope pops release what they drained") {
+    onNewThread([] {
+        NS::Object* object = makeObject();
+        object->retain();
+        {
+            NS::AutoreleaseScope scope;
+            object->autorelease();
+            CHECK(object->retainCount() == 2);
+        }
+        CHECK(object->retainCount() == 1);
+        object->release();
+    });
+}
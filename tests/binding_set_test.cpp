@@ -0,0 +1,145 @@
+//
+//  binding_set_test.cpp
+//  Metal-Guide
+//
+//  BindingSet flushed through an emitter that logs every call it would send to an encoder, so the tests count messages.
+//
+
+#include "binding_set.hpp"
+
+#include "test.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Call {
+    std::string name;
+    NS::UInteger location;
+    NS::UInteger length;
+    std::vector<const void*> objects;
+};
+
+struct CountingEmitter {
+    std::vector<Call>* calls;
+
+    template <typename Object>
+    void record(const char* name, NS::UInteger location, NS::UInteger length, const Object* const objects[]) const {
+        calls->push_back(Call { name, location, length, std::vector<const void*>(objects, objects + length) });
+    }
+
+    void setBuffer(const MTL::Buffer* buffer, NS::UInteger, NS::UInteger index) const { record("setBuffer", index, 1, &buffer); }
+    void setBufferOffset(NS::UInteger, NS::UInteger index) const { calls->push_back(Call { "setBufferOffset", index, 1, {} }); }
+    void setBuffers(const MTL::Buffer* const buffers[], const NS::UInteger[], NS::Range range) const {
+        record("setBuffers", range.location, range.length, buffers);
+    }
+    void setTexture(const MTL::Texture* texture, NS::UInteger index) const { record("setTexture", index, 1, &texture); }
+    void setTextures(const MTL::Texture* const textures[], NS::Range range) const {
+        record("setTextures", range.location, range.length, textures);
+    }
+    void setSamplerState(const MTL::SamplerState* sampler, NS::UInteger index) const { record("setSamplerState", index, 1, &sampler); }
+    void setSamplerStates(const MTL::SamplerState* const samplers[], NS::Range range) const {
+        record("setSamplerStates", range.location, range.length, samplers);
+    }
+};
+
+// Only ever stored and compared, never dereferenced.
+template <typename Object>
+const Object* fakeObject(std::uintptr_t address) {
+    return reinterpret_cast<const Object*>(address);
+}
+
+}
+
+TEST_CASE("a single dirty slot uses the singular setter, an offset change the offset setter") {
+    BindingSet set;
+    std::vector<Call> calls;
+    set.setBuffer(fakeObject<MTL::Buffer>(0x100), 0, 3);
+    set.flush(CountingEmitter { &calls });
+    REQUIRE(calls.size() == 1);
+    CHECK(calls[0].name == "setBuffer" && calls[0].location == 3);
+
+    calls.clear();
+    set.setBufferOffset(256, 3);
+    set.flush(CountingEmitter { &calls });
+    REQUIRE(calls.size() == 1);
+    CHECK(calls[0].name == "setBufferOffset");
+    CHECK(set.encoderCallCount() == 2);
+}
+
+TEST_CASE("rebinding what was flushed sends nothing") {
+    BindingSet set;
+    std::vector<Call> calls;
+    set.setTexture(fakeObject<MTL::Texture>(0x200), 0);
+    set.setSamplerState(fakeObject<MTL::SamplerState>(0x300), 0);
+    set.flush(CountingEmitter { &calls });
+    CHECK(calls.size() == 2);
+
+    calls.clear();
+    set.setTexture(fakeObject<MTL::Texture>(0x201), 0);
+    set.setTexture(fakeObject<MTL::Texture>(0x200), 0);
+    set.setSamplerState(fakeObject<MTL::SamplerState>(0x300), 0);
+    CHECK(!set.isDirty());
+    set.flush(CountingEmitter { &calls });
+    CHECK(calls.empty());
+}
+
+TEST_CASE("each resource kind flushes with one call however many slots changed") {
+    BindingSet set;
+    std::vector<Call> calls;
+    for (NS::UInteger i = 0; i < 8; i++) {
+        set.setBuffer(fakeObject<MTL::Buffer>(0x100 + i), i * 16, i);
+        set.setTexture(fakeObject<MTL::Texture>(0x200 + i), i);
+    }
+    set.setSamplerState(fakeObject<MTL::SamplerState>(0x300), 2);
+    set.setSamplerState(fakeObject<MTL::SamplerState>(0x301), 5);
+    set.flush(CountingEmitter { &calls });
+    REQUIRE(calls.size() == 3);
+    CHECK(calls[0].name == "setBuffers" && calls[0].location == 0 && calls[0].length == 8);
+    CHECK(calls[1].name == "setTextures" && calls[1].length == 8);
+    CHECK(calls[2].name == "setSamplerStates" && calls[2].location == 2 && calls[2].length == 4);
+    // The gap is resent with what it holds, which is nothing here.
+    CHECK(calls[2].objects[1] == nullptr && calls[2].objects[3] == fakeObject<MTL::SamplerState>(0x301));
+}
+
+TEST_CASE("a flush over the first and last texture slot resends the 126 clean ones between") {
+    BindingSet set;
+    std::vector<Call> calls;
+    for (NS::UInteger i = 0; i < BindingSet::maxTextures; i++) {
+        set.setTexture(fakeObject<MTL::Texture>(0x1000 + i), i);
+    }
+    set.flush(CountingEmitter { &calls });
+
+    calls.clear();
+    set.setTexture(fakeObject<MTL::Texture>(0x2000), 0);
+    set.setTexture(fakeObject<MTL::Texture>(0x2001), BindingSet::maxTextures - 1);
+    set.flush(CountingEmitter { &calls });
+    REQUIRE(calls.size() == 1);
+    CHECK(calls[0].name == "setTextures" && calls[0].location == 0 && calls[0].length == BindingSet::maxTextures);
+    REQUIRE(calls[0].objects.size() == BindingSet::maxTextures);
+    CHECK(calls[0].objects.front() == fakeObject<MTL::Texture>(0x2000));
+    CHECK(calls[0].objects.back() == fakeObject<MTL::Texture>(0x2001));
+    bool cleanSlotsUnchanged = true;
+    for (NS::UInteger i = 1; i + 1 < BindingSet::maxTextures; i++) {
+        cleanSlotsUnchanged = cleanSlotsUnchanged && calls[0].objects[i] == fakeObject<MTL::Texture>(0x1000 + i);
+    }
+    CHECK(cleanSlotsUnchanged);
+}
+
+TEST_CASE("invalidate makes everything bound dirty again for a new encoder") {
+    BindingSet set;
+    std::vector<Call> calls;
+    set.setBuffer(fakeObject<MTL::Buffer>(0x100), 0, 0);
+    set.setTexture(fakeObject<MTL::Texture>(0x200), 4);
+    set.flush(CountingEmitter { &calls });
+    CHECK(!set.isDirty());
+
+    set.invalidate();
+    CHECK(set.isDirty());
+    calls.clear();
+    set.flush(CountingEmitter { &calls });
+    REQUIRE(calls.size() == 2);
+    CHECK(calls[0].name == "setBuffer" && calls[1].name == "setTexture" && calls[1].location == 4);
+}
@@ -0,0 +1,108 @@
+//
+//  command_list_test.cpp
+//  Metal-Guide
+//
+//  Recording with the command recorders and replaying onto stub encoders.
+//
+
+#include "command_decoder.hpp"
+
+#include "stub_encoder.hpp"
+#include "test.hpp"
+
+#include <cstring>
+#include <string>
+
+namespace {
+
+// Only ever stored and passed back, never dereferenced.
+template <typename Object>
+const Object* fakeObject(std::uintptr_t address) {
+    return reinterpret_cast<const Object*>(address);
+}
+
+// Same fields as MTL::Viewport and MTL::Size, which the recorders convert from.
+struct Viewport {
+    double originX, originY, width, height, znear, zfar;
+};
+
+struct Size {
+    NS::UInteger width, height, depth;
+};
+
+}
+
+TEST_CASE("render commands replay in recording order with their arguments") {
+    CommandList list;
+    RenderCommandRecorder recorder(list);
+    const float color[4] = { 1.0f, 0.5f, 0.25f, 1.0f };
+    recorder.pushDebugGroup(nullptr);
+    recorder.setRenderPipelineState(fakeObject<MTL::RenderPipelineState>(0x100));
+    recorder.setViewport(Viewport { 0.0, 0.0, 1920.0, 1080.0, 0.0, 1.0 });
+    recorder.setVertexBytes(color, sizeof(color), 1);
+    recorder.setFragmentBuffer(fakeObject<MTL::Buffer>(0x200), 16, 0);
+    recorder.drawPrimitives(MTL::PrimitiveType(3), 0, 3, 1);
+    recorder.drawPrimitives(MTL::PrimitiveType(3), 6, 30, 2);
+    recorder.popDebugGroup();
+    CHECK(list.commandCount() == 8);
+
+    StubRenderEncoder encoder;
+    encoder.logging = true;
+    replayRenderCommands(list, &encoder);
+    const char* expected[] = { "pushDebugGroup", "setRenderPipelineState", "setViewport", "setVertexBytes", "setFragmentBuffer",
+                               "drawPrimitives", "drawPrimitives", "popDebugGroup" };
+    REQUIRE(encoder.log.size() == std::size(expected));
+    for (std::size_t i = 0; i < encoder.log.size(); i++) {
+        CHECK(std::string(encoder.log[i]) == expected[i]);
+    }
+    CHECK(encoder.viewport.width == 1920.0 && encoder.viewport.zfar == 1.0);
+    REQUIRE(encoder.vertexBytes.size() == sizeof(color));
+    CHECK(std::memcmp(encoder.vertexBytes.data(), color, sizeof(color)) == 0);
+    CHECK(encoder.vertexCount == 33);
+}
+
+TEST_CASE("compute and blit commands replay onto their own encoders") {
+    CommandList compute;
+    ComputeCommandRecorder computeRecorder(compute);
+    computeRecorder.setComputePipelineState(fakeObject<MTL::ComputePipelineState>(0x100));
+    computeRecorder.setBytes("abcd", 4, 0);
+    computeRecorder.dispatchThreads(Size { 64, 64, 1 }, Size { 8, 4, 1 });
+    computeRecorder.updateFence(fakeObject<MTL::Fence>(0x300));
+
+    StubComputeEncoder computeEncoder;
+    replayComputeCommands(compute, &computeEncoder);
+    CHECK(computeEncoder.calls == 4);
+    CHECK(computeEncoder.threadsPerThreadgroup.width == 8 && computeEncoder.threadsPerThreadgroup.height == 4);
+
+    CommandList blit;
+    BlitCommandRecorder blitRecorder(blit);
+    blitRecorder.waitForFence(fakeObject<MTL::Fence>(0x300));
+    blitRecorder.fillBuffer(fakeObject<MTL::Buffer>(0x200), NS::Range::Make(0, 256), 0);
+    blitRecorder.generateMipmaps(fakeObject<MTL::Texture>(0x400));
+
+    StubBlitEncoder blitEncoder;
+    replayBlitCommands(blit, &blitEncoder);
+    CHECK(blitEncoder.calls == 3);
+}
+
+TEST_CASE("reset keeps the chunks and records from the start again") {
+    CommandList list(256);
+    RenderCommandRecorder recorder(list);
+    for (int i = 0; i < 100; i++) {
+        recorder.drawPrimitives(MTL::PrimitiveType(3), 0, 3, 1);
+    }
+    std::size_t bytes = list.byteSize();
+    CHECK(bytes > 256);
+
+    list.reset();
+    CHECK(list.empty());
+    CHECK(list.byteSize() == 0);
+    for (int i = 0; i < 100; i++) {
+        recorder.drawPrimitives(MTL::PrimitiveType(3), 0, 3, 1);
+    }
+    CHECK(list.byteSize() == bytes);
+
+    StubRenderEncoder encoder;
+    replayRenderCommands(list, &encoder);
+    CHECK(encoder.calls == 100 && encoder.vertexCount == 300);
+}
@@ -0,0 +1,153 @@
+//
+//  fast_enumeration_test.cpp
+//  Metal-Guide
+//
+
+#include <Foundation/NSArray.hpp>
+
+#include "test.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace {
+
+class Item : public NS::Referencing<Item> {
+};
+
+// A stand-in collection. One that hands out its storage answers every countByEnumeratingWithState call with all of
+// its remaining objects, as NSArray does; one that doesn't copies at most count of them into the caller's buffer.
+struct Collection {
+    NS::Object** items;
+    std::uint64_t count;
+    bool handsOutStorage;
+    unsigned long mutations;
+    std::uint64_t enumerationCalls;
+};
+
+Collection& collection(id self) {
+    return *static_cast<Collection*>(object_getIndexedIvars(self));
+}
+
+std::uint64_t countByEnumerating(id self, SEL, NS::FastEnumerationState* state, NS::Object** buffer, std::uint64_t length) {
+    Collection& items = collection(self);
+    items.enumerationCalls++;
+    state->mutationsPtr = &items.mutations;
+    std::uint64_t remaining = items.count - state->state;
+    if (items.handsOutStorage) {
+        state->itemsPtr = items.items + state->state;
+    } else {
+        remaining = std::min(remaining, length);
+        for (std::uint64_t i = 0; i < remaining; i++) {
+            buffer[i] = items.items[state->state + i];
+        }
+        state->itemsPtr = buffer;
+    }
+    state->state += remaining;
+    return remaining;
+}
+
+void registerCollectionClass() {
+    if (objc_lookUpClass("TestCollection")) {
+        return;
+    }
+    Class cls = objc_allocateClassPair(objc_lookUpClass("NSObject"), "TestCollection", 0);
+    class_addMethod(cls, sel_registerName("countByEnumeratingWithState:objects:count:"), reinterpret_cast<IMP>(countByEnumerating),
+        "Q@:^v^@Q");
+    class_addMethod(cls, sel_registerName("count"),
+        reinterpret_cast<IMP>(+[](id self, SEL) -> std::uint64_t { return collection(self).count; }), "Q@:");
+    class_addMethod(cls, sel_registerName("getObjects:range:"),
+        reinterpret_cast<IMP>(+[](id self, SEL, NS::Object** objects, NS::Range range) {
+            for (NS::UInteger i = 0; i < range.length; i++) {
+                objects[i] = collection(self).items[range.location + i];
+            }
+        }),
+        "v@:^@{_NSRange=QQ}");
+    objc_registerClassPair(cls);
+}
+
+// Items are never messaged, so any distinct addresses will do.
+struct Fixture {
+    std::vector<std::uint64_t> storage;
+    std::vector<NS::Object*> items;
+    NS::Array* array;
+
+    Fixture(std::uint64_t count, bool handsOutStorage) : storage(count) {
+        registerCollectionClass();
+        for (std::uint64_t& item : storage) {
+            items.push_back(reinterpret_cast<NS::Object*>(&item));
+        }
+        id self = class_createInstance(objc_lookUpClass("TestCollection"), sizeof(Collection));
+        collection(self) = { items.data(), count, handsOutStorage, 0, 0 };
+        array = reinterpret_cast<NS::Array*>(self);
+    }
+    ~Fixture() { object_dispose(reinterpret_cast<id>(array)); }
+
+    std::uint64_t enumerationCalls() const { return collection(reinterpret_cast<id>(array)).enumerationCalls; }
+};
+
+}
+
+TEST_CASE("a collection that hands out its storage is enumerated in one batch") {
+    Fixture fixture(100, true);
+    std::uint64_t index = 0;
+    for (NS::Object* object : *fixture.array) {
+        CHECK(object == fixture.items[index]);
+        index++;
+    }
+    CHECK(index == 100);
+    // One batch, then the call that returns 0.
+    CHECK(fixture.enumerationCalls() == 2);
+}
+
+TEST_CASE("a collection that copies is enumerated one buffer at a time") {
+    Fixture fixture(40, false);
+    std::uint64_t index = 0;
+    for (Item* item : fixture.array->objects<Item>()) {
+        CHECK(reinterpret_cast<NS::Object*>(item) == fixture.items[index]);
+        index++;
+    }
+    CHECK(index == 40);
+    // Batches of 16, 16 and 8, then the call that returns 0.
+    CHECK(fixture.enumerationCalls() == 4);
+}
+
+TEST_CASE("an empty collection begins at its end") {
+    Fixture fixture(0, true);
+    CHECK(fixture.array->begin() == fixture.array->end());
+    CHECK(fixture.enumerationCalls() == 1);
+}
+
+TEST_CASE("postfix increment returns the position before it, across batches") {
+    Fixture fixture(20, false);
+    NS::FastEnumerationIterator<NS::Object> it = fixture.array->begin();
+    for (std::uint64_t i = 0; i < 16; i++) {
+        NS::FastEnumerationIterator<NS::Object> previous = it++;
+        CHECK(*previous == fixture.items[i]);
+    }
+    // The last increment fetched the second batch into the iterator's buffer; the copies kept the first.
+    CHECK(*it == fixture.items[16]);
+    CHECK(fixture.enumerationCalls() == 2);
+}
+
+TEST_CASE("getObjects fills a vector or an array of a derived type") {
+    Fixture fixture(10, true);
+
+    std::vector<Item*> items(4);
+    CHECK(fixture.array->getObjects(items, 3) == 4);
+    for (std::uint64_t i = 0; i < items.size(); i++) {
+        CHECK(reinterpret_cast<NS::Object*>(items[i]) == fixture.items[3 + i]);
+    }
+
+    std::array<NS::Object*, 16> objects {};
+    CHECK(fixture.array->getObjects(objects) == 10);
+    CHECK(objects[9] == fixture.items[9]);
+    CHECK(objects[10] == nullptr);
+
+    CHECK(fixture.array->getObjects(std::span(objects).first(2), 8) == 2);
+    CHECK(objects[0] == fixture.items[8]);
+    CHECK(fixture.array->getObjects(items, 10) == 0);
+}
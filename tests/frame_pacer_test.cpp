@@ -0,0 +1,153 @@
+//
+//  frame_pacer_test.cpp
+//  Metal-Guide
+//
+//  FramePacer against a simulated GPU clock: a CPU that spends a fixed time building each frame and a GPU that runs
+//  submitted frames in order, each for a fixed time, and signals the frame's value when it finishes.
+//
+
+#include "frame_pacer.hpp"
+
+#include "test.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+
+namespace {
+
+// Times are in microseconds.
+class SimulatedGpu {
+public:
+    explicit SimulatedGpu(std::uint64_t frameTime) : frameTime(frameTime) {}
+
+    void submit(std::uint64_t value, std::uint64_t now) {
+        std::uint64_t start = std::max(now, queue.empty() ? lastFinish : queue.back().finish);
+        queue.push_back(Frame { value, start + frameTime });
+    }
+
+    // What SharedEvent::signaledValue() would return at time now.
+    std::uint64_t signaledValue(std::uint64_t now) {
+        while (!queue.empty() && queue.front().finish <= now) {
+            signaled = queue.front().value;
+            lastFinish = queue.front().finish;
+            queue.pop_front();
+        }
+        return signaled;
+    }
+
+    // When the frame with the given value finishes; it must have been submitted.
+    std::uint64_t finishTime(std::uint64_t value) const {
+        for (const Frame& frame : queue) {
+            if (frame.value >= value) {
+                return frame.finish;
+            }
+        }
+        return lastFinish;
+    }
+
+private:
+    struct Frame {
+        std::uint64_t value;
+        std::uint64_t finish;
+    };
+
+    std::uint64_t frameTime;
+    std::deque<Frame> queue;
+    std::uint64_t signaled = 0;
+    std::uint64_t lastFinish = 0;
+};
+
+struct PacingResult {
+    double framesPerSecond;
+    FramePacerStats stats;
+};
+
+// Runs frameCount frames the way FrameScheduler does: check the signaled value, wait for the required one if the GPU
+// is too far behind, build the frame on the CPU, submit it.
+PacingResult simulate(std::uint32_t framesInFlight, std::uint64_t cpuTime, std::uint64_t gpuTime, std::uint64_t frameCount = 200) {
+    FramePacer pacer(framesInFlight);
+    SimulatedGpu gpu(gpuTime);
+    std::uint64_t now = 0;
+    for (std::uint64_t frame = 0; frame < frameCount; frame++) {
+        pacer.observe(gpu.signaledValue(now));
+        bool blocked = !pacer.canBeginFrame();
+        if (blocked) {
+            now = gpu.finishTime(pacer.requiredValue());
+            pacer.observe(gpu.signaledValue(now));
+        }
+        std::uint64_t value = pacer.beginFrame(blocked);
+        now += cpuTime;
+        gpu.submit(value, now);
+    }
+    now = gpu.finishTime(pacer.submittedValue());
+    return PacingResult { double(frameCount) * 1e6 / double(now), pacer.stats() };
+}
+
+bool near(double value, double expected) {
+    return std::fabs(value - expected) < expected * 0.02;
+}
+
+}
+
+TEST_CASE("frames wait for the one framesInFlight back") {
+    FramePacer pacer(2);
+    CHECK(pacer.requiredValue() == 0);
+    CHECK(pacer.beginFrame() == 1);
+    CHECK(pacer.requiredValue() == 0);
+    CHECK(pacer.beginFrame() == 2);
+    CHECK(pacer.requiredValue() == 1);
+    CHECK(!pacer.canBeginFrame());
+
+    pacer.observe(1);
+    CHECK(pacer.canBeginFrame());
+    CHECK(pacer.beginFrame() == 3);
+    CHECK(pacer.framesPending() == 2);
+
+    // Stale values and values past the last submitted frame don't move it backwards or past what was submitted.
+    pacer.observe(0);
+    CHECK(pacer.completedValue() == 1);
+    pacer.observe(10);
+    CHECK(pacer.completedValue() == 3);
+}
+
+TEST_CASE("lowering frames in flight makes the next frame wait for more") {
+    FramePacer pacer(3);
+    pacer.beginFrame();
+    pacer.beginFrame();
+    pacer.beginFrame();
+    pacer.observe(1);
+    CHECK(pacer.canBeginFrame());
+
+    pacer.setFramesInFlight(1);
+    CHECK(pacer.requiredValue() == 3);
+    CHECK(!pacer.canBeginFrame());
+    pacer.observe(3);
+    CHECK(pacer.canBeginFrame());
+}
+
+TEST_CASE("one frame in flight serializes the CPU and GPU") {
+    PacingResult result = simulate(1, 4000, 10000);
+    CHECK(near(result.framesPerSecond, 1e6 / 14000.0));
+    CHECK(result.stats.maxFramesPending == 1);
+}
+
+TEST_CASE("more frames in flight run at the rate of the slower side") {
+    for (std::uint32_t framesInFlight : { 2u, 3u }) {
+        PacingResult gpuBound = simulate(framesInFlight, 4000, 10000);
+        CHECK(near(gpuBound.framesPerSecond, 100.0));
+        CHECK(gpuBound.stats.maxFramesPending == framesInFlight);
+
+        // A CPU-bound frame never waits for the GPU.
+        PacingResult cpuBound = simulate(framesInFlight, 12000, 5000);
+        CHECK(near(cpuBound.framesPerSecond, 1e6 / 12000.0));
+        CHECK(cpuBound.stats.blockedFrames == 0);
+    }
+}
+
+TEST_CASE("a GPU-bound CPU waits on nearly every frame, never with more than framesInFlight pending") {
+    PacingResult result = simulate(2, 4000, 10000);
+    CHECK(result.stats.blockedFrames >= result.stats.frames - 2);
+    CHECK(result.stats.maxFramesPending <= 2);
+}
@@ -0,0 +1,110 @@
+//
+//  frame_ring_test.cpp
+//  Metal-Guide
+//
+
+#include "frame_ring.hpp"
+
+#include "test.hpp"
+
+#include <memory>
+#include <thread>
+
+namespace {
+
+// Runs one frame with a single allocation and returns the region it landed in.
+std::size_t runFrame(FrameRing& ring) {
+    ring.beginFrame();
+    std::size_t region = *ring.allocate(16, 16) / ring.regionSize();
+    ring.endFrame();
+    return region;
+}
+
+}
+
+TEST_CASE("frames take the regions in turn and stay inside them") {
+    FrameRing ring(256, 3);
+    ring.beginFrame();
+    CHECK(ring.allocate(200, 16) == 0u);
+    CHECK(!ring.allocate(100, 16));
+    CHECK(ring.allocate(32, 16) == 208u);
+    ring.endFrame();
+
+    CHECK(runFrame(ring) == 1);
+    CHECK(runFrame(ring) == 2);
+    CHECK(!ring.regionReady());
+    ring.completeFrame(0);
+    CHECK(runFrame(ring) == 0);
+    CHECK(ring.stats().failedAllocations == 1);
+}
+
+TEST_CASE("growing adds a region used next, up to the limit") {
+    FrameRing ring(256, 2);
+    runFrame(ring);
+    runFrame(ring);
+    CHECK(!ring.regionReady());
+
+    CHECK(ring.growIfFull(3));
+    CHECK(ring.regionCount() == 3);
+    CHECK(ring.capacity() == 768);
+    CHECK(runFrame(ring) == 2);
+
+    // At the limit the ring no longer grows, and the oldest region is next in line.
+    CHECK(!ring.growIfFull(3));
+    CHECK(!ring.regionReady());
+    ring.completeFrame(0);
+    CHECK(!ring.growIfFull(3));
+    CHECK(runFrame(ring) == 0);
+    ring.completeFrame(1);
+    CHECK(runFrame(ring) == 1);
+    ring.completeFrame(2);
+    CHECK(runFrame(ring) == 2);
+    CHECK(ring.stats().regionsAdded == 1);
+}
+
+TEST_CASE("growing does nothing while the next region is free") {
+    FrameRing ring(256, 2);
+    runFrame(ring);
+    CHECK(!ring.growIfFull(4));
+    CHECK(ring.regionCount() == 2);
+}
+
+TEST_CASE("a reset keeps regions busy until their frames complete") {
+    FrameRing ring(256, 2);
+    runFrame(ring);
+    runFrame(ring);
+    ring.reset(512);
+    CHECK(ring.regionSize() == 512);
+    CHECK(!ring.regionReady());
+    ring.completeFrame(0);
+    CHECK(ring.regionReady());
+    ring.beginFrame();
+    CHECK(ring.allocate(400, 16) == 0u);
+    ring.endFrame();
+}
+
+TEST_CASE("a reset moves the open frame to its region in the new memory") {
+    FrameRing ring(256, 2);
+    runFrame(ring);
+    ring.beginFrame();
+    CHECK(ring.allocate(200, 16) == 256u);
+    CHECK(!ring.allocate(200, 16));
+    ring.reset(1024);
+    CHECK(ring.allocate(200, 16) == 1024u);
+    CHECK(ring.allocate(200, 16) == 1232u);
+    ring.endFrame();
+}
+
+TEST_CASE("a ring can be destroyed as soon as the frame it waited for completes") {
+    // UniformRing's destructor does this while the last completion handler may still be running.
+    for (int i = 0; i < 2000; i++) {
+        auto ring = std::make_unique<FrameRing>(256, 1);
+        ring->beginFrame();
+        std::uint64_t serial = ring->endFrame();
+        FrameRing* completing = ring.get();
+        std::thread handler([completing, serial] { completing->completeFrame(serial); });
+        ring->waitForFrame(serial);
+        ring.reset();
+        handler.join();
+    }
+}
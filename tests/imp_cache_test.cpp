@@ -0,0 +1,113 @@
+//
+//  imp_cache_test.cpp
+//  Metal-Guide
+//
+
+#define METALCPP_IMP_CACHE
+#include <Foundation/NSAutoreleasePool.hpp>
+#include <Foundation/NSObject.hpp>
+
+#include "test.hpp"
+
+#include <cstdint>
+
+namespace {
+
+struct Extent {
+    double width, height, depth, scale;
+};
+
+class Counter : public NS::Referencing<Counter> {
+public:
+    static Counter* make(const char* className) {
+        return reinterpret_cast<Counter*>(class_createInstance(objc_lookUpClass(className), sizeof(std::uint64_t)));
+    }
+
+    std::uint64_t add(std::uint64_t amount) {
+        return sendMessageCached<std::uint64_t>(_NS_PRIVATE_IMP_CACHE_SITE(), this, sel_registerName("add:"), amount);
+    }
+
+    std::uint64_t addUncached(std::uint64_t amount) { return sendMessage<std::uint64_t>(this, sel_registerName("add:"), amount); }
+
+    double scaled(double factor, float bias) {
+        return sendMessageCached<double>(_NS_PRIVATE_IMP_CACHE_SITE(), this, sel_registerName("scaled:bias:"), factor, bias);
+    }
+
+    Extent extent(double scale) { return sendMessageCached<Extent>(_NS_PRIVATE_IMP_CACHE_SITE(), this, sel_registerName("extent:"), scale); }
+};
+
+std::uint64_t& value(id self) {
+    return *static_cast<std::uint64_t*>(object_getIndexedIvars(self));
+}
+
+// Counter adds its argument; DoublingCounter, a subclass, adds it twice, so a stale cache entry shows in the result.
+void registerClasses() {
+    if (objc_lookUpClass("Counter")) {
+        return;
+    }
+    Class counter = objc_allocateClassPair(objc_lookUpClass("NSObject"), "Counter", 0);
+    class_addMethod(counter, sel_registerName("add:"),
+        reinterpret_cast<IMP>(+[](id self, SEL, std::uint64_t amount) -> std::uint64_t { return value(self) += amount; }), "Q@:Q");
+    class_addMethod(counter, sel_registerName("scaled:bias:"),
+        reinterpret_cast<IMP>(+[](id self, SEL, double factor, float bias) { return double(value(self)) * factor + bias; }), "d@:df");
+    class_addMethod(counter, sel_registerName("extent:"),
+        reinterpret_cast<IMP>(+[](id self, SEL, double scale) { return Extent { 1.0, 2.0, double(value(self)), scale }; }), "{Extent=dddd}@:d");
+    objc_registerClassPair(counter);
+
+    Class doubling = objc_allocateClassPair(counter, "DoublingCounter", 0);
+    class_addMethod(doubling, sel_registerName("add:"),
+        reinterpret_cast<IMP>(+[](id self, SEL, std::uint64_t amount) -> std::uint64_t { return value(self) += 2 * amount; }), "Q@:Q");
+    objc_registerClassPair(doubling);
+}
+
+}
+
+TEST_CASE("cached sends reach the receiver's method") {
+    registerClasses();
+    Counter* counter = Counter::make("Counter");
+    CHECK(counter->add(3) == 3);
+    CHECK(counter->add(4) == 7);
+    CHECK(counter->addUncached(1) == 8);
+    CHECK(counter->scaled(0.5, 1.0f) == 5.0);
+
+    Extent extent = counter->extent(3.0);
+    CHECK(extent.width == 1.0 && extent.height == 2.0 && extent.depth == 8.0 && extent.scale == 3.0);
+    counter->release();
+}
+
+TEST_CASE("a class change refills the entry") {
+    registerClasses();
+    Counter* counter = Counter::make("Counter");
+    Counter* doubling = Counter::make("DoublingCounter");
+    CHECK(counter->add(1) == 1);
+    CHECK(doubling->add(1) == 2);
+    CHECK(counter->add(1) == 2);
+
+    object_setClass(reinterpret_cast<id>(counter), objc_lookUpClass("DoublingCounter"));
+    CHECK(counter->add(1) == 4);
+    CHECK(counter->scaled(1.0, 0.0f) == 4.0);
+    counter->release();
+    doubling->release();
+}
+
+TEST_CASE("messages to nil return zero") {
+    // Calling a wrapper through a null pointer is undefined in C++, so go through objc_msgSend itself.
+    using AddProc = std::uint64_t (*)(id, SEL, std::uint64_t);
+    using ScaledProc = double (*)(id, SEL, double, float);
+    CHECK(reinterpret_cast<AddProc>(&objc_msgSend)(nullptr, sel_registerName("add:"), 5) == 0);
+    CHECK(reinterpret_cast<ScaledProc>(&objc_msgSend_fpret)(nullptr, sel_registerName("scaled:bias:"), 2.0, 1.0f) == 0.0);
+}
+
+TEST_CASE("autorelease pools release their objects") {
+    registerClasses();
+    Counter* counter = Counter::make("Counter");
+    counter->retain();
+    {
+        NS::AutoreleasePool* pool = NS::AutoreleasePool::alloc()->init();
+        counter->autorelease();
+        CHECK(counter->retainCount() == 2);
+        pool->drain();
+    }
+    CHECK(counter->retainCount() == 1);
+    counter->release();
+}
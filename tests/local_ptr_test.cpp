@@ -0,0 +1,59 @@
+//
+//  local_ptr_test.cpp
+//  Metal-Guide
+//
+
+#include <Foundation/NSLocalPtr.hpp>
+
+#include "test.hpp"
+
+#include <utility>
+
+namespace {
+
+class Derived : public NS::Referencing<Derived> {
+};
+
+Derived* makeDerived() {
+    return reinterpret_cast<Derived*>(class_createInstance(objc_lookUpClass("NSObject"), 0));
+}
+
+}
+
+TEST_CASE("copies share one retain") {
+    Derived* object = makeDerived();
+    {
+        NS::LocalPtr<Derived> first = NS::RetainLocalPtr(object);
+        NS::LocalPtr<Derived> second = first;
+        CHECK(first.useCount() == 2);
+        CHECK(object->retainCount() == 2);
+    }
+    CHECK(object->retainCount() == 1);
+    object->release();
+}
+
+TEST_CASE("a LocalPtr to a derived class converts to one to its base") {
+    Derived* object = makeDerived();
+    {
+        NS::LocalPtr<Derived> derived = NS::RetainLocalPtr(object);
+        NS::LocalPtr<NS::Object> copied = derived;
+        CHECK(copied.get() == object);
+        CHECK(derived.useCount() == 2);
+
+        NS::LocalPtr<NS::Object> moved = std::move(derived);
+        CHECK(!derived);
+        CHECK(moved.useCount() == 2);
+
+        NS::LocalPtr<NS::Object> assigned;
+        assigned = NS::RetainLocalPtr(object);
+        CHECK(assigned.useCount() == 1);
+        assigned = moved;
+        CHECK(assigned.useCount() == 3);
+        CHECK(object->retainCount() == 2);
+        assigned = NS::LocalPtr<Derived>();
+        CHECK(!assigned);
+        CHECK(moved.useCount() == 2);
+    }
+    CHECK(object->retainCount() == 1);
+    object->release();
+}
@@ -0,0 +1,12 @@
+//
+//  foundation_implementation.cpp
+//  Metal-Guide
+//
+//  The metal-cpp Foundation symbols for the Linux build. Only the headers that don't use blocks are pulled in; the
+//  Metal headers all include those that do, so Metal classes are forward-declared or faked in the tests instead.
+//
+
+#define NS_PRIVATE_IMPLEMENTATION
+#include <Foundation/NSAutoreleasePool.hpp>
+#include <Foundation/NSObject.hpp>
+#include <Foundation/NSString.hpp>
@@ -0,0 +1,47 @@
+//
+//  CoreFoundation.h
+//  Metal-Guide
+//
+//  Linux stand-in for the CoreFoundation types the metal-cpp Foundation headers name. Only the types are provided.
+//
+
+#pragma once
+
+#include <cstdint>
+
+typedef double CFTimeInterval;
+typedef const void* CFTypeRef;
+typedef struct __CFString* CFStringRef;
+typedef long CFIndex;
+typedef unsigned int CFStringEncoding;
+typedef unsigned char UInt8;
+typedef unsigned char Boolean;
+
+typedef struct {
+    CFIndex location;
+    CFIndex length;
+} CFRange;
+
+static inline CFRange CFRangeMake(CFIndex location, CFIndex length) {
+    CFRange range = { location, length };
+    return range;
+}
+
+enum {
+    kCFStringEncodingUTF8 = 0x08000100,
+};
+
+extern "C" {
+const char* CFStringGetCStringPtr(CFStringRef string, CFStringEncoding encoding);
+CFIndex CFStringGetLength(CFStringRef string);
+CFIndex CFStringGetBytes(CFStringRef string, CFRange range, CFStringEncoding encoding, UInt8 lossByte, Boolean isExternalRepresentation,
+    UInt8* buffer, CFIndex maxBufLen, CFIndex* usedBufLen);
+}
+
+typedef struct dispatch_queue_s* dispatch_queue_t;
+typedef struct dispatch_data_s* dispatch_data_t;
+
+#ifndef __clang__
+// GCC has no CFSTR builtin; the constant strings are only compared, never messaged, off-device.
+#define __builtin___CFStringMakeConstantString(string) ((const void*)(string))
+#endif
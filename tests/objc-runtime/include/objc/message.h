@@ -0,0 +1,18 @@
+//
+//  message.h
+//  Metal-Guide
+//
+//  Linux stand-in for <objc/message.h>. Like Apple's, the entry points are declared without a prototype and must be
+//  cast to the method's real signature before calling.
+//
+
+#pragma once
+
+#include <objc/runtime.h>
+
+extern "C" {
+
+void objc_msgSend(void);
+void objc_msgSend_stret(void);
+void objc_msgSend_fpret(void);
+}
@@ -0,0 +1,59 @@
+//
+//  runtime.h
+//  Metal-Guide
+//
+//  Linux stand-in for the parts of <objc/runtime.h> that metal-cpp and the tests use. See objc_runtime.cpp.
+//
+
+#pragma once
+
+#include <cstddef>
+
+#if defined(__aarch64__) && !defined(__arm64__)
+// metal-cpp picks its message-send entry points by Apple's architecture macro.
+#define __arm64__ 1
+#endif
+
+typedef struct objc_class* Class;
+typedef struct objc_object {
+    Class isa;
+}* id;
+typedef struct objc_selector* SEL;
+typedef void (*IMP)(void);
+typedef bool BOOL;
+typedef struct objc_object Protocol;
+
+#define YES true
+#define NO false
+#define Nil nullptr
+#define nil nullptr
+
+extern "C" {
+
+SEL sel_registerName(const char* name);
+const char* sel_getName(SEL selector);
+
+Class objc_lookUpClass(const char* name);
+Class objc_getClass(const char* name);
+Protocol* objc_getProtocol(const char* name);
+
+// Classes must be set up before other threads send messages to them.
+Class objc_allocateClassPair(Class superclass, const char* name, std::size_t extraBytes);
+void objc_registerClassPair(Class cls);
+BOOL class_addMethod(Class cls, SEL name, IMP imp, const char* types);
+IMP class_replaceMethod(Class cls, SEL name, IMP imp, const char* types);
+IMP class_getMethodImplementation(Class cls, SEL name);
+BOOL class_respondsToSelector(Class cls, SEL name);
+const char* class_getName(Class cls);
+Class class_getSuperclass(Class cls);
+std::size_t class_getInstanceSize(Class cls);
+
+id class_createInstance(Class cls, std::size_t extraBytes);
+id object_dispose(id object);
+Class object_getClass(id object);
+Class object_setClass(id object, Class cls);
+void* object_getIndexedIvars(id object);
+
+void* objc_autoreleasePoolPush(void);
+void objc_autoreleasePoolPop(void* context);
+}
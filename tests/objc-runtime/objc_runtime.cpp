@@ -0,0 +1,553 @@
+//
+//  objc_runtime.cpp
+//  Metal-Guide
+//
+//  A small Objective-C runtime for building and running metal-cpp code on Linux, where there is no libobjc. It has
+//  selectors, classes with metaclasses and single inheritance, methods added at runtime, a root NSObject with
+//  reference counting, autorelease pools, and an objc_msgSend that looks the method up and tail-calls it with the
+//  caller's arguments intact. Tests and benchmarks build fake Metal objects by registering classes the same way
+//  Objective-C code would, through objc_allocateClassPair and class_addMethod.
+//
+//  Dispatch looks methods up in a hash table per class on every send, with no method cache, so it is slower than
+//  Apple's objc_msgSend. Compare timings taken against it with each other, not with a device.
+//
+
+#include <objc/message.h>
+#include <objc/runtime.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <unordered_map>
+
+struct objc_class : objc_object {
+    Class superclass;
+    const char* name;
+    std::size_t instanceSize;
+    std::unordered_map<SEL, IMP> methods;
+    bool registered;
+};
+
+namespace {
+
+// Every object starts with this; subclasses have no ivars of their own and keep their state in indexed ivars.
+struct ObjectHeader {
+    Class isa;
+    std::atomic<std::uintptr_t> retainCount;
+};
+
+struct Runtime {
+    // Registering the root classes registers selectors, so selectors have their own lock.
+    std::mutex selectorMutex;
+    std::unordered_map<std::string, std::unique_ptr<char[]>> selectors;
+    std::mutex mutex;
+    std::unordered_map<std::string, Class> classes;
+    std::unordered_map<std::string, std::unique_ptr<Protocol>> protocols;
+};
+
+// Reached from other translation units' static initializers, so it can't be a namespace-scope object.
+Runtime& runtime() {
+    static Runtime* shared = new Runtime;
+    return *shared;
+}
+
+// Autorelease pools are laid out the way Apple's runtime lays them out, because NS::AutoreleaseScope measures them:
+// each thread has a list of pages aligned to their size, a push writes a null boundary slot and returns its address,
+// and the first push on a thread with no page yet returns the placeholder token 1 without allocating one.
+constexpr std::size_t poolPageSize = 16384;
+void* const emptyPoolPlaceholder = reinterpret_cast<void*>(1);
+
+struct PoolPage {
+    PoolPage* parent;
+    PoolPage* child;
+    id* next;
+
+    id* begin() { return reinterpret_cast<id*>(this + 1); }
+    id* end() { return reinterpret_cast<id*>(reinterpret_cast<char*>(this) + poolPageSize); }
+};
+
+struct PoolStack {
+    PoolPage* hotPage = nullptr;
+    bool placeholder = false;
+};
+
+thread_local PoolStack poolStack;
+
+PoolPage* newPoolPage(PoolPage* parent) {
+    auto* page = static_cast<PoolPage*>(std::aligned_alloc(poolPageSize, poolPageSize));
+    page->parent = parent;
+    page->child = nullptr;
+    page->next = page->begin();
+    if (parent) {
+        parent->child = page;
+    }
+    return page;
+}
+
+id* pushSlot(id object) {
+    PoolStack& stack = poolStack;
+    if (!stack.hotPage) {
+        stack.hotPage = newPoolPage(nullptr);
+        if (stack.placeholder) {
+            // The placeholder pool gets its boundary now that there is somewhere to put it.
+            stack.placeholder = false;
+            *stack.hotPage->next++ = nullptr;
+        }
+    } else if (stack.hotPage->next == stack.hotPage->end()) {
+        stack.hotPage = stack.hotPage->child ? stack.hotPage->child : newPoolPage(stack.hotPage);
+    }
+    id* slot = stack.hotPage->next++;
+    *slot = object;
+    return slot;
+}
+
+void releaseObject(id object) {
+    using Release = void (*)(id, SEL);
+    SEL selector = sel_registerName("release");
+    reinterpret_cast<Release>(class_getMethodImplementation(object_getClass(object), selector))(object, selector);
+}
+
+[[noreturn]] void unrecognizedSelector(id self, SEL selector) {
+    Class cls = object_getClass(self);
+    std::fprintf(stderr, "objc: -[%s %s]: unrecognized selector sent to %p\n", cls ? cls->name : "nil", sel_getName(selector),
+        static_cast<void*>(self));
+    std::abort();
+}
+
+Class makeClass(Class isa, Class superclass, const char* name, std::size_t instanceSize) {
+    Class cls = new objc_class;
+    cls->isa = isa;
+    cls->superclass = superclass;
+    cls->name = name;
+    cls->instanceSize = instanceSize;
+    cls->registered = false;
+    return cls;
+}
+
+template <typename Function>
+void addMethod(Class cls, const char* name, Function function) {
+    class_addMethod(cls, sel_registerName(name), reinterpret_cast<IMP>(function), nullptr);
+}
+
+id retain(id self, SEL) {
+    reinterpret_cast<ObjectHeader*>(self)->retainCount.fetch_add(1, std::memory_order_relaxed);
+    return self;
+}
+
+void release(id self, SEL) {
+    if (reinterpret_cast<ObjectHeader*>(self)->retainCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        using Dealloc = void (*)(id, SEL);
+        SEL dealloc = sel_registerName("dealloc");
+        reinterpret_cast<Dealloc>(class_getMethodImplementation(object_getClass(self), dealloc))(self, dealloc);
+    }
+}
+
+id autorelease(id self, SEL) {
+    // Like Apple's runtime, an object autoreleased with no pool in place just leaks.
+    if (poolStack.hotPage || poolStack.placeholder) {
+        pushSlot(self);
+    }
+    return self;
+}
+
+// NSObject and NSAutoreleasePool, with the methods metal-cpp sends to every object.
+void registerRootClasses(Runtime& state) {
+    Class rootMetaclass = makeClass(nullptr, nullptr, "NSObject", sizeof(ObjectHeader));
+    rootMetaclass->isa = rootMetaclass;
+    Class root = makeClass(rootMetaclass, nullptr, "NSObject", sizeof(ObjectHeader));
+    rootMetaclass->superclass = root;
+    root->registered = true;
+    state.classes.emplace("NSObject", root);
+
+    addMethod(rootMetaclass, "alloc", +[](id self, SEL) { return class_createInstance(reinterpret_cast<Class>(self), 0); });
+    addMethod(rootMetaclass, "class", +[](id self, SEL) { return self; });
+    addMethod(root, "init", +[](id self, SEL) { return self; });
+    addMethod(root, "class", +[](id self, SEL) { return reinterpret_cast<id>(object_getClass(self)); });
+    addMethod(root, "retain", retain);
+    addMethod(root, "release", release);
+    addMethod(root, "autorelease", autorelease);
+    addMethod(root, "retainCount", +[](id self, SEL) -> std::uintptr_t {
+        return reinterpret_cast<ObjectHeader*>(self)->retainCount.load(std::memory_order_relaxed);
+    });
+    addMethod(root, "dealloc", +[](id self, SEL) { object_dispose(self); });
+    addMethod(root, "respondsToSelector:", +[](id self, SEL, SEL selector) -> BOOL {
+        return class_respondsToSelector(object_getClass(self), selector);
+    });
+
+    // An NSAutoreleasePool instance stands for the pool pushed by init; draining it pops back to that point.
+    Class pool = makeClass(makeClass(rootMetaclass, rootMetaclass, "NSAutoreleasePool", 0), root, "NSAutoreleasePool",
+        sizeof(ObjectHeader) + sizeof(void*));
+    pool->registered = true;
+    state.classes.emplace("NSAutoreleasePool", pool);
+
+    auto drain = +[](id self, SEL) {
+        void* token = *reinterpret_cast<void**>(reinterpret_cast<ObjectHeader*>(self) + 1);
+        objc_autoreleasePoolPop(token);
+        object_dispose(self);
+    };
+    addMethod(pool, "init", +[](id self, SEL) {
+        *reinterpret_cast<void**>(reinterpret_cast<ObjectHeader*>(self) + 1) = objc_autoreleasePoolPush();
+        return self;
+    });
+    addMethod(pool, "drain", drain);
+    addMethod(pool, "release", drain);
+    addMethod(pool, "addObject:", +[](id, SEL, id object) { autorelease(object, nullptr); });
+}
+
+}
+
+extern "C" {
+
+// Called by the objc_msgSend trampolines with the receiver already known to be non-nil.
+IMP objc_standin_lookup(id self, SEL selector) {
+    return class_getMethodImplementation(self->isa, selector);
+}
+
+SEL sel_registerName(const char* name) {
+    Runtime& state = runtime();
+    std::lock_guard<std::mutex> lock(state.selectorMutex);
+    auto found = state.selectors.find(name);
+    if (found == state.selectors.end()) {
+        std::size_t length = std::strlen(name) + 1;
+        auto stored = std::make_unique<char[]>(length);
+        std::memcpy(stored.get(), name, length);
+        found = state.selectors.emplace(name, std::move(stored)).first;
+    }
+    return reinterpret_cast<SEL>(found->second.get());
+}
+
+const char* sel_getName(SEL selector) {
+    return selector ? reinterpret_cast<const char*>(selector) : "<null selector>";
+}
+
+Class objc_lookUpClass(const char* name) {
+    Runtime& state = runtime();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (state.classes.empty()) {
+        registerRootClasses(state);
+    }
+    auto found = state.classes.find(name);
+    return found != state.classes.end() && found->second->registered ? found->second : nullptr;
+}
+
+Class objc_getClass(const char* name) {
+    return objc_lookUpClass(name);
+}
+
+Protocol* objc_getProtocol(const char* name) {
+    Runtime& state = runtime();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    std::unique_ptr<Protocol>& protocol = state.protocols[name];
+    if (!protocol) {
+        protocol = std::make_unique<Protocol>();
+    }
+    return protocol.get();
+}
+
+Class objc_allocateClassPair(Class superclass, const char* name, std::size_t) {
+    if (!superclass) {
+        // Only NSObject may be a root class.
+        return nullptr;
+    }
+    Runtime& state = runtime();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (state.classes.count(name)) {
+        return nullptr;
+    }
+    const char* storedName = strdup(name);
+    Class rootMetaclass = superclass->isa->isa;
+    Class metaclass = makeClass(rootMetaclass, superclass->isa, storedName, 0);
+    Class cls = makeClass(metaclass, superclass, storedName, superclass->instanceSize);
+    state.classes.emplace(name, cls);
+    return cls;
+}
+
+void objc_registerClassPair(Class cls) {
+    std::lock_guard<std::mutex> lock(runtime().mutex);
+    cls->registered = true;
+}
+
+BOOL class_addMethod(Class cls, SEL name, IMP imp, const char*) {
+    return cls->methods.emplace(name, imp).second;
+}
+
+IMP class_replaceMethod(Class cls, SEL name, IMP imp, const char*) {
+    IMP& slot = cls->methods[name];
+    IMP previous = slot;
+    slot = imp;
+    return previous;
+}
+
+IMP class_getMethodImplementation(Class cls, SEL name) {
+    for (Class current = cls; current; current = current->superclass) {
+        auto found = current->methods.find(name);
+        if (found != current->methods.end()) {
+            return found->second;
+        }
+    }
+    return reinterpret_cast<IMP>(unrecognizedSelector);
+}
+
+BOOL class_respondsToSelector(Class cls, SEL name) {
+    return class_getMethodImplementation(cls, name) != reinterpret_cast<IMP>(unrecognizedSelector);
+}
+
+const char* class_getName(Class cls) {
+    return cls ? cls->name : "nil";
+}
+
+Class class_getSuperclass(Class cls) {
+    return cls ? cls->superclass : nullptr;
+}
+
+std::size_t class_getInstanceSize(Class cls) {
+    return cls ? cls->instanceSize : 0;
+}
+
+id class_createInstance(Class cls, std::size_t extraBytes) {
+    // Indexed ivars start at the next 16-byte boundary, where object_getIndexedIvars finds them.
+    std::size_t ivars = (cls->instanceSize + 15) & ~std::size_t(15);
+    void* memory = std::calloc(1, ivars + extraBytes);
+    if (!memory) {
+        return nullptr;
+    }
+    auto* header = static_cast<ObjectHeader*>(memory);
+    header->isa = cls;
+    new (&header->retainCount) std::atomic<std::uintptr_t>(1);
+    return reinterpret_cast<id>(header);
+}
+
+id object_dispose(id object) {
+    std::free(object);
+    return nullptr;
+}
+
+Class object_getClass(id object) {
+    return object ? object->isa : nullptr;
+}
+
+Class object_setClass(id object, Class cls) {
+    if (!object) {
+        return nullptr;
+    }
+    Class previous = object->isa;
+    object->isa = cls;
+    return previous;
+}
+
+void* object_getIndexedIvars(id object) {
+    std::size_t ivars = (object->isa->instanceSize + 15) & ~std::size_t(15);
+    return reinterpret_cast<char*>(object) + ivars;
+}
+
+void* objc_autoreleasePoolPush(void) {
+    if (!poolStack.hotPage && !poolStack.placeholder) {
+        poolStack.placeholder = true;
+        return emptyPoolPlaceholder;
+    }
+    return pushSlot(nullptr);
+}
+
+void objc_autoreleasePoolPop(void* context) {
+    PoolStack& stack = poolStack;
+    if (context == emptyPoolPlaceholder) {
+        stack.placeholder = false;
+        if (!stack.hotPage) {
+            return;
+        }
+        PoolPage* coldPage = stack.hotPage;
+        while (coldPage->parent) {
+            coldPage = coldPage->parent;
+        }
+        context = coldPage->begin();
+    }
+
+    // Releasing can autorelease more objects, so pop one slot at a time.
+    id* boundary = static_cast<id*>(context);
+    while (true) {
+        PoolPage* page = stack.hotPage;
+        if (page->next == page->begin()) {
+            stack.hotPage = page->parent;
+            continue;
+        }
+        id* slot = --page->next;
+        if (slot == boundary) {
+            break;
+        }
+        if (*slot) {
+            releaseObject(*slot);
+        }
+    }
+
+    // Keep one spare page past the hot page, as Apple's runtime does, and free the rest.
+    PoolPage* spare = stack.hotPage->child;
+    if (spare) {
+        for (PoolPage* page = spare->child; page;) {
+            PoolPage* child = page->child;
+            std::free(page);
+            page = child;
+        }
+        spare->child = nullptr;
+        spare->next = spare->begin();
+    }
+}
+}
+
+// The entry points save every argument register, look the method up, restore the registers and jump to the IMP, so
+// the method sees exactly the arguments the caller passed. A nil receiver returns zero without a lookup.
+#if defined(__x86_64__)
+asm(R"(
+    .text
+
+    .globl objc_msgSend
+    .type objc_msgSend, @function
+objc_msgSend:
+    testq %rdi, %rdi
+    jz 2f
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $192, %rsp
+    movq %rdi, 0(%rsp)
+    movq %rsi, 8(%rsp)
+    movq %rdx, 16(%rsp)
+    movq %rcx, 24(%rsp)
+    movq %r8, 32(%rsp)
+    movq %r9, 40(%rsp)
+    movq %rax, 48(%rsp)
+    movdqa %xmm0, 64(%rsp)
+    movdqa %xmm1, 80(%rsp)
+    movdqa %xmm2, 96(%rsp)
+    movdqa %xmm3, 112(%rsp)
+    movdqa %xmm4, 128(%rsp)
+    movdqa %xmm5, 144(%rsp)
+    movdqa %xmm6, 160(%rsp)
+    movdqa %xmm7, 176(%rsp)
+    call objc_standin_lookup
+    movq %rax, %r11
+1:
+    movq 0(%rsp), %rdi
+    movq 8(%rsp), %rsi
+    movq 16(%rsp), %rdx
+    movq 24(%rsp), %rcx
+    movq 32(%rsp), %r8
+    movq 40(%rsp), %r9
+    movq 48(%rsp), %rax
+    movdqa 64(%rsp), %xmm0
+    movdqa 80(%rsp), %xmm1
+    movdqa 96(%rsp), %xmm2
+    movdqa 112(%rsp), %xmm3
+    movdqa 128(%rsp), %xmm4
+    movdqa 144(%rsp), %xmm5
+    movdqa 160(%rsp), %xmm6
+    movdqa 176(%rsp), %xmm7
+    leave
+    jmp *%r11
+2:
+    xorl %eax, %eax
+    xorl %edx, %edx
+    pxor %xmm0, %xmm0
+    pxor %xmm1, %xmm1
+    ret
+    .size objc_msgSend, .-objc_msgSend
+
+    .globl objc_msgSend_fpret
+    .type objc_msgSend_fpret, @function
+objc_msgSend_fpret:
+    jmp objc_msgSend
+    .size objc_msgSend_fpret, .-objc_msgSend_fpret
+
+    .globl objc_msgSend_stret
+    .type objc_msgSend_stret, @function
+objc_msgSend_stret:
+    testq %rsi, %rsi
+    jz 3f
+    pushq %rbp
+    movq %rsp, %rbp
+    subq $192, %rsp
+    movq %rdi, 0(%rsp)
+    movq %rsi, 8(%rsp)
+    movq %rdx, 16(%rsp)
+    movq %rcx, 24(%rsp)
+    movq %r8, 32(%rsp)
+    movq %r9, 40(%rsp)
+    movq %rax, 48(%rsp)
+    movdqa %xmm0, 64(%rsp)
+    movdqa %xmm1, 80(%rsp)
+    movdqa %xmm2, 96(%rsp)
+    movdqa %xmm3, 112(%rsp)
+    movdqa %xmm4, 128(%rsp)
+    movdqa %xmm5, 144(%rsp)
+    movdqa %xmm6, 160(%rsp)
+    movdqa %xmm7, 176(%rsp)
+    movq %rsi, %rdi
+    movq %rdx, %rsi
+    call objc_standin_lookup
+    movq %rax, %r11
+    jmp 1b
+3:
+    ret
+    .size objc_msgSend_stret, .-objc_msgSend_stret
+)");
+#elif defined(__aarch64__)
+asm(R"(
+    .text
+
+    .globl objc_msgSend
+    .type objc_msgSend, %function
+objc_msgSend:
+    cbz x0, 1f
+    stp x29, x30, [sp, #-16]!
+    mov x29, sp
+    sub sp, sp, #208
+    stp x0, x1, [sp, #0]
+    stp x2, x3, [sp, #16]
+    stp x4, x5, [sp, #32]
+    stp x6, x7, [sp, #48]
+    str x8, [sp, #64]
+    stp q0, q1, [sp, #80]
+    stp q2, q3, [sp, #112]
+    stp q4, q5, [sp, #144]
+    stp q6, q7, [sp, #176]
+    bl objc_standin_lookup
+    mov x16, x0
+    ldp x0, x1, [sp, #0]
+    ldp x2, x3, [sp, #16]
+    ldp x4, x5, [sp, #32]
+    ldp x6, x7, [sp, #48]
+    ldr x8, [sp, #64]
+    ldp q0, q1, [sp, #80]
+    ldp q2, q3, [sp, #112]
+    ldp q4, q5, [sp, #144]
+    ldp q6, q7, [sp, #176]
+    add sp, sp, #208
+    ldp x29, x30, [sp], #16
+    br x16
+1:
+    mov x1, #0
+    movi d0, #0
+    movi d1, #0
+    ret
+    .size objc_msgSend, .-objc_msgSend
+
+    // arm64 has no separate struct or floating-point return entry points; these only satisfy the declarations.
+    .globl objc_msgSend_fpret
+    .type objc_msgSend_fpret, %function
+objc_msgSend_fpret:
+    b objc_msgSend
+    .size objc_msgSend_fpret, .-objc_msgSend_fpret
+
+    .globl objc_msgSend_stret
+    .type objc_msgSend_stret, %function
+objc_msgSend_stret:
+    b objc_msgSend
+    .size objc_msgSend_stret, .-objc_msgSend_stret
+)");
+#else
+#error "The stand-in objc_msgSend supports x86-64 and arm64 only."
+#endif
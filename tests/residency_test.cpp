@@ -0,0 +1,274 @@
+//
+//  residency_test.cpp
+//  Metal-Guide
+//
+//  ResidencyPolicy driven by a fake device that purges volatile memory under pressure, and TileResidency's region math
+//  and batching.
+//
+
+#include "residency_policy.hpp"
+#include "tile_residency.hpp"
+
+#include "test.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+// Resources with a purgeable state, like MTL::Resource. Volatile memory still counts as allocated until the system
+// purges it; a purged resource reports its contents lost when made non-volatile again.
+class FakeDevice {
+public:
+    std::uint32_t newResource(std::uint64_t size) {
+        resources.push_back(Resource { size, false, false });
+        return static_cast<std::uint32_t>(resources.size() - 1);
+    }
+
+    void makeVolatile(std::uint32_t resource) { resources[resource].isVolatile = true; }
+
+    // Returns whether the contents were lost, as setPurgeableState(NonVolatile) returning PurgeableStateEmpty does.
+    bool makeNonVolatile(std::uint32_t resource) {
+        Resource& entry = resources[resource];
+        bool lost = entry.purged;
+        entry.isVolatile = false;
+        entry.purged = false;
+        return lost;
+    }
+
+    // Memory pressure: the system takes every volatile resource.
+    void purge() {
+        for (Resource& resource : resources) {
+            if (resource.isVolatile) {
+                resource.purged = true;
+            }
+        }
+    }
+
+    std::uint64_t allocatedSize() const {
+        std::uint64_t bytes = 0;
+        for (const Resource& resource : resources) {
+            bytes += resource.purged ? 0 : resource.size;
+        }
+        return bytes;
+    }
+
+    bool isVolatile(std::uint32_t resource) const { return resources[resource].isVolatile; }
+
+private:
+    struct Resource {
+        std::uint64_t size;
+        bool isVolatile;
+        bool purged;
+    };
+
+    std::vector<Resource> resources;
+};
+
+constexpr std::uint64_t megabyte = 1 << 20;
+
+// One frame of a caller using the policy: restore and use what the frame needs, then evict down to the budget.
+void runFrame(ResidencyPolicy& policy, FakeDevice& device, const std::vector<std::uint32_t>& used, std::uint64_t budget) {
+    policy.beginFrame();
+    for (std::uint32_t handle : used) {
+        if (policy.use(handle)) {
+            policy.restored(handle, device.makeNonVolatile(handle));
+        }
+    }
+    for (std::uint32_t handle : policy.evict(device.allocatedSize(), budget)) {
+        device.makeVolatile(handle);
+    }
+}
+
+TileResidency makeTiles(std::uint64_t budgetTiles) {
+    // 1024x1024 with 256x256 tiles: 4x4 tiles at mip 0, 2x2 at mip 1, and mips from 2 on in the tail.
+    SparseTextureLayout layout = { 1024, 1024, 1, 11, 2, 2, TileBox { 0, 0, 0, 256, 256, 1 } };
+    return TileResidency(layout, budgetTiles);
+}
+
+bool sameBox(const TileBox& a, const TileBox& b) {
+    return a.x == b.x && a.y == b.y && a.z == b.z && a.width == b.width && a.height == b.height && a.depth == b.depth;
+}
+
+}
+
+TEST_CASE("residency: the coldest unprotected resources are evicted until the rest fit") {
+    FakeDevice device;
+    ResidencyPolicy policy(2);
+    for (int i = 0; i < 4; i++) {
+        policy.add(64 * megabyte, 64);
+        device.newResource(64 * megabyte);
+    }
+
+    // Resources 2 and 3 stay hot; 0 and 1 fall out of the protection window.
+    for (int frame = 0; frame < 3; frame++) {
+        runFrame(policy, device, { 2, 3 }, 1024 * megabyte);
+    }
+    CHECK(policy.stats().evictions == 0);
+
+    runFrame(policy, device, { 2, 3 }, 150 * megabyte);
+    CHECK(device.isVolatile(0));
+    CHECK(device.isVolatile(1));
+    CHECK(!device.isVolatile(2) && !device.isVolatile(3));
+    CHECK(policy.stats().evictedBytes == 128 * megabyte);
+    CHECK(policy.stats().volatileBytes == 128 * megabyte);
+}
+
+TEST_CASE("residency: resources used within the protected frames are never evicted") {
+    FakeDevice device;
+    ResidencyPolicy policy(3);
+    for (int i = 0; i < 3; i++) {
+        policy.add(64 * megabyte, 64);
+        device.newResource(64 * megabyte);
+    }
+    runFrame(policy, device, { 0, 1, 2 }, 0);
+    runFrame(policy, device, {}, 0);
+    CHECK(policy.stats().evictions == 0);
+
+    runFrame(policy, device, {}, 0);
+    runFrame(policy, device, {}, 0);
+    CHECK(policy.stats().evictions == 3);
+}
+
+TEST_CASE("residency: purged resources are reloaded and counted, surviving ones are not") {
+    FakeDevice device;
+    ResidencyPolicy policy(1);
+    for (int i = 0; i < 3; i++) {
+        policy.add(100 * megabyte, 100);
+        device.newResource(100 * megabyte);
+    }
+    runFrame(policy, device, { 0, 1, 2 }, 1024 * megabyte);
+    runFrame(policy, device, { 2 }, 100 * megabyte);
+    CHECK(policy.isVolatile(0) && policy.isVolatile(1));
+
+    // Pressure takes both; the volatile bytes no longer count as allocated.
+    device.purge();
+    CHECK(device.allocatedSize() == 100 * megabyte);
+
+    runFrame(policy, device, { 0, 2 }, 1024 * megabyte);
+    CHECK(!policy.isVolatile(0));
+    CHECK(policy.stats().restores == 1);
+    CHECK(policy.stats().reloads == 1);
+    CHECK(policy.stats().reloadCost == 100);
+
+    // Evict 0 again, but make it resident before any pressure: its contents survive.
+    runFrame(policy, device, { 2 }, 0);
+    runFrame(policy, device, { 0, 2 }, 1024 * megabyte);
+    CHECK(policy.stats().restores == 2);
+    CHECK(policy.stats().reloads == 1);
+}
+
+TEST_CASE("residency: volatile bytes don't count against the budget") {
+    FakeDevice device;
+    ResidencyPolicy policy(1);
+    for (int i = 0; i < 3; i++) {
+        policy.add(100 * megabyte, 1);
+        device.newResource(100 * megabyte);
+    }
+    runFrame(policy, device, { 0, 1, 2 }, 1024 * megabyte);
+    runFrame(policy, device, { 1, 2 }, 200 * megabyte);
+    CHECK(policy.stats().evictions == 1);
+
+    // 300 MB allocated, 100 MB of it volatile: within a 200 MB budget, so nothing more goes.
+    runFrame(policy, device, { 1, 2 }, 200 * megabyte);
+    CHECK(policy.stats().evictions == 1);
+}
+
+TEST_CASE("residency: removed handles are reused and leave the accounting") {
+    FakeDevice device;
+    ResidencyPolicy policy(1);
+    ResidencyPolicy::Handle a = policy.add(10, 1);
+    ResidencyPolicy::Handle b = policy.add(20, 1);
+    policy.beginFrame();
+    policy.beginFrame();
+    CHECK(policy.evict(30, 20).size() == 1);
+    CHECK(policy.isVolatile(a));
+    policy.remove(a);
+    CHECK(policy.stats().volatileBytes == 0);
+    CHECK(policy.add(5, 1) == a);
+    policy.remove(b);
+}
+
+TEST_CASE("tiles: pixel boxes round outward or inward to tiles") {
+    TileResidency tiles = makeTiles(64);
+    CHECK(sameBox(tiles.tileCount(0), TileBox { 0, 0, 0, 4, 4, 1 }));
+    CHECK(sameBox(tiles.tileCount(1), TileBox { 0, 0, 0, 2, 2, 1 }));
+
+    TileBox pixels = { 100, 300, 0, 300, 300, 1 };
+    CHECK(sameBox(tiles.pixelsToTiles(pixels, 0), TileBox { 0, 1, 0, 2, 2, 1 }));
+    CHECK(sameBox(tiles.pixelsToTiles(pixels, 0, false), TileBox { 1, 2, 0, 0, 0, 1 }));
+    CHECK(sameBox(tiles.pixelsToTiles(TileBox { 0, 0, 0, 512, 600, 1 }, 0, false), TileBox { 0, 0, 0, 2, 2, 1 }));
+
+    // Boxes past the edge are clamped to the mip.
+    CHECK(sameBox(tiles.pixelsToTiles(TileBox { 400, 400, 0, 4000, 4000, 1 }, 1), TileBox { 1, 1, 0, 1, 1, 1 }));
+    CHECK(sameBox(tiles.tilesToPixels(TileBox { 1, 1, 0, 3, 3, 1 }, 1), TileBox { 256, 256, 0, 256, 256, 1 }));
+}
+
+TEST_CASE("tiles: mips in the tail map one shared tile per slice") {
+    TileResidency tiles = makeTiles(64);
+    tiles.request(TileBox { 0, 0, 0, 8, 8, 1 }, 5, 1);
+    tiles.request(TileBox { 0, 0, 0, 64, 64, 1 }, 3, 1);
+    TileUpdates updates = tiles.update();
+    CHECK(updates.map.tiles == 1);
+    REQUIRE(updates.map.regions.size() == 1);
+    CHECK(updates.map.mipLevels[0] == 2 && updates.map.slices[0] == 1);
+    CHECK(tiles.isMapped(0, 0, 0, 9, 1));
+    CHECK(!tiles.isMapped(0, 0, 0, 9, 0));
+}
+
+TEST_CASE("tiles: requests coalesce into as few boxes as possible") {
+    TileResidency tiles = makeTiles(64);
+    // The whole of mip 0 is one 4x4 box.
+    tiles.request(TileBox { 0, 0, 0, 1024, 1024, 1 }, 0, 0);
+    TileUpdates updates = tiles.update();
+    CHECK(updates.map.tiles == 16);
+    REQUIRE(updates.map.regions.size() == 1);
+    CHECK(sameBox(updates.map.regions[0], TileBox { 0, 0, 0, 4, 4, 1 }));
+
+    // An L shape needs two: the 3-wide top row, and the 1-wide column below it.
+    TileResidency shape = makeTiles(64);
+    shape.request(TileBox { 0, 0, 0, 768, 256, 1 }, 0, 0);
+    shape.request(TileBox { 0, 256, 0, 256, 512, 1 }, 0, 0);
+    updates = shape.update();
+    CHECK(updates.map.tiles == 5);
+    CHECK(updates.map.regions.size() == 2);
+
+    // Different mips and slices never share a box.
+    TileResidency split = makeTiles(64);
+    split.request(TileBox { 0, 0, 0, 256, 256, 1 }, 0, 0);
+    split.request(TileBox { 0, 0, 0, 256, 256, 1 }, 0, 1);
+    split.request(TileBox { 0, 0, 0, 256, 256, 1 }, 1, 0);
+    CHECK(split.update().map.regions.size() == 3);
+}
+
+TEST_CASE("tiles: the least recently requested tiles are unmapped to make room") {
+    TileResidency tiles = makeTiles(4);
+    tiles.request(TileBox { 0, 0, 0, 512, 512, 1 }, 0, 0);
+    CHECK(tiles.update().map.tiles == 4);
+
+    // Keep (0, 0) warm, then ask for two new tiles: the two colder ones go.
+    tiles.request(TileBox { 0, 0, 0, 256, 256, 1 }, 0, 0);
+    tiles.update();
+    tiles.request(TileBox { 512, 0, 0, 512, 256, 1 }, 0, 0);
+    TileUpdates updates = tiles.update();
+    CHECK(updates.unmap.tiles == 2);
+    CHECK(updates.map.tiles == 2);
+    CHECK(tiles.isMapped(0, 0, 0, 0, 0));
+    CHECK(tiles.isMapped(2, 0, 0, 0, 0) && tiles.isMapped(3, 0, 0, 0, 0));
+    CHECK(tiles.stats().mappedTiles == 4);
+}
+
+TEST_CASE("tiles: requests over budget in one frame are deferred") {
+    TileResidency tiles = makeTiles(4);
+    tiles.request(TileBox { 0, 0, 0, 1024, 512, 1 }, 0, 0);
+    TileUpdates updates = tiles.update();
+    CHECK(updates.map.tiles == 4);
+    CHECK(updates.unmap.tiles == 0);
+    CHECK(tiles.stats().tilesDeferred == 4);
+
+    // Tiles requested in the same frame don't evict each other either.
+    tiles.request(TileBox { 0, 0, 0, 1024, 1024, 1 }, 0, 0);
+    updates = tiles.update();
+    CHECK(updates.unmap.tiles == 0);
+    CHECK(tiles.stats().mappedTiles == 4);
+}
@@ -0,0 +1,118 @@
+//
+//  stub_encoder.hpp
+//  Metal-Guide
+//
+//  Stand-ins for the Metal encoders with the method names the command replay calls. They only count the calls and,
+//  when asked, log their names, so replay can be tested and timed off-device.
+//
+
+#pragma once
+
+#include "command_list.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+class StubEncoder {
+public:
+    std::uint64_t calls = 0;
+    bool logging = false;
+    std::vector<const char*> log;
+
+    template <typename... Arguments> void pushDebugGroup(Arguments...) { call("pushDebugGroup"); }
+    template <typename... Arguments> void popDebugGroup(Arguments...) { call("popDebugGroup"); }
+    template <typename... Arguments> void insertDebugSignpost(Arguments...) { call("insertDebugSignpost"); }
+    template <typename... Arguments> void updateFence(Arguments...) { call("updateFence"); }
+    template <typename... Arguments> void waitForFence(Arguments...) { call("waitForFence"); }
+
+protected:
+    void call(const char* name) {
+        calls++;
+        if (logging) {
+            log.push_back(name);
+        }
+    }
+};
+
+class StubRenderEncoder : public StubEncoder {
+public:
+    CommandViewport viewport {};
+    std::vector<std::uint8_t> vertexBytes;
+    NS::UInteger vertexCount = 0;
+
+    template <typename... Arguments> void useResource(Arguments...) { call("useResource"); }
+    template <typename... Arguments> void useHeap(Arguments...) { call("useHeap"); }
+    template <typename... Arguments> void memoryBarrier(Arguments...) { call("memoryBarrier"); }
+    template <typename... Arguments> void setVertexBuffer(Arguments...) { call("setVertexBuffer"); }
+    template <typename... Arguments> void setVertexBufferOffset(Arguments...) { call("setVertexBufferOffset"); }
+    template <typename... Arguments> void setVertexTexture(Arguments...) { call("setVertexTexture"); }
+    template <typename... Arguments> void setVertexSamplerState(Arguments...) { call("setVertexSamplerState"); }
+    template <typename... Arguments> void setFragmentBuffer(Arguments...) { call("setFragmentBuffer"); }
+    template <typename... Arguments> void setFragmentBufferOffset(Arguments...) { call("setFragmentBufferOffset"); }
+    template <typename... Arguments> void setFragmentBytes(Arguments...) { call("setFragmentBytes"); }
+    template <typename... Arguments> void setFragmentTexture(Arguments...) { call("setFragmentTexture"); }
+    template <typename... Arguments> void setFragmentSamplerState(Arguments...) { call("setFragmentSamplerState"); }
+    template <typename... Arguments> void setRenderPipelineState(Arguments...) { call("setRenderPipelineState"); }
+    template <typename... Arguments> void setDepthStencilState(Arguments...) { call("setDepthStencilState"); }
+    template <typename... Arguments> void setCullMode(Arguments...) { call("setCullMode"); }
+    template <typename... Arguments> void setFrontFacingWinding(Arguments...) { call("setFrontFacingWinding"); }
+    template <typename... Arguments> void setTriangleFillMode(Arguments...) { call("setTriangleFillMode"); }
+    template <typename... Arguments> void setDepthClipMode(Arguments...) { call("setDepthClipMode"); }
+    template <typename... Arguments> void setScissorRect(Arguments...) { call("setScissorRect"); }
+    template <typename... Arguments> void setDepthBias(Arguments...) { call("setDepthBias"); }
+    template <typename... Arguments> void setStencilReferenceValues(Arguments...) { call("setStencilReferenceValues"); }
+    template <typename... Arguments> void setBlendColor(Arguments...) { call("setBlendColor"); }
+    template <typename... Arguments> void setVisibilityResultMode(Arguments...) { call("setVisibilityResultMode"); }
+    template <typename... Arguments> void drawIndexedPrimitives(Arguments...) { call("drawIndexedPrimitives"); }
+
+    void setViewport(CommandViewport value) {
+        call("setViewport");
+        viewport = value;
+    }
+
+    void setVertexBytes(const void* bytes, NS::UInteger length, NS::UInteger) {
+        call("setVertexBytes");
+        vertexBytes.resize(length);
+        std::memcpy(vertexBytes.data(), bytes, length);
+    }
+
+    void drawPrimitives(MTL::PrimitiveType, NS::UInteger, NS::UInteger count, NS::UInteger, NS::UInteger) {
+        call("drawPrimitives");
+        vertexCount += count;
+    }
+
+    void drawPrimitives(MTL::PrimitiveType, const MTL::Buffer*, NS::UInteger) { call("drawPrimitivesIndirect"); }
+};
+
+class StubComputeEncoder : public StubEncoder {
+public:
+    CommandSize threadsPerThreadgroup {};
+
+    template <typename... Arguments> void useResource(Arguments...) { call("useResource"); }
+    template <typename... Arguments> void useHeap(Arguments...) { call("useHeap"); }
+    template <typename... Arguments> void memoryBarrier(Arguments...) { call("memoryBarrier"); }
+    template <typename... Arguments> void setBuffer(Arguments...) { call("setBuffer"); }
+    template <typename... Arguments> void setBufferOffset(Arguments...) { call("setBufferOffset"); }
+    template <typename... Arguments> void setBytes(Arguments...) { call("setBytes"); }
+    template <typename... Arguments> void setTexture(Arguments...) { call("setTexture"); }
+    template <typename... Arguments> void setSamplerState(Arguments...) { call("setSamplerState"); }
+    template <typename... Arguments> void setThreadgroupMemoryLength(Arguments...) { call("setThreadgroupMemoryLength"); }
+    template <typename... Arguments> void setComputePipelineState(Arguments...) { call("setComputePipelineState"); }
+    template <typename... Arguments> void dispatchThreadgroups(Arguments...) { call("dispatchThreadgroups"); }
+
+    void dispatchThreads(CommandSize, CommandSize threadgroup) {
+        call("dispatchThreads");
+        threadsPerThreadgroup = threadgroup;
+    }
+};
+
+class StubBlitEncoder : public StubEncoder {
+public:
+    template <typename... Arguments> void copyFromBuffer(Arguments...) { call("copyFromBuffer"); }
+    template <typename... Arguments> void copyFromTexture(Arguments...) { call("copyFromTexture"); }
+    template <typename... Arguments> void fillBuffer(Arguments...) { call("fillBuffer"); }
+    template <typename... Arguments> void generateMipmaps(Arguments...) { call("generateMipmaps"); }
+    template <typename... Arguments> void synchronizeResource(Arguments...) { call("synchronizeResource"); }
+    template <typename... Arguments> void optimizeContentsForGPUAccess(Arguments...) { call("optimizeContentsForGPUAccess"); }
+};
@@ -0,0 +1,61 @@
+//
+//  test.hpp
+//  Metal-Guide
+//
+//  Minimal test registration for the Linux build. A TEST_CASE body runs once; a failing CHECK reports the expression and
+//  keeps going, a failing REQUIRE stops the test case.
+//
+
+#pragma once
+
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+namespace test {
+
+struct Case {
+    const char* name;
+    std::function<void()> body;
+};
+
+inline std::vector<Case>& registry() {
+    static std::vector<Case> cases;
+    return cases;
+}
+
+inline int& failures() {
+    static int count = 0;
+    return count;
+}
+
+struct Registration {
+    Registration(const char* name, std::function<void()> body) { registry().push_back({ name, std::move(body) }); }
+};
+
+struct RequireFailed {};
+
+inline bool check(bool passed, const char* expression, const char* file, int line) {
+    if (!passed) {
+        std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", file, line, expression);
+        failures()++;
+    }
+    return passed;
+}
+
+}
+
+#define TEST_CONCAT_(a, b) a##b
+#define TEST_CONCAT(a, b) TEST_CONCAT_(a, b)
+#define TEST_CASE(name)                                                                                                \
+    static void TEST_CONCAT(testBody, __LINE__)();                                                                     \
+    static test::Registration TEST_CONCAT(testRegistration, __LINE__)(name, TEST_CONCAT(testBody, __LINE__));          \
+    static void TEST_CONCAT(testBody, __LINE__)()
+
+#define CHECK(expression) test::check(static_cast<bool>(expression), #expression, __FILE__, __LINE__)
+#define REQUIRE(expression)                                                                                            \
+    do {                                                                                                               \
+        if (!CHECK(expression)) {                                                                                      \
+            throw test::RequireFailed {};                                                                              \
+        }                                                                                                              \
+    } while (false)
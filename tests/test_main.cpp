@@ -0,0 +1,20 @@
+//
+//  test_main.cpp
+//  Metal-Guide
+//
+
+#include "test.hpp"
+
+#include <cstdio>
+
+int main() {
+    for (const test::Case& testCase : test::registry()) {
+        int failuresBefore = test::failures();
+        try {
+            testCase.body();
+        } catch (const test::RequireFailed&) {
+        }
+        std::printf("%s %s\n", test::failures() == failuresBefore ? "PASS" : "FAIL", testCase.name);
+    }
+    return test::failures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,103 @@
+//
+//  tlsf_allocator_test.cpp
+//  Metal-Guide
+//
+
+#include "tlsf_allocator.hpp"
+
+#include "test.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+bool overlaps(const TlsfAllocation& a, const TlsfAllocation& b) {
+    return a.offset < b.offset + b.size && b.offset < a.offset + a.size;
+}
+
+// Live allocations must lie inside the range, be aligned and granular, and never overlap.
+bool consistent(const TlsfAllocator& allocator, std::vector<TlsfAllocation> live) {
+    std::sort(live.begin(), live.end(), [](const TlsfAllocation& a, const TlsfAllocation& b) { return a.offset < b.offset; });
+    std::uint64_t used = 0;
+    for (std::size_t i = 0; i < live.size(); i++) {
+        if (live[i].offset + live[i].size > allocator.capacity() || live[i].offset % 256 != 0 || live[i].size % 256 != 0) {
+            return false;
+        }
+        if (i > 0 && overlaps(live[i - 1], live[i])) {
+            return false;
+        }
+        used += live[i].size;
+    }
+    TlsfStats stats = allocator.stats();
+    return stats.usedBytes == used && stats.allocations == live.size() && stats.freeBytes == allocator.capacity() - used;
+}
+
+}
+
+TEST_CASE("allocations are aligned and rounded to the granularity") {
+    TlsfAllocator allocator(1 << 20);
+    TlsfAllocation a = allocator.allocate(100, 256);
+    TlsfAllocation b = allocator.allocate(1000, 4096);
+    REQUIRE(a && b);
+    CHECK(a.size == 256);
+    CHECK(b.offset % 4096 == 0 && b.size == 1024);
+    CHECK(!overlaps(a, b));
+    allocator.free(a);
+    allocator.free(b);
+    CHECK(allocator.empty());
+    CHECK(allocator.stats().freeBlocks == 1);
+}
+
+TEST_CASE("a full allocator fails without corrupting itself") {
+    TlsfAllocator allocator(64 * 1024);
+    std::vector<TlsfAllocation> live;
+    while (TlsfAllocation allocation = allocator.allocate(4096, 256)) {
+        live.push_back(allocation);
+    }
+    CHECK(live.size() == 16);
+    CHECK(!allocator.allocate(256, 256));
+    CHECK(consistent(allocator, live));
+    allocator.free(live[3]);
+    TlsfAllocation reused = allocator.allocate(4096, 256);
+    CHECK(reused && reused.offset == live[3].offset);
+}
+
+TEST_CASE("random allocate and free keeps every invariant and merges back to one block") {
+    std::mt19937_64 random(12345);
+    TlsfAllocator allocator(64 << 20);
+    std::vector<TlsfAllocation> live;
+
+    for (int step = 0; step < 50000; step++) {
+        bool allocate = live.empty() || random() % 100 < 55;
+        if (allocate) {
+            // Mostly small, sometimes large, with the alignments Metal reports for buffers and textures.
+            std::uint64_t size = random() % 8 == 0 ? 256 * 1024 + random() % (4 << 20) : 16 + random() % 65536;
+            std::uint64_t alignment = std::uint64_t(256) << (random() % 7);
+            if (TlsfAllocation allocation = allocator.allocate(size, alignment)) {
+                CHECK(allocation.size >= size && allocation.offset % alignment == 0);
+                live.push_back(allocation);
+            }
+        } else {
+            std::size_t index = random() % live.size();
+            allocator.free(live[index]);
+            live[index] = live.back();
+            live.pop_back();
+        }
+        if (step % 1000 == 0) {
+            REQUIRE(consistent(allocator, live));
+        }
+    }
+    REQUIRE(consistent(allocator, live));
+
+    for (const TlsfAllocation& allocation : live) {
+        allocator.free(allocation);
+    }
+    TlsfStats stats = allocator.stats();
+    CHECK(allocator.empty());
+    CHECK(stats.freeBlocks == 1);
+    CHECK(stats.largestFreeBlock == allocator.capacity());
+    CHECK(stats.fragmentation() == 0.0);
+}